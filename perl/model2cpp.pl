@@ -1,9 +1,27 @@
 #!/usr/bin/env perl -w
 
-die "Usage: $0 <model>" unless @ARGV == 1;
-my ($model) = @ARGV;
+# Optional second argument is an eigensystem cache file for the model,
+# as written by "historian ... -model model/<model>.json -eigencache <dir>" (see Makefile.models).
+# If supplied, the eigensystem is compiled in, so the preset need not be diagonalized at startup.
+
+die "Usage: $0 <model> [<eigencache file>]" unless @ARGV == 1 || @ARGV == 2;
+my ($model, $eigenFile) = @ARGV;
 my $ucmodel = uc($model);
 
+my ($eigenHash, @eigen);
+if (defined $eigenFile) {
+    open EIGEN, "<$eigenFile" or die "$eigenFile: $!";
+    binmode EIGEN;
+    local $/;
+    my ($magic, $hash, $size, @data) = unpack ("a8 Q Q d*", <EIGEN>);
+    close EIGEN;
+    die "$eigenFile: not an eigensystem cache file" unless $magic eq "HISTEIGN";
+    die "$eigenFile: expected $size values, found ", scalar(@data) unless @data == $size;
+    $eigenHash = sprintf ("0x%016xULL", $hash);
+    @eigen = map (sprintf ("%.17g", $_), @data);
+    s/^(-?\d+)$/$1.0/ foreach @eigen;  # keep the sign of negative zero
+}
+
 open HDR, ">src/${model}.h";
 print HDR map ("$_\n",
 	       "#ifndef ${ucmodel}_MODEL_INCLUDED",
@@ -14,6 +32,11 @@ print HDR map ("$_\n",
 	       "RateModel ${model}Model();",
 	       "",
 	       "extern const char* ${model}ModelText;",
+	       (@eigen
+		? ("extern const EigenSystemHash ${model}ModelEigenHash;",
+		   "extern const double ${model}ModelEigen[];",
+		   "extern const size_t ${model}ModelEigenSize;")
+		: ()),
 	       "",
 	       "#endif /* ${ucmodel}_MODEL_INCLUDED */");
 close HDR;
@@ -27,6 +50,9 @@ print CPP map ("$_\n",
 	       "  RateModel m;",
 	       "  ParsedJson pj (${model}ModelText);",
 	       "  m.read (pj.value);",
+	       (@eigen
+		? ("  EigenModel::addPrecomputedEigenSystem (m, ${model}ModelEigenHash, ${model}ModelEigen, ${model}ModelEigenSize);")
+		: ()),
 	       "  return m;",
 	       "}",
 	       "",
@@ -41,4 +67,16 @@ while (<JSON>) {
 }
 print CPP ";\n";
 
+if (@eigen) {
+    print CPP "\n";
+    print CPP "const EigenSystemHash ${model}ModelEigenHash = $eigenHash;\n";
+    print CPP "const size_t ${model}ModelEigenSize = ", scalar(@eigen), ";\n";
+    print CPP "const double ${model}ModelEigen[] = {\n";
+    while (@eigen) {
+	my @line = splice (@eigen, 0, 4);
+	print CPP "  ", join (", ", @line), (@eigen ? "," : ""), "\n";
+    }
+    print CPP "};\n";
+}
+
 close CPP;
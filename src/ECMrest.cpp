@@ -5,6 +5,7 @@ RateModel ECMrestModel() {
   RateModel m;
   ParsedJson pj (ECMrestModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, ECMrestModelEigenHash, ECMrestModelEigen, ECMrestModelEigenSize);
   return m;
 }
 
@@ -731,3 +732,3760 @@ const char* ECMrestModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash ECMrestModelEigenHash = 0x29beac1e31f93f95ULL;
+const size_t ECMrestModelEigenSize = 15006;
+const double ECMrestModelEigen[] = {
+  -4.1102273697444769, 0.0, -3.174362260063083, 0.0,
+  -2.9416359965424572, 0.0, -2.7560022113399274, 0.0,
+  -2.648639511467255, 0.0, -2.5813217674724802, 0.0,
+  -2.031054934335137, 0.0, -1.9952275898558136, 0.0,
+  -1.8990294993124426, 0.0, -1.8468344036043685, 0.0,
+  -1.8193746035622607, 0.0, -7.8929002984550045e-16, 0.0,
+  -1.6323543211665665, 0.0, -1.6039842410173661, 0.0,
+  -1.4877903559985393, 0.0, -0.11053116966241272, 0.0,
+  -1.4417648544049368, 0.0, -0.16175566264746902, 0.0,
+  -0.17763235560137713, 0.0, -0.17272767789737564, 0.0,
+  -0.19280499882464872, 0.0, -0.22162654405551904, 0.0,
+  -0.2486089943667692, 0.0, -0.29267535123861538, 0.0,
+  -1.3858568890597671, 0.0, -1.3743154968957521, 0.0,
+  -0.33410908875030443, 0.0, -0.35805009792764508, 0.0,
+  -0.39303931806771408, 0.0, -0.41096257144414272, 0.0,
+  -0.45003886137567573, 0.0, -0.48372463758233414, 0.0,
+  -1.2905918622627597, 0.0, -1.2726564692572526, 0.0,
+  -1.2353474332179164, 0.0, -0.52281237143467629, 0.0,
+  -0.55342403739844204, 0.0, -1.2019188247688943, 0.0,
+  -1.180980619813679, 0.0, -1.1638363178254854, 0.0,
+  -1.1385707861901213, 0.0, -1.1248408878887968, 0.0,
+  -1.0928909905318156, 0.0, -1.0542331258953679, 0.0,
+  -1.0193623702177221, 0.0, -1.0065044311035294, 0.0,
+  -0.96963878118074476, 0.0, -0.93891159406674907, 0.0,
+  -0.91582423476401886, 0.0, -0.89277673517193712, 0.0,
+  -0.59920532471171906, 0.0, -0.61406428442583738, 0.0,
+  -0.84259881162362404, 0.0, -0.65908029135547719, 0.0,
+  -0.67474388289686138, 0.0, -0.69811729362551078, 0.0,
+  -0.72849576562943275, 0.0, -0.81190907952844815, 0.0,
+  -0.787562056121482, 0.0, -0.77117435014683, 0.0,
+  -0.7544099357106705, 0.0, 3.040632299007005e-05, 0.0,
+  0.0021115591435639947, 0.0, 0.0015849462125845292, 0.0,
+  -0.0002817138261188978, 0.0, -0.0034332601673153869, 0.0,
+  0.0021888909886179355, 0.0, 0.018420540477030432, 0.0,
+  0.028127559996166819, 0.0, 0.0052430082022271894, 0.0,
+  -0.0046853724811928435, 0.0, -0.0066660937221437611, 0.0,
+  0.12803687993289622, 0.0, 0.01248381110060587, 0.0,
+  -0.013187226072782464, 0.0, -0.023785122727991513, 0.0,
+  0.22765253423376322, 0.0, 0.018348185402157473, 0.0,
+  -0.067135026020144428, 0.0, -0.18869576799924409, 0.0,
+  0.014123250650271559, 0.0, 0.0034680941108863111, 0.0,
+  0.067880049904060116, 0.0, 0.014508333927466583, 0.0,
+  -0.056665869006621836, 0.0, -0.020014478165931642, 0.0,
+  0.0051197464542307326, 0.0, -0.12087024019984104, 0.0,
+  0.12186279210977516, 0.0, -0.31140992149184871, 0.0,
+  -0.12034460972693957, 0.0, -0.1620859309590757, 0.0,
+  -0.094954598940952498, 0.0, -0.058769875577328448, 0.0,
+  -0.022845103051950016, 0.0, 0.037618801015654617, 0.0,
+  -0.052365672219275815, 0.0, -0.075398647943072314, 0.0,
+  -0.024751082418293442, 0.0, -0.0069942217946348632, 0.0,
+  -0.022282737524454716, 0.0, 0.021849983287136981, 0.0,
+  0.006016652899289078, 0.0, -0.024946418898685638, 0.0,
+  -0.041971217103265172, 0.0, 0.048448894248951109, 0.0,
+  0.068726793308707845, 0.0, 0.33723643958284771, 0.0,
+  -0.015192584368607572, 0.0, 0.17932590622345917, 0.0,
+  0.02428338080033262, 0.0, -0.13635165063545782, 0.0,
+  0.025902983990479883, 0.0, -0.07175312672591784, 0.0,
+  -0.15023972792780124, 0.0, 0.054724597370150251, 0.0,
+  0.038341779849039449, 0.0, -0.38287295932837523, 0.0,
+  -0.10116849072118014, 0.0, -0.13377037053119406, 0.0,
+  0.11213750463917513, 0.0, -0.0035932342354100828, 0.0,
+  5.4151771283965423e-05, 0.0, -0.0022864896817252492, 0.0,
+  0.00077641623023177542, 0.0, -0.0001465501728080716, 0.0,
+  0.00067086345986859725, 0.0, 0.0072648953208612199, 0.0,
+  0.018363527641292003, 0.0, 0.026192332550942068, 0.0,
+  0.0044729718029591749, 0.0, 0.0067792485276796819, 0.0,
+  -0.0013622272977383222, 0.0, 0.12803687993289661, 0.0,
+  0.0046362421184459142, 0.0, -0.017319787911700947, 0.0,
+  0.023555854554355774, 0.0, 0.23562000643454459, 0.0,
+  -0.0012175825503872176, 0.0, -0.070215493503069923, 0.0,
+  -0.20276955948554987, 0.0, 0.017588633870873466, 0.0,
+  0.0048662972019522218, 0.0, 0.081046243622098918, 0.0,
+  0.019142921097534894, 0.0, -0.064942537882626647, 0.0,
+  0.0066467102941801135, 0.0, -0.0046419017022814235, 0.0,
+  -0.15117638111362269, 0.0, 0.16224092872125664, 0.0,
+  -0.36738311040469018, 0.0, -0.1820523652436149, 0.0,
+  -0.21557858283821157, 0.0, -0.20405746077919798, 0.0,
+  0.0095848853729294057, 0.0, 0.0099992535152013465, 0.0,
+  -0.010098708630694807, 0.0, -0.02289734977204275, 0.0,
+  0.0252579703431344, 0.0, 0.018723682425548546, 0.0,
+  0.016808661932404399, 0.0, 0.02916421612670627, 0.0,
+  -0.017749279839983458, 0.0, 0.0035095437873993015, 0.0,
+  0.015737949180158594, 0.0, 0.050936797700113438, 0.0,
+  -0.065360855962136241, 0.0, -0.030714017080595773, 0.0,
+  -0.28052606958120824, 0.0, 0.0050161338546578236, 0.0,
+  -0.15416795429395083, 0.0, -0.015775267271590645, 0.0,
+  0.12704856612748314, 0.0, -0.0082574365949607022, 0.0,
+  0.04717434230533972, 0.0, 0.13332797760946052, 0.0,
+  -0.048597455497893044, 0.0, -0.035688124239597677, 0.0,
+  0.33217271680873456, 0.0, 0.078411699825104292, 0.0,
+  0.1231705158212764, 0.0, -0.10411714910577964, 0.0,
+  -0.015441311494523038, 0.0, 0.00013780428339265084, 0.0,
+  -0.28527761783128214, 0.0, -0.0025208868233769798, 0.0,
+  -0.008594938904750991, 0.0, 0.0032547491267694169, 0.0,
+  0.0069622980450186854, 0.0, 0.091204242044989448, 0.0,
+  0.15142358406371875, 0.0, 0.029070678134880148, 0.0,
+  -0.018541596843449363, 0.0, 0.02009666024950231, 0.0,
+  0.12803687993289653, 0.0, 0.028370536061019632, 0.0,
+  -0.16307770149448797, 0.0, -0.18282226036588731, 0.0,
+  0.20101284304794856, 0.0, 0.10839167948673932, 0.0,
+  -0.0032685543493306594, 0.0, 0.070353198429892308, 0.0,
+  -0.035861735025075822, 0.0, -0.034831620609907001, 0.0,
+  -0.0061642810707603878, 0.0, 0.054872676108932629, 0.0,
+  -0.12217361935348585, 0.0, 0.010016101555259345, 0.0,
+  -0.0038260197116210715, 0.0, 0.091018987716951216, 0.0,
+  0.19695259979460034, 0.0, 0.095014709076699164, 0.0,
+  0.025868659878072645, 0.0, -0.032787703480873551, 0.0,
+  0.24197979563173055, 0.0, 0.11842725165319942, 0.0,
+  0.046633463614968403, 0.0, -0.055258238277784102, 0.0,
+  -0.0042843394571452659, 0.0, -0.11766074246190453, 0.0,
+  0.026883593950997584, 0.0, 0.0094339391859916133, 0.0,
+  -0.029681073092970325, 0.0, -0.01163543242213534, 0.0,
+  -0.043037365475805084, 0.0, 0.040739787442340691, 0.0,
+  -0.031162909709411515, 0.0, 0.13092421533061624, 0.0,
+  -0.1323945728007116, 0.0, 0.057680902161345041, 0.0,
+  0.081539772588373693, 0.0, -0.069871939938620092, 0.0,
+  0.23933004131071214, 0.0, -0.18919445080549932, 0.0,
+  0.014681099261652878, 0.0, 0.38702350179399347, 0.0,
+  -0.29915805509454091, 0.0, 0.13315563039632217, 0.0,
+  -0.0074279830053102383, 0.0, 0.23918063828562008, 0.0,
+  0.04280965268361947, 0.0, -0.18773483672868738, 0.0,
+  0.030767538342842422, 0.0, -0.020436006280006611, 0.0,
+  -0.00091812599071775945, 0.0, 0.079872274322434073, 0.0,
+  -0.0099978204816402096, 0.0, 0.0045611109858557887, 0.0,
+  0.0010438973221767118, 0.0, -0.068103709060104323, 0.0,
+  -0.35239921329366347, 0.0, -0.54663515687480235, 0.0,
+  -0.11533596272635667, 0.0, -0.049426994723261924, 0.0,
+  0.027363420927383902, 0.0, 0.12803687993289634, 0.0,
+  -0.086301375977831676, 0.0, 0.24452205331827792, 0.0,
+  0.22768304242994097, 0.0, 0.20125048566015113, 0.0,
+  -0.16805828905596229, 0.0, 0.030154031411342517, 0.0,
+  0.03488336071929974, 0.0, -0.016784070837438578, 0.0,
+  -0.02853553880008242, 0.0, 0.0055507356467103782, 0.0,
+  0.046823254155498761, 0.0, -0.10504633316747357, 0.0,
+  0.1131383672796706, 0.0, -0.020532913935748971, 0.0,
+  0.062673206173539345, 0.0, 0.21172225109566356, 0.0,
+  0.065627875554677459, 0.0, -0.010096023723404303, 0.0,
+  0.023197183286344458, 0.0, 0.014865154858537915, 0.0,
+  0.17761214899687003, 0.0, 0.039908113599700978, 0.0,
+  -0.097110620982348669, 0.0, 0.050721257314571749, 0.0,
+  -0.0085816698104445692, 0.0, 0.0090852652025623024, 0.0,
+  -0.053430092697304782, 0.0, -0.046424481875269021, 0.0,
+  0.0057038554136527291, 0.0, 0.0082881796997479034, 0.0,
+  0.0079300515277983957, 0.0, -0.11147695840716144, 0.0,
+  0.20601531155495309, 0.0, -0.21948049283693263, 0.0,
+  0.039547045449070561, 0.0, 0.01361659817228472, 0.0,
+  -0.020288436131884486, 0.0, 0.039556826530527923, 0.0,
+  -0.042682996396511186, 0.0, -0.0068043719344499046, 0.0,
+  0.053183949411544647, 0.0, -0.028075376002876483, 0.0,
+  0.030451216103294761, 0.0, -0.0019539849743955085, 0.0,
+  0.027360675129972509, 0.0, -0.00035992781161344909, 0.0,
+  -0.032110042178333395, 0.0, 0.0029959153497712289, 0.0,
+  0.013376354416393118, 0.0, -0.0018776788901251568, 0.0,
+  -0.0012000641349911014, 0.0, -0.15523629744986336, 0.0,
+  0.029217808262099625, 0.0, 0.36410184986136285, 0.0,
+  0.0098567381711160418, 0.0, -0.039645045807502867, 0.0,
+  0.021762225601519303, 0.0, 0.01451344137745085, 0.0,
+  0.26265864698205338, 0.0, 0.46800265259202545, 0.0,
+  0.12803687993289634, 0.0, -0.39433133421252181, 0.0,
+  -0.17259566882702379, 0.0, 0.14759985408515458, 0.0,
+  -0.016233674046132421, 0.0, 0.075819627510523846, 0.0,
+  -0.00026168149633731027, 0.0, -0.035050401066699197, 0.0,
+  0.0021056198926040566, 0.0, 0.091681109432179261, 0.0,
+  -0.03686498242104834, 0.0, -0.086319605148349632, 0.0,
+  0.20563012147448814, 0.0, -0.24796646203279207, 0.0,
+  0.024004699467407364, 0.0, -0.0041521921051275602, 0.0,
+  0.14976021692000024, 0.0, 0.057757999809772066, 0.0,
+  -0.020263828101634133, 0.0, -0.041855879983964624, 0.0,
+  0.093826181847505852, 0.0, 0.043259087730103819, 0.0,
+  0.11877266720562471, 0.0, 0.034162549812294253, 0.0,
+  -0.16810279065786213, 0.0, -0.091712694400278114, 0.0,
+  0.06310809087166902, 0.0, 0.025194154945124978, 0.0,
+  -0.051363835031200164, 0.0, 0.0094658249708972873, 0.0,
+  0.039577050526330766, 0.0, 0.019206030776226752, 0.0,
+  0.049630097878464119, 0.0, 0.063196293540582843, 0.0,
+  0.08791753871716447, 0.0, -0.047191240046425248, 0.0,
+  0.069871908234132668, 0.0, 0.00255522172899025, 0.0,
+  -0.0067591511413904572, 0.0, -0.074172650889005626, 0.0,
+  -0.26155730239430275, 0.0, 0.014323899275891444, 0.0,
+  0.069033835677557734, 0.0, -0.078782735661404368, 0.0,
+  0.049893112963021277, 0.0, -0.033286108805844018, 0.0,
+  -0.014668915433843606, 0.0, 0.085316079866587013, 0.0,
+  0.088458738649039748, 0.0, 0.35426428753179584, 0.0,
+  -0.0025463797764468422, 0.0, 0.0042808080563281042, 0.0,
+  -0.093578408487872453, 0.0, 0.001186484432394951, 0.0,
+  -0.057243270538114614, 0.0, -0.52488321026251872, 0.0,
+  -0.1426651218069363, 0.0, 0.15473329896736135, 0.0,
+  0.37279492612440701, 0.0, -0.1133142512104971, 0.0,
+  0.013731006432551013, 0.0, 0.1280368799328957, 0.0,
+  0.12400225347009351, 0.0, 0.085779634449575481, 0.0,
+  -0.2885402638026317, 0.0, -0.0028777950420259789, 0.0,
+  -0.33391254641197299, 0.0, 0.0079101633290765781, 0.0,
+  -0.050174848779292423, 0.0, 0.001590584372139715, 0.0,
+  0.08956350083847843, 0.0, -0.036959263994825117, 0.0,
+  -0.079682858287423136, 0.0, 0.17206315460579855, 0.0,
+  -0.047178616379417601, 0.0, 0.1032114658636557, 0.0,
+  -0.037754726386740593, 0.0, 0.12246584396762877, 0.0,
+  0.084834964156229542, 0.0, -0.040411778509733452, 0.0,
+  -0.0023146353549759334, 0.0, 0.028482461031042135, 0.0,
+  -0.11350272419478138, 0.0, -0.25504358259395332, 0.0,
+  -0.24764903230532315, 0.0, -0.10524622976672807, 0.0,
+  0.026436320491380689, 0.0, -0.0095838464700793921, 0.0,
+  -0.17117614470291234, 0.0, 0.080031859762410687, 0.0,
+  0.014766835870967051, 0.0, -0.10599308626171333, 0.0,
+  0.041407813339378485, 0.0, -0.037424312608050764, 0.0,
+  -0.015516801206056407, 0.0, -0.046527405801299472, 0.0,
+  -0.039528878856764038, 0.0, -0.025727402642677651, 0.0,
+  0.16788392879924502, 0.0, -0.2653653782830302, 0.0,
+  0.11881910820422606, 0.0, -0.16838269765911434, 0.0,
+  0.025818916614256598, 0.0, -0.02057268546616008, 0.0,
+  0.024833974181830379, 0.0, 0.040335295949641976, 0.0,
+  0.12160745581774576, 0.0, -0.073037686356875797, 0.0,
+  -0.13052532924889224, 0.0, 0.088227962535499874, 0.0,
+  0.15316300345675757, 0.0, 0.0002274660780216771, 0.0,
+  0.0074903775830777695, 0.0, 0.04736657679376572, 0.0,
+  -0.0094265953901645407, 0.0, -0.12620149980370815, 0.0,
+  -0.01337070593587837, 0.0, 0.034160859836450563, 0.0,
+  -0.044380773423456213, 0.0, -0.066580419585559159, 0.0,
+  -0.19773115475825509, 0.0, -0.37891313992597897, 0.0,
+  0.12803687993289628, 0.0, 0.38815834409271965, 0.0,
+  0.18021939421794012, 0.0, 0.12802042487574045, 0.0,
+  -0.01378274725557095, 0.0, 0.28922536237878754, 0.0,
+  0.0037655895608561763, 0.0, -0.011521845243248601, 0.0,
+  -0.0026369156975491991, 0.0, 0.10341208438909093, 0.0,
+  -0.03025446386631803, 0.0, -0.097495682540207046, 0.0,
+  0.218333990705568, 0.0, 0.1821261506466359, 0.0,
+  -0.099026735948838665, 0.0, -0.040667408380878498, 0.0,
+  0.18427544766953968, 0.0, 0.09706374956207886, 0.0,
+  -0.038524279541971317, 0.0, -0.051401687201852495, 0.0,
+  0.12332683919160853, 0.0, 0.10289263229713028, 0.0,
+  0.14594734332735684, 0.0, 0.34801795604140051, 0.0,
+  -0.19780353291445693, 0.0, -0.14313528530542102, 0.0,
+  -0.068271336597881108, 0.0, 0.15767822675026702, 0.0,
+  0.040066307667251472, 0.0, 0.0063003912087441338, 0.0,
+  0.082457475876331413, 0.0, -0.037273724315691377, 0.0,
+  0.054562170928483436, 0.0, -0.012363148122574722, 0.0,
+  0.012426705939598845, 0.0, -0.074352457900183647, 0.0,
+  0.13143122175411154, 0.0, 0.10206357174484466, 0.0,
+  0.016433990705979683, 0.0, -0.083748819464365493, 0.0,
+  -0.31680743141319478, 0.0, 0.037792304153184832, 0.0,
+  0.076512258302860001, 0.0, -0.10888311553785915, 0.0,
+  0.053966979413120723, 0.0, 0.04407133186752573, 0.0,
+  -0.054032316012171996, 0.0, 0.087550733790030782, 0.0,
+  0.16365865525757003, 0.0, 0.54122253403571341, 0.0,
+  0.0053273991643244421, 0.0, -0.01154063452965916, 0.0,
+  0.14152129895677082, 0.0, -0.0082757615306625378, 0.0,
+  -0.046017822517621113, 0.0, 0.75383494844853172, 0.0,
+  0.1401486694971896, 0.0, -0.069843588422486183, 0.0,
+  -0.29096969794304856, 0.0, 0.050274954118283505, 0.0,
+  -0.048236993593642856, 0.0, 0.12803687993289611, 0.0,
+  0.063577937779261254, 0.0, -0.0032268321859332473, 0.0,
+  -0.26740212931606949, 0.0, 0.0010647501306795359, 0.0,
+  -0.44192692542247997, 0.0, 0.037355976854858718, 0.0,
+  -0.01279571292121652, 0.0, 0.0033387403476184763, 0.0,
+  0.072741929320467219, 0.0, -0.024073542740054941, 0.0,
+  -0.078842400074864427, 0.0, 0.15785716630353705, 0.0,
+  -0.012432658600857325, 0.0, 0.077023074526507293, 0.0,
+  -0.051085814293744994, 0.0, 0.13511365250680124, 0.0,
+  0.088034006106796639, 0.0, -0.043079294698478862, 0.0,
+  -0.0060008315443959067, 0.0, 0.021445035176371315, 0.0,
+  -0.13683984675965186, 0.0, -0.18046379378962263, 0.0,
+  -0.27998229837947314, 0.0, -0.091624849597325628, 0.0,
+  0.0025170947891100101, 0.0, 0.0049221293208042069, 0.0,
+  -0.17780959282865896, 0.0, 0.083226817536274575, 0.0,
+  0.0081448761136103144, 0.0, -0.11194146954441819, 0.0,
+  -0.0016897746344500945, 0.0, -0.043871886612993093, 0.0,
+  -0.0010360055879867593, 0.0, -0.061947332581376156, 0.0,
+  -0.03841555388865709, 0.0, -0.03615563035303046, 0.0,
+  0.098858086768567083, 0.0, -0.24132429953208639, 0.0,
+  0.084663028005539667, 0.0, -0.15717467562286158, 0.0,
+  0.03621632346202603, 0.0, -0.017689904574970858, 0.0,
+  0.027869130974321341, 0.0, 0.05301513501628017, 0.0,
+  0.077204990916174401, 0.0, -0.055696445107296454, 0.0,
+  -0.119892020872564, 0.0, 0.10211723743639838, 0.0,
+  0.19045518933993055, 0.0, -3.7713646696384677e-06, 0.0,
+  -0.00013760529824667679, 0.0, 0.0017751666895229087, 0.0,
+  -0.00040419032852525709, 0.0, -0.0055263403268434258, 0.0,
+  -0.0029691708012698154, 0.0, -0.0026971608504202495, 0.0,
+  -0.00095232026434565961, 0.0, 0.0049882264193215594, 0.0,
+  -0.0091692627113377275, 0.0, -0.015593056093094474, 0.0,
+  0.12803687993289672, 0.0, -0.00089145366248071596, 0.0,
+  0.0030809956777002583, 0.0, -0.0053289001585047719, 0.0,
+  0.14208961917840404, 0.0, -0.02866974978296247, 0.0,
+  -0.11479515959430553, 0.0, -0.3615621507525662, 0.0,
+  0.13570866251951139, 0.0, -0.0027132573088071649, 0.0,
+  0.20236660654369998, 0.0, 0.0025897851237234584, 0.0,
+  0.099449865962241354, 0.0, 0.0083506802811912466, 0.0,
+  0.00095301900224113397, 0.0, -0.062897697793863908, 0.0,
+  -0.13471117961114648, 0.0, 0.14980794069142606, 0.0,
+  0.14769431862406623, 0.0, 0.26872186246474489, 0.0,
+  0.16887678250673022, 0.0, 0.0075721070551225678, 0.0,
+  0.016123656347587147, 0.0, -0.044581671019872406, 0.0,
+  0.050025554264542728, 0.0, 0.02780231534026055, 0.0,
+  0.06350610844755282, 0.0, 0.039327867962247513, 0.0,
+  0.10869451391216446, 0.0, -0.068574893918543253, 0.0,
+  0.023608106977349753, 0.0, 0.057343846464306784, 0.0,
+  0.090857433301902643, 0.0, -0.087215946557855709, 0.0,
+  -0.15839548205551271, 0.0, -0.47264606106347867, 0.0,
+  0.0093841436212174119, 0.0, -0.18991917602069799, 0.0,
+  0.10556964841723686, 0.0, -0.09468339232854156, 0.0,
+  0.037667302055527936, 0.0, 0.052390652777853763, 0.0,
+  -0.054069195135718076, 0.0, 0.0069148986635433297, 0.0,
+  0.010692829533915954, 0.0, -0.31774391654433826, 0.0,
+  -0.12717434040249659, 0.0, -0.092492419265358755, 0.0,
+  -0.00054340925960209656, 0.0, -0.01724051532592626, 0.0,
+  0.00019262546994602888, 0.0, 9.6922667441057851e-06, 0.0,
+  0.0020994271528733256, 0.0, -6.0335713101703139e-05, 0.0,
+  0.0025017487519546164, 0.0, 0.016536339227086843, 0.0,
+  0.0065188510677296908, 0.0, -0.010967861018661597, 0.0,
+  -0.018531909886560817, 0.0, 0.0069826356142892072, 0.0,
+  0.0033010047499395447, 0.0, 0.12803687993289617, 0.0,
+  -0.0090028101785260516, 0.0, -0.0095282918678725147, 0.0,
+  0.013109937358287796, 0.0, 0.13906892664546136, 0.0,
+  0.037216684717916296, 0.0, -0.11330739665295682, 0.0,
+  -0.36125901542093747, 0.0, 0.13979574764855385, 0.0,
+  0.0037325895703459173, 0.0, 0.20749932341548413, 0.0,
+  0.0094025797966582701, 0.0, 0.10358932028228292, 0.0,
+  -0.0074475204152760826, 0.0, -0.0077624389586405879, 0.0,
+  -0.078717990736336868, 0.0, -0.14088427334115944, 0.0,
+  0.19919981633702274, 0.0, 0.12818474856448558, 0.0,
+  0.26712055438320853, 0.0, 0.13199871756915454, 0.0,
+  0.017313652969224224, 0.0, -0.00018278972493369317, 0.0,
+  0.081381468489224201, 0.0, 0.044606116159498312, 0.0,
+  0.089435838627255626, 0.0, -0.088039740384200219, 0.0,
+  -0.056281958582626752, 0.0, -0.13278102979483114, 0.0,
+  0.074238819078523074, 0.0, -0.018960691282788107, 0.0,
+  -0.063804141033463199, 0.0, -0.10413806089035764, 0.0,
+  0.07289622880629297, 0.0, 0.15280093292397673, 0.0,
+  0.42922851290797709, 0.0, -0.00043291606078038261, 0.0,
+  0.15815799179979464, 0.0, -0.080921370094769907, 0.0,
+  0.094780964362427389, 0.0, 0.010472051039606594, 0.0,
+  -0.049058933535531299, 0.0, 0.047159664704209001, 0.0,
+  -0.048390804264386925, 0.0, -0.014668918462969579, 0.0,
+  0.34191453107019476, 0.0, 0.14117107546112026, 0.0,
+  0.10613853374844553, 0.0, -0.029914393875286636, 0.0,
+  -0.021521424354150057, 0.0, 1.0663781044823878e-05, 0.0,
+  -4.6349636981978563e-05, 0.0, 0.0070182414727718483, 0.0,
+  -0.00024648276836443015, 0.0, -0.021540012214549702, 0.0,
+  -0.0056766785419416332, 0.0, 0.00017951237284208484, 0.0,
+  3.7997942825259069e-06, 0.0, 5.7313973916986823e-05, 0.0,
+  -0.0078163687225636502, 0.0, -0.0052095854781402081, 0.0,
+  0.12803687993289634, 0.0, 0.048400001990216532, 0.0,
+  0.025810273809168557, 0.0, -0.017478280634378503, 0.0,
+  0.052007714487981582, 0.0, -0.012281631560307758, 0.0,
+  0.039505790624283034, 0.0, -0.43135560810378304, 0.0,
+  -0.034447082367283319, 0.0, 0.28053777489244286, 0.0,
+  -0.58643617191418962, 0.0, -0.031209859528154284, 0.0,
+  -0.25575441712518016, 0.0, 0.024914628011585185, 0.0,
+  0.0060017818189052885, 0.0, 0.020177417894662944, 0.0,
+  -0.11629308436781191, 0.0, 0.036379063856101693, 0.0,
+  0.083295471354534689, 0.0, 0.025384683042296182, 0.0,
+  0.014440528181453598, 0.0, 0.001978363874488498, 0.0,
+  -0.023815919014321951, 0.0, -0.024538129430958639, 0.0,
+  0.044585166727952812, 0.0, -0.063975103487655463, 0.0,
+  -0.015039480456188572, 0.0, -0.030687878739838241, 0.0,
+  0.015014572230825541, 0.0, 0.028454567345576311, 0.0,
+  -0.022960807632516771, 0.0, -0.010999561956080959, 0.0,
+  0.025375468320608344, 0.0, -0.091835555635768826, 0.0,
+  -0.11832530965963582, 0.0, -0.10241551198771462, 0.0,
+  -0.037715966128950888, 0.0, 0.086041254736730605, 0.0,
+  -0.14939585948146372, 0.0, -0.12042369698757706, 0.0,
+  0.038130262439876966, 0.0, 0.15770649857577146, 0.0,
+  0.031788559842168281, 0.0, -0.01609436616668692, 0.0,
+  0.057956618869805125, 0.0, -0.40200533795442961, 0.0,
+  0.75439117511708065, 0.0, -0.053168809665609731, 0.0,
+  -0.015126244935707344, 0.0, 0.089817669742383463, 0.0,
+  -0.00086953640835539829, 0.0, -0.0001481326782561601, 0.0,
+  0.0039619291190686277, 0.0, 0.00050754511634367025, 0.0,
+  0.0066355239890903183, 0.0, 0.02688392228370132, 0.0,
+  0.0053084654213279492, 0.0, -0.0085781133178022759, 0.0,
+  -0.027253189236864744, 0.0, 0.0080253190039750785, 0.0,
+  -0.0047293985692447313, 0.0, 0.12803687993289622, 0.0,
+  -0.027700540424274941, 0.0, -0.015409050577819022, 0.0,
+  0.035649546339562604, 0.0, 0.043870521924076554, 0.0,
+  0.04599269980797583, 0.0, 0.037608533400426476, 0.0,
+  -0.44792119577545281, 0.0, -0.036408449936650537, 0.0,
+  0.3060807922565173, 0.0, -0.64297054040866719, 0.0,
+  -0.033513992752924021, 0.0, -0.2748434223737567, 0.0,
+  -0.0017024127565149097, 0.0, -0.017148283877321053, 0.0,
+  0.015356146514209655, 0.0, -0.13260742218796487, 0.0,
+  0.087446388053469382, 0.0, 0.077321722631700882, 0.0,
+  0.050446470957084072, 0.0, -0.011309928214241365, 0.0,
+  0.010077087857151352, 0.0, 0.033510287484753896, 0.0,
+  0.03260257059972712, 0.0, 0.069322828603243056, 0.0,
+  0.020283329672862702, 0.0, 0.0095396316569804785, 0.0,
+  0.033812408223687057, 0.0, -0.019851597249304801, 0.0,
+  -0.020583807684871433, 0.0, 0.024828354592809892, 0.0,
+  0.0051569213205133945, 0.0, -0.017534799809152731, 0.0,
+  0.039741669386038986, 0.0, 0.069859823641639479, 0.0,
+  0.091539205018878411, 0.0, 0.02025310428002574, 0.0,
+  -0.10593544033593681, 0.0, 0.15736097314946718, 0.0,
+  0.099323557307984298, 0.0, 0.059690836555884252, 0.0,
+  -0.14196998569206326, 0.0, -0.011956556007337393, 0.0,
+  0.010563486534819264, 0.0, -0.057199527920583186, 0.0,
+  0.33450756406477306, 0.0, -0.5806268849703794, 0.0,
+  0.04395214582626368, 0.0, -0.01475238685042489, 0.0,
+  -0.11466320382475165, 0.0, 0.0038965608598454824, 0.0,
+  -0.0020153631157805224, 0.0, -0.0034354374487718508, 0.0,
+  -0.00086358393983294889, 0.0, 0.0002125870919415829, 0.0,
+  -0.010914561614527894, 0.0, 0.019321236080281766, 0.0,
+  0.020617010745771831, 0.0, 0.016108126452042699, 0.0,
+  0.0010861112134811189, 0.0, 0.00109334792646387, 0.0,
+  0.12803687993289573, 0.0, 0.0034877217987997785, 0.0,
+  -0.01445996611788084, 0.0, -0.0056394445555443236, 0.0,
+  0.22552298594514578, 0.0, 0.0254418919735372, 0.0,
+  0.94602969399881109, 0.0, -0.040777132099580921, 0.0,
+  0.27708270889111658, 0.0, -0.036282120936667855, 0.0,
+  0.072163674749347553, 0.0, -0.11168652574020554, 0.0,
+  0.018897380522553995, 0.0, -0.0056335490832488217, 0.0,
+  0.0059749138639248293, 0.0, -0.013088975421729043, 0.0,
+  -0.10945957862133343, 0.0, -0.041497014619500318, 0.0,
+  0.032576764800814818, 0.0, -0.014488479956782093, 0.0,
+  -0.0070616758047431488, 0.0, -0.0070523414364780631, 0.0,
+  0.0036773889539493038, 0.0, 0.020050614079007999, 0.0,
+  0.0010900569146808311, 0.0, -0.0027375195499502098, 0.0,
+  0.00028651525668512828, 0.0, 0.013991498766583326, 0.0,
+  0.0049336857752257353, 0.0, -0.0014691250294238166, 0.0,
+  0.0056545459659368483, 0.0, 0.0024288768026654592, 0.0,
+  0.008371687448492867, 0.0, -0.01826531220673536, 0.0,
+  0.027838082880436068, 0.0, -0.0016691869850139587, 0.0,
+  0.0030567771524889868, 0.0, -0.0037736280166061433, 0.0,
+  0.0089476717795222913, 0.0, -0.00090690331689333311, 0.0,
+  0.015319669157976747, 0.0, -0.014084339452485713, 0.0,
+  0.0099994173660964396, 0.0, -0.0052976267090233363, 0.0,
+  -0.0070236381223854789, 0.0, -0.0060646474774306118, 0.0,
+  -0.00013588053273414264, 0.0, 0.0060159608799744595, 0.0,
+  -0.01560686854665338, 0.0, -0.014717416111864307, 0.0,
+  -0.00018719658825029818, 0.0, -0.18929254745080296, 0.0,
+  -0.002160458927770927, 0.0, -0.0042325526718801319, 0.0,
+  -0.0016092982443214668, 0.0, -0.010387842493474473, 0.0,
+  -0.069851794119210123, 0.0, -0.11498113026018902, 0.0,
+  -0.022815687810252224, 0.0, 0.0093938323362540415, 0.0,
+  -0.010397827705219482, 0.0, 0.12803687993289647, 0.0,
+  -0.03133914799333986, 0.0, 0.14123305935484898, 0.0,
+  0.1915352159436968, 0.0, 0.20024058344797074, 0.0,
+  -0.13079860345315453, 0.0, -0.022592755756584822, 0.0,
+  0.082015622687306292, 0.0, -0.040703742759759957, 0.0,
+  -0.034536345556835123, 0.0, -0.0040827296512030344, 0.0,
+  0.066942070552485619, 0.0, -0.14232827810124277, 0.0,
+  0.002149064293661072, 0.0, -0.0060475448207788947, 0.0,
+  0.11634362250083051, 0.0, 0.1416578078140168, 0.0,
+  0.12412130981963798, 0.0, 0.011638803233203638, 0.0,
+  -0.057764657076436077, 0.0, 0.25232842825021212, 0.0,
+  -0.069854989316975133, 0.0, -0.11302545177326709, 0.0,
+  0.034629948649638725, 0.0, 0.027048667030056012, 0.0,
+  -0.035601272487586787, 0.0, -0.01338600288305674, 0.0,
+  0.0044359669797669216, 0.0, 0.096157591935152956, 0.0,
+  0.024830608699956919, 0.0, -0.0064872756690801375, 0.0,
+  -0.047144072363403268, 0.0, 0.22398386093250974, 0.0,
+  -0.47060428173510854, 0.0, 0.57146387972677071, 0.0,
+  -0.06163915455040006, 0.0, -0.0016560128227840144, 0.0,
+  0.016838718343134284, 0.0, -0.12002338577331867, 0.0,
+  -0.027090848738459062, 0.0, 0.041856190253155491, 0.0,
+  -0.041998542871409791, 0.0, -0.05560142431302622, 0.0,
+  0.060818946160141045, 0.0, -0.029272767478029059, 0.0,
+  0.0023918586181652731, 0.0, 0.0023999563013884025, 0.0,
+  -0.0043061013465823588, 0.0, 0.026131443586235686, 0.0,
+  -0.065917101128651956, 0.0, -0.0023456089045683533, 0.0,
+  -0.010020985228268907, 0.0, 0.00042139479960585674, 0.0,
+  0.0012051569466563733, 0.0, 0.00030494191964781811, 0.0,
+  -0.0056632918034312087, 0.0, -0.15730058927859458, 0.0,
+  -0.21882214406907663, 0.0, -0.046963487390640317, 0.0,
+  -0.023971194862853384, 0.0, 0.020601276217989458, 0.0,
+  0.12803687993289598, 0.0, 0.11748017844244461, 0.0,
+  -0.39046412652519941, 0.0, -0.48759599848121082, 0.0,
+  0.18915833758180586, 0.0, 0.2493627457595953, 0.0,
+  -0.01961763060145625, 0.0, 0.077653248379252846, 0.0,
+  -0.040505009325777441, 0.0, -0.033347562017269058, 0.0,
+  -0.0039244309844457094, 0.0, 0.064033800455918319, 0.0,
+  -0.12272411819705697, 0.0, -0.12458355922335664, 0.0,
+  0.040614066080413277, 0.0, 0.10310289426174686, 0.0,
+  0.10914188928558129, 0.0, 0.12652318945431279, 0.0,
+  -0.023937101497168076, 0.0, -0.021628536227125385, 0.0,
+  0.10863551999047388, 0.0, -0.16312847274037612, 0.0,
+  0.037779639384694655, 0.0, 0.059031437772702033, 0.0,
+  0.086043131050953486, 0.0, 0.1093621072722696, 0.0,
+  -0.0064772218992687636, 0.0, 0.062274752704887033, 0.0,
+  0.0035439729701463329, 0.0, -0.025738588937361133, 0.0,
+  -0.041088902755995797, 0.0, 0.024132257512786925, 0.0,
+  0.0059821003249337246, 0.0, -0.0037601311532579553, 0.0,
+  -0.034442748644538404, 0.0, -0.027591393891725231, 0.0,
+  -0.030072871931424813, 0.0, 0.041459702996364582, 0.0,
+  -0.050282222645441646, 0.0, 0.19928925501258765, 0.0,
+  0.00682815537614754, 0.0, -0.16444373700275919, 0.0,
+  0.25726187456440136, 0.0, -0.051697516868102117, 0.0,
+  -0.020717568657855689, 0.0, -0.12720248802739395, 0.0,
+  -0.011786980848591311, 0.0, 0.10604380448975971, 0.0,
+  -0.019127230205717778, 0.0, 0.0065022647224752357, 0.0,
+  -0.00017326551533885899, 0.0, 0.93456517006958717, 0.0,
+  0.011152246849154845, 0.0, 0.020479226208613446, 0.0,
+  0.0012610087759840486, 0.0, 0.029529383910727201, 0.0,
+  0.10655746602014809, 0.0, 0.16443286704734392, 0.0,
+  0.029275758999704839, 0.0, -0.01275078771717433, 0.0,
+  0.017297067678069579, 0.0, 0.12803687993289634, 0.0,
+  0.017664872061301361, 0.0, -0.097517797936459538, 0.0,
+  -0.080672033263446505, 0.0, 0.18868824027812475, 0.0,
+  0.042722390280808736, 0.0, -0.013240572840837069, 0.0,
+  0.081072236209944859, 0.0, -0.031672169400718236, 0.0,
+  -0.035351830355339245, 0.0, -0.0065905141513173289, 0.0,
+  0.066617882735357611, 0.0, -0.13696358192357375, 0.0,
+  -0.011610798594413508, 0.0, 0.0046065828029760066, 0.0,
+  0.096237506872096604, 0.0, 0.17030357095075299, 0.0,
+  0.11706482186976201, 0.0, 0.026357803367044304, 0.0,
+  -0.047860247741413821, 0.0, 0.25535434895145914, 0.0,
+  -0.0032546652892977345, 0.0, 0.0017033147266046222, 0.0,
+  -0.016437007531460955, 0.0, 0.016119433687031049, 0.0,
+  -0.07605772152985589, 0.0, 0.005102854646174014, 0.0,
+  0.019547962911456527, 0.0, 0.012176254967784107, 0.0,
+  -0.0082952119045052886, 0.0, -0.033557047967798244, 0.0,
+  0.0072732078728892993, 0.0, 0.07341172383914038, 0.0,
+  -0.12877761680439201, 0.0, 0.16138730275194652, 0.0,
+  -0.0052319780715336913, 0.0, 0.044815284760440006, 0.0,
+  -0.019287467676948538, 0.0, 0.099096838380499125, 0.0,
+  -0.11763268578649486, 0.0, 0.021463983582428021, 0.0,
+  0.21402037692289261, 0.0, -0.19978802722576447, 0.0,
+  0.079529946522765099, 0.0, -0.014272515794608706, 0.0,
+  0.14791768045623724, 0.0, 0.027706376377857223, 0.0,
+  -0.11955487251318864, 0.0, 0.0056177312318222913, 0.0,
+  -0.043827369310100048, 0.0, 0.0029449979949395968, 0.0,
+  -0.018055793577544804, 0.0, 0.00031094909730496653, 0.0,
+  -0.0016941730105623821, 0.0, -0.00039418940787927899, 0.0,
+  0.014416954123984634, 0.0, 0.18092739167103153, 0.0,
+  0.27265528448293935, 0.0, 0.059067690803845455, 0.0,
+  0.026668174798029284, 0.0, -0.019687016521210184, 0.0,
+  0.128036879932896, 0.0, -0.038729890988164123, 0.0,
+  0.13483490954995572, 0.0, 0.18807654425958334, 0.0,
+  0.19590436273809045, 0.0, -0.059257027651348805, 0.0,
+  -0.0035794378834934039, 0.0, 0.078882597375361518, 0.0,
+  -0.032642684985644647, 0.0, -0.037018179186156679, 0.0,
+  -0.0044629086348835284, 0.0, 0.073203713496205094, 0.0,
+  -0.14483216011247305, 0.0, 0.035541972120053826, 0.0,
+  -0.014960612646761413, 0.0, 0.10555109721447578, 0.0,
+  0.19987030250730961, 0.0, 0.1570587204357263, 0.0,
+  -0.010154236826527569, 0.0, 0.018243678163340254, 0.0,
+  0.088710413592205814, 0.0, 0.034692047669196327, 0.0,
+  0.014922818830244189, 0.0, 0.0050811549997609971, 0.0,
+  0.12202853774145686, 0.0, 0.085964970548036243, 0.0,
+  -0.0091645331693277262, 0.0, -0.022989743525385745, 0.0,
+  -0.03326385840417867, 0.0, 0.004281748032633999, 0.0,
+  0.031737551926539334, 0.0, -0.01414256085477484, 0.0,
+  -0.083080191387427352, 0.0, 0.11346746409380669, 0.0,
+  -0.14708935683972188, 0.0, -0.013796755540283385, 0.0,
+  -0.031802901121853036, 0.0, 0.0018816320954344926, 0.0,
+  -0.099570412849255038, 0.0, 0.10649362337064869, 0.0,
+  -0.0081480336231671644, 0.0, -0.2021178459233153, 0.0,
+  0.17319727628823911, 0.0, -0.038210206023222996, 0.0,
+  -0.0022503065085919425, 0.0, -0.1160540620590913, 0.0,
+  -0.015114348982979127, 0.0, 0.10731982946163861, 0.0,
+  -0.020854708653794133, 0.0, 0.00072064730126784058, 0.0,
+  -0.00031953562641715466, 0.0, 0.0020457170076678475, 0.0,
+  -0.014733741695691782, 0.0, 0.0036423002478721128, 0.0,
+  0.030113777012332154, 0.0, 0.0035271661180363736, 0.0,
+  -8.8337088163714086e-05, 0.0, 0.0023372624618229502, 0.0,
+  0.0039534953050034839, 0.0, -0.0081341336076362902, 0.0,
+  -0.016165228143968709, 0.0, 0.12803687993289564, 0.0,
+  0.059484365153570383, 0.0, 0.029055791938057803, 0.0,
+  -0.037222346028309101, 0.0, -0.070450170193379055, 0.0,
+  0.014108958039723014, 0.0, -0.028173508101311237, 0.0,
+  0.15132902294104064, 0.0, 0.13707690903388156, 0.0,
+  0.43516090352597714, 0.0, 0.13028808886270393, 0.0,
+  0.015754830625740499, 0.0, -0.15051860885591725, 0.0,
+  0.15439990217477553, 0.0, -0.0080250986755801973, 0.0,
+  0.099279214189576748, 0.0, -0.0551244810039343, 0.0,
+  -0.12571604544494583, 0.0, 0.060039235786601738, 0.0,
+  0.038685087198668207, 0.0, 0.030945201585234509, 0.0,
+  -0.11499940787589784, 0.0, 0.17643773924358269, 0.0,
+  0.18653054404332747, 0.0, -0.012125313656328109, 0.0,
+  -0.059870025385692596, 0.0, 0.45979839406566242, 0.0,
+  -0.44890820760178995, 0.0, -0.059839104036562604, 0.0,
+  0.20709958016465993, 0.0, 0.013268473058273731, 0.0,
+  0.22619744256472504, 0.0, 0.089178987304611684, 0.0,
+  0.069147102383633502, 0.0, 0.023604436852718277, 0.0,
+  0.051137949644981098, 0.0, -0.030623169213943521, 0.0,
+  -0.11591469548218851, 0.0, -0.091252754881899684, 0.0,
+  -0.16189446208116107, 0.0, -0.08222373640411107, 0.0,
+  0.011133196381728099, 0.0, 0.13304418112054067, 0.0,
+  -0.23521198361469256, 0.0, -0.38574226618029556, 0.0,
+  0.0080697578068259813, 0.0, 0.0083172146012279458, 0.0,
+  -0.058048176682514101, 0.0, 0.24088203010589607, 0.0,
+  -0.14008945477287491, 0.0, -0.0017191104775938558, 0.0,
+  8.5912131960928011e-05, 0.0, 0.003828573261111471, 0.0,
+  0.00052885490047516724, 0.0, 0.00033995985860668432, 0.0,
+  -0.00089288584400467111, 0.0, 0.017533821995873725, 0.0,
+  0.0027290960327846902, 0.0, -0.050692215237007801, 0.0,
+  0.016393671191751925, 0.0, -0.0091880302775114529, 0.0,
+  0.12803687993289584, 0.0, -0.022601068256196368, 0.0,
+  -0.011133899230331637, 0.0, 0.024009212882044807, 0.0,
+  -0.065437893641115685, 0.0, -0.034738784015594104, 0.0,
+  -0.024231526021992859, 0.0, 0.1357034087993082, 0.0,
+  0.12286143705507373, 0.0, 0.39085259247170973, 0.0,
+  0.1193283875251749, 0.0, 0.01932716192007013, 0.0,
+  -0.13597811297668386, 0.0, -0.007191051661602596, 0.0,
+  -0.027324744591979068, 0.0, 0.071983066748671762, 0.0,
+  -0.064227986003129747, 0.0, -0.06357184963737994, 0.0,
+  -0.0033556707140879024, 0.0, 0.045099361074890265, 0.0,
+  -0.034330001197706676, 0.0, 0.037784299693023396, 0.0,
+  -0.073897693744511175, 0.0, -0.065831601296875236, 0.0,
+  0.039069770800603053, 0.0, 0.0517376036683454, 0.0,
+  -0.46594977757805717, 0.0, 0.12559101739558814, 0.0,
+  -0.11730227806509072, 0.0, 0.12019113155278272, 0.0,
+  0.28427140338657175, 0.0, 0.63828536158577709, 0.0,
+  0.18441940732950096, 0.0, 0.068006016747754819, 0.0,
+  0.012136134476380412, 0.0, 0.0070800618739596142, 0.0,
+  -0.044692945735691214, 0.0, 0.098319580989649866, 0.0,
+  0.031159339255523291, 0.0, 0.12232931528358527, 0.0,
+  0.06923754250514548, 0.0, -0.0079545774881631098, 0.0,
+  -0.05048672752378551, 0.0, 0.27096943250517469, 0.0,
+  0.22599741924771405, 0.0, -0.0037922421483088447, 0.0,
+  0.0019455122747805665, 0.0, 0.056063566269007742, 0.0,
+  -0.10945215546170259, 0.0, 0.073496974735601114, 0.0,
+  -0.00011397862133428782, 0.0, -0.0036497593028327739, 0.0,
+  0.0025213907040323859, 0.0, -0.0038292008668841734, 0.0,
+  -0.0031571269034642055, 0.0, -0.0027255768362494811, 0.0,
+  0.0014464101928125484, 0.0, -0.0016297129628523659, 0.0,
+  -0.007912698607299571, 0.0, 0.0046141693965201262, 0.0,
+  0.012037525584994517, 0.0, 0.12803687993289606, 0.0,
+  -0.032784489343346636, 0.0, -0.025888731785131194, 0.0,
+  0.026859180737321131, 0.0, -0.075187726652619552, 0.0,
+  -0.010626778491349156, 0.0, -0.027656666370959943, 0.0,
+  0.1537609939241231, 0.0, 0.14174126984075711, 0.0,
+  0.41703794229053115, 0.0, 0.12552536106945919, 0.0,
+  0.024396536449382961, 0.0, -0.16239099145663649, 0.0,
+  -0.16553962682328432, 0.0, 0.0084433118076703111, 0.0,
+  0.056861247479662112, 0.0, -0.054389880122378748, 0.0,
+  -0.11565550906622081, 0.0, 0.068465668921485257, 0.0,
+  0.030323055375205819, 0.0, 0.032660759020090024, 0.0,
+  0.1272263063275742, 0.0, -0.20939667872521339, 0.0,
+  -0.16781268349554973, 0.0, -0.0093487389905590676, 0.0,
+  -0.060314351421819651, 0.0, -0.33638889905096858, 0.0,
+  0.40201505177269264, 0.0, 0.12850078399302661, 0.0,
+  -0.21953678348013406, 0.0, -0.11158019442740939, 0.0,
+  -0.3623627644740568, 0.0, -0.11211856029193235, 0.0,
+  -0.049674759538270066, 0.0, -0.09106023766687249, 0.0,
+  -0.016384456648010894, 0.0, -0.0073801096998862602, 0.0,
+  0.032329321651001365, 0.0, -0.054634826811738514, 0.0,
+  -0.1644448126390301, 0.0, -0.071900165923313983, 0.0,
+  0.018515761813386246, 0.0, 0.090565353351832939, 0.0,
+  -0.31213861124596687, 0.0, -0.34662264084208938, 0.0,
+  0.031281242408042233, 0.0, -0.0048552691437197138, 0.0,
+  -0.09961718905548729, 0.0, 0.16490909341149965, 0.0,
+  -0.10346807960118543, 0.0, 0.0055538929797570918, 0.0,
+  0.00016392737906378149, 0.0, -0.010265516214176843, 0.0,
+  -0.00064471439379240191, 0.0, -0.011198379915835666, 0.0,
+  0.016133175402724614, 0.0, -0.025543909094250767, 0.0,
+  0.00038397872894388522, 0.0, 0.063727948015900357, 0.0,
+  -0.01826221635491744, 0.0, 0.015365033343527795, 0.0,
+  0.12803687993289584, 0.0, 0.010504139517121314, 0.0,
+  0.025214817726250983, 0.0, -0.014433061223523809, 0.0,
+  -0.070919167074277825, 0.0, 0.024667021304731491, 0.0,
+  -0.021531000762391436, 0.0, 0.14637072723207559, 0.0,
+  0.12541231554694873, 0.0, 0.39329873646520963, 0.0,
+  0.11883776021056637, 0.0, 0.021477912680048131, 0.0,
+  -0.14975043086861728, 0.0, 0.0029206249522738771, 0.0,
+  0.025197460756053947, 0.0, 0.040927601798303397, 0.0,
+  -0.058837807251295518, 0.0, -0.078269278200952863, 0.0,
+  0.0019847562140661626, 0.0, 0.067116224411381764, 0.0,
+  -0.039176326320109436, 0.0, -0.023610398975152713, 0.0,
+  0.072267612550538346, 0.0, 0.050352474174373912, 0.0,
+  0.052978186797895635, 0.0, 0.093133569089825563, 0.0,
+  0.27137644472946582, 0.0, -0.085781078899945004, 0.0,
+  0.044428335926287463, 0.0, -0.063695656668910597, 0.0,
+  -0.14706807583291512, 0.0, -0.39669303010985729, 0.0,
+  -0.14066300924071931, 0.0, -0.062638812000278724, 0.0,
+  0.041710403795721135, 0.0, -0.034341536794678322, 0.0,
+  0.12552132298648669, 0.0, -0.023407728530554655, 0.0,
+  0.12699512979071814, 0.0, 0.16085903423359893, 0.0,
+  0.10008121593341175, 0.0, -0.022627191245750754, 0.0,
+  -0.12424358334868291, 0.0, 0.38472962298464586, 0.0,
+  0.45754237001923842, 0.0, -0.028586721907894838, 0.0,
+  -0.0013606132804036507, 0.0, 0.12487830037781208, 0.0,
+  -0.25654838280519882, 0.0, 0.16495457390298998, 0.0,
+  8.6169332684847316e-05, 0.0, 0.0020803981920320307, 0.0,
+  0.001082185958866197, 0.0, 0.0031440354028779002, 0.0,
+  -0.0026105027715316955, 0.0, 7.4333571168062846e-05, 0.0,
+  0.0076109281278868533, 0.0, -0.0085836052805439694, 0.0,
+  0.0082527800970660318, 0.0, -0.0083927124654840802, 0.0,
+  -0.014731333755547955, 0.0, 0.12803687993289567, 0.0,
+  -0.039378981957656045, 0.0, -0.047193401868734587, 0.0,
+  -0.033965998218965211, 0.0, -0.044398339173585252, 0.0,
+  -0.011146673211658535, 0.0, -0.058039191314186861, 0.0,
+  -0.091315639088050959, 0.0, 0.16432638476877434, 0.0,
+  -0.046410680028291691, 0.0, 0.071901918874669485, 0.0,
+  0.098213544136247347, 0.0, -0.036037580158426508, 0.0,
+  -0.058718731486029435, 0.0, -0.0023689172451281724, 0.0,
+  0.27221003130152543, 0.0, -0.23175006245094648, 0.0,
+  0.43989449189456897, 0.0, 0.047154019205294918, 0.0,
+  -0.51169606433217141, 0.0, -0.35587213706608195, 0.0,
+  0.093200308267472901, 0.0, -0.051338411370229965, 0.0,
+  0.19457720523878186, 0.0, -0.10140977264502045, 0.0,
+  -0.37270086362292076, 0.0, -0.25193292125918743, 0.0,
+  -0.24058509603519537, 0.0, -0.23924428538439141, 0.0,
+  0.11752568146025183, 0.0, -0.063495272286456725, 0.0,
+  -0.10690122285960413, 0.0, -0.14161264382388689, 0.0,
+  -0.043107108865508836, 0.0, 0.010211993954266274, 0.0,
+  -0.15995278323246059, 0.0, 0.084389650507301336, 0.0,
+  -0.1207509586551867, 0.0, -0.067799758773144508, 0.0,
+  -0.0004620783545159776, 0.0, -0.098810874185572592, 0.0,
+  0.056593278191925736, 0.0, 0.1186043943999153, 0.0,
+  0.26960675088413366, 0.0, -0.13768136632077882, 0.0,
+  -0.068287080314092183, 0.0, -0.035539120537641453, 0.0,
+  -0.083595216231141217, 0.0, -0.032881700224298274, 0.0,
+  -0.033829224718117515, 0.0, -0.0063499743218622257, 0.0,
+  5.1058569556267334e-05, 0.0, 0.0028729634177599847, 0.0,
+  0.0024279828653360979, 0.0, 0.0011901345375952574, 0.0,
+  -0.00013376961797418265, 0.0, -0.020832012585306574, 0.0,
+  0.038813083404714593, 0.0, -0.012308918278824079, 0.0,
+  0.0061824960029544952, 0.0, 0.0051826388009428639, 0.0,
+  0.12803687993289561, 0.0, 0.021795268918600681, 0.0,
+  0.067126606476839323, 0.0, 0.064516804438767991, 0.0,
+  -0.039020421292736529, 0.0, -0.018583537860833336, 0.0,
+  -0.049689345459717725, 0.0, -0.078495007885349313, 0.0,
+  0.14436074956700748, 0.0, -0.035433557383634684, 0.0,
+  0.064563913597230446, 0.0, 0.087650426522076136, 0.0,
+  -0.043243281624688858, 0.0, 0.069089877150642923, 0.0,
+  0.00078308528024688916, 0.0, 0.19318128329934867, 0.0,
+  -0.17802078225969306, 0.0, 0.32731943769670552, 0.0,
+  -0.0091243035842692079, 0.0, -0.30395521299061556, 0.0,
+  -0.2309606067242887, 0.0, -0.10596271874297636, 0.0,
+  0.12301266957313568, 0.0, -0.2670702747560823, 0.0,
+  -0.059942886363013474, 0.0, -0.13308349916969123, 0.0,
+  0.39220016892583226, 0.0, 0.36582901320558492, 0.0,
+  0.41289142412865415, 0.0, -0.21374570519364322, 0.0,
+  0.10573767930150836, 0.0, 0.11671796225035901, 0.0,
+  0.20133368200479429, 0.0, 0.054396764471092922, 0.0,
+  -0.092165627356839822, 0.0, 0.25352004364463582, 0.0,
+  -0.021222454023880052, 0.0, 0.17398427558652457, 0.0,
+  0.084716091792664455, 0.0, 0.086570988809429331, 0.0,
+  -0.025620637065906053, 0.0, -0.098190294612502615, 0.0,
+  0.016951888601936964, 0.0, 0.079866216946003765, 0.0,
+  -0.0045398682429889552, 0.0, 0.088054390251833217, 0.0,
+  0.057238817912851299, 0.0, 0.050608532027540121, 0.0,
+  0.11981637607627398, 0.0, 0.0028956552767237498, 0.0,
+  -0.0042866009505335752, 0.0, -0.022587011124298249, 0.0,
+  -5.8903748757608204e-05, 0.0, -0.016143184208819675, 0.0,
+  0.0041832176550835199, 0.0, 0.001149962137820316, 0.0,
+  -0.02280496153890511, 0.0, 0.0091820163946773562, 0.0,
+  0.0019637703884516724, 0.0, 0.001609709669464404, 0.0,
+  0.00055088203615381458, 0.0, 0.12803687993289589, 0.0,
+  0.012232384994803074, 0.0, 0.044588556477087198, 0.0,
+  0.014701087770045515, 0.0, -0.089802356324470659, 0.0,
+  -0.0041015674631339821, 0.0, -0.024028961066839761, 0.0,
+  0.051986935133247432, 0.0, 0.13479578785487867, 0.0,
+  -0.043978130515460567, 0.0, -0.0091967346559594914, 0.0,
+  0.099532730161299876, 0.0, -0.10912574108694052, 0.0,
+  0.072847140244490141, 0.0, 0.060959145373239293, 0.0,
+  -0.16116269892092955, 0.0, -0.0092545900442710261, 0.0,
+  0.058171124488754368, 0.0, 0.15794180159855603, 0.0,
+  -0.15374963376528511, 0.0, -0.008795003579565636, 0.0,
+  -0.21683074782574829, 0.0, 0.40736671818858733, 0.0,
+  -0.120202257845826, 0.0, -0.05154340640377849, 0.0,
+  0.014825366957971544, 0.0, -0.050173477472985617, 0.0,
+  -0.033173238084047818, 0.0, -0.21481645027851748, 0.0,
+  -0.1021532915623605, 0.0, 0.097269297172698041, 0.0,
+  0.010403832498501991, 0.0, -0.095125013388706103, 0.0,
+  -0.054061846001727053, 0.0, 0.058434773623983111, 0.0,
+  -0.15246221031939872, 0.0, -0.089834841769024829, 0.0,
+  0.31718926062718084, 0.0, 0.016077911935377217, 0.0,
+  -0.032472477455973627, 0.0, -0.072750919044836937, 0.0,
+  0.015697586822301726, 0.0, -0.19250691727801542, 0.0,
+  -0.42581042411716435, 0.0, 0.11172855885057388, 0.0,
+  0.017256163976736526, 0.0, -0.030258997093980649, 0.0,
+  -0.14394784499601809, 0.0, -0.3594621918513925, 0.0,
+  -0.0016907431970051062, 0.0, 0.040089979984593703, 0.0,
+  0.0029649197971119267, 0.0, -0.010742443735052782, 0.0,
+  -0.0037361537671210393, 0.0, -0.0026377534491713586, 0.0,
+  -0.0068535454856275936, 0.0, 0.053422134444757137, 0.0,
+  -0.060480047367293024, 0.0, 0.0023971652822110355, 0.0,
+  0.0036315159083896284, 0.0, 0.0045838950822541238, 0.0,
+  0.12803687993289584, 0.0, 0.0039231608938640611, 0.0,
+  -0.050235345088362894, 0.0, -0.027225042758562051, 0.0,
+  -0.088369685921720439, 0.0, 0.0015464542130794866, 0.0,
+  -0.01524459668710334, 0.0, 0.041859603019241846, 0.0,
+  0.12306432594150545, 0.0, -0.055145650860518952, 0.0,
+  -0.011841937993106764, 0.0, 0.1057539328085737, 0.0,
+  -0.10458468028489626, 0.0, -0.057715031302634098, 0.0,
+  -0.068206395011397636, 0.0, -0.16080913157472321, 0.0,
+  -0.016995146013390791, 0.0, 0.10780996206078507, 0.0,
+  0.054548679856038881, 0.0, -0.11627239788045789, 0.0,
+  -0.058341543730227423, 0.0, 0.18339769300277128, 0.0,
+  -0.42386047335561494, 0.0, 0.14088003023163392, 0.0,
+  -0.08044001046647066, 0.0, 0.1361126371514485, 0.0,
+  0.084568448958077677, 0.0, -0.0073743398121293852, 0.0,
+  0.058006075679204232, 0.0, 0.076043800106539008, 0.0,
+  -0.013654110528705988, 0.0, 0.058022695803018061, 0.0,
+  0.053063832918757117, 0.0, 0.0032216804712960983, 0.0,
+  -0.046698897169707196, 0.0, 0.10833415862514711, 0.0,
+  0.11434646293180434, 0.0, -0.25650498822148604, 0.0,
+  -0.058726068268921634, 0.0, 0.072156710859463846, 0.0,
+  -0.048556645277900538, 0.0, -0.026726807993794038, 0.0,
+  -0.24620987870899033, 0.0, -0.37397848488005991, 0.0,
+  0.25496619280193938, 0.0, -0.038193396443988788, 0.0,
+  0.0036113965158265354, 0.0, 0.028388592213901741, 0.0,
+  -0.007201175947491578, 0.0, -0.018066892550505882, 0.0,
+  0.046483466598877192, 0.0, 0.0094099511798932649, 0.0,
+  -0.028012825128759754, 0.0, -0.2586160834281116, 0.0,
+  0.033405929094633684, 0.0, 0.0012088588206644753, 0.0,
+  -0.064729406536939274, 0.0, 0.053187043836679722, 0.0,
+  -0.054639884156276915, 0.0, 0.016025219115361363, 0.0,
+  -0.00011618630302837719, 0.0, 0.12803687993289606, 0.0,
+  0.0082466328977068501, 0.0, -0.0042681527772057797, 0.0,
+  -0.0075551025622348613, 0.0, -0.093820058008858245, 0.0,
+  0.011211168585581166, 0.0, 0.018747314792833286, 0.0,
+  0.015090614744785891, 0.0, 0.12037270398227812, 0.0,
+  -0.042162703616584293, 0.0, -0.066015445572749382, 0.0,
+  0.39547442507740355, 0.0, 0.077830063288100992, 0.0,
+  -0.021566325904912059, 0.0, -0.040366765355478951, 0.0,
+  0.0046661026086989464, 0.0, -0.15349567285776547, 0.0,
+  0.011533523535248653, 0.0, -0.47541566364326032, 0.0,
+  0.14705568621900517, 0.0, 0.08527339553223022, 0.0,
+  0.022653854794989322, 0.0, -0.048311291351599561, 0.0,
+  0.028904051722516259, 0.0, -0.11634236192138354, 0.0,
+  0.053917434950290222, 0.0, 0.12278864840072556, 0.0,
+  0.14893235378080105, 0.0, 0.30280681181166214, 0.0,
+  0.13775534859132854, 0.0, 0.13220188875555058, 0.0,
+  0.26295153510483105, 0.0, -0.67367608876539542, 0.0,
+  -0.11115374440371947, 0.0, 0.24404657760727336, 0.0,
+  -0.086375853337563188, 0.0, -0.088109273867684593, 0.0,
+  -0.10828783840967475, 0.0, -0.023501874554427978, 0.0,
+  -0.21631899735098251, 0.0, 0.040786667064238474, 0.0,
+  0.014117194839704784, 0.0, 0.10637661733099035, 0.0,
+  0.043469929196280697, 0.0, -0.070906868190736522, 0.0,
+  0.0077160376932590485, 0.0, 0.010630924082736328, 0.0,
+  -0.097582588171553769, 0.0, -0.098398234267628101, 0.0,
+  0.084700588161437565, 0.0, 0.16297670414017082, 0.0,
+  0.0016774352935686697, 0.0, -0.055681763682501141, 0.0,
+  -0.046671313460220493, 0.0, -0.012738865517979453, 0.0,
+  -0.0017504180855556683, 0.0, 0.2292868071460076, 0.0,
+  -0.19312395378426941, 0.0, 0.15764003587941608, 0.0,
+  -0.020657575498173854, 0.0, 0.027392701934137773, 0.0,
+  0.12803687993289598, 0.0, -0.012872542215730807, 0.0,
+  0.012029770685559403, 0.0, 0.02104085369944619, 0.0,
+  -0.081077625998203715, 0.0, 0.00089516398057532161, 0.0,
+  0.021261168690456782, 0.0, 0.0075213817636537875, 0.0,
+  0.09383792239514957, 0.0, -0.027098849300499765, 0.0,
+  -0.045112427054687251, 0.0, 0.31340552999930266, 0.0,
+  0.044718785051754133, 0.0, 0.023785045036983254, 0.0,
+  0.07222288761929864, 0.0, 0.023655560707004808, 0.0,
+  -0.11555342827171391, 0.0, 0.057156135755579367, 0.0,
+  -0.34985709433064027, 0.0, 0.076004713583021369, 0.0,
+  0.0095644147687239094, 0.0, -0.010294205936697427, 0.0,
+  0.073977639669655704, 0.0, -0.015105679392645227, 0.0,
+  -0.10053493466374562, 0.0, 0.14353330433080719, 0.0,
+  -0.1165080229843423, 0.0, -0.13008403650389963, 0.0,
+  -0.059121624072288825, 0.0, 0.013015021656174176, 0.0,
+  -0.13408554381812804, 0.0, -0.1350617007675762, 0.0,
+  0.21253329578724617, 0.0, 0.072398142903076362, 0.0,
+  -0.04776748218405185, 0.0, -0.081448119773794847, 0.0,
+  -0.30754557643920466, 0.0, 0.21886885518797541, 0.0,
+  0.15828647977127752, 0.0, -0.018891627515923971, 0.0,
+  0.018189634404794965, 0.0, 0.23296874951320576, 0.0,
+  -0.061695622615260716, 0.0, -0.02367138206150312, 0.0,
+  0.036486194145544271, 0.0, -0.027428210499092928, 0.0,
+  -0.030198985015909056, 0.0, 0.32207788064935799, 0.0,
+  0.25639605539841542, 0.0, -0.060512341221680491, 0.0,
+  0.039443092637894625, 0.0, -0.037469484498446518, 0.0,
+  0.06192848276862533, 0.0, 0.9192924791376107, 0.0,
+  -0.16302809050347578, 0.0, -0.011215097003351519, 0.0,
+  0.22140246374643355, 0.0, -0.17383988849230192, 0.0,
+  0.11753640285469545, 0.0, -0.0031834280276485773, 0.0,
+  0.06951405677870999, 0.0, 0.12803687993289528, 0.0,
+  0.039104995718020716, 0.0, 0.015754525401210515, 0.0,
+  -0.006238528241701671, 0.0, -0.097077168005694506, 0.0,
+  0.0086808271784290392, 0.0, 0.013930919338329784, 0.0,
+  0.028131357374262256, 0.0, 0.11768431595729495, 0.0,
+  -0.049472609628314561, 0.0, -0.062734159595816533, 0.0,
+  0.363930807299578, 0.0, 0.081016865292344031, 0.0,
+  0.014849881232127897, 0.0, 0.020104067583338655, 0.0,
+  -0.029153484715354647, 0.0, -0.116675164030555, 0.0,
+  -0.046687592633801109, 0.0, -0.35223887607543186, 0.0,
+  0.14824953482039963, 0.0, 0.10413555794338859, 0.0,
+  -0.012645752287556209, 0.0, 0.02418019556597337, 0.0,
+  -0.021369026345392696, 0.0, -0.042503137060089638, 0.0,
+  -0.032071513443236714, 0.0, 0.033103761285530581, 0.0,
+  0.054490078802573783, 0.0, 0.018099804695570886, 0.0,
+  -0.036868158566210764, 0.0, 0.060077798891743993, 0.0,
+  0.068196269053975606, 0.0, -0.10038601605439526, 0.0,
+  -0.052544695227943104, 0.0, 0.014778543535965543, 0.0,
+  0.053761030641369563, 0.0, 0.15117237133432454, 0.0,
+  -0.11581380854657479, 0.0, -0.086556916458252933, 0.0,
+  -0.1737903879082198, 0.0, 0.03606404649915286, 0.0,
+  -0.16697499748961556, 0.0, 0.12640401152346356, 0.0,
+  0.048954949466962966, 0.0, -0.087379384743317828, 0.0,
+  0.048493744762878634, 0.0, 0.0078689391116181281, 0.0,
+  -0.27066991630209941, 0.0, -0.23421575588457741, 0.0,
+  0.10660388610806398, 0.0, -0.81095799459781504, 0.0,
+  -0.0026397386337472552, 0.0, 0.16930945151937929, 0.0,
+  0.07230004704077829, 0.0, 0.054175605156701875, 0.0,
+  0.0087677179403363933, 0.0, -0.36286058898078194, 0.0,
+  0.30801498219242779, 0.0, -0.19631775080969097, 0.0,
+  0.011511460556107307, 0.0, -0.066149548959976628, 0.0,
+  0.12803687993289559, 0.0, -0.028651824540597767, 0.0,
+  -0.0030614179118134549, 0.0, 0.019740043561289881, 0.0,
+  -0.082163076967846679, 0.0, 0.0098656135277021082, 0.0,
+  0.027800258984146783, 0.0, 0.021515106836784044, 0.0,
+  0.09485514626545255, 0.0, -0.034403281450289196, 0.0,
+  -0.040343867979493318, 0.0, 0.26500847493782925, 0.0,
+  0.039173215082276849, 0.0, -0.0070910476857015663, 0.0,
+  -0.039024263853187725, 0.0, -0.02504870371500232, 0.0,
+  -0.070738647236568683, 0.0, 0.018274459959630628, 0.0,
+  -0.22671140449079866, 0.0, 0.070242504485539675, 0.0,
+  0.0064827086207525485, 0.0, 0.012639878646839233, 0.0,
+  -0.052549649489505808, 0.0, 0.0027298748026754506, 0.0,
+  -0.050919660752892143, 0.0, 0.084102768340571732, 0.0,
+  -0.039849478571397201, 0.0, -0.082923174316034645, 0.0,
+  -0.11000980699896455, 0.0, -0.015739134030171301, 0.0,
+  -0.05257014899171978, 0.0, -0.077919438202914318, 0.0,
+  0.10721289767514473, 0.0, 0.0025039772304951105, 0.0,
+  -0.044362699486479439, 0.0, -0.018926685022237554, 0.0,
+  -0.091653176693574215, 0.0, 0.031526191030823859, 0.0,
+  0.049982381215774252, 0.0, 0.0070137852004711031, 0.0,
+  0.0068216354506996126, 0.0, 0.11806324642261484, 0.0,
+  -0.063601399403070025, 0.0, -0.050752782894388594, 0.0,
+  0.06514801913412574, 0.0, -0.023959754806759995, 0.0,
+  -0.012355823700764604, 0.0, 0.16405031025241648, 0.0,
+  0.16226020507862327, 0.0, -0.035858909209604432, 0.0,
+  -9.5821292336163187e-05, 0.0, 0.0040933541999885461, 0.0,
+  -0.0065960838391257897, 0.0, 0.0009572794089450187, 0.0,
+  0.016031356970801634, 0.0, 0.0020466033592043313, 0.0,
+  0.013685250642322627, 0.0, 0.018039709375351959, 0.0,
+  -0.03256477960621719, 0.0, -0.1431363359534219, 0.0,
+  0.068283923917939859, 0.0, 0.12803687993289584, 0.0,
+  -0.00055058534157925623, 0.0, -0.049018199388252394, 0.0,
+  -0.079106991001134858, 0.0, 0.16929136054283406, 0.0,
+  0.038962211332725698, 0.0, -0.043145490739471173, 0.0,
+  0.099086413426988679, 0.0, -0.088236829466525335, 0.0,
+  -0.039014098440195391, 0.0, -0.032329558577235781, 0.0,
+  -0.028336404749738069, 0.0, 0.04614068733054788, 0.0,
+  0.10541937820526941, 0.0, -0.01516168124310926, 0.0,
+  0.050422730163323735, 0.0, -0.23631617557395956, 0.0,
+  -0.12648849203212381, 0.0, 0.096953041814089758, 0.0,
+  0.0034101971880618415, 0.0, 0.087484126611877738, 0.0,
+  0.20903228021466366, 0.0, 0.05776424837904777, 0.0,
+  -0.11882947469314238, 0.0, -0.36036233419225799, 0.0,
+  -0.1093575999380253, 0.0, -0.0013210911582408349, 0.0,
+  -0.06090741620865954, 0.0, 0.020876705417460908, 0.0,
+  0.0045741323373959105, 0.0, 0.32134843655812911, 0.0,
+  -0.097169189825316207, 0.0, 0.0013356848940879267, 0.0,
+  0.058102993074237191, 0.0, 0.016959520159832594, 0.0,
+  -0.055158138991505214, 0.0, -0.10066643977580859, 0.0,
+  -0.040187382313604761, 0.0, -0.20857554846340018, 0.0,
+  0.014467925543522038, 0.0, 0.17098709169888773, 0.0,
+  -0.14272795637553148, 0.0, -0.084661433194978181, 0.0,
+  0.007521075945573827, 0.0, 0.02850847347437634, 0.0,
+  0.021830082469989468, 0.0, -0.003768095951374379, 0.0,
+  0.081084238711255904, 0.0, 0.043409504121027426, 0.0,
+  0.007895651663287007, 0.0, -6.5767164645612e-05, 0.0,
+  -0.00011273143856614064, 0.0, -0.0047696751899224355, 0.0,
+  -0.00019577783306347601, 0.0, -0.0063650216137197298, 0.0,
+  -0.00011600035626516386, 0.0, 0.0041835788298312396, 0.0,
+  0.01672800501218915, 0.0, 0.015726647075625402, 0.0,
+  0.020783807087222564, 0.0, -0.006729090281028036, 0.0,
+  0.12803687993289573, 0.0, 0.039433634500345087, 0.0,
+  -0.070552101024729183, 0.0, 0.17333157606746183, 0.0,
+  0.1718722528595599, 0.0, -0.11220477291858523, 0.0,
+  -0.04110981384946176, 0.0, 0.10423701854992877, 0.0,
+  -0.093847517717789042, 0.0, -0.036462705926757683, 0.0,
+  -0.031540589989734059, 0.0, -0.028782084248447321, 0.0,
+  0.041239361013701507, 0.0, 0.029239958732187047, 0.0,
+  -0.017869322152602903, 0.0, 0.056196872684944457, 0.0,
+  -0.23296533218950444, 0.0, -0.089866979170926314, 0.0,
+  0.065056024246271132, 0.0, 0.01443922991071731, 0.0,
+  0.022252457330366886, 0.0, -0.026557172694461444, 0.0,
+  -0.00070804802428945052, 0.0, 0.01631564987649519, 0.0,
+  -0.29168767896835385, 0.0, 0.067787328616189621, 0.0,
+  0.0045105785757915094, 0.0, 0.028406850337505851, 0.0,
+  -0.044302714289850754, 0.0, -0.0022025924032698964, 0.0,
+  -0.30261275892419587, 0.0, 0.083311266089853536, 0.0,
+  -0.022650380574990643, 0.0, -0.040962217968744344, 0.0,
+  0.0064743782469006477, 0.0, 0.077391770096572499, 0.0,
+  0.1451900373681056, 0.0, 0.038300301764619092, 0.0,
+  0.21579357298445709, 0.0, 0.30755315175279996, 0.0,
+  0.13913748172221149, 0.0, 0.23051442512921769, 0.0,
+  0.23713216328199402, 0.0, -0.10425474354337472, 0.0,
+  -0.026561932268917465, 0.0, -0.082195076223573402, 0.0,
+  -0.013884499947717443, 0.0, -0.13630094493815834, 0.0,
+  -0.012243081528830633, 0.0, 0.067944941502690148, 0.0,
+  0.00028122458054721875, 0.0, 0.0062943800909273416, 0.0,
+  0.0026618868040744646, 0.0, 0.0024112861492892788, 0.0,
+  -0.017845366757331619, 0.0, -0.0017554692598240776, 0.0,
+  -0.054698057511094744, 0.0, -0.07275050451032479, 0.0,
+  0.094472896265178685, 0.0, 0.449194579289794, 0.0,
+  -0.21529929879109999, 0.0, 0.128036879932896, 0.0,
+  0.0040214303458510937, 0.0, 0.20524600782571453, 0.0,
+  0.061431259709305124, 0.0, 0.14294840907634604, 0.0,
+  0.025756110786593293, 0.0, -0.032933964366763782, 0.0,
+  0.099826670863813194, 0.0, -0.067693965311335758, 0.0,
+  -0.039872299899408603, 0.0, -0.034324844498600009, 0.0,
+  -0.0083916588186916385, 0.0, 0.036746541912983884, 0.0,
+  -0.30247882548095634, 0.0, 0.060897465278067837, 0.0,
+  0.030326490329498954, 0.0, -0.15000999148416466, 0.0,
+  -0.079366601485851743, 0.0, 0.095862525603661097, 0.0,
+  0.0115379848290741, 0.0, 0.10448911691764204, 0.0,
+  -0.50254055541821741, 0.0, -0.15003197589357861, 0.0,
+  0.24008665235692453, 0.0, -0.20757633785811005, 0.0,
+  -0.14059099430998209, 0.0, -0.031416282187870376, 0.0,
+  0.015469756299929621, 0.0, 0.078044589175675944, 0.0,
+  0.010699590141051808, 0.0, 0.13396324620891684, 0.0,
+  -0.030655946006850572, 0.0, -0.02069968929950548, 0.0,
+  0.11016725912977721, 0.0, -0.21884848260076001, 0.0,
+  -0.041719211006478026, 0.0, -0.1143641936867581, 0.0,
+  -0.064456931555649355, 0.0, -0.026074550659739081, 0.0,
+  -0.095956029326602757, 0.0, 0.073551650683328348, 0.0,
+  -0.068367480094495586, 0.0, -0.17128773044041842, 0.0,
+  0.069811149478561582, 0.0, 0.015129108750841096, 0.0,
+  0.1390827733430304, 0.0, 0.02889064994961503, 0.0,
+  0.04225734275111391, 0.0, -0.0015054391160913387, 0.0,
+  -0.022200985614983695, 0.0, -0.00078163141365828067, 0.0,
+  -0.0033794203783700815, 0.0, 0.031430981042546664, 0.0,
+  -0.0013148098571197277, 0.0, 0.014402841506121238, 0.0,
+  0.0046634978539687229, 0.0, 0.021497939132869352, 0.0,
+  0.026317622193235527, 0.0, 0.028097011450512882, 0.0,
+  -0.009455798726888209, 0.0, 0.012102813578780658, 0.0,
+  0.12803687993289573, 0.0, 0.013775312918653842, 0.0,
+  -0.014972037410103865, 0.0, -0.065187424175342873, 0.0,
+  0.14202122558117919, 0.0, 0.012595244517201948, 0.0,
+  -0.0037920667138749628, 0.0, 0.092655017953799601, 0.0,
+  -0.038463933761759633, 0.0, -0.036836664844903451, 0.0,
+  -0.035076057815571431, 0.0, 0.050144720188376485, 0.0,
+  0.0095479543672756448, 0.0, -0.022262564137061111, 0.0,
+  0.0070562022274392568, 0.0, 0.096555411918756107, 0.0,
+  0.19986952843442402, 0.0, 0.088446142547780229, 0.0,
+  0.12604449680386456, 0.0, 0.44313412657616164, 0.0,
+  -0.62255812851107273, 0.0, -0.0083288914719279114, 0.0,
+  0.0011670022230027121, 0.0, 0.033695361279605721, 0.0,
+  -0.12495505013930047, 0.0, -0.07796378195051977, 0.0,
+  0.0012260781223346429, 0.0, 0.026853539651865595, 0.0,
+  0.018018036416386021, 0.0, 0.0074473563104362484, 0.0,
+  -0.040044215370358682, 0.0, 0.011425406744457682, 0.0,
+  0.041937845023485354, 0.0, -0.042639834821164617, 0.0,
+  0.089988012968906128, 0.0, -0.01368675984028302, 0.0,
+  -0.0043200073386275798, 0.0, 0.020578093402715141, 0.0,
+  0.0099750021856283393, 0.0, -0.17812348684300136, 0.0,
+  0.078900577337122052, 0.0, 0.010197396559869173, 0.0,
+  -0.027375583439823801, 0.0, -0.045731520598488333, 0.0,
+  -0.01006403857632137, 0.0, 0.019317596989074481, 0.0,
+  -0.0023647627741363014, 0.0, 0.0076380110134163194, 0.0,
+  -0.040529021664136133, 0.0, 0.041767963480921912, 0.0,
+  0.0086673060697652696, 0.0, -0.00041096226548547254, 0.0,
+  0.38897370267134179, 0.0, -0.062606452054927889, 0.0,
+  -0.68869535522340053, 0.0, -0.076895616929036154, 0.0,
+  0.011836339740280647, 0.0, -0.011893039627562378, 0.0,
+  0.023589931854692235, 0.0, 0.021134854456879536, 0.0,
+  0.039552791838402782, 0.0, 0.12803687993289592, 0.0,
+  -0.31043981634156842, 0.0, -0.1532358955078294, 0.0,
+  0.046933947958368652, 0.0, -0.049635662315163365, 0.0,
+  -0.012029506211453102, 0.0, -0.0064508026077405951, 0.0,
+  -0.0033092430554374228, 0.0, 0.0068397995157622685, 0.0,
+  0.045416088477573176, 0.0, -0.026870485164118951, 0.0,
+  -0.049170067591742188, 0.0, 0.18239522519760595, 0.0,
+  -0.1063193149584664, 0.0, 0.017281698851517084, 0.0,
+  0.095122421551846803, 0.0, 0.094818655458398002, 0.0,
+  -0.027202734055772271, 0.0, 0.033727117964902013, 0.0,
+  -0.035439150689525911, 0.0, 0.051954662821172767, 0.0,
+  -0.001577274346326839, 0.0, 0.043758837765515007, 0.0,
+  -0.082943432045928037, 0.0, -0.11493886587429136, 0.0,
+  0.00012146296902196291, 0.0, 0.076917890023729674, 0.0,
+  0.033910180954384528, 0.0, -0.13312924322105957, 0.0,
+  -0.02133780229609443, 0.0, 0.012417048699417078, 0.0,
+  0.017614802788125574, 0.0, 0.013202172379094174, 0.0,
+  0.076231467151186311, 0.0, 0.11108275040179165, 0.0,
+  0.048018422379993889, 0.0, -0.063749437462539568, 0.0,
+  -0.17121452496818379, 0.0, 0.10289832289935132, 0.0,
+  -0.067901713569988587, 0.0, -0.15753552528251341, 0.0,
+  -0.040177097746511639, 0.0, 0.052318513146092933, 0.0,
+  -0.014474169057665095, 0.0, 0.010151375150395431, 0.0,
+  -0.058307791093034279, 0.0, 0.023899212755591821, 0.0,
+  0.097106158956629385, 0.0, -0.070569405628338161, 0.0,
+  -0.035446959703937818, 0.0, 0.011946650221191067, 0.0,
+  -0.0014737847561690977, 0.0, 0.21564972173931163, 0.0,
+  -0.00070886140627664631, 0.0, 0.16096236224441446, 0.0,
+  0.089314860494369486, 0.0, -0.024110363898930974, 0.0,
+  -0.048233206504414816, 0.0, 0.17099329922219622, 0.0,
+  -0.054031707453963546, 0.0, -0.031640428390411521, 0.0,
+  0.12803687993289614, 0.0, -0.079889511722987805, 0.0,
+  0.036109826058376343, 0.0, 0.1596831639146141, 0.0,
+  -0.042596689878523664, 0.0, 0.39716810611587811, 0.0,
+  -0.00013983746143384331, 0.0, 0.0030689575597211425, 0.0,
+  -0.0032785324398186613, 0.0, 0.041879626109721742, 0.0,
+  -0.035232515684530077, 0.0, -0.037861168764512711, 0.0,
+  0.20855429212378251, 0.0, 0.073499113494625651, 0.0,
+  -0.016242891547588751, 0.0, 0.082010665142119368, 0.0,
+  0.11083530823668115, 0.0, -0.0048985070787137958, 0.0,
+  0.0075588798394414141, 0.0, -0.0026486882313747121, 0.0,
+  -0.018418772708418504, 0.0, -0.022108524077703827, 0.0,
+  -0.11456002203341066, 0.0, -0.11807149554084084, 0.0,
+  -0.13056981231478032, 0.0, 0.17475349801088683, 0.0,
+  -0.020783079428806476, 0.0, -0.093679606536462151, 0.0,
+  0.1029581976442716, 0.0, 0.050374051965978134, 0.0,
+  -0.01149421789168102, 0.0, 0.029864197801120648, 0.0,
+  -0.048540239854151547, 0.0, -0.12982204399213448, 0.0,
+  -0.10175211543005454, 0.0, -0.045296086619461794, 0.0,
+  0.12951485680465918, 0.0, 0.17183635966599733, 0.0,
+  -0.06488860578544621, 0.0, 0.1241789214817897, 0.0,
+  -0.14588921014500245, 0.0, -0.032976555654091418, 0.0,
+  -0.06868316490108009, 0.0, 0.090697851109839356, 0.0,
+  -0.0031446627590887314, 0.0, 0.00039989354258666626, 0.0,
+  0.011492671985452769, 0.0, -0.12193339700944567, 0.0,
+  -0.01261381138382307, 0.0, -0.27448479500675843, 0.0,
+  0.0016734892357720666, 0.0, -0.00059207513273842134, 0.0,
+  -0.030587229502048511, 0.0, 0.01287625195616735, 0.0,
+  0.17941749288963704, 0.0, 0.014114702272335784, 0.0,
+  -0.0087144874459779802, 0.0, 0.015463389982036412, 0.0,
+  0.012991472133603204, 0.0, -0.03491803317717862, 0.0,
+  0.052285402021311607, 0.0, 0.12803687993289586, 0.0,
+  0.22341368940872214, 0.0, 0.081137408970918506, 0.0,
+  -0.11330331708564274, 0.0, -0.043705729385661043, 0.0,
+  -0.20729471973641586, 0.0, -0.0077860455840958178, 0.0,
+  0.020810251569811158, 0.0, 0.014101126723855282, 0.0,
+  0.035985017008314552, 0.0, -0.038144583912155826, 0.0,
+  -0.03247169638009411, 0.0, 0.21964993228237581, 0.0,
+  0.0096758503422138507, 0.0, 0.023142830741218725, 0.0,
+  0.04760053834674418, 0.0, 0.11999011132170789, 0.0,
+  -0.040845209008862474, 0.0, 0.070126086589559627, 0.0,
+  -0.022500457176922735, 0.0, 0.06399418596237666, 0.0,
+  0.11151547209144302, 0.0, 0.07151864178651729, 0.0,
+  0.084887418645164636, 0.0, -0.15669297313785296, 0.0,
+  -0.044284288688761768, 0.0, -0.044263582091027362, 0.0,
+  0.0051166885302476317, 0.0, -0.057301395601261178, 0.0,
+  -0.12810555547235666, 0.0, -0.00047297403963783092, 0.0,
+  0.028951083820515953, 0.0, -0.03008357523609238, 0.0,
+  -0.28162444716285728, 0.0, -0.10883140241814211, 0.0,
+  0.21377300869607163, 0.0, -0.33241618852047672, 0.0,
+  -0.26101752107264153, 0.0, 0.42662351522030839, 0.0,
+  -0.013728319099945121, 0.0, -0.25684935892346317, 0.0,
+  -0.23143440486212433, 0.0, 0.029760693729212005, 0.0,
+  0.045567925152067326, 0.0, -0.0044544744919392913, 0.0,
+  -0.038073810657863118, 0.0, 0.061968625763955239, 0.0,
+  0.095233994719363363, 0.0, -0.15452366422472671, 0.0,
+  -0.18458993329903839, 0.0, -0.066376661618385513, 0.0,
+  0.0045429316446325245, 0.0, -0.78040031072166083, 0.0,
+  0.012877772233337487, 0.0, -0.31661866666924154, 0.0,
+  -0.041745191971706196, 0.0, 0.091836017771907405, 0.0,
+  0.00043659032393391034, 0.0, -0.32887767651746064, 0.0,
+  0.050794640304127038, 0.0, -0.12207667770687712, 0.0,
+  0.12803687993289548, 0.0, -0.12672277537038096, 0.0,
+  -0.088712685937963165, 0.0, 0.089253460294946269, 0.0,
+  -0.038241672587257164, 0.0, 0.18527342376150679, 0.0,
+  0.0022525968869503621, 0.0, 0.022085079442095767, 0.0,
+  0.007243736433766872, 0.0, 0.029541669857285954, 0.0,
+  -0.031518647457711907, 0.0, -0.016410543673952834, 0.0,
+  0.16466024766013709, 0.0, 0.059336709784064065, 0.0,
+  -0.022868093184797406, 0.0, 0.010958420334074355, 0.0,
+  0.10705316741526509, 0.0, 0.0089112733123029187, 0.0,
+  0.012522272287306693, 0.0, 0.039634616047442027, 0.0,
+  -0.055887210964701131, 0.0, -0.059917350885545624, 0.0,
+  -0.038619607098900867, 0.0, -0.13445816428862153, 0.0,
+  -0.069578859322475581, 0.0, 0.051348820650865122, 0.0,
+  0.0029966256019162123, 0.0, -0.070926057698066508, 0.0,
+  -0.0055091662611302956, 0.0, -0.027571271470596008, 0.0,
+  -0.022270613600103746, 0.0, -0.0046311353188126791, 0.0,
+  -0.031445603209497457, 0.0, -0.12156804373189653, 0.0,
+  -0.05585048623012847, 0.0, 0.014520572020747779, 0.0,
+  -0.00088349340762092774, 0.0, -0.0026719179242337171, 0.0,
+  -0.026740932873495469, 0.0, 0.081940045420487204, 0.0,
+  -0.095800013776857124, 0.0, -0.027078945151008189, 0.0,
+  -0.040578793775119325, 0.0, 0.068365182799201007, 0.0,
+  0.015161932652675954, 0.0, -0.0076531941672112894, 0.0,
+  0.013620582910753071, 0.0, -0.062767222360182895, 0.0,
+  0.019423305758359734, 0.0, -0.14976629760223883, 0.0,
+  -0.00011716013925154246, 0.0, -7.1353335256431374e-05, 0.0,
+  -0.020832862317344714, 0.0, 0.0009836182587934022, 0.0,
+  0.033736819977906472, 0.0, 0.0027939262387186182, 0.0,
+  -0.0020002484193422402, 0.0, 0.0085221229523801331, 0.0,
+  -0.04304014922541409, 0.0, 0.069172997370660724, 0.0,
+  0.14693048317401966, 0.0, 0.1280368799328957, 0.0,
+  0.27272663682537424, 0.0, 0.16066903834294061, 0.0,
+  0.032418768187492022, 0.0, -0.10093000504029694, 0.0,
+  0.17106677643003559, 0.0, -0.026787907051520878, 0.0,
+  -0.03770484103029291, 0.0, 0.072072676701361221, 0.0,
+  -0.058614787382559499, 0.0, -0.0075799030586994618, 0.0,
+  -0.059353329933320341, 0.0, 0.080194273291328375, 0.0,
+  0.14491994362540239, 0.0, 0.0060666395699990909, 0.0,
+  0.27206503953159966, 0.0, 0.014763994397414205, 0.0,
+  -0.09925228054982084, 0.0, 0.076726257486692567, 0.0,
+  -0.070862053971269448, 0.0, 0.01857151244590963, 0.0,
+  -0.13730268010880353, 0.0, -0.18438634986533745, 0.0,
+  -0.21862978829786478, 0.0, 0.10161968178209632, 0.0,
+  0.056826765559439135, 0.0, 0.011980306759419948, 0.0,
+  0.080016007415792983, 0.0, -0.14844820450443835, 0.0,
+  0.12158143990852595, 0.0, -0.12524545086436922, 0.0,
+  -0.029902985856977742, 0.0, 0.013949062858717984, 0.0,
+  0.176857661337771, 0.0, 0.13052156187028272, 0.0,
+  0.019490407965511301, 0.0, -0.1179417062314929, 0.0,
+  -0.1960364540052342, 0.0, -0.08552207451439163, 0.0,
+  -0.13603005941793953, 0.0, 0.074705923495571133, 0.0,
+  0.13663997510137854, 0.0, 0.073650600268775859, 0.0,
+  -0.021743531540006966, 0.0, 0.018351468611522703, 0.0,
+  -0.04993541296619379, 0.0, -0.035324395643806066, 0.0,
+  0.083526588074368371, 0.0, -0.12308793974656675, 0.0,
+  0.050758851336039662, 0.0, 0.00050674274508090899, 0.0,
+  2.0033047824037749e-05, 0.0, -0.00026122667513220951, 0.0,
+  0.00012149309505355223, 0.0, -0.0042501480556154025, 0.0,
+  -0.00060088458615290246, 0.0, -0.0016487015018887676, 0.0,
+  -0.001817117218704064, 0.0, 0.015190156924429642, 0.0,
+  -0.026888412875915067, 0.0, -0.059254406839164213, 0.0,
+  0.12803687993289589, 0.0, -0.11333721607264448, 0.0,
+  -0.066822222720759536, 0.0, -0.010785156174855568, 0.0,
+  -0.11343991676958225, 0.0, -0.055169359257201338, 0.0,
+  -0.028430392510420087, 0.0, -0.042721603172439504, 0.0,
+  0.079165372249980173, 0.0, -0.070261003042099604, 0.0,
+  -0.0086500099285563362, 0.0, -0.080026277250990166, 0.0,
+  0.10182157729584196, 0.0, -0.063460241439561818, 0.0,
+  0.0054520369275220231, 0.0, 0.42607065644363218, 0.0,
+  0.015087328045663281, 0.0, -0.12357046514116231, 0.0,
+  0.068459902460314165, 0.0, -0.14009229244175947, 0.0,
+  -0.031733043502193088, 0.0, 0.062317066447392426, 0.0,
+  0.077233536401172961, 0.0, 0.099866658557419261, 0.0,
+  0.20405270070242709, 0.0, 0.3621894753755131, 0.0,
+  -0.041299779438680989, 0.0, -0.10037971146770776, 0.0,
+  0.048940715949558719, 0.0, -0.092026976568927693, 0.0,
+  0.045143086017687017, 0.0, 0.022627528308404341, 0.0,
+  -0.02488031833023336, 0.0, -0.22599604816401583, 0.0,
+  -0.13995018619058336, 0.0, 0.04786234905789867, 0.0,
+  -0.027322600123100886, 0.0, 0.049111289705214015, 0.0,
+  0.022214172941948596, 0.0, -0.18656992301408357, 0.0,
+  0.33727674534691199, 0.0, -0.072385060020374689, 0.0,
+  -0.031270366777219824, 0.0, -0.082418587850602382, 0.0,
+  0.014724287970975558, 0.0, 0.10244378049550205, 0.0,
+  -0.0038501655667470881, 0.0, -0.075599928432447158, 0.0,
+  0.12022308821486263, 0.0, 0.19791018622400192, 0.0,
+  0.0040290359665857067, 0.0, 0.00058841554134603637, 0.0,
+  0.0003929206091239724, 0.0, 0.013119089990600996, 0.0,
+  -0.011232098661035753, 0.0, -0.00037364954890294462, 0.0,
+  -0.023206229399119281, 0.0, 0.025425987386139295, 0.0,
+  -0.024628891980891313, 0.0, -0.020317968946716568, 0.0,
+  -0.021369612170321229, 0.0, 0.1280368799328957, 0.0,
+  -0.07092955789464972, 0.0, -0.050080068047386232, 0.0,
+  0.003087911177986151, 0.0, -0.10374584204696358, 0.0,
+  0.0028635651948833519, 0.0, -0.018063485729795277, 0.0,
+  0.039055813881871182, 0.0, 0.11430044443338785, 0.0,
+  -0.079661543332642124, 0.0, -0.048393226360632445, 0.0,
+  0.10528978759369158, 0.0, 0.05940529691805084, 0.0,
+  -0.017846158988162716, 0.0, -0.030527486771608377, 0.0,
+  -0.077425709533736634, 0.0, 0.036091718189375441, 0.0,
+  -0.16492681255097896, 0.0, 0.22109875234157056, 0.0,
+  -0.0051791514231414775, 0.0, 0.056361827659325861, 0.0,
+  0.11643007484984425, 0.0, -0.033337010143834132, 0.0,
+  0.065533170958670672, 0.0, 0.19060502466694468, 0.0,
+  -0.2025287757916536, 0.0, -0.029855217274315327, 0.0,
+  -0.059782884936392361, 0.0, 0.32267516021046255, 0.0,
+  0.19944131936883264, 0.0, -0.14325441034340206, 0.0,
+  -0.014812458891149502, 0.0, 0.048928028059641575, 0.0,
+  0.12438994607353543, 0.0, 0.023148071492743429, 0.0,
+  -0.045279872788471308, 0.0, -0.16501949133807936, 0.0,
+  0.16445482176088641, 0.0, 0.065475239758760559, 0.0,
+  0.080774727293963441, 0.0, 0.0034532597472000832, 0.0,
+  -0.027921273918337753, 0.0, 0.054777888292470323, 0.0,
+  0.041724813192804182, 0.0, -0.053576624508034611, 0.0,
+  0.0094142291686665908, 0.0, -0.0087740436612620543, 0.0,
+  -0.018515365817513962, 0.0, -0.12102589346296687, 0.0,
+  0.038420591657036568, 0.0, -0.027694365870179097, 0.0,
+  -0.00011199986974229641, 0.0, 0.019043515435194978, 0.0,
+  -0.0091344318279680051, 0.0, 0.010467551850149059, 0.0,
+  -0.00016577107566022287, 0.0, 0.084338293593414881, 0.0,
+  -0.078424101944789965, 0.0, 0.080814501196832561, 0.0,
+  -0.0014090703884176096, 0.0, 0.029231521977174286, 0.0,
+  0.128036879932896, 0.0, 0.038023938279441033, 0.0,
+  0.024082195293721766, 0.0, -0.010284810795139451, 0.0,
+  -0.10302055933783076, 0.0, -0.030073848926208076, 0.0,
+  -0.0095819275240684454, 0.0, 0.040887143260559082, 0.0,
+  0.11282644724216113, 0.0, -0.076162941224372019, 0.0,
+  -0.053315275607596128, 0.0, 0.13441433834383335, 0.0,
+  0.076811341164110009, 0.0, 0.0015717311525899956, 0.0,
+  0.03059866488603271, 0.0, -0.090199337288551618, 0.0,
+  0.057130248984770149, 0.0, -0.15610812918420677, 0.0,
+  0.19975311439720655, 0.0, 0.045903660131060085, 0.0,
+  -0.010761563737508445, 0.0, -0.05517038208193107, 0.0,
+  0.041402519687283146, 0.0, -0.017958438589709923, 0.0,
+  0.24190931513483577, 0.0, -0.19352953753086957, 0.0,
+  0.043692134062796553, 0.0, 0.073892594209574072, 0.0,
+  -0.18742868610383487, 0.0, -0.14820195929850161, 0.0,
+  0.14843809563971594, 0.0, 0.046782903143277786, 0.0,
+  -0.13416883457387535, 0.0, -0.10072022724736909, 0.0,
+  0.024796377131566849, 0.0, -0.0088918488660986762, 0.0,
+  0.15138815655835861, 0.0, -0.064534803448964409, 0.0,
+  -0.052240915429706471, 0.0, 0.22718877285864089, 0.0,
+  0.019460689722596767, 0.0, 0.094708798988187654, 0.0,
+  -0.023823819083898638, 0.0, 0.062902719819311032, 0.0,
+  0.012684131123904138, 0.0, -0.020818206642719144, 0.0,
+  0.0093188651495629479, 0.0, 0.098008499180366637, 0.0,
+  0.31582272591855787, 0.0, -0.022894945387451481, 0.0,
+  -0.0059991776216894669, 0.0, -0.0001876790605971671, 0.0,
+  -0.13428677625701615, 0.0, 0.037249812372976449, 0.0,
+  0.34209906247057398, 0.0, 0.048250060669858798, 0.0,
+  0.0081268209463272768, 0.0, -0.041334268061830194, 0.0,
+  0.16884195633545565, 0.0, -0.25559745441558307, 0.0,
+  -0.56886501333928929, 0.0, 0.12803687993289656, 0.0,
+  -0.33813054641734774, 0.0, -0.18429461067408881, 0.0,
+  -0.086353009903495884, 0.0, -0.091896913162270916, 0.0,
+  -0.24491723485024078, 0.0, 0.0059565781190603429, 0.0,
+  -0.039124550452335968, 0.0, -0.026937421771002314, 0.0,
+  0.007122483922431793, 0.0, -0.026500423159049311, 0.0,
+  -0.0032283703890474153, 0.0, 0.13671222725197918, 0.0,
+  -0.034422077986806361, 0.0, -0.020348525697096376, 0.0,
+  0.18788212262653012, 0.0, 0.053791571912518703, 0.0,
+  -0.069996438826476146, 0.0, 0.038027846196099439, 0.0,
+  -0.045370219418775073, 0.0, 0.039818126964462568, 0.0,
+  -0.074943651973621322, 0.0, 0.015241665934105303, 0.0,
+  -0.021699504902357874, 0.0, -0.054433028134075835, 0.0,
+  0.11338734682332917, 0.0, 0.082207281373131214, 0.0,
+  0.18811221285245469, 0.0, -0.14717327876781278, 0.0,
+  -0.051370982275653822, 0.0, 0.016894536751903423, 0.0,
+  -0.021563875808105926, 0.0, 0.023880044439095045, 0.0,
+  0.42179573538679405, 0.0, 0.3009755307399431, 0.0,
+  -0.050818388137924213, 0.0, 0.096298910010708033, 0.0,
+  -0.14692391550800019, 0.0, -0.028393769024119976, 0.0,
+  -0.11245849477080472, 0.0, -0.081776518080391991, 0.0,
+  0.067032039658172046, 0.0, 0.057834293446871077, 0.0,
+  0.0038196140683945186, 0.0, 0.024943555709497241, 0.0,
+  -0.084606493815710795, 0.0, 0.038300616034004899, 0.0,
+  0.094736821900459012, 0.0, -0.12792329784552806, 0.0,
+  -0.14070643957212237, 0.0, -0.013995801803975472, 0.0,
+  0.00031260753655322406, 0.0, -0.031285159748554746, 0.0,
+  -0.0060729574211566412, 0.0, -0.10547461866586273, 0.0,
+  -0.034878124431206671, 0.0, 0.024345388096131335, 0.0,
+  0.022191590000807445, 0.0, -0.14088635414207953, 0.0,
+  0.12965160585548752, 0.0, 0.25558885887293986, 0.0,
+  0.12803687993289578, 0.0, 0.27999596356305856, 0.0,
+  0.095760801055770298, 0.0, -0.13144538716871326, 0.0,
+  -0.087683570568876879, 0.0, -0.2882717497131867, 0.0,
+  0.0092808100483104394, 0.0, -0.030774274854141175, 0.0,
+  -0.023125136045123579, 0.0, 0.010379751051188759, 0.0,
+  -0.034944507245892709, 0.0, 0.013582835395977278, 0.0,
+  0.17278408037363327, 0.0, -0.067312059219276327, 0.0,
+  -0.033228454567322339, 0.0, 0.20383642228796675, 0.0,
+  0.067723018462482867, 0.0, -0.055565054841192091, 0.0,
+  -0.0028957006980284343, 0.0, -0.036384061849269532, 0.0,
+  -0.0056241796443573331, 0.0, 0.11260026160877554, 0.0,
+  0.195574487855289, 0.0, 0.3397737576920814, 0.0,
+  -0.078319393559470721, 0.0, 0.3244790471055139, 0.0,
+  0.0031089183411446251, 0.0, 0.18182188457997983, 0.0,
+  0.098001401011210978, 0.0, 0.16537670310123659, 0.0,
+  0.15916725460370479, 0.0, -0.081623680975310878, 0.0,
+  0.044691759173037887, 0.0, 0.23783409659058719, 0.0,
+  0.061825723946935016, 0.0, -0.17898212728248938, 0.0,
+  0.40821541173121279, 0.0, 0.27791466182106567, 0.0,
+  -0.076901318147769765, 0.0, 0.036781317424033601, 0.0,
+  -0.060148231904568715, 0.0, 0.038306972758318576, 0.0,
+  -0.12482861813621397, 0.0, 0.065914018774627992, 0.0,
+  -0.066892562115641194, 0.0, -0.034873791466146851, 0.0,
+  0.014967294907519938, 0.0, 0.0028174347619129873, 0.0,
+  -0.039630761473826728, 0.0, -0.32868851672456134, 0.0,
+  -0.059789609385914634, 0.0, 0.0080207284828211316, 0.0,
+  -0.027808929027140321, 0.0, -0.25841762715438493, 0.0,
+  0.035115584741033053, 0.0, 0.0014392990440687617, 0.0,
+  0.097223393805668051, 0.0, -0.089628344670468554, 0.0,
+  0.077132312682647905, 0.0, -0.011870107493928859, 0.0,
+  0.032233412214805419, 0.0, 0.12803687993289628, 0.0,
+  0.023108680327886606, 0.0, 0.010073805967057673, 0.0,
+  -0.0055270318532293422, 0.0, -0.10180620148444215, 0.0,
+  -0.0040300942889623156, 0.0, 0.0096122047137429303, 0.0,
+  0.033452055659946835, 0.0, 0.10406927200927248, 0.0,
+  -0.062257961424454784, 0.0, -0.062721846855451083, 0.0,
+  0.30703350100636467, 0.0, 0.10232234170116095, 0.0,
+  0.023161894416353256, 0.0, 0.034518336798701893, 0.0,
+  -0.050703664937397475, 0.0, -0.066562874625724883, 0.0,
+  -0.12202007509652839, 0.0, -0.18227647309964745, 0.0,
+  0.14413035129271648, 0.0, 0.10981376518753641, 0.0,
+  -0.010464398178851579, 0.0, 0.016085841166410535, 0.0,
+  -0.028050894847327337, 0.0, 0.057053501964661274, 0.0,
+  -0.14307069752981658, 0.0, -0.028017956647496942, 0.0,
+  -0.034251986751332002, 0.0, -0.19451513859776556, 0.0,
+  -0.14800570685873166, 0.0, -0.015559225353300994, 0.0,
+  -0.10021503303973112, 0.0, 0.40737805415805889, 0.0,
+  0.022175612145035849, 0.0, -0.18407412050541452, 0.0,
+  0.18340949982878707, 0.0, 0.37007204201944188, 0.0,
+  -0.15418779969996693, 0.0, -0.14609379500490816, 0.0,
+  -0.099894938053930557, 0.0, 0.030306189942717551, 0.0,
+  -0.32949235997314069, 0.0, 0.16238302746894592, 0.0,
+  0.1038517270963778, 0.0, -0.10154192065567916, 0.0,
+  0.073005916595127923, 0.0, 0.013424863596254199, 0.0,
+  -0.39831581425343238, 0.0, -0.31656901783427804, 0.0,
+  0.11416047443718906, 0.0, 0.5486207347985097, 0.0,
+  -0.0018141762857224832, 0.0, 0.091260526018486832, 0.0,
+  0.077317920726565251, 0.0, 0.040230067140823819, 0.0,
+  0.0067754264066304326, 0.0, -0.61883929936990623, 0.0,
+  0.52318298841290345, 0.0, -0.38550244995534005, 0.0,
+  0.030727737294355566, 0.0, -0.11350632561255471, 0.0,
+  0.12803687993289567, 0.0, -0.030652415110261119, 0.0,
+  -0.0072764717272543484, 0.0, 0.017443077980694423, 0.0,
+  -0.085956477908712053, 0.0, 0.012795042086202774, 0.0,
+  0.018812516666469811, 0.0, 0.026119844872150133, 0.0,
+  0.079981782928579714, 0.0, -0.041554123521448036, 0.0,
+  -0.046287365435766878, 0.0, 0.21231639487593254, 0.0,
+  0.083317001725472142, 0.0, -0.0011363746673789404, 0.0,
+  -0.063291231809161144, 0.0, -0.03213329691119475, 0.0,
+  -0.011403386364680678, 0.0, -0.054922517328487262, 0.0,
+  -0.088910924889547299, 0.0, 0.089299674143573704, 0.0,
+  -0.00044576794345184124, 0.0, -0.034534499715961134, 0.0,
+  -0.0099380232308607479, 0.0, -0.031958894668235253, 0.0,
+  0.036100275981345992, 0.0, -0.018663529641837928, 0.0,
+  -0.019781036673239955, 0.0, -0.044719908251319038, 0.0,
+  -0.22617332532418027, 0.0, -0.10644316422511192, 0.0,
+  0.017806028924651142, 0.0, -0.075457389100302655, 0.0,
+  0.13431010937643126, 0.0, -0.038355321043475284, 0.0,
+  -0.070386204664485447, 0.0, 0.023841443457847521, 0.0,
+  0.10273774126665412, 0.0, -0.031766573884751861, 0.0,
+  -0.029188359401556365, 0.0, 0.059279953519909258, 0.0,
+  -0.00033269660744857126, 0.0, 0.030628364236445188, 0.0,
+  -0.021992484943213264, 0.0, 0.024024619611995736, 0.0,
+  0.019958636494320645, 0.0, -0.0090057458090207938, 0.0,
+  0.0017606129691610112, 0.0, 0.037136720289049595, 0.0,
+  0.13181418522312841, 0.0, -0.041963596969925084, 0.0,
+  3.11546021123032e-05, 0.0, 0.0041131098498633969, 0.0,
+  0.001908102569602495, 0.0, 7.1439009466575085e-05, 0.0,
+  -0.0023606564525154765, 0.0, -0.0011766130623629353, 0.0,
+  -0.012032082088855351, 0.0, -0.010781963009594425, 0.0,
+  0.05705374373633143, 0.0, 0.24494116420945539, 0.0,
+  -0.10219492211176766, 0.0, 0.12803687993289622, 0.0,
+  0.012811934187924949, 0.0, 0.017129842063382549, 0.0,
+  -0.096876145495749993, 0.0, 0.14482992106048631, 0.0,
+  0.017529585021806911, 0.0, -0.037926310010517418, 0.0,
+  0.092845554524517676, 0.0, -0.10561012190921418, 0.0,
+  -0.024258505794932911, 0.0, -0.02097299146531717, 0.0,
+  -0.07528039196044653, 0.0, 0.049360102923894388, 0.0,
+  0.074836174062371003, 0.0, -0.020399110111300189, 0.0,
+  -0.076832748247740904, 0.0, -0.25635823640793437, 0.0,
+  -0.047413857442093692, 0.0, -0.024358964130460507, 0.0,
+  -0.033132992173143028, 0.0, -0.01460069877074347, 0.0,
+  0.27683693417947325, 0.0, 0.13591320531278708, 0.0,
+  -0.077358308486257188, 0.0, 0.20353224498013731, 0.0,
+  -0.019416189298847589, 0.0, 0.04036891295548662, 0.0,
+  0.063223618774312568, 0.0, -0.10679243360851556, 0.0,
+  -0.048243688203838661, 0.0, -0.46799713276561739, 0.0,
+  0.1445249361278246, 0.0, -0.030157992600516197, 0.0,
+  -0.067067400377880282, 0.0, 0.010084352437566328, 0.0,
+  -0.065349677649423857, 0.0, 0.08655389604832868, 0.0,
+  0.094760744054964832, 0.0, -0.16350584297969134, 0.0,
+  -0.22394154418535975, 0.0, -0.14356330906500242, 0.0,
+  -0.20231873540118964, 0.0, -0.14290619045761391, 0.0,
+  0.033684363043171128, 0.0, 0.04003827736572884, 0.0,
+  0.025789677854545542, 0.0, -0.0064056486150928706, 0.0,
+  0.16932447954516736, 0.0, 0.034410565864366305, 0.0,
+  -0.041031145159404619, 0.0, 0.0002073014536535994, 0.0,
+  0.00064475445487289736, 0.0, 0.0087390624522860807, 0.0,
+  -0.00018787414321342735, 0.0, 0.010917726582064299, 0.0,
+  -0.019093570105497334, 0.0, 0.062314998542284561, 0.0,
+  0.019985123528557053, 0.0, -0.097039864937291082, 0.0,
+  -0.050173187608578751, 0.0, 0.0054165473767494015, 0.0,
+  0.12803687993289575, 0.0, -0.24252893077894352, 0.0,
+  0.54284819988838029, 0.0, -0.34772236363045028, 0.0,
+  0.14039483007921774, 0.0, 0.12880049624494705, 0.0,
+  -0.03271096008833313, 0.0, 0.091882441488978603, 0.0,
+  -0.10214528888091588, 0.0, -0.019254976669438102, 0.0,
+  -0.018236517802313369, 0.0, -0.064802899789864754, 0.0,
+  0.036947926638113984, 0.0, -0.083541031070745592, 0.0,
+  0.041631728130728081, 0.0, -0.061190542446169498, 0.0,
+  -0.20880810258160379, 0.0, -0.0047771223831129207, 0.0,
+  -0.047404939098770006, 0.0, -0.010992312291746627, 0.0,
+  -0.078901732671523561, 0.0, 0.054845592735713718, 0.0,
+  -0.030600443601046422, 0.0, 0.016494073096841085, 0.0,
+  0.2446061720684253, 0.0, 0.13829474890528465, 0.0,
+  0.0088156072061106316, 0.0, -0.011260585214175308, 0.0,
+  0.01245412714387174, 0.0, -0.0029057694658698482, 0.0,
+  0.17983718304120638, 0.0, -0.041191175618727385, 0.0,
+  0.041233840518771873, 0.0, -0.0066313546903376914, 0.0,
+  0.075849356824005468, 0.0, 0.045446469246192014, 0.0,
+  -0.012062982978048522, 0.0, -0.025458147288419004, 0.0,
+  0.14634148698750116, 0.0, 0.085428260538950709, 0.0,
+  -0.16378596017365171, 0.0, 0.17128599595824329, 0.0,
+  0.11435204340746037, 0.0, -0.03987385476576645, 0.0,
+  -0.028503677603680819, 0.0, -0.033510859135786025, 0.0,
+  -0.00069494127704770772, 0.0, -0.12049286827176664, 0.0,
+  -0.029125936935526602, 0.0, 0.044851448854029238, 0.0,
+  9.1792612771911054e-06, 0.0, -0.01106719332486774, 0.0,
+  0.0025734123560611443, 0.0, -0.0009074534105358821, 0.0,
+  0.010451295041959916, 0.0, -0.0081243855038580868, 0.0,
+  0.054082954390645012, 0.0, 0.029287578039187929, 0.0,
+  -0.19264918025281128, 0.0, -0.66588896987639423, 0.0,
+  0.28464961763951657, 0.0, 0.12803687993289598, 0.0,
+  -0.085082246946492648, 0.0, -0.028774651521113685, 0.0,
+  0.18113445188592653, 0.0, 0.12907013670988654, 0.0,
+  -0.053332989588755243, 0.0, -0.032471365750989425, 0.0,
+  0.10084280710483294, 0.0, -0.096395418950123754, 0.0,
+  -0.027054132242059194, 0.0, -0.024805811718407803, 0.0,
+  -0.065095336231476064, 0.0, 0.041956374898636309, 0.0,
+  -0.069069044217380873, 0.0, 0.0112636392732223, 0.0,
+  -0.074557273227866094, 0.0, -0.21820248737861736, 0.0,
+  -0.023306414902587631, 0.0, 0.0016101897494764481, 0.0,
+  -0.020260713027875622, 0.0, 0.013519991112423272, 0.0,
+  -0.44942608430010772, 0.0, -0.13904794541646068, 0.0,
+  0.21967293496954568, 0.0, 0.164100811799196, 0.0,
+  -0.034658330583010363, 0.0, -0.0019561806981917514, 0.0,
+  0.10321967253398528, 0.0, -0.036176007880447572, 0.0,
+  -0.0056218529501477653, 0.0, -0.27429742970224263, 0.0,
+  0.088022969051875663, 0.0, -0.042809572133737615, 0.0,
+  0.0068920783227532636, 0.0, -0.16443184841547553, 0.0,
+  -0.07469468341757915, 0.0, 0.033612236831344802, 0.0,
+  0.047408706114147499, 0.0, -0.054008855561869948, 0.0,
+  -0.23548682506931873, 0.0, -0.12383439641233238, 0.0,
+  -0.12379673419916419, 0.0, -0.15557370236631082, 0.0,
+  0.06363752881813628, 0.0, 0.025668632332938961, 0.0,
+  0.10596433009899267, 0.0, 0.015326045125047365, 0.0,
+  0.12652611940172614, 0.0, 0.015949768567131442, 0.0,
+  -0.037535113626175509, 0.0, -0.0004082708688600782, 0.0,
+  -0.00039005038266950407, 0.0, -0.017600956870148451, 0.0,
+  0.00034096781547945113, 0.0, -0.017799574055088831, 0.0,
+  0.030314331118186929, 0.0, -0.058603765821146299, 0.0,
+  -0.0017082826536355283, 0.0, 0.11064618801490908, 0.0,
+  0.059771951315215267, 0.0, -0.013946103168417734, 0.0,
+  0.12803687993289578, 0.0, 0.1762259802075116, 0.0,
+  -0.35328970465571907, 0.0, 0.22781914900770001, 0.0,
+  0.1327573699088356, 0.0, -0.076583158535556375, 0.0,
+  -0.02822172483160143, 0.0, 0.10068269067828761, 0.0,
+  -0.099009639240190184, 0.0, -0.020509806814282903, 0.0,
+  -0.021347688651987093, 0.0, -0.069854802179928871, 0.0,
+  0.03619624682162461, 0.0, 0.043578238422409266, 0.0,
+  -0.015845891221038667, 0.0, -0.084302728503928018, 0.0,
+  -0.19960957538759005, 0.0, 0.023877011481917121, 0.0,
+  -0.046184972415288968, 0.0, 0.012435476981453468, 0.0,
+  -0.11627840110250426, 0.0, -0.028703536968151144, 0.0,
+  -0.033839512692185054, 0.0, -0.064779602703152361, 0.0,
+  0.35889927030252694, 0.0, 0.13249803725046277, 0.0,
+  -0.033470461037074878, 0.0, -0.085000980470339826, 0.0,
+  0.079048805416023632, 0.0, 0.04582001151414742, 0.0,
+  0.32870032816241607, 0.0, -0.10161244029669474, 0.0,
+  0.019704107511640298, 0.0, 0.023251825058748381, 0.0,
+  0.036533121711171013, 0.0, 0.040189411937771605, 0.0,
+  -0.019128597879338148, 0.0, -0.046632596571636903, 0.0,
+  0.082844571634146422, 0.0, -0.06969761831592701, 0.0,
+  -0.2589564443889506, 0.0, 0.085102554899766369, 0.0,
+  0.019851569536155574, 0.0, 0.0054890656949365159, 0.0,
+  -0.0025631613410550631, 0.0, -0.0052073870270207588, 0.0,
+  0.0014021879047068861, 0.0, -0.064858778845052131, 0.0,
+  -0.0082604767646645618, 0.0, 0.026340060892980518, 0.0,
+  -0.00032642534533531154, 0.0, -0.00011021127502191885, 0.0,
+  -0.013180263342066945, 0.0, 0.0013815936466608221, 0.0,
+  0.010636871617842788, 0.0, 0.005809452141177552, 0.0,
+  0.0077479994041169328, 0.0, -0.0005672962383784047, 0.0,
+  -0.027547273397876357, 0.0, -0.088492272190344487, 0.0,
+  -0.05577995740061447, 0.0, 0.12803687993289595, 0.0,
+  0.1605963797104418, 0.0, 0.067915036276259333, 0.0,
+  0.076032432388059512, 0.0, -0.044086078919815856, 0.0,
+  0.03758222059443872, 0.0, -0.00064122649604324408, 0.0,
+  0.03430209614640177, 0.0, -0.064574648529634487, 0.0,
+  0.069250008922414674, 0.0, -0.003466318432699067, 0.0,
+  -0.13973387680446253, 0.0, 0.16382103690603142, 0.0,
+  -0.40920733059549269, 0.0, 0.082207579917489601, 0.0,
+  -0.17298879380655657, 0.0, 0.061248535983233467, 0.0,
+  0.14706841203928694, 0.0, -0.13809082275797918, 0.0,
+  -0.064463879343172256, 0.0, 0.025808676642400663, 0.0,
+  0.066495111917933947, 0.0, 0.04452761621332977, 0.0,
+  -0.19663136273303036, 0.0, 0.11152595164859057, 0.0,
+  -0.21683785532782221, 0.0, -0.0017486667330562512, 0.0,
+  -0.15580697249792846, 0.0, 0.064971028407728074, 0.0,
+  0.046226615812959858, 0.0, 0.049999973799406038, 0.0,
+  0.036089152609716596, 0.0, -0.0065049717323478759, 0.0,
+  0.016695144972154959, 0.0, 0.032822579609451959, 0.0,
+  0.022594654076723758, 0.0, 0.24399839074451157, 0.0,
+  0.02880442121053399, 0.0, 0.15711993704486302, 0.0,
+  -0.097433771536387381, 0.0, 0.35932835587558642, 0.0,
+  -0.012850851702726814, 0.0, 0.064957195391210171, 0.0,
+  -0.14150053757673081, 0.0, -0.0069292683526609462, 0.0,
+  -0.04637348212279619, 0.0, 0.0089672835297240419, 0.0,
+  0.2040790775895974, 0.0, -0.080448265880760955, 0.0,
+  -0.094795433720963176, 0.0, -0.0012139467581623734, 0.0,
+  -0.00032125675920397493, 0.0, -0.049780382915560611, 0.0,
+  0.00058558310570608655, 0.0, -0.049426426185637168, 0.0,
+  0.10408524745771595, 0.0, -0.084838211548261766, 0.0,
+  0.017948148492509409, 0.0, 0.13683664874837451, 0.0,
+  -0.034502485387027687, 0.0, 0.043293139700493727, 0.0,
+  0.12803687993289625, 0.0, 0.026377844984793671, 0.0,
+  0.0035811756492089794, 0.0, 0.066308769469158368, 0.0,
+  -0.045902251465135283, 0.0, 0.037947945319583731, 0.0,
+  0.0028051484358032875, 0.0, 0.029570408523904811, 0.0,
+  -0.058159742168351632, 0.0, 0.062797650591124327, 0.0,
+  0.0009503837069431059, 0.0, -0.11754289120573554, 0.0,
+  0.1172425947388897, 0.0, -0.050105103140215157, 0.0,
+  -0.0012732112934112443, 0.0, -0.13529375864930795, 0.0,
+  0.045583782509606943, 0.0, 0.12399294217763661, 0.0,
+  -0.12603941606085192, 0.0, -0.018610848663952097, 0.0,
+  -0.033537905922225317, 0.0, 0.10429875690362768, 0.0,
+  0.038519718405441522, 0.0, 0.1906623978706245, 0.0,
+  0.10567163630747531, 0.0, -0.027468027846617921, 0.0,
+  0.080046859829963998, 0.0, 0.13068993699482381, 0.0,
+  -0.11519893745143564, 0.0, -0.10861279063563926, 0.0,
+  -0.051029026856019837, 0.0, 0.014549658238395557, 0.0,
+  0.031866237465422748, 0.0, 0.070684782042548661, 0.0,
+  0.026355056696710476, 0.0, -0.021717261146112676, 0.0,
+  -0.31122430504061449, 0.0, -0.038277288868461788, 0.0,
+  -0.19052099348795898, 0.0, 0.15955151606263177, 0.0,
+  0.20438115834094517, 0.0, 0.066966708313371551, 0.0,
+  -0.078363689812391515, 0.0, 0.020701976848422031, 0.0,
+  -0.032188435237317098, 0.0, -0.0018358697993478435, 0.0,
+  0.0012708304875206696, 0.0, -0.21684147723501351, 0.0,
+  -0.020216086331290975, 0.0, -0.047773699021041678, 0.0,
+  -0.00050041520769467964, 0.0, 1.4931396850150262e-05, 0.0,
+  -0.020327621179040172, 0.0, 0.00020980429126359621, 0.0,
+  -0.021066284482741168, 0.0, 0.030887230769331607, 0.0,
+  -0.051328023822893497, 0.0, 0.017373524937941191, 0.0,
+  0.1160109051001231, 0.0, 0.11731189884314996, 0.0,
+  0.071632081744352677, 0.0, 0.12803687993289567, 0.0,
+  -0.21698269899556599, 0.0, -0.036401751904839477, 0.0,
+  -0.19093057750874048, 0.0, -0.051925687140698763, 0.0,
+  -0.083557978103752428, 0.0, 0.00062508872290638145, 0.0,
+  0.037319693061622292, 0.0, -0.05631234286151135, 0.0,
+  0.064457418910740985, 0.0, -0.0011388187295121033, 0.0,
+  -0.12486872238338335, 0.0, 0.13344821758952802, 0.0,
+  0.61987331714962024, 0.0, -0.098638735327720869, 0.0,
+  -0.18692205481486235, 0.0, 0.06458260799009545, 0.0,
+  0.13536253139721677, 0.0, -0.10247415182194013, 0.0,
+  -0.058726280474186113, 0.0, 0.029301644400758272, 0.0,
+  -0.17004074721794865, 0.0, -0.15975831986073857, 0.0,
+  0.10495214786081115, 0.0, 0.065822145113529906, 0.0,
+  -0.16922522200429227, 0.0, -0.081695147295626713, 0.0,
+  0.066381182162277869, 0.0, 0.039279255690279874, 0.0,
+  0.076764892599138185, 0.0, 0.094370743719649305, 0.0,
+  -0.060827531051317482, 0.0, -0.018617812164852129, 0.0,
+  -0.066354989244118714, 0.0, -0.068283157523393215, 0.0,
+  0.0074221411462903706, 0.0, 0.15227633490484097, 0.0,
+  0.064973305753852836, 0.0, 0.16760412147098849, 0.0,
+  -0.10874501242573648, 0.0, 0.28075670365216776, 0.0,
+  -0.01594682338973415, 0.0, 0.08493547843785193, 0.0,
+  -0.094271400184802678, 0.0, -0.014568494524986597, 0.0,
+  -0.0084146557278065009, 0.0, 0.0026080348513389468, 0.0,
+  0.14336631681119985, 0.0, -0.037962130876684833, 0.0,
+  -0.043148294708414213, 0.0, 0.009365758727665506, 0.0,
+  0.00096814189636411135, 0.0, 0.25540032533461526, 0.0,
+  -0.0034988976959708486, 0.0, 0.2069422590267527, 0.0,
+  -0.33639613114656347, 0.0, 0.26427937128044904, 0.0,
+  -0.084602090079491668, 0.0, -0.42527560247556856, 0.0,
+  0.12363255618226811, 0.0, -0.09123359635533014, 0.0,
+  0.12803687993289559, 0.0, -0.01752718551073347, 0.0,
+  -0.15207859459647388, 0.0, 0.034482323290697177, 0.0,
+  -0.047764962661000623, 0.0, -0.044831979646833491, 0.0,
+  0.0032624292361317056, 0.0, 0.034701942482195026, 0.0,
+  -0.02974641425382743, 0.0, 0.045619954553231486, 0.0,
+  -0.0038312342917295595, 0.0, -0.089421396097737027, 0.0,
+  0.085446429630512286, 0.0, 0.070615140735477866, 0.0,
+  -0.054169530314411872, 0.0, -0.13379716215161402, 0.0,
+  0.048637392133338751, 0.0, 0.092135863678498353, 0.0,
+  -0.067332935594968682, 0.0, -0.0078201457664133691, 0.0,
+  -0.035922538589666195, 0.0, -0.067695356456174055, 0.0,
+  0.087714417718848442, 0.0, -0.026763129458423907, 0.0,
+  0.046491969062965072, 0.0, 0.024260664051487166, 0.0,
+  0.00030521614677450387, 0.0, -0.0038213781625130103, 0.0,
+  0.0293931924666174, 0.0, -0.0033569164009112566, 0.0,
+  -0.047379204223540347, 0.0, -0.05951309982340134, 0.0,
+  -0.0083110465872557101, 0.0, 0.0012656280087642003, 0.0,
+  -0.0054302461610829496, 0.0, 0.013797061312534121, 0.0,
+  -0.11999064384644162, 0.0, -0.090012645334777111, 0.0,
+  -0.11186171139574184, 0.0, 0.080132260194027971, 0.0,
+  0.087588999868292619, 0.0, 0.026432174000037594, 0.0,
+  -0.040961044366531731, 0.0, 0.051945286787010936, 0.0,
+  0.015463606043724468, 0.0, 0.00026557439884620262, 0.0,
+  0.002559999977575546, 0.0, -0.11832394447921565, 0.0,
+  0.024343493104506796, 0.0, -0.027102388397437432, 0.0,
+  1.2942126931512434e-05, 0.0, -3.0743412040992147e-05, 0.0,
+  0.0012743370899684935, 0.0, -5.6663145415550819e-05, 0.0,
+  -0.0022597793076025124, 0.0, 3.8316190756163077e-06, 0.0,
+  -0.00078098031737978155, 0.0, -0.00029317189723232717, 0.0,
+  0.0065913188027692388, 0.0, -0.010160112400673663, 0.0,
+  -0.017587776508217971, 0.0, 0.12803687993289545, 0.0,
+  -0.046345335478136525, 0.0, -0.024939304717401245, 0.0,
+  -0.0052194688907449107, 0.0, -0.15785398474425608, 0.0,
+  -0.034095141893297508, 0.0, -0.030133159532885364, 0.0,
+  -0.024193557529499761, 0.0, 0.071137914837281199, 0.0,
+  -0.12986719449790537, 0.0, 0.014732519949829954, 0.0,
+  -0.24216417146617211, 0.0, -0.1861724048594933, 0.0,
+  -0.019358266046493312, 0.0, 0.0072718360334748109, 0.0,
+  0.18021017313785531, 0.0, -0.023434367991152293, 0.0,
+  -0.086153356644696408, 0.0, -0.16614810810126932, 0.0,
+  0.16152699612550764, 0.0, 0.053315798645787456, 0.0,
+  0.022069447922557391, 0.0, 0.083027083616551894, 0.0,
+  0.064556180092186319, 0.0, -0.010462300772226305, 0.0,
+  -0.20756898842444435, 0.0, -0.0068167240139248939, 0.0,
+  0.0036591386525101004, 0.0, 0.084205175135349863, 0.0,
+  -0.011452810498090781, 0.0, 0.040724740914359639, 0.0,
+  0.0099741906217086385, 0.0, 0.010509125733958197, 0.0,
+  -0.14184428677137384, 0.0, -0.12695545793402727, 0.0,
+  0.13262490597755869, 0.0, 0.024828700875409473, 0.0,
+  0.011130695669179789, 0.0, -0.21659404187417361, 0.0,
+  0.028632835563850004, 0.0, -0.12704465949254101, 0.0,
+  0.24936275523849585, 0.0, 0.052205745462559294, 0.0,
+  -0.039422735401978229, 0.0, 0.064805299268562086, 0.0,
+  -0.04367392525794863, 0.0, -0.058977201304202469, 0.0,
+  0.1127482639948888, 0.0, -0.14687085867922572, 0.0,
+  -0.0781053798253699, 0.0, 0.00014644258964854209, 0.0,
+  2.0090363006072361e-05, 0.0, 0.0019969317000430413, 0.0,
+  -0.0001212856639852809, 0.0, 0.002873446423570123, 0.0,
+  -0.0049589241136947211, 0.0, 0.0086210322254551882, 0.0,
+  -0.0042005063575516208, 0.0, -0.013840566291284212, 0.0,
+  0.008363154516441932, 0.0, 0.0053053432100754168, 0.0,
+  0.12803687993289586, 0.0, 0.023408173219522748, 0.0,
+  0.0022737925204638402, 0.0, -0.0024656243154951548, 0.0,
+  -0.1540005710197134, 0.0, 0.012101145323888904, 0.0,
+  -0.025791647430406763, 0.0, -0.023670161685883807, 0.0,
+  0.057291002514791599, 0.0, -0.11727624813826386, 0.0,
+  0.019729501355102142, 0.0, -0.22762488969841252, 0.0,
+  -0.17977634610638979, 0.0, 0.008821199748283097, 0.0,
+  -0.028390446313063641, 0.0, 0.16349642556316796, 0.0,
+  -0.029041523272402413, 0.0, -0.037875500901711601, 0.0,
+  -0.18807899475933729, 0.0, 0.13257672467005782, 0.0,
+  0.0065128850843421014, 0.0, -0.0082719752771243053, 0.0,
+  -0.10611595252108837, 0.0, -0.038374539797322298, 0.0,
+  0.0041235791021317931, 0.0, -0.12596726053590182, 0.0,
+  0.00759841735910953, 0.0, -0.026714478289440048, 0.0,
+  -0.10446315787142992, 0.0, 0.018446271294252768, 0.0,
+  -0.012991355649630722, 0.0, -0.017717579730479213, 0.0,
+  -0.025323289847715161, 0.0, 0.13507208488054726, 0.0,
+  0.12752919622159034, 0.0, -0.1919280003886108, 0.0,
+  0.011451801975919055, 0.0, 0.076469281575782852, 0.0,
+  0.29636553664984061, 0.0, 0.1538900520798514, 0.0,
+  -0.044486283584085677, 0.0, -0.32870000632199387, 0.0,
+  -0.12321925542054685, 0.0, -0.055766391248896589, 0.0,
+  0.002262243702117148, 0.0, 0.060042691351998079, 0.0,
+  0.074845473870472926, 0.0, -0.16152961397939594, 0.0,
+  0.16676685217755477, 0.0, 0.025400954414796083, 0.0,
+  0.0001828702948105341, 0.0, 0.0007343385253178481, 0.0,
+  0.0034188485411917593, 0.0, -0.00013284007069324288, 0.0,
+  0.0042202771291054205, 0.0, -0.0067913807408423532, 0.0,
+  0.017051851232701094, 0.0, -0.010044360017768149, 0.0,
+  -0.019535699691093592, 0.0, 0.012974022478113073, 0.0,
+  -0.0078793550843535981, 0.0, 0.12803687993289559, 0.0,
+  0.023798361828891338, 0.0, -0.013963279472147563, 0.0,
+  0.008666168018100686, 0.0, -0.13689521575549024, 0.0,
+  0.0012781166923972805, 0.0, -0.021412517138935709, 0.0,
+  0.038423921668827812, 0.0, 0.083629045864018453, 0.0,
+  -0.098392200932011786, 0.0, -0.013207868891082671, 0.0,
+  -0.097742857389219728, 0.0, -0.1582563148577748, 0.0,
+  -0.05295248585043117, 0.0, -0.0459680496658849, 0.0,
+  -0.28141117011814243, 0.0, 0.024259751810370229, 0.0,
+  0.019526801220885574, 0.0, 0.093881587903466221, 0.0,
+  -0.015905583007985002, 0.0, 0.01944811622236365, 0.0,
+  0.067959059960729248, 0.0, -0.18685037481139946, 0.0,
+  0.007171740189832714, 0.0, -0.15394848730737165, 0.0,
+  0.18847244709728367, 0.0, 0.1118345853993481, 0.0,
+  -0.0006242098806907647, 0.0, -0.13796337812520659, 0.0,
+  -0.11541896646280686, 0.0, 0.075593626699214683, 0.0,
+  0.016546210289267806, 0.0, 0.00252309331552241, 0.0,
+  -0.023444630455148812, 0.0, -0.014870409314594919, 0.0,
+  -0.037629334109843454, 0.0, -0.028558582531313138, 0.0,
+  0.18879150800818179, 0.0, 0.035952659190211927, 0.0,
+  -0.17419013636988279, 0.0, 0.020803143502098897, 0.0,
+  0.037565958029198994, 0.0, 0.16580988445263678, 0.0,
+  0.20685381928749969, 0.0, -0.14275918614607838, 0.0,
+  0.0054706120634594197, 0.0, -0.013227021820345115, 0.0,
+  0.060573709797908049, 0.0, -0.042823886493390827, 0.0,
+  0.028599111218618873, 0.0, -0.0020023659197128292, 0.0,
+  -0.00038000000813320897, 0.0, -0.022152421898126527, 0.0,
+  0.00096969817677417241, 0.0, -0.021563155856497356, 0.0,
+  0.036988398688580941, 0.0, -0.057422097360497998, 0.0,
+  0.029709680219939062, 0.0, 0.074031595248851598, 0.0,
+  -0.02838137396366008, 0.0, 0.017416589444134149, 0.0,
+  0.12803687993289617, 0.0, -0.013492593787642296, 0.0,
+  0.057510669253776292, 0.0, -0.0081732534487371049, 0.0,
+  -0.12375277625830736, 0.0, 0.018674227588008911, 0.0,
+  -0.016643348727062628, 0.0, 0.035276547194632489, 0.0,
+  0.071286206465121418, 0.0, -0.078037551312721554, 0.0,
+  -0.010080540077648624, 0.0, -0.0860012840618153, 0.0,
+  -0.12636563179787688, 0.0, 0.033379705458954828, 0.0,
+  0.099736378885004084, 0.0, -0.23471058744148701, 0.0,
+  0.022066933322649619, 0.0, 0.050703698027323642, 0.0,
+  0.033450419584700866, 0.0, -0.0091462025468496844, 0.0,
+  -0.021116924270276508, 0.0, -0.082978092371226456, 0.0,
+  0.29414169158330788, 0.0, -0.03993523405443794, 0.0,
+  -0.10908283812058538, 0.0, 0.18560504355988888, 0.0,
+  -0.16533795432619927, 0.0, 0.0037910944181452346, 0.0,
+  0.17322030837792238, 0.0, 0.12124361246895352, 0.0,
+  -0.10864545324715448, 0.0, -0.016242308691984637, 0.0,
+  0.007765051110049344, 0.0, 0.048192161587022261, 0.0,
+  0.04218319158672508, 0.0, 0.065297959492553306, 0.0,
+  0.063475541585573725, 0.0, -0.2928317070107494, 0.0,
+  -0.033064471442185557, 0.0, -0.020506835554668437, 0.0,
+  0.016807674798051498, 0.0, -0.052877234646207874, 0.0,
+  -0.0034420277775828105, 0.0, 0.087715081740725356, 0.0,
+  -0.016011696925571174, 0.0, -0.00832511896590429, 0.0,
+  0.025992347702952348, 0.0, -0.02587471293539961, 0.0,
+  0.15212210080832289, 0.0, 0.0097489986216338399, 0.0,
+  0.00015031451937367473, 0.0, -6.947032396479291e-06, 0.0,
+  0.0081344520169383469, 0.0, -0.0023195434905982216, 0.0,
+  -0.021008151495890207, 0.0, -0.0044039563658704707, 0.0,
+  -0.0016746652014187596, 0.0, 0.0064089424667333169, 0.0,
+  -0.025657561231550809, 0.0, 0.035346504846306442, 0.0,
+  0.079898857559993569, 0.0, 0.12803687993289578, 0.0,
+  0.049983397825004827, 0.0, 0.028479286026297051, 0.0,
+  0.012691841595213306, 0.0, -0.19230693312384636, 0.0,
+  0.056865952470663117, 0.0, 0.095792676626398357, 0.0,
+  -0.10007768561811421, 0.0, -0.36976555526652422, 0.0,
+  0.0048529798660299217, 0.0, 0.085220837335114874, 0.0,
+  0.098498310210492754, 0.0, -0.072342861145458751, 0.0,
+  0.084542997773421488, 0.0, -0.0095381600350612251, 0.0,
+  0.032112184237144896, 0.0, -0.0057221749380281439, 0.0,
+  -0.028840876042161824, 0.0, 0.07353353047397039, 0.0,
+  -0.011406373657398801, 0.0, 0.011505525142137363, 0.0,
+  -0.009807950542702254, 0.0, -0.046717121257633679, 0.0,
+  0.10357826014691211, 0.0, -0.013242933508801171, 0.0,
+  -0.045108079928806014, 0.0, -0.12515071793379451, 0.0,
+  -0.23587685884735893, 0.0, 0.24315960818909496, 0.0,
+  -0.59372791940612379, 0.0, -0.055951328742980602, 0.0,
+  0.087132316176832883, 0.0, -0.031139777929016243, 0.0,
+  0.20129599857123925, 0.0, 0.15620451748742775, 0.0,
+  -0.015743723442021375, 0.0, 0.020466066012511903, 0.0,
+  -0.026004109815747412, 0.0, -0.022753294361650928, 0.0,
+  -0.094794486178585394, 0.0, -0.034963093540600489, 0.0,
+  0.028425926469256922, 0.0, 0.15370092345106362, 0.0,
+  -0.027585822062658159, 0.0, 0.17091251824624129, 0.0,
+  0.019125851157895269, 0.0, 0.007688746680986412, 0.0,
+  -0.026897262302628944, 0.0, 0.033149620874752192, 0.0,
+  -0.071387951406020542, 0.0, -0.00070810495469254429, 0.0,
+  -1.5216125668302924e-05, 0.0, 0.0038400418200383916, 0.0,
+  0.00095504615286561912, 0.0, 0.0073723503521032257, 0.0,
+  -0.0048749335830228285, 0.0, -0.0021896553098539333, 0.0,
+  0.0049484837068594443, 0.0, -0.016993682231699638, 0.0,
+  -0.0021801758424541844, 0.0, -0.027403260011292584, 0.0,
+  0.12803687993289564, 0.0, -0.022408343615500169, 0.0,
+  -0.028538527761721513, 0.0, 0.021433884653065959, 0.0,
+  -0.18571382421989391, 0.0, 0.010675699582011868, 0.0,
+  0.092186807087881323, 0.0, -0.09151111352701774, 0.0,
+  -0.35051734570856385, 0.0, 0.005374545209550761, 0.0,
+  0.081744014412701321, 0.0, 0.091155374218195293, 0.0,
+  -0.067754437490329861, 0.0, 0.047430455763030066, 0.0,
+  0.19307089201661831, 0.0, 0.029480994825479015, 0.0,
+  -0.010605770568591867, 0.0, -0.0058686410660798907, 0.0,
+  0.014801324844659321, 0.0, 0.0077979152784821105, 0.0,
+  -0.022144036971680828, 0.0, 0.014798908416036091, 0.0,
+  -0.05375582248097583, 0.0, -0.018293417022533582, 0.0,
+  0.008137063741206492, 0.0, 0.05504512860274232, 0.0,
+  0.020822280332627122, 0.0, 0.019277384291978606, 0.0,
+  -0.019460688625922758, 0.0, 0.05660731138557451, 0.0,
+  0.013041416134127739, 0.0, 0.011138665160937738, 0.0,
+  -0.012339443060235102, 0.0, -0.061218654472850277, 0.0,
+  -0.035265898255034255, 0.0, 0.041941831550296481, 0.0,
+  0.041383636148080792, 0.0, -0.027741914842000868, 0.0,
+  0.018745071476239824, 0.0, 0.18936003779864494, 0.0,
+  -0.010187343438217705, 0.0, -0.005661929769704011, 0.0,
+  -0.34039111466709904, 0.0, 0.02376580172741502, 0.0,
+  -0.37715013993443763, 0.0, -0.082564150613890663, 0.0,
+  0.0021178537367589206, 0.0, 0.1647294993177271, 0.0,
+  -0.16301586372456547, 0.0, 0.18094409099328751, 0.0,
+  0.00016082423087330567, 0.0, -1.9346688658381267e-05, 0.0,
+  0.0014113108443052262, 0.0, 0.002447602781479988, 0.0,
+  0.0056378691957577644, 0.0, -0.0029356909952398132, 0.0,
+  -0.001669327668919793, 0.0, 0.0043426775371883239, 0.0,
+  -0.017096087064755607, 0.0, -0.0054437203521404721, 0.0,
+  -0.035025080791674032, 0.0, 0.12803687993289595, 0.0,
+  -0.0082011246634410475, 0.0, -0.023865813276968826, 0.0,
+  0.025923921093912894, 0.0, -0.20171130493875539, 0.0,
+  -0.01198350698037141, 0.0, 0.10490405464498076, 0.0,
+  -0.097913233241276945, 0.0, -0.39931372763250483, 0.0,
+  0.0033256154196663348, 0.0, 0.099892622033121645, 0.0,
+  0.11969929569613284, 0.0, -0.092540860117661952, 0.0,
+  -0.025119706290072718, 0.0, 0.25669521796900163, 0.0,
+  -0.020718479788546473, 0.0, -0.0093816260865269251, 0.0,
+  -0.017967201649318858, 0.0, 0.090453997224459931, 0.0,
+  -0.014038833666970832, 0.0, 0.012988867668253148, 0.0,
+  0.070102722419151636, 0.0, -0.0030658325066994147, 0.0,
+  -0.013515514315037339, 0.0, -0.016322965293371204, 0.0,
+  -0.079184682630729031, 0.0, 0.096587601223822761, 0.0,
+  0.1681168974762875, 0.0, -0.15417227842264528, 0.0,
+  0.40635338598551984, 0.0, 0.048237051618245937, 0.0,
+  -0.049682985593634196, 0.0, 0.014744174709554103, 0.0,
+  -0.13622530030147756, 0.0, -0.1058024589877806, 0.0,
+  -0.032371860131632429, 0.0, -0.072976307074667068, 0.0,
+  0.086674637197169224, 0.0, 0.019826286435255368, 0.0,
+  -0.16417230888768364, 0.0, -0.0073424469073131177, 0.0,
+  -0.036014390259453945, 0.0, 0.31374992706080251, 0.0,
+  -0.022428620664436565, 0.0, 0.33405774356257389, 0.0,
+  0.10662899314265477, 0.0, -0.020984953880553877, 0.0,
+  -0.18023158877461459, 0.0, 0.16939126047148653, 0.0,
+  -0.10348805885620255, 0.0, 0.0018593608710279958, 0.0,
+  5.6388647146542493e-05, 0.0, -0.026011591453238645, 0.0,
+  -0.004102757325333382, 0.0, -0.019943509129159712, 0.0,
+  0.031788423768882475, 0.0, 0.015105538512788085, 0.0,
+  -0.038613495272100187, 0.0, 0.13227980767637992, 0.0,
+  -0.034094089429512586, 0.0, 0.03653910070922152, 0.0,
+  0.12803687993289573, 0.0, 0.01083406116236529, 0.0,
+  0.081266908213885672, 0.0, -0.094787262876362424, 0.0,
+  -0.17872435560398969, 0.0, -0.040117314675926406, 0.0,
+  0.097259725478367892, 0.0, -0.079273117923142442, 0.0,
+  -0.32836620072143502, 0.0, 0.0029004803570329392, 0.0,
+  0.080234732531337019, 0.0, 0.10287840003917995, 0.0,
+  -0.067198440760981457, 0.0, -0.23179565663643606, 0.0,
+  -0.89376575255808699, 0.0, -0.019565688329657396, 0.0,
+  -0.008271706410780736, 0.0, -0.0030293682566960504, 0.0,
+  0.038164104385047463, 0.0, 0.0021201169942049458, 0.0,
+  -0.01214050526241608, 0.0, -0.14033621786526498, 0.0,
+  0.18881225412013508, 0.0, -0.17358404552908654, 0.0,
+  -0.001990743617444756, 0.0, 0.0052346555397227859, 0.0,
+  -0.014403867952165866, 0.0, 0.0062978044971690557, 0.0,
+  -0.05519694239484884, 0.0, 0.19374346648127833, 0.0,
+  -0.026177985800145319, 0.0, -0.052348358900870334, 0.0,
+  0.012088243568441631, 0.0, -0.11064688865572798, 0.0,
+  -0.073141419409916267, 0.0, 0.039327864600439834, 0.0,
+  -0.042667754284655336, 0.0, -0.054969218713967927, 0.0,
+  -0.017625900200297001, 0.0, 0.032010965589468504, 0.0,
+  -0.0066018584795746035, 0.0, 0.00095111179720394894, 0.0,
+  -0.037977522714272564, 0.0, 0.01217151108411323, 0.0,
+  -0.025987683492062756, 0.0, 0.00084496244720014399, 0.0,
+  -0.0066513240030114437, 0.0, -0.0011695570483522435, 0.0,
+  0.028202205359496583, 0.0, 0.048210445121897878, 0.0,
+  8.2199159620675066e-05, -0.0, 0.00014162292247486209, -0.0,
+  0.00027619411463903482, -0.0, -0.0017321268897440298, -0.0,
+  -0.0027282867489467708, -0.0, -0.0034666469018674335, -0.0,
+  0.00027125234699018044, -0.0, 0.0058355470163311577, -0.0,
+  -7.3641003918415465e-06, -0.0, 0.00037181593597738197, -0.0,
+  7.858153714580005e-06, -0.0, -0.00074753849815844197, -0.0,
+  0.0056617430255489452, -0.0, -0.00033122923382540061, -0.0,
+  -0.0049877827197656981, -0.0, -0.00016105639587889555, -0.0,
+  0.010387653387828738, -0.0, -0.00039108885121246325, -0.0,
+  -0.0021236229511667078, -0.0, -0.00014835387802673831, -0.0,
+  0.0080447302362513309, -0.0, 0.00011695278416480668, -0.0,
+  -0.0090891113389518843, -0.0, -0.0084283643751129865, -0.0,
+  0.099100510300323769, -0.0, 0.047250242375006968, -0.0,
+  0.28201540445737028, -0.0, 0.023156048274011101, -0.0,
+  -0.77732109827768303, -0.0, -0.00029974151388831495, -0.0,
+  -0.00018855476115068153, -0.0, 0.00046609760600019946, -0.0,
+  -0.0019217351034246622, -0.0, 0.014230439915386134, -0.0,
+  0.029516935507629443, -0.0, 0.0031782693147078146, -0.0,
+  -0.098572979491753018, -0.0, -0.00032966530569560071, -0.0,
+  0.0012501646612428541, -0.0, 0.014783903686503336, -0.0,
+  -0.089232979092284989, -0.0, -0.0074416214861495926, -0.0,
+  -0.019991974608077192, -0.0, -0.075847360790834067, -0.0,
+  0.54988696474391763, -0.0, 7.2577338858384853e-05, -0.0,
+  0.00048016301936844216, -0.0, 1.2238447260851877e-05, -0.0,
+  -0.0011358599061090751, -0.0, -0.00075875924460818886, -0.0,
+  -0.0042028678413966805, -0.0, -0.00097363982836659916, -0.0,
+  0.021596117540501225, -0.0, 4.4635068994109371e-05, -0.0,
+  0.00043939246548098794, -0.0, 0.00074307775536378029, -0.0,
+  -0.0078070464007319674, -0.0, 0.00030981656342786852, -0.0,
+  -0.0019903878082797679, -0.0, 0.00031070687106955004, -0.0,
+  0.0023175693475153657, -0.0, 0.0054132265489618475, 0.0,
+  -0.0056707383730424899, 0.0, -0.54221169693130378, 0.0,
+  0.14289694786673104, 0.0, -0.0016535701599082022, 0.0,
+  0.0055266462512947295, 0.0, 0.0084705196741106312, 0.0,
+  -0.011987965985943018, 0.0, -0.00025480374571238833, 0.0,
+  1.7741450596047943e-05, 0.0, -3.2389565155393571e-05, 0.0,
+  -0.0001207664075500894, 0.0, -0.0027769718404748378, 0.0,
+  -0.31762430409230202, 0.0, -0.020207464588263054, 0.0,
+  0.82380592826802834, 0.0, -0.06039465534857158, 0.0,
+  0.0023743852448638077, 0.0, 0.00010064161548783995, 0.0,
+  -0.0045049420420554811, 0.0, 0.00022517229471918652, 0.0,
+  0.0026776498387284893, 0.0, 6.930548032376526e-05, 0.0,
+  -0.042115163635150291, 0.0, 0.0069502828835456701, 0.0,
+  0.0090707329625540224, 0.0, 0.002752596521625746, 0.0,
+  -0.020860306475331419, 0.0, -0.0023994544200291682, 0.0,
+  0.012142655629465194, 0.0, -0.00030649466058405727, 0.0,
+  0.009892955123372028, 0.0, -0.007879219811436378, 0.0,
+  -0.00063986096918152422, 0.0, -0.003453096044357732, 0.0,
+  -0.0010663360027847023, 0.0, 0.0063977631766778485, 0.0,
+  -0.00019039569425162461, 0.0, 4.686797465082789e-05, 0.0,
+  0.0020474890838816035, 0.0, -0.00034221651512769587, 0.0,
+  -0.0002207705585220568, 0.0, 0.00042345457728460909, 0.0,
+  0.0096489054810325429, 0.0, -0.0017243688653829656, 0.0,
+  0.0090865416048067013, 0.0, 0.001416218270660343, 0.0,
+  -0.013992830235929994, 0.0, -0.0010290739037994974, 0.0,
+  -0.00024293809958303431, 0.0, -0.001054745905213229, 0.0,
+  2.7549755561942652e-05, 0.0, 0.0021170017222666205, 0.0,
+  -0.00010054769084718185, 0.0, 5.7163981385503991e-05, 0.0,
+  0.0028296771536933931, 0.0, -0.0014050002495519483, 0.0,
+  -1.3578522109585019e-05, 0.0, -4.0559597437811078e-05, 0.0,
+  -3.544504213537687e-05, 0.0, 6.6651542719021494e-05, 0.0,
+  0.0027109431423567617, -0.0, 0.001284747846049012, -0.0,
+  -0.0031967410570153676, -0.0, -0.011933976108841294, -0.0,
+  -0.14271327530498035, -0.0, -0.080605466258606526, -0.0,
+  0.035738084540559323, -0.0, 0.098082278908404236, -0.0,
+  0.0021931216376847879, -0.0, 0.0025639969595441336, -0.0,
+  0.0032722013153434551, -0.0, 0.0021550378475789222, -0.0,
+  -0.0031582982747831731, -0.0, -0.0024186841177825645, -0.0,
+  0.00056694836080265171, -0.0, 0.0065588941627556753, -0.0,
+  0.00069394356741526335, -0.0, -0.011409631247659986, -0.0,
+  0.0029923541564949693, -0.0, 0.0020764336527915204, -0.0,
+  -0.0094079972012870612, -0.0, 0.00092931326810315369, -0.0,
+  0.0026018482190103484, -0.0, -7.3278334434272483e-05, -0.0,
+  -0.016801402913186676, -0.0, -0.018016268660126268, -0.0,
+  -0.060962489095434086, -0.0, 0.023003098250312763, -0.0,
+  0.10267996371908782, -0.0, -0.013054896928401271, -0.0,
+  -0.0086520614814397049, -0.0, 0.0027913582950998498, -0.0,
+  0.048893582784038506, -0.0, 0.40407021753307487, -0.0,
+  0.33711371978174265, -0.0, -0.036754483240030403, -0.0,
+  -0.73326730176525201, -0.0, -0.037088965165837894, -0.0,
+  -0.00040775529478376938, -0.0, 0.00091221077239752159, -0.0,
+  0.038822499848494167, -0.0, -0.10539293798366176, -0.0,
+  -0.028274744704171576, -0.0, -0.022320372016777255, -0.0,
+  0.057874410788575678, -0.0, 0.0028124379865301732, -0.0,
+  0.012807182912009118, -0.0, 0.0021708528121095693, -0.0,
+  -0.030982400477054774, -0.0, -0.01938414360097326, -0.0,
+  -0.1090452455529021, -0.0, -0.025024003837744332, -0.0,
+  0.37261177123144912, -0.0, 0.0027807201679393469, -0.0,
+  0.0037909741597248153, -0.0, 0.0087896860790100777, -0.0,
+  -0.054647077031335776, -0.0, 0.010608021936041554, -0.0,
+  0.0068293352301428299, -0.0, 0.0017251404590550299, -0.0,
+  -0.020513434677226616, -0.0, -0.0011265251940557565, 0.0,
+  -0.00056693920970628253, 0.0, -0.025481428483435167, 0.0,
+  0.012728503195848583, 0.0, 0.062797969064981765, 0.0,
+  0.0023893388804667056, 0.0, -0.016628037890500692, 0.0,
+  -0.013409221843840087, 0.0, -0.0011674448226598659, 0.0,
+  -0.0001722733155493781, 0.0, -0.0002686736884375351, 0.0,
+  0.00064543084999258229, 0.0, -0.0018561049156102724, 0.0,
+  -0.011078025895186026, 0.0, 0.0037907470603752305, 0.0,
+  0.028158444388737072, 0.0, -0.0088393326707766149, 0.0,
+  0.0065941855951458335, 0.0, 0.0009663610786409245, 0.0,
+  -0.0073724685111186085, 0.0, -0.0013813719045617187, 0.0,
+  0.0063121096836632655, 0.0, 0.005140724686776176, 0.0,
+  -0.046951419086476182, 0.0, -0.013661364130656856, 0.0,
+  -0.38885737110427693, 0.0, -0.11946112425411849, 0.0,
+  0.79831900371191378, 0.0, 0.1025108771810615, 0.0,
+  0.0044294812102553078, 0.0, -0.00083027349734425776, 0.0,
+  0.0059115534401644847, 0.0, -0.0047817156100747457, 0.0,
+  -0.15204864680450569, 0.0, -0.0025906916405485656, 0.0,
+  0.03617316519283386, 0.0, 0.028288667509587397, 0.0,
+  0.0040940130294720069, 0.0, 0.00044336412435567644, 0.0,
+  0.07120671736610841, 0.0, -0.043535624616006269, 0.0,
+  0.068348536366595422, 0.0, -0.01283179514916633, 0.0,
+  -0.48491561093186702, 0.0, 0.11463326106055691, 0.0,
+  0.00024617476339217417, 0.0, -0.00064369872423654937, 0.0,
+  -0.0017896668758425015, 0.0, 0.0014031982613538004, 0.0,
+  0.0047503950151025877, 0.0, 0.0029989132753990692, 0.0,
+  0.00060382553150657985, 0.0, -0.01193419789272793, 0.0,
+  -0.00028906832651235146, 0.0, -0.00053829946635354585, 0.0,
+  -0.00079845320295706106, 0.0, 0.0055925408945506055, 0.0,
+  -0.0070718899444343238, 0.0, 0.0039709434555258525, 0.0,
+  0.0069947079525585669, 0.0, -0.0075643942233733705, 0.0,
+  -0.0058879180504436933, -0.0, 0.0011130292864963164, -0.0,
+  0.0041382887565751614, -0.0, 0.0012493576328537065, -0.0,
+  0.33561637655539994, -0.0, -0.049438176053646823, -0.0,
+  -0.095471325025462947, -0.0, -0.031977460259381953, -0.0,
+  -0.0068455818497458864, -0.0, 0.0030634412013812711, -0.0,
+  -0.010069474691381137, -0.0, 0.0036188666903120238, -0.0,
+  0.0001959553611910727, -0.0, -0.0018064204334217726, -0.0,
+  0.00041135863993432299, -0.0, 0.00074359338825707945, -0.0,
+  -0.00088204139119006772, -0.0, 0.023381531174848459, -0.0,
+  0.00026641141665643015, -0.0, -0.0026068684253621873, -0.0,
+  -0.010290127235187942, -0.0, -0.0022476752471225613, -0.0,
+  0.0010806799195926533, -0.0, 0.0052178582587531176, -0.0,
+  -0.004136431339451168, -0.0, 0.02154173383242651, -0.0,
+  -0.013983942264157133, -0.0, -0.060716607465689333, -0.0,
+  0.032942566869986457, -0.0, 0.031813153878860308, -0.0,
+  -0.011576568231198531, -0.0, -0.018762929272102408, -0.0,
+  0.022464216108946122, -0.0, -0.7173199601206689, -0.0,
+  0.2522905734307021, -0.0, 0.21616437637024952, -0.0,
+  -0.29828441488392438, -0.0, 0.060221154536417472, -0.0,
+  -0.0066517406331521294, -0.0, -0.026145711139769889, -0.0,
+  0.02139590479325235, -0.0, 0.26920263617240431, -0.0,
+  -0.095577890405551341, -0.0, 0.028259614354355044, -0.0,
+  0.025580176308943325, -0.0, -0.0034886964923768701, -0.0,
+  0.016042429679541694, -0.0, 0.0088397557646837602, -0.0,
+  -0.0314150355535259, -0.0, 0.01568503924547927, -0.0,
+  -0.10855675997216978, -0.0, -0.026002035398705596, -0.0,
+  0.30271467233062588, -0.0, -0.004944110310769077, -0.0,
+  0.0054694024166195149, -0.0, 0.010878866183770658, -0.0,
+  -0.053334374543113773, -0.0, -0.027469016437400299, -0.0,
+  0.013146120363668612, -0.0, 0.0069098073456556981, -0.0,
+  -0.015769655142769779, -0.0, 0.004355037816243983, 0.0,
+  0.013983457615987323, 0.0, 0.010269957301930224, 0.0,
+  -0.094561099057953457, 0.0, 0.010540621883616643, 0.0,
+  -0.52591243200291082, 0.0, -0.011734795525292012, 0.0,
+  0.60772475362174716, 0.0, -0.0042669806892513202, 0.0,
+  0.023491891447243771, 0.0, -0.0030787039328774861, 0.0,
+  0.017009938681989762, 0.0, -0.011671839609305328, 0.0,
+  -0.013527589343055922, 0.0, -0.0088630905878801479, 0.0,
+  0.020201543446864804, 0.0, 0.037425730590903671, 0.0,
+  0.0031772134126456489, 0.0, -0.00081177165890911637, 0.0,
+  -0.0026109482120644611, 0.0, 0.017198800478106034, 0.0,
+  7.4251829266007619e-05, 0.0, -0.00014091955571820185, 0.0,
+  0.0016640949879419531, 0.0, -0.012468656910580935, 0.0,
+  0.00090436852598257164, 0.0, -0.0022292224930682346, 0.0,
+  -0.0048457482227593808, 0.0, 0.0061851892192672994, 0.0,
+  0.0047117569449089377, 0.0, -0.00024476653022527319, 0.0,
+  -0.0021413179010975774, 0.0, 0.0084385460237082627, 0.0,
+  -0.092918053325210623, 0.0, 0.16241014957619862, 0.0,
+  0.019728942981750895, 0.0, -0.04562609123531227, 0.0,
+  0.0057859226741211588, 0.0, -0.0010910259151717234, 0.0,
+  -0.0010090594795531187, 0.0, -0.00039310362322421795, 0.0,
+  0.044049201832909265, 0.0, -0.036666997981193307, 0.0,
+  0.0013437860196861559, 0.0, 0.0049980680377348027, 0.0,
+  -0.0020173294133677766, 0.0, -0.032549013153474082, 0.0,
+  -0.0079721128120993408, 0.0, 0.062070992701139777, 0.0,
+  0.0099384721648410317, 0.0, 0.2652159247127221, 0.0,
+  0.044229408221292836, 0.0, -0.57088421301632597, 0.0,
+  9.7256179757559568e-06, 0.0, -0.010950576710420804, 0.0,
+  -0.020310167186676779, 0.0, 0.10613855479711004, 0.0,
+  -0.0066805317332835424, 0.0, -0.010084934849848225, 0.0,
+  -0.0041742075498545578, 0.0, 0.029160997052124871, 0.0,
+  0.0349395610332646, -0.0, 0.033696795401046337, -0.0,
+  0.12825619285127335, -0.0, -0.46647025417929944, -0.0,
+  -0.04041747856326388, -0.0, -0.13627489192993683, -0.0,
+  0.028582305783896235, -0.0, 0.10771270091922419, -0.0,
+  -0.0036952142336400171, -0.0, 0.0088287038714310855, -0.0,
+  9.2814384895091394e-05, -0.0, 0.0032020373107189541, -0.0,
+  0.01969768552878674, -0.0, -0.086720125714105395, -0.0,
+  -0.23468961735424743, -0.0, 0.069496243237374564, -0.0,
+  0.44776317282685318, -0.0, -7.5859649435293296e-05, -0.0,
+  0.015197138416132752, -0.0, 0.0013209262787611631, -0.0,
+  -0.025960493336316341, -0.0, 0.0072478143219539331, -0.0,
+  -0.020921474350581934, -0.0, -0.031460903720653202, -0.0,
+  0.092655859715986708, -0.0, -0.046165629260373556, -0.0,
+  0.27837996114399266, -0.0, 0.091198467131447386, -0.0,
+  -0.24403577641212104, -0.0, 0.030036493494588729, -0.0,
+  0.0084156553932292454, -0.0, -0.063607320471047488, -0.0,
+  0.037085142283505922, -0.0, 0.013635253538931616, -0.0,
+  -0.041796554859302067, -0.0, -0.011612379568848846, -0.0,
+  0.095690125455545658, -0.0, -0.0039490160910129173, -0.0,
+  -0.002853864275016332, -0.0, -0.059745357477027396, -0.0,
+  0.19066473732347938, -0.0, 0.0070730731486803762, -0.0,
+  0.024399796969139003, -0.0, 0.086536063853248232, -0.0,
+  -0.43520181276330033, -0.0, -0.019666687638388278, -0.0,
+  0.10127227202942277, -0.0, 0.05059301945813887, -0.0,
+  -0.11439670193127648, -0.0, 0.01263634005385183, -0.0,
+  -0.2060863377099719, -0.0, -0.070070300204920152, -0.0,
+  0.42757035314782654, -0.0, -0.0018898278592760236, -0.0,
+  0.018149141077065827, -0.0, 0.048615441398698861, -0.0,
+  -0.15708472985651065, -0.0, -0.0024218280139401563, -0.0,
+  -0.0043184453401753789, -0.0, -0.0022628333400082526, -0.0,
+  0.013210427321607317, -0.0, 0.047209859097348095, -0.0,
+  0.042529691544887796, -0.0, 0.1884266799086054, -0.0,
+  -0.64028326883848696, -0.0, 0.019632209038329552, -0.0,
+  0.13078784638500532, -0.0, -0.032858588450990961, -0.0,
+  -0.047499610696447502, -0.0, -0.0011545197574644897, -0.0,
+  -0.013144176992890498, -0.0, 1.7384674236908482e-06, -0.0,
+  -0.004578621498944494, -0.0, 0.018599084124842173, -0.0,
+  -0.12631486892022684, -0.0, -0.28889522599102019, -0.0,
+  0.094896816263203385, -0.0, 0.59709514134954578, -0.0,
+  0.0017760729693816451, -0.0, 0.0020930982410266971, -0.0,
+  -0.0013169939969828065, -0.0, 0.00034531728428425915, -0.0,
+  -0.0072331045923669625, -0.0, 0.034492507816332542, -0.0,
+  0.01120896420380077, -0.0, -0.092821663114357036, -0.0,
+  0.033566692945099647, -0.0, -0.20748209094708683, -0.0,
+  -0.063363636365912371, -0.0, 0.18330364845278235, -0.0,
+  0.035035763070639062, -0.0, 0.029776229673440482, -0.0,
+  -0.074861198467026907, -0.0, 0.040173099234243746, -0.0,
+  -0.012123394298282488, -0.0, -0.073989215728565511, -0.0,
+  0.018233483653048714, -0.0, 0.00040254436880907504, -0.0,
+  0.014888067596529593, -0.0, -0.0027832985537212941, -0.0,
+  0.05792459140563546, -0.0, -0.15688473653562862, -0.0,
+  -0.031833418494284831, -0.0, 0.019680834047400071, -0.0,
+  -0.070592295522923398, -0.0, 0.32557570748500808, -0.0,
+  -0.015594585656328991, -0.0, 0.02874023864913124, -0.0,
+  0.024243717754271223, -0.0, -0.0029507558677772864, -0.0,
+  -0.00081870453986761379, -0.0, 0.038580061864941666, -0.0,
+  0.020987124803637222, -0.0, -0.12111863862471874, -0.0,
+  -0.00062775483240183106, -0.0, -0.0078249941802100952, -0.0,
+  -0.025340229139238193, -0.0, 0.071918142916060829, -0.0,
+  0.0082013858429188895, -0.0, 0.0086359354164829774, -0.0,
+  0.0052089972505313187, -0.0, -0.029881702520472116, -0.0,
+  0.0088006456906588489, -0.0, 0.007263527288185973, -0.0,
+  0.036177403395191481, -0.0, -0.13510539572749619, -0.0,
+  0.013093918088238314, -0.0, 0.31512796986234609, -0.0,
+  -0.049298524318965274, -0.0, -0.19789946683976656, -0.0,
+  0.006047806078185212, -0.0, -0.022210840574655305, -0.0,
+  2.6224085308441085e-05, -0.0, -0.014547677043148813, -0.0,
+  0.014532631016492289, -0.0, -0.02506656493072032, -0.0,
+  -0.06200729560881646, -0.0, 0.016896802651279665, -0.0,
+  0.12936386007081274, -0.0, 0.0030044702168391031, -0.0,
+  -0.03888171566650387, -0.0, -0.0063948543079362557, -0.0,
+  0.057315810766682768, -0.0, 0.0069548638919561499, -0.0,
+  -0.010939560373714179, -0.0, 0.0023974606107465281, -0.0,
+  0.0036793284396859044, -0.0, -0.034486238572773477, -0.0,
+  0.1693730671796175, -0.0, 0.04284463118044339, -0.0,
+  -0.1168401733325023, -0.0, -0.063250438774585471, -0.0,
+  0.027995939850286079, -0.0, 0.097221283690227617, -0.0,
+  0.042892580318262354, -0.0, 0.024048688989934258, -0.0,
+  0.26232201313151254, -0.0, 0.015319925894998686, -0.0,
+  -0.30325460198243864, -0.0, -0.075196505710780986, -0.0,
+  0.023268718513132541, -0.0, -0.056112986143780394, -0.0,
+  0.16167906556835474, -0.0, 0.13004293354215365, -0.0,
+  -0.12495607212016803, -0.0, 0.060754945736016336, -0.0,
+  -0.23991581458764843, -0.0, 0.082526514851344684, -0.0,
+  -0.13956196374333543, -0.0, -0.15948369206766513, -0.0,
+  0.19113638148802251, -0.0, -0.039758433921801895, -0.0,
+  0.29415690698865615, -0.0, 0.14015131387259261, -0.0,
+  -0.6088828084304887, -0.0, 0.014114756812732665, -0.0,
+  -0.025785145825500514, -0.0, -0.049289066476780739, -0.0,
+  0.17922184758030588, -0.0, -0.032835951122746058, -0.0,
+  -0.029659108270358468, -0.0, -0.020508156456415367, -0.0,
+  0.1023748155902852, -0.0, -0.0081413522514480318, -0.0,
+  0.011395972459608735, -0.0, -0.023886239753388685, -0.0,
+  -0.059936389425267203, -0.0, 0.24530666208741506, -0.0,
+  -0.099156209325211311, -0.0, -0.15155871623473038, -0.0,
+  0.03539704169639251, -0.0, -0.011508124151615196, -0.0,
+  0.008663285319162807, -0.0, -0.0037022290912023829, -0.0,
+  0.0044346264951581546, -0.0, 0.0010143595860866732, -0.0,
+  0.010683719707371551, -0.0, -0.032763520189128974, -0.0,
+  -0.007618190129676872, -0.0, 0.060460911423388788, -0.0,
+  -0.006399063223024355, -0.0, 0.013016636996607928, -0.0,
+  0.0038602727276584739, -0.0, -0.017002642074147079, -0.0,
+  -0.0073216527950027491, -0.0, 0.0056880348536952419, -0.0,
+  0.0020343550435943853, -0.0, 0.005770015139442944, -0.0,
+  0.010470283915871932, -0.0, -0.022976062260261169, -0.0,
+  -0.0012012612628139292, -0.0, 0.0070922081961433403, -0.0,
+  -0.2877953142551849, -0.0, 0.038300323053826489, -0.0,
+  0.47852766610624869, -0.0, -0.014943030663400627, -0.0,
+  0.02230398192831937, -0.0, -0.085807008252224842, -0.0,
+  -0.04262520643081489, -0.0, 0.048485214067328135, -0.0,
+  0.12510622213271769, -0.0, -0.042637702709636058, -0.0,
+  -0.047920045615412049, -0.0, -0.0029182037124131062, -0.0,
+  -0.20378927770313274, -0.0, 0.11903776339876866, -0.0,
+  -0.0096787296595561585, -0.0, 0.0197961501273545, -0.0,
+  0.36676641405225868, -0.0, -0.074697661405084187, -0.0,
+  -0.57064939389075764, -0.0, 0.10688647660279769, -0.0,
+  -0.13221307923409217, -0.0, -0.076779525725994419, -0.0,
+  0.14670970586011159, -0.0, 0.18323756663443724, -0.0,
+  -0.022522573784206919, -0.0, 0.016128882439769246, -0.0,
+  0.033885561915312327, -0.0, -0.071125557257709138, -0.0,
+  0.04682730091548739, -0.0, -0.0039389506802485399, -0.0,
+  -0.0067599600872042158, -0.0, -0.02731474164834264, -0.0,
+  -0.012759225270070968, -0.0, -0.0025224344026504213, -0.0,
+  0.028518390424149154, -0.0, 0.036550828874206673, -0.0,
+  0.48146688436801915, -0.0, 0.013235434998861935, -0.0,
+  -0.3199233566707822, -0.0, -0.037410712821681805, -0.0,
+  -0.021557670528566879, -0.0, 0.0045113846179959784, -0.0,
+  -0.0027180778137599151, -0.0, -0.0028787312686418642, -0.0,
+  0.0011248030684641063, -0.0, -0.013026350644909231, -0.0,
+  0.031016691218635303, -0.0, 0.011383812739233518, -0.0,
+  -0.049165648160300834, -0.0, -0.014008363551341265, -0.0,
+  -0.0080361023164360716, -0.0, 0.011093335403153768, -0.0,
+  0.015757847837111667, -0.0, -0.014156285776019111, -0.0,
+  0.0052523034980794759, -0.0, 0.00076689918149868677, -0.0,
+  0.00802276621591776, -0.0, -8.3619945741948229e-05, -0.0,
+  0.03356074470538687, -0.0, 0.02889452356013578, -0.0,
+  -0.044892976417964935, -0.0, 0.15123515619044622, -0.0,
+  -0.013659479669455339, -0.0, -0.25264786163139696, -0.0,
+  0.021068192538298169, -0.0, 0.045979130404161683, -0.0,
+  -0.055349906261290605, -0.0, 0.070306849960671935, -0.0,
+  -0.12835848904444894, -0.0, 0.2927215447576354, -0.0,
+  -0.10350224038790579, -0.0, -0.055518028753768864, -0.0,
+  0.066686022082688853, -0.0, -0.49961388174307164, -0.0,
+  0.25849327182306442, -0.0, 0.028951459110330011, -0.0,
+  -0.080550954147844953, -0.0, -0.16856118080588273, -0.0,
+  0.0088829726405360177, -0.0, 0.26870677126775883, -0.0,
+  -0.027471265573999717, -0.0, -0.091801064743008934, -0.0,
+  0.10612424018625706, -0.0, 0.098679018482618494, -0.0,
+  -0.14894877246776342, -0.0, -0.042946809978030256, -0.0,
+  0.01127062776099113, -0.0, -0.022668938529211122, -0.0,
+  0.04807904658004658, -0.0, 0.11659869404388444, -0.0,
+  -0.054537059466772432, -0.0, -0.047910194829567904, -0.0,
+  0.032246035082048929, -0.0, 0.17263063910912205, 0.0,
+  0.16700723684886037, 0.0, 0.12798707338737586, 0.0,
+  0.12047358314519314, 0.0, 0.092786137294320281, 0.0,
+  0.086936236887464144, 0.0, 0.076150238941046014, 0.0,
+  0.069948875892923965, 0.0, 0.12469113484039017, 0.0,
+  0.12326185343257365, 0.0, 0.047056942525107615, 0.0,
+  0.054898464565805626, 0.0, 0.092786137294319768, 0.0,
+  0.11299133402667724, 0.0, 0.13578954402349003, 0.0,
+  0.059358134969430508, 0.0, 0.22524069136623756, 0.0,
+  0.078157481136722828, 0.0, 0.078883837262005763, 0.0,
+  0.083117009519036653, 0.0, 0.092497156900389621, 0.0,
+  0.086670687336285315, 0.0, 0.091403717572005772, 0.0,
+  0.12555807602217914, 0.0, 0.15785358761409896, 0.0,
+  0.064911244701438955, 0.0, 0.11049985441414453, 0.0,
+  0.037489348401745594, 0.0, 0.061209171546766458, 0.0,
+  0.19975574473396837, 0.0, 0.18308079497610857, 0.0,
+  0.10583711670667834, 0.0, 0.15700226699414463, 0.0,
+  0.10484521103021467, 0.0, 0.15777548480492948, 0.0,
+  0.12127804207964685, 0.0, 0.094832430894581862, 0.0,
+  0.17968332277719995, 0.0, 0.15754117637741877, 0.0,
+  0.234316237791826, 0.0, 0.20575404047824741, 0.0,
+  0.079211869060521287, 0.0, 0.091216270829997545, 0.0,
+  0.081008233671438931, 0.0, 0.064005252115063221, 0.0,
+  0.14876242062667738, 0.0, 0.14791110000672147, 0.0,
+  0.085139872276548539, 0.0, 0.1776604600196896, 0.0,
+  0.14843438882816135, 0.0, 0.22108562191837722, 0.0,
+  0.12424594882811853, 0.0, 0.14724722612877156, 0.0,
+  0.22023430129842061, 0.0, 0.19160181145658711, 0.0,
+  0.25948096290649858, 0.0, 0.24897613507309224, 0.0,
+  0.13161885401379411, 0.0, 0.17949587603519021, 0.0,
+  0.12337119736541032, 0.0, 0.079594572825455692, 0.0,
+  0.019605215770186393, 0.0, 0.0070438152782872415, 0.0,
+  0.033032406152006276, 0.0, -0.094583658172479851, 0.0,
+  -0.33285182543125341, 0.0, 0.098070180484271699, 0.0,
+  0.26889749496771365, 0.0, 0.040457005648680745, 0.0,
+  -0.0010112089636880042, 0.0, -0.010095163254214005, 0.0,
+  0.02071932701487654, 0.0, -0.013834230249302805, 0.0,
+  0.0029439571918509011, 0.0, -0.032213571759176461, 0.0,
+  0.14512341416293484, 0.0, 0.0095388781885599617, 0.0,
+  -0.079359639413092764, 0.0, 0.042294115304131602, 0.0,
+  -0.016218980620632064, 0.0, -0.024789335896325766, 0.0,
+  0.0088388431049445607, 0.0, -0.031048690243059594, 0.0,
+  0.018123106857058324, 0.0, 0.013972121484782588, 0.0,
+  0.0056337443529768209, 0.0, 0.0048697106700601647, 0.0,
+  -0.012939949759242935, 0.0, 0.013336648167844712, 0.0,
+  -0.01595421145847167, 0.0, -0.001000530846015833, 0.0,
+  0.065677430852028568, 0.0, 0.0038719087200917855, 0.0,
+  0.019674964430881004, 0.0, -0.29609602389627282, 0.0,
+  -0.11466631334517881, 0.0, 0.24648955290485638, 0.0,
+  -0.10932465579077262, 0.0, 0.44580187075826694, 0.0,
+  -0.16243259566432047, 0.0, -0.15119457134844402, 0.0,
+  0.071172468399216732, 0.0, -0.24365830950071046, 0.0,
+  0.23234356205451279, 0.0, 0.017029851743977115, 0.0,
+  -0.017847889582447988, 0.0, 0.017338618666566729, 0.0,
+  -0.32634042783481909, 0.0, -0.065898951479817947, 0.0,
+  0.28481789784826828, 0.0, 0.21685869451689918, 0.0,
+  0.053052563129962219, 0.0, -0.24525276000956014, 0.0,
+  -0.023478257694852185, 0.0, -0.092853344361798942, 0.0,
+  0.040801271073833127, 0.0, 0.056177075105598148, 0.0,
+  -0.030560448674425374, 0.0, 0.059848110060788162, 0.0,
+  -0.0365907060771994, 0.0, -0.0092043633153942959, 0.0,
+  0.0078447895760580689, 0.0, -0.01656781564103018, 0.0,
+  -0.021050954068008131, 0.0, -0.15189889461009198, 0.0,
+  0.21438963497023644, 0.0, -0.11654855997517191, 0.0,
+  0.054272390615802676, 0.0, 0.099877282947881063, 0.0,
+  -0.0016426727136378463, 0.0, 0.0027958932785307382, 0.0,
+  -0.008547471649808222, 0.0, 0.0088391446517010579, 0.0,
+  -0.0061564449734869131, 0.0, -0.0097643714919511456, 0.0,
+  0.11613828975582047, 0.0, -0.38587033588573255, 0.0,
+  -0.042126759779812444, 0.0, 0.22102587741488136, 0.0,
+  0.0165271205489376, 0.0, -0.0063918892013343342, 0.0,
+  -0.015660102805892494, 0.0, 0.016973763253818632, 0.0,
+  -0.029767848594100119, 0.0, 0.044653188500768125, 0.0,
+  0.040743842862511842, 0.0, -0.057710889762805528, 0.0,
+  -0.0020162938101553883, 0.0, 0.0096741535883383308, 0.0,
+  0.0042984030946628888, 0.0, -0.001363744599334409, 0.0,
+  -0.071260777324891944, 0.0, -0.094004071562968194, 0.0,
+  0.15809081629792845, 0.0, -0.017107271597263277, 0.0,
+  -0.11692382985188837, 0.0, 0.041462820653845378, 0.0,
+  0.07161388514185274, 0.0, -0.061226091351066256, 0.0,
+  0.2101037906122033, 0.0, -0.076614138958049208, 0.0,
+  -0.085400658489758835, 0.0, 0.036061050143073189, 0.0,
+  -0.10624214236912771, 0.0, 0.063570262812910741, 0.0,
+  0.0059390457092691005, 0.0, -0.0033894589791529308, 0.0,
+  0.018545584208920499, 0.0, 0.58435005915315874, 0.0,
+  -0.017829410759350253, 0.0, -0.45678905294918171, 0.0,
+  0.073365923569283051, 0.0, 0.0057620901113217748, 0.0,
+  -0.032915347603228597, 0.0, -0.16297055181330827, 0.0,
+  -0.039972676232365681, 0.0, 0.003170621262159082, 0.0,
+  -0.026368586794492804, 0.0, 0.10420776127393988, 0.0,
+  0.027279796477850754, 0.0, -0.037280348497530043, 0.0,
+  -0.021428113674266773, 0.0, 0.04707508545863609, 0.0,
+  -0.032171462956534704, -0.0, 0.030823481465280179, -0.0,
+  -0.18333387497086229, -0.0, 0.21491664324847573, -0.0,
+  0.10730415991070966, -0.0, -0.19654174031064128, -0.0,
+  0.076383238892590355, -0.0, -0.14655246786306464, -0.0,
+  -0.0052061981835442948, -0.0, 0.012661257622345207, -0.0,
+  -0.006444213930907986, -0.0, 0.015334221804514324, -0.0,
+  -0.0040998405055773356, -0.0, 0.16956698847196625, -0.0,
+  -0.51876897853838033, -0.0, -0.037518959465855754, -0.0,
+  0.33191663844767599, -0.0, -0.022794067598708109, -0.0,
+  0.014839302435805696, -0.0, 0.017491626941191322, -0.0,
+  -0.010460064755250966, -0.0, -0.023065568252376826, -0.0,
+  0.046204496645267108, -0.0, 0.014462442922646068, -0.0,
+  -0.033672127916751206, -0.0, -0.0038424465647381523, -0.0,
+  0.018216821287543445, -0.0, -0.0018324729512822736, -0.0,
+  0.0094669949069348738, -0.0, -0.12381169773676885, -0.0,
+  0.24863829032219947, -0.0, 0.050941878575176423, -0.0,
+  -0.080189458214609502, -0.0, 0.038555223135925208, -0.0,
+  0.19739956333869557, -0.0, -0.10766445266128104, -0.0,
+  0.066317703838476447, -0.0, 0.045640649322842654, -0.0,
+  -0.013312758620092083, -0.0, 0.0056691078683828071, -0.0,
+  -0.016580293509185731, -0.0, -0.053593889446590146, -0.0,
+  -0.093943167305290023, -0.0, -0.0035080733514507565, -0.0,
+  0.0087475467109257767, -0.0, -0.11291655575391407, -0.0,
+  -0.40297761786173975, -0.0, 0.12083189620629244, -0.0,
+  0.3171235853350427, -0.0, 0.08842619718494793, -0.0,
+  0.11486269542310866, -0.0, -0.18586827076656928, -0.0,
+  0.039782418048465829, -0.0, -0.0090065571603991663, -0.0,
+  -0.0037014684360946273, -0.0, 0.017618954782800511, -0.0,
+  -0.015944107824370037, -0.0, 0.013088512242404348, -0.0,
+  0.030144140096497123, -0.0, 0.025058900168567162, -0.0,
+  -0.059112724190865676, -0.0, 0.2756874019568355, 0.0,
+  0.27604126388800482, 0.0, 0.18047475776046076, 0.0,
+  0.17008081080050036, 0.0, -0.010566385954594764, 0.0,
+  -0.0017550409350669172, 0.0, -0.0073626408431836767, 0.0,
+  0.00052246234419790066, 0.0, 0.12428664960442441, 0.0,
+  0.1202500732242968, 0.0, 0.017167933715381837, 0.0,
+  0.016895052757158628, 0.0, 0.14679134891813245, 0.0,
+  0.15871712614992325, 0.0, 0.18018489108768693, 0.0,
+  0.078569073925585223, 0.0, 0.309540523323662, 0.0,
+  -0.038625948235468388, 0.0, -0.036211281373579415, 0.0,
+  -0.043839280337747109, 0.0, -0.046017027670445604, 0.0,
+  -0.026993892769728293, 0.0, -0.025019715488684677, 0.0,
+  -0.079096804339042037, 0.0, -0.09785529291310581, 0.0,
+  -0.042721076453615725, 0.0, -0.062847684658986658, 0.0,
+  -0.025530042833841179, 0.0, -0.035279282949139561, 0.0,
+  0.2372250934005459, 0.0, 0.22073698801197233, 0.0,
+  0.1061313966258539, 0.0, 0.15641764124047175, 0.0,
+  -0.036506397012119329, 0.0, -0.047145682642723681, 0.0,
+  -0.037183229102484498, 0.0, -0.025440187928969338, 0.0,
+  -0.12721977353088221, 0.0, -0.12536795344266874, 0.0,
+  -0.17052954710963972, 0.0, -0.14869584353458054, 0.0,
+  -0.051064341699521329, 0.0, -0.0561070057743078, 0.0,
+  -0.057853541515362095, 0.0, -0.038594087531190736, 0.0,
+  0.15113953561932403, 0.0, 0.14567278912137027, 0.0,
+  0.077087740691849774, 0.0, 0.16545350632559422, 0.0,
+  -0.045905270985342368, 0.0, -0.071190335633917412, 0.0,
+  -0.045257550259888799, 0.0, -0.049338179178896581, 0.0,
+  -0.24387487696499122, 0.0, -0.206989585527627, 0.0,
+  -0.24918409839967967, 0.0, -0.21614202932157642, 0.0,
+  -0.17755773652041251, 0.0, -0.23384347767145394, 0.0,
+  -0.17457038583658577, 0.0, -0.099791545612187199, 0.0,
+  0.029335502010697855, 0.0, -0.0018832858025245064, 0.0,
+  0.12848267804197916, 0.0, -0.18751425619924325, 0.0,
+  0.065154927840790328, 0.0, -0.26885375176198267, 0.0,
+  0.20398121326231983, 0.0, -0.28629497715147528, 0.0,
+  -0.033108690686836674, 0.0, 0.042486299219256035, 0.0,
+  -0.0053525692773400274, 0.0, 0.023384690594692698, 0.0,
+  0.021863265358813326, 0.0, -0.13687709187345565, 0.0,
+  0.31360315818868423, 0.0, 0.023486500764436161, 0.0,
+  -0.12361445014898514, 0.0, 0.010212875147133593, 0.0,
+  -0.025379623039484395, 0.0, -0.0081803910270980638, 0.0,
+  0.021131368289152075, 0.0, -0.0089474655743522168, 0.0,
+  -0.015731668374454652, 0.0, -0.0047695459572747144, 0.0,
+  0.0022608619727660724, 0.0, 0.0067398983488819366, 0.0,
+  0.0009161083275988672, 0.0, 0.0030140574678624876, 0.0,
+  0.0055927206368341972, 0.0, 0.072081763283785918, 0.0,
+  -0.19025524881040751, 0.0, 0.025246478592053003, 0.0,
+  0.018314499416073049, 0.0, -0.011680970449020209, 0.0,
+  0.58035858830033871, 0.0, -0.23283750836314626, 0.0,
+  0.1627243467234363, 0.0, 0.28467935168605912, 0.0,
+  -0.080496046423153098, 0.0, 0.0062142967349740619, 0.0,
+  -0.057308614954029904, 0.0, -0.17967685397708399, 0.0,
+  -0.24353249805018745, 0.0, -0.0030236178199057133, 0.0,
+  0.0075847253230653311, 0.0, 0.024151682899470211, 0.0,
+  0.17644153586724548, 0.0, -0.042054400803103784, 0.0,
+  -0.12601045586708762, 0.0, 0.051665363862674576, 0.0,
+  0.077701838016039207, 0.0, -0.096150752152162192, 0.0,
+  -0.061138892154862748, 0.0, -0.06954405168735811, 0.0,
+  0.021473785639864188, 0.0, 0.0030715566814308384, 0.0,
+  0.043060879383431935, 0.0, 0.069319105385785409, 0.0,
+  0.017747343101858489, 0.0, -0.013692420854197692, 0.0,
+  -0.029573167129271799, 0.0, -0.12010467987251155, 0.0,
+  -0.12152374179728606, 0.0, -0.004335255613237732, 0.0,
+  0.037646976275607071, 0.0, -0.00025162222588885776, 0.0,
+  0.007126547405384355, 0.0, 0.0029716464742471174, 0.0,
+  0.027079068900744692, 0.0, -0.14833787175357341, 0.0,
+  -0.1447370927990585, 0.0, 0.019265369974682648, 0.0,
+  0.021396339772902388, 0.0, 0.90966346758342087, 0.0,
+  -0.02645496757179756, 0.0, -0.027606145495577113, 0.0,
+  -0.0081447903871015373, 0.0, -0.0083551561712449304, 0.0,
+  -0.022819407938618929, 0.0, -0.019808960407145554, 0.0,
+  -0.023822241885104008, 0.0, -0.020638849794193909, 0.0,
+  -0.052129850969850781, 0.0, -0.047067380185091809, 0.0,
+  -0.031266015294651624, 0.0, -0.024938095625246653, 0.0,
+  0.012611068912744949, 0.0, 0.024346791083992802, 0.0,
+  0.0054122837802418541, 0.0, 0.017634300341434182, 0.0,
+  -0.08931565367335105, 0.0, -0.077997591068605043, 0.0,
+  -0.03612225892148388, 0.0, -0.0061698525141789346, 0.0,
+  -0.0070089867835089505, 0.0, -0.00022864196542107327, 0.0,
+  -0.0097857025156499172, 0.0, 0.0022137738488887154, 0.0,
+  -0.049881492965370387, 0.0, -0.046416226393853864, 0.0,
+  -0.043862848925861848, 0.0, -0.020431212652293515, 0.0,
+  0.0048896749859719917, 0.0, 0.0087730597495820298, 0.0,
+  0.0080694709847701513, 0.0, 0.01247829935969709, 0.0,
+  -0.058469141503807866, 0.0, -0.050140302307261173, 0.0,
+  -0.028650119640367455, 0.0, -0.051959770648449415, 0.0,
+  -0.0009863677815761722, 0.0, 0.006427013863908964, 0.0,
+  0.00080485341480612523, 0.0, 0.004978300553777776, 0.0,
+  -0.068773720893376841, 0.0, -0.051211981996666898, 0.0,
+  -0.057579264696910007, 0.0, -0.042942895489419999, 0.0,
+  0.13066019548436114, 0.0, 0.17148105169822778, 0.0,
+  0.13412166748823381, 0.0, 0.080224937186968534, 0.0,
+  -0.33107473394025444, -0.0, -0.344178746516279, -0.0,
+  0.091515773546405527, -0.0, 0.042712613569801376, -0.0,
+  -0.033053852699094464, -0.0, -0.044333590957536008, -0.0,
+  -0.0089174217747005503, -0.0, -0.0090968540668867302, -0.0,
+  -0.45820997460992868, -0.0, -0.45257794691560504, -0.0,
+  -0.20630281545866117, -0.0, -0.24992391314891807, -0.0,
+  -0.038454376466213379, -0.0, 0.094186297067612182, -0.0,
+  0.10716968594306624, -0.0, 0.048910082967975749, -0.0,
+  0.18058183183032567, -0.0, 0.12020949779694991, -0.0,
+  0.1087989704684493, -0.0, 0.12989190528833883, -0.0,
+  0.13760322572024097, -0.0, -0.080438396383323923, -0.0,
+  -0.072920879392560201, -0.0, 0.066341435873827057, -0.0,
+  0.06715766107023162, -0.0, 0.0099557244800278864, -0.0,
+  0.0084470553291509983, -0.0, 0.010718760823673908, -0.0,
+  0.013384618858857951, -0.0, 0.20116822641522059, -0.0,
+  0.19395937265404861, -0.0, 0.10738177740825537, -0.0,
+  0.14784984315726801, -0.0, -0.0035263325390380309, -0.0,
+  0.0049212610875116383, -0.0, 0.025651071288425368, -0.0,
+  0.021286381885407563, -0.0, -0.068857441922678106, -0.0,
+  -0.06840496515623487, -0.0, 0.093010949608422794, -0.0,
+  0.085502958209338509, -0.0, -0.031498191686834688, -0.0,
+  -0.028530287079638311, -0.0, 0.027542158533584198, -0.0,
+  0.016991519027306872, -0.0, 0.14037842037704718, -0.0,
+  0.13812722723197193, -0.0, 0.087261750530330542, -0.0,
+  0.18179904429346008, -0.0, 0.051748907880869242, -0.0,
+  0.066445232334860924, -0.0, 0.04712662085960078, -0.0,
+  0.051933418173853559, -0.0, -0.054154019227835443, -0.0,
+  -0.046094258758589038, -0.0, 0.10133353412142243, -0.0,
+  0.089266764066452051, -0.0, -0.13387557796733868, -0.0,
+  -0.16694534549034523, -0.0, -0.12277252048448191, -0.0,
+  -0.064129137136610323, -0.0, 0.019613735274083204, -0.0,
+  0.023630622560037239, -0.0, -0.036923696276405071, -0.0,
+  -0.016266604046020358, -0.0, 0.0015717042750258124, -0.0,
+  0.0011124110974413367, -0.0, -0.0016153821521128655, -0.0,
+  0.0018787593254922998, -0.0, 0.13612908083154981, -0.0,
+  0.13862144416970471, -0.0, -0.013040189831549979, -0.0,
+  -0.016079411576750555, -0.0, 0.20682369103250942, -0.0,
+  -0.03699876649630085, -0.0, -0.044246898153035015, -0.0,
+  -0.01512397054198783, -0.0, -0.059148057972538616, -0.0,
+  0.086187170183556275, -0.0, 0.077967100463786493, -0.0,
+  0.094775043562517494, -0.0, 0.093320344785304224, -0.0,
+  0.11457432456322524, -0.0, 0.10615018424826636, -0.0,
+  0.13615347740706285, -0.0, 0.15627675985627026, -0.0,
+  0.062857299331302574, -0.0, 0.083415710603316109, -0.0,
+  0.035492308161079185, -0.0, 0.046707343114231262, -0.0,
+  -0.14179370049715093, -0.0, -0.13822078136727603, -0.0,
+  -0.057636250297440822, -0.0, -0.04858110464593491, -0.0,
+  0.0057689893139600103, -0.0, -0.0041612784056002479, -0.0,
+  0.01375763416631285, -0.0, 0.0055262087655882216, -0.0,
+  0.10418043967032473, -0.0, 0.10033145410440739, -0.0,
+  0.21545574010846055, -0.0, 0.18675276888684028, -0.0,
+  -0.017165404872429332, -0.0, -0.016969317430217803, -0.0,
+  0.067820258936243549, -0.0, 0.041182666018963268, -0.0,
+  -0.12638820462669029, -0.0, -0.12154213815274435, -0.0,
+  -0.066023288771007424, -0.0, -0.14150638116097833, -0.0,
+  -0.077108870911424113, -0.0, -0.10344052982909943, -0.0,
+  -0.056285120169398593, -0.0, -0.035236235842547023, -0.0,
+  0.12603578082300876, -0.0, 0.088306728712270036, -0.0,
+  0.17457031958751673, -0.0, 0.1427811873917795, -0.0,
+  -0.39151853078407406, -0.0, -0.50614127359050431, -0.0,
+  -0.3963106877743619, -0.0, -0.21025661515585684, -0.0,
+  0.0067413260940039875, 0.0, 0.0091510410391588987, 0.0,
+  -0.050196839373100093, 0.0, -0.038709226005614231, 0.0,
+  0.095785448798689721, 0.0, 0.087673527666971035, 0.0,
+  0.088670497545255716, 0.0, 0.057293075814223458, 0.0,
+  -0.0038094575827631893, 0.0, 0.0051805457697562838, 0.0,
+  0.14864545579412983, 0.0, 0.18920510840906454, 0.0,
+  -0.037906382883132986, 0.0, -0.043939802473247011, 0.0,
+  -0.05098788550744892, 0.0, -0.023628096425057154, 0.0,
+  -0.093885492340428381, 0.0, 0.38296316820449894, 0.0,
+  0.34716633803453723, 0.0, 0.39030315456386572, 0.0,
+  0.40962600338833177, 0.0, -0.045292548256570003, 0.0,
+  -0.036468273120897551, 0.0, -0.0621753156965991, 0.0,
+  -0.098017203292776717, 0.0, -0.030816617764753092, 0.0,
+  -0.033717016518263282, 0.0, -0.020883788904978245, 0.0,
+  -0.023711168287867707, 0.0, -0.087752083447084406, 0.0,
+  -0.075167181745864564, 0.0, -0.047516656087692011, 0.0,
+  -0.065121262129495927, 0.0, 0.05361606148562998, 0.0,
+  0.074401022160393959, 0.0, 0.049140601988606432, 0.0,
+  0.031544852909023022, 0.0, -0.11859094975325549, 0.0,
+  -0.12463643336545407, 0.0, -0.21017820792631745, 0.0,
+  -0.17645284399631145, 0.0, 0.0063526996322100541, 0.0,
+  0.010660948212104997, 0.0, -0.056788531960266932, 0.0,
+  -0.029947896398667403, 0.0, -0.040634401409693786, 0.0,
+  -0.032068625556774491, 0.0, -0.025936011253834958, 0.0,
+  -0.041028811340316926, 0.0, 0.11574199007710395, 0.0,
+  0.15632933436770152, 0.0, 0.09017615861583847, 0.0,
+  0.075637741673614145, 0.0, -0.32204829377495714, 0.0,
+  -0.25301499323669435, 0.0, -0.28747677181015879, 0.0,
+  -0.21877512343809888, 0.0, 0.0071922235496524479, 0.0,
+  0.010862574761668777, 0.0, 0.0046197916332545606, 0.0,
+  0.002599500875145171, 0.0, 0.17728233308027294, 0.0,
+  0.2047734317409596, 0.0, -0.011935866934821765, 0.0,
+  0.010116907965397966, 0.0, -0.051749070517194212, 0.0,
+  -0.048610442980254784, 0.0, -0.034855086019617641, 0.0,
+  -0.025475702811605546, 0.0, 0.3817507103883398, 0.0,
+  0.38694639590021873, 0.0, -0.41749365859918308, 0.0,
+  -0.53401898884700805, 0.0, 0.1012994676284345, 0.0,
+  -0.006979128365354647, 0.0, -0.0080621050566488488, 0.0,
+  -0.0059184089547130222, 0.0, -0.015207935955527047, 0.0,
+  0.15405673710394335, 0.0, 0.14240893144541469, 0.0,
+  0.15784354122515884, 0.0, 0.16629847591589073, 0.0,
+  0.094279690607453032, 0.0, 0.089281018213331176, 0.0,
+  -0.01746963116377127, 0.0, -0.028280212382589206, 0.0,
+  -0.06482923891939632, 0.0, -0.075415970790398065, 0.0,
+  -0.035580938880878897, 0.0, -0.037359363000367823, 0.0,
+  -0.097702230822195535, 0.0, -0.087361087096399059, 0.0,
+  -0.054960668385707352, 0.0, -0.083314794566824488, 0.0,
+  -0.042621578841574151, 0.0, -0.084098568701115178, 0.0,
+  -0.06998750091344455, 0.0, -0.045219929717150935, 0.0,
+  -0.020605200685439629, 0.0, -0.020616555962399155, 0.0,
+  -0.17155065879988884, 0.0, -0.16596077651537838, 0.0,
+  -0.031757660154190202, 0.0, -0.048223270534050143, 0.0,
+  -0.07686938876259862, 0.0, -0.044821202328453692, 0.0,
+  -0.047201852540087103, 0.0, -0.040808262960853207, 0.0,
+  -0.031951545106067548, 0.0, -0.057378219778965837, 0.0,
+  -0.0077841001053690455, 0.0, 0.003178812477923751, 0.0,
+  -0.0021406332420773532, 0.0, -0.0085347589687590816, 0.0,
+  0.049087105722927148, 0.0, 0.057190138317032006, 0.0,
+  -0.051849393099370485, 0.0, -0.037970555323936436, 0.0,
+  0.16969511065790749, 0.0, 0.22198103097730285, 0.0,
+  0.18644580653287729, 0.0, 0.096616498190839936, 0.0,
+  0.023614209934089702, 0.0, 0.030142654704770649, 0.0,
+  0.066215589230097599, 0.0, 0.053185276248891494, 0.0,
+  -0.075514532669857554, 0.0, -0.065313617760849443, 0.0,
+  -0.069999454084314267, 0.0, -0.051997034376648141, 0.0,
+  0.0030446495293746305, 0.0, 0.010927321481601899, 0.0,
+  -0.013846930695187167, 0.0, -0.017346999583359186, 0.0,
+  -0.097706144302872167, 0.0, 0.071315228156617477, 0.0,
+  0.081981074640285853, 0.0, 0.037282847232580983, 0.0,
+  0.15545974928705147, 0.0, 0.011609734596931716, 0.0,
+  0.014374545180494145, 0.0, 0.019118599794396059, 0.0,
+  0.018730891793746266, 0.0, 0.080256759917278972, 0.0,
+  0.075536332039559922, 0.0, 0.1178280167150019, 0.0,
+  0.1573942934730497, 0.0, 0.24203397811427321, 0.0,
+  0.3265174226360486, 0.0, 0.12863664704769012, 0.0,
+  0.15293759727889239, 0.0, -0.053368134704124194, 0.0,
+  -0.049682452761415551, 0.0, -0.0083738237735225731, 0.0,
+  0.074228235037692714, 0.0, -0.048605722390281436, 0.0,
+  -0.056321153170082558, 0.0, -0.03713001744343037, 0.0,
+  -0.01467296397070548, 0.0, -0.10055203357166762, 0.0,
+  -0.11886792924725684, 0.0, 0.23260906406495824, 0.0,
+  0.26075459459290162, 0.0, -0.0024110799679467215, 0.0,
+  0.011681557457886543, 0.0, 0.23450544235138934, 0.0,
+  0.1281259629782536, 0.0, -0.10558764577383821, 0.0,
+  -0.090371856822299521, 0.0, -0.052254159616125215, 0.0,
+  -0.11701055736670359, 0.0, -0.19555739148872509, 0.0,
+  -0.2450162378360673, 0.0, -0.14627627888810918, 0.0,
+  -0.12414423793449854, 0.0, -0.50284350926484911, 0.0,
+  -0.41120402563636338, 0.0, -0.23912695323578134, 0.0,
+  -0.20188342091534314, 0.0, 0.12223199040516118, 0.0,
+  0.1542676102501937, 0.0, 0.13923338235135022, 0.0,
+  0.077205040729711377, 0.0, -0.08376029936704904, -0.0,
+  -0.092867410557438385, -0.0, -0.13388821065199877, -0.0,
+  -0.10836062810817032, -0.0, 0.1633686109993302, -0.0,
+  0.12808182515273028, -0.0, 0.14236112536167009, -0.0,
+  0.094546146208456056, -0.0, 0.10617898485336515, -0.0,
+  0.10933078498130169, -0.0, -0.10304944052235149, -0.0,
+  -0.12919459205770462, -0.0, 0.015013553390709809, -0.0,
+  -0.1377003742421111, -0.0, -0.14269049331628725, -0.0,
+  -0.06961200479972636, -0.0, -0.27932554123407394, -0.0,
+  -0.10073016362560354, -0.0, -0.091845065380201138, -0.0,
+  -0.11557146854161525, -0.0, -0.11860288512649825, -0.0,
+  -0.026744017717452238, -0.0, -0.033843969340699297, -0.0,
+  -0.11731961995462165, -0.0, -0.14135830176243064, -0.0,
+  0.043257967476195605, -0.0, 0.042310727315526341, -0.0,
+  0.026006512494469614, -0.0, 0.020530735487801259, -0.0,
+  0.078919100528872604, -0.0, 0.0646477636792607, -0.0,
+  0.03330069247384438, -0.0, 0.012835566681129963, -0.0,
+  0.16374228717622336, -0.0, 0.28174579610953493, -0.0,
+  0.22809304340158096, -0.0, 0.13370401124116621, -0.0,
+  0.12338146298513795, -0.0, 0.13735127447222006, -0.0,
+  0.11918630217059216, -0.0, 0.13532327811730807, -0.0,
+  0.092724907499699999, -0.0, 0.13495060259430816, -0.0,
+  0.070973859525772953, -0.0, 0.045661275055126092, -0.0,
+  0.062873564455264319, -0.0, 0.046793941600353342, -0.0,
+  0.030586496984120894, -0.0, 0.055062143316399616, -0.0,
+  0.20821067316499856, -0.0, 0.22194466502434387, -0.0,
+  0.14196909165812094, -0.0, 0.1077307868497987, -0.0,
+  -0.35107431633458097, -0.0, -0.29493814820861974, -0.0,
+  -0.35161333598302746, -0.0, -0.2693924892173245, -0.0,
+  -0.081529086327698827, -0.0, -0.10413363011163224, -0.0,
+  -0.097756602781839549, -0.0, -0.045797465215979258, -0.0,
+  -0.02842719831432771, 0.0, 0.0091330103558185487, 0.0,
+  0.010547189214961684, 0.0, 0.11214338063039177, 0.0,
+  -0.18929883905117947, 0.0, -0.033745661596522793, 0.0,
+  0.11410784106864802, 0.0, -0.0071551156424658749, 0.0,
+  0.0085670113740661229, 0.0, -0.0075528751478535416, 0.0,
+  0.0096460614180254641, 0.0, -0.00076894800135591872, 0.0,
+  -0.0043006795856758533, 0.0, 0.0019978664515629021, 0.0,
+  -0.13918709593474377, 0.0, -0.0056704072117634832, 0.0,
+  0.065865847328337612, 0.0, 0.099286336187089194, 0.0,
+  -0.004667156315876133, 0.0, -0.11320452601772189, 0.0,
+  0.0022226756146500317, 0.0, -0.041871721350059704, 0.0,
+  0.051957732510511424, 0.0, 0.075253909908180677, 0.0,
+  -0.074957535976205802, 0.0, -0.011517759621144416, 0.0,
+  0.02162407771429108, 0.0, 0.0045803934173562722, 0.0,
+  -0.0035710737301524065, 0.0, 0.17325733815302455, 0.0,
+  0.044044476705110844, 0.0, -0.2633933994818366, 0.0,
+  -0.028757625023535911, 0.0, -0.09171337539936153, 0.0,
+  0.095409920461103276, 0.0, 0.0096547988289417443, 0.0,
+  0.046296936440678053, 0.0, 0.21424358955309344, 0.0,
+  -0.082256024090913954, 0.0, -0.034404801217052298, 0.0,
+  0.0026607161345089466, 0.0, -0.022433614603643213, 0.0,
+  -0.050516947399193324, 0.0, 0.015437435281246697, 0.0,
+  -0.00059842408692476791, 0.0, 0.091596045149433203, 0.0,
+  -0.10166524405332945, 0.0, -0.048382504998124534, 0.0,
+  0.063698963043926277, 0.0, -0.49974659449667436, 0.0,
+  -0.09114112177347157, 0.0, 0.63366116116491811, 0.0,
+  0.085549378886257729, 0.0, -0.035077071229617542, 0.0,
+  0.013905902392268948, 0.0, -0.11304822904381182, 0.0,
+  0.068377328782795899, 0.0, 0.091551962437213932, 0.0,
+  0.070046055259111603, 0.0, -0.025497655348280308, 0.0,
+  -0.15179611612470331, 0.0, 0.009727879647580118, -0.0,
+  -0.0085326334000272643, -0.0, -0.0053897071475630404, -0.0,
+  -0.027226653907381416, -0.0, 0.024514962037614996, -0.0,
+  0.098759899714129573, -0.0, -0.082999522028156622, -0.0,
+  0.059299829760574685, -0.0, 0.0013079435313361663, -0.0,
+  -0.010531221528412921, -0.0, 0.0031085350327353582, -0.0,
+  -0.010361740676092832, -0.0, 0.0061019212821646542, -0.0,
+  -0.0075210086569963835, -0.0, 0.060700833944153335, -0.0,
+  0.003009615296900105, -0.0, -0.037089253036835648, -0.0,
+  -0.0069035550487720311, -0.0, -0.023724441440207394, -0.0,
+  0.0077242192707272271, -0.0, 0.025652932481348662, -0.0,
+  -0.0022598207229006179, -0.0, 0.00078781596396151584, -0.0,
+  0.084243301504651452, -0.0, -0.11850356326913233, -0.0,
+  -0.028840032391975245, -0.0, 0.087839207914494247, -0.0,
+  0.0082955213281192004, -0.0, -0.026290756174222045, -0.0,
+  -0.033334849326245135, -0.0, -0.036008308825452348, -0.0,
+  0.070939655168880442, -0.0, 0.012193511689721524, -0.0,
+  0.019942834616834108, -0.0, -0.028206858801599521, -0.0,
+  0.030892319141764778, -0.0, -0.023869245599601477, -0.0,
+  0.011997971342488352, -0.0, 0.0094537634097575634, -0.0,
+  -0.078730914135449706, -0.0, 0.069295128798288058, -0.0,
+  -0.017740876248980977, -0.0, -0.033360635322147614, -0.0,
+  0.030777325759772715, -0.0, -0.044587283900642434, -0.0,
+  -0.03340075742327555, -0.0, 0.06777617607580419, -0.0,
+  0.010555129946660533, -0.0, -0.030985557122306825, -0.0,
+  0.13430687635483909, -0.0, -0.0030982241753284541, -0.0,
+  -0.13489056975730318, -0.0, -0.087791819277208846, -0.0,
+  0.017627101096131522, -0.0, -0.059871989170755188, -0.0,
+  -0.13128449423244032, -0.0, 0.27331481544427283, -0.0,
+  -0.013817662054207033, -0.0, 0.38143727817469664, -0.0,
+  0.34856470934150402, -0.0, -0.78299506027028831, -0.0,
+  -0.1330006871637536, -0.0, -0.1609295722105368, -0.0,
+  0.074253124110075328, -0.0, 0.048127174025844828, -0.0,
+  -0.0024557104309609911, -0.0, -0.020921305726538376, -0.0,
+  -0.019739420039147703, -0.0, -0.022777060804678031, -0.0,
+  -0.049990438740914869, -0.0, -0.061847096415046258, -0.0,
+  0.0060520975004084744, -0.0, 0.005373522434230899, -0.0,
+  -0.0077411479671283152, -0.0, 0.083792343975930397, -0.0,
+  0.089238817747748597, -0.0, 0.036411723141312094, -0.0,
+  0.1515396309260168, -0.0, 0.04945901998928371, -0.0,
+  0.036193867737509003, -0.0, 0.030124712718792461, -0.0,
+  0.024130221175100469, -0.0, 0.1503810065873975, -0.0,
+  0.11255000736094591, -0.0, -0.12898101944100201, -0.0,
+  -0.16180121728478841, -0.0, 0.0019305935151726211, -0.0,
+  0.016661403176708629, -0.0, -0.0069665055388488349, -0.0,
+  -0.0097727857665640006, -0.0, 0.064201068526979335, -0.0,
+  0.065580022132142646, -0.0, 0.020458640631437004, -0.0,
+  0.096627148946887009, -0.0, 0.063569400697025172, -0.0,
+  0.08247578898783188, -0.0, 0.036796851728324122, -0.0,
+  0.006624017318228633, -0.0, 0.31159977095018687, -0.0,
+  0.4278507825282169, -0.0, -0.11563896630563862, -0.0,
+  -0.11829553163389503, -0.0, 0.094862013861717276, -0.0,
+  0.11851429091764523, -0.0, -0.026180934007053843, -0.0,
+  -0.013109542045645742, -0.0, -0.072854473766015865, -0.0,
+  -0.05769015307972003, -0.0, -0.040461281324127601, -0.0,
+  -0.095466067809843694, -0.0, -0.16367001431249339, -0.0,
+  -0.19065793421500427, -0.0, -0.14803329459504444, -0.0,
+  -0.12557715669845723, -0.0, 0.2529769114665617, -0.0,
+  0.19967536837443126, -0.0, -0.46543973233067071, -0.0,
+  -0.37248348559941802, -0.0, 0.026940433099298139, -0.0,
+  0.033729758429926197, -0.0, -0.016292520910292155, -0.0,
+  -0.0099264785560859593, -0.0, 0.16627365629575652, -0.0,
+  0.21415595655950312, -0.0, 0.19923345686136068, -0.0,
+  0.20160104287017416, -0.0, 0.10982823387322625, -0.0,
+  0.084149252266098165, -0.0, 0.11091063438804613, -0.0,
+  0.074698936375968916, -0.0, -0.13276196163187984, -0.0,
+  -0.13725420357131429, -0.0, -0.043252582103361623, -0.0,
+  -0.057539021858898635, -0.0, -0.080273335921451791, -0.0,
+  0.12650861376820272, -0.0, 0.11713649947246803, -0.0,
+  0.079898466778918237, -0.0, 0.35581935293425482, -0.0,
+  -0.034052540032302882, -0.0, -0.040044859716279996, -0.0,
+  -0.035730776547861741, -0.0, -0.04301493859265338, -0.0,
+  -0.15875468282492466, -0.0, -0.12860830334525253, -0.0,
+  -0.0091840931856269521, -0.0, -0.02120380497053059, -0.0,
+  -0.078749991940019928, -0.0, -0.10092040499486302, -0.0,
+  -0.034571701636000512, -0.0, -0.03422218194274021, -0.0,
+  -0.37310165169442, -0.0, -0.33710759066452484, -0.0,
+  -0.12548523561141189, -0.0, 0.24802014394534228, -0.0,
+  0.078573633159343167, -0.0, 0.1382140206523296, -0.0,
+  0.11501701105123184, -0.0, 0.080239986828265483, -0.0,
+  0.020967472685585343, -0.0, 0.018786283050307977, -0.0,
+  0.066841222962842214, -0.0, 0.092907106211623597, -0.0,
+  0.033677429876267047, -0.0, 0.048825091278506309, -0.0,
+  -0.042618256241843989, -0.0, -0.0057687789231882902, -0.0,
+  -0.30142200599520924, -0.0, -0.2441083065941333, -0.0,
+  -0.14683417091932699, -0.0, -0.28028935048889447, -0.0,
+  0.071856272545160596, -0.0, 0.079653580673121532, -0.0,
+  0.063420879427398949, -0.0, 0.056604615791632715, -0.0,
+  -0.040791779402419064, -0.0, -0.043979819924680176, -0.0,
+  0.049753804856990935, -0.0, 0.043424432130087176, -0.0,
+  -0.0059526956725316346, -0.0, -0.015046349552104342, -0.0,
+  -0.0091480039522814534, -0.0, -0.0052037091170886486, -0.0,
+  -0.40660584169109909, -0.0, -0.46406388106862606, -0.0,
+  0.091977212126639743, -0.0, 0.059800313908315063, -0.0,
+  0.040533912974267547, -0.0, 0.055782632868173136, -0.0,
+  0.055905125258156899, -0.0, 0.046575175012377276, -0.0,
+  0.14128423424437522, -0.0, 0.18571240655116888, -0.0,
+  0.012947875521381585, -0.0, 0.036309926033519409, -0.0,
+  -0.02912213693026992, -0.0, 0.10607542403133076, -0.0,
+  0.1299450533274587, -0.0, 0.052556924809378361, -0.0,
+  0.26756678298994663, -0.0, -0.074316381618642582, -0.0,
+  -0.037929416916878088, -0.0, -0.072707552277961857, -0.0,
+  -0.054757423258067581, -0.0, 0.28836600127166467, -0.0,
+  0.22628665702947093, -0.0, 0.055242764244804697, -0.0,
+  0.12871721673449782, -0.0, 0.0056624611273102081, -0.0,
+  0.047769187594362203, -0.0, -0.013238313555792048, -0.0,
+  0.0084602723436730479, -0.0, -0.19110567479665974, -0.0,
+  -0.12444178251585607, -0.0, -0.063532957781129773, -0.0,
+  0.10502872908997109, -0.0, -0.021571703598077523, -0.0,
+  -0.005845565803593444, -0.0, -0.037466798980610644, -0.0,
+  0.0063917523165252553, -0.0, -0.13488745325416029, -0.0,
+  -0.14724211800896264, -0.0, -0.29229200864205435, -0.0,
+  -0.24293896781485635, -0.0, -0.041936240720291167, -0.0,
+  -0.038335166237129854, -0.0, -0.07476248721562602, -0.0,
+  -0.026588224527888872, -0.0, -0.053348451309800524, -0.0,
+  -0.0053442950245938103, -0.0, -0.015008308849735523, -0.0,
+  0.03208440878359195, -0.0, 0.16511146173612673, -0.0,
+  0.20733888339021142, -0.0, 0.12720494510671879, -0.0,
+  0.10261222952137296, -0.0, -0.14350943482940728, -0.0,
+  -0.054888490359039928, -0.0, 0.038323035067112161, -0.0,
+  0.095481810803470082, -0.0, -0.028711100774199191, -0.0,
+  -0.0079673760120399315, -0.0, -0.016765538688827169, -0.0,
+  -0.0018237227554956732, -0.0, -0.1842962086069902, 0.0,
+  -0.2697140037939067, 0.0, 0.029370539144826183, 0.0,
+  -0.010789816764421305, 0.0, -0.016679248057502757, 0.0,
+  -0.031165972356029078, 0.0, -0.026024217238655362, 0.0,
+  -0.026731369162044528, 0.0, 0.16336960040634874, 0.0,
+  0.14016414405134955, 0.0, 0.034770983564539754, 0.0,
+  0.037655949134787342, 0.0, 0.026814081638400624, 0.0,
+  0.011666090517911062, 0.0, -0.028834323784744861, 0.0,
+  0.013879101133876817, 0.0, -0.020289251219742649, 0.0,
+  0.041627237398141628, 0.0, -0.0023482225043922828, 0.0,
+  0.050481778225742381, 0.0, 0.0016285737634429407, 0.0,
+  0.036254576503121701, 0.0, -0.0073983601033071802, 0.0,
+  0.17591935313871751, 0.0, 0.076385439365283678, 0.0,
+  -0.27375704421008301, 0.0, -0.34294483808082987, 0.0,
+  -0.11714319324211685, 0.0, -0.12310104751591319, 0.0,
+  0.17180373329911261, 0.0, 0.10565795191672371, 0.0,
+  0.09000336488958946, 0.0, 0.17555034681845819, 0.0,
+  0.031368930315470625, 0.0, 0.010579590173695292, 0.0,
+  0.0754455554610899, 0.0, 0.010534450962000027, 0.0,
+  0.12229921366939872, 0.0, 0.095675830282164309, 0.0,
+  0.45957940354613813, 0.0, 0.36459760480620307, 0.0,
+  0.026721686792696923, 0.0, -0.0023431379800515173, 0.0,
+  -0.13098804465403496, 0.0, -0.050482705313518665, 0.0,
+  -0.03214577732676592, 0.0, -0.062200838539981505, 0.0,
+  0.0012161354033575554, 0.0, -0.072788597349702694, 0.0,
+  -0.18183238093263462, 0.0, -0.24719447612782358, 0.0,
+  -0.11294537429925414, 0.0, -0.087952168409856729, 0.0,
+  -0.32460278448980689, 0.0, -0.31967729025843677, 0.0,
+  0.21610151279948223, 0.0, 0.07388072870229867, 0.0,
+  0.085856939335506352, 0.0, 0.023568228756467142, 0.0,
+  0.098995037112946146, 0.0, 0.026946999293259864, 0.0,
+  -0.23230133853475227, -0.0, -0.29890241047442606, -0.0,
+  -0.034838995233163042, -0.0, 0.023201475002389053, -0.0,
+  -0.032242453818201025, -0.0, -0.0016705979110376423, -0.0,
+  -0.032496542699165971, -0.0, -0.0034848227162895384, -0.0,
+  0.27818076206452574, -0.0, 0.2733534221225653, -0.0,
+  0.009917083390318571, -0.0, 0.022992145660122733, -0.0,
+  -0.011160777077949272, -0.0, -0.054187092609857671, -0.0,
+  -0.024382709946779293, -0.0, -0.023585424833804231, -0.0,
+  0.034115187933640288, -0.0, 0.025101671900357305, -0.0,
+  0.029535677126030391, -0.0, 0.020924321408331024, -0.0,
+  0.051540000159289237, -0.0, -0.36819071428319361, -0.0,
+  -0.23065452017807636, -0.0, -0.16026816196523075, -0.0,
+  -0.15237706347813559, -0.0, 0.079248358115047671, -0.0,
+  0.069725357016688361, -0.0, 0.046141291410001443, -0.0,
+  0.035694804150701955, -0.0, 0.0056554515219533674, -0.0,
+  0.021947008670667945, -0.0, 0.01013809782788661, -0.0,
+  0.57760325845741656, -0.0, -0.030847531586637202, -0.0,
+  -0.003469435990076237, -0.0, -0.022654893953210416, -0.0,
+  0.031204702950833899, -0.0, -0.10570852687358641, -0.0,
+  -0.18323010911064286, -0.0, -0.010075103318158732, -0.0,
+  0.078412301638180623, -0.0, -0.029836622160824531, -0.0,
+  -0.027553197707055825, -0.0, 0.096933327655806464, -0.0,
+  0.047451943085324695, -0.0, -0.040920639152807053, -0.0,
+  -0.013498277095951791, -0.0, -0.014321095264226348, -0.0,
+  0.018341791163751446, -0.0, -0.079440044707044036, -0.0,
+  -0.034159789932916886, -0.0, -0.060576370152510869, -0.0,
+  -0.0095598369390517152, -0.0, 0.29533749820956362, -0.0,
+  0.2108897200461986, -0.0, -0.034264437565338361, -0.0,
+  -0.018905451336033392, -0.0, -0.012463907395664201, -0.0,
+  0.011620411340327583, -0.0, -0.014379153581361144, -0.0,
+  0.0014009795552406559, -0.0, -0.12825555919737408, -0.0,
+  -0.26664293752419393, -0.0, 0.24231903476168809, -0.0,
+  0.014012111406959439, -0.0, 0.068116049948673735, -0.0,
+  0.019374061129018939, -0.0, 0.073480345160133201, -0.0,
+  0.011736803103761882, -0.0, 0.16475850403338105, -0.0,
+  0.12730361078451188, -0.0, 0.0053167850252383254, -0.0,
+  -0.0048580542782330855, -0.0, -0.0051266443157515886, -0.0,
+  0.22307640399805068, -0.0, 0.115419846885428, -0.0,
+  0.11859484780679806, -0.0, 0.1563377193375193, -0.0,
+  0.01892370577376239, -0.0, -0.021188692748798702, -0.0,
+  0.021240194971443568, -0.0, -0.028352699099596968, -0.0,
+  -0.24132846107311789, -0.0, -0.16517491342763868, -0.0,
+  -0.0086401839582765805, -0.0, -0.072056753238252377, -0.0,
+  0.043308766052157076, -0.0, 0.0082691795818341275, -0.0,
+  0.030545641948223668, -0.0, 0.0031046691023286824, -0.0,
+  0.13673221674943567, -0.0, 0.031875946033579149, -0.0,
+  0.086526945947652339, -0.0, -0.76476525306408805, -0.0,
+  0.042620196256746533, -0.0, -0.022737490381312602, -0.0,
+  0.060724648898390139, -0.0, -0.041467861220925335, -0.0,
+  0.026109428164648216, -0.0, -0.039115431683944601, -0.0,
+  0.10333079474552509, -0.0, -0.017324713883752171, -0.0,
+  0.024678195725663099, -0.0, -0.0040139671481694388, -0.0,
+  0.06960304853565645, -0.0, -0.00022323730082312676, -0.0,
+  -0.016994531395966583, -0.0, -0.091312371823803903, -0.0,
+  0.0090064100686927107, -0.0, -0.16163378761966388, -0.0,
+  0.029973853573092592, -0.0, -0.058014794486757768, -0.0,
+  0.028485021193814627, -0.0, -0.041386286378998355, -0.0,
+  0.091872005411280266, -0.0, 0.0097637205864177443, -0.0,
+  0.039484383230770671, -0.0, -0.041136818431232867, -0.0,
+  0.011848595336258353, -0.0, -0.031099513070075021, -0.0,
+  0.012537974676274953, -0.0, -0.0075607091940665403, -0.0,
+  -0.085621999426137158, -0.0, 0.013509364809832952, -0.0,
+  0.12791765068587838, -0.0, 0.18058314482569993, -0.0,
+  0.033874521360125941, -0.0, -0.083275996484875506, -0.0,
+  0.06612539264078382, -0.0, -0.080780406502284935, -0.0,
+  0.0079682882935318434, -0.0, 0.01801068031328952, -0.0,
+  0.00078567438550925612, -0.0, 0.004668828900111101, -0.0,
+  -0.0055224162867081742, -0.0, -0.066612430825478908, -0.0,
+  -0.18694283121371796, -0.0, -0.0016304192515718134, -0.0,
+  0.065946158446627448, -0.0, -0.075854067572959052, -0.0,
+  0.025154293344417201, -0.0, 0.089244106047129804, -0.0,
+  -0.018430810143859184, -0.0, 0.068171414457852075, -0.0,
+  -0.081739065445317297, -0.0, -0.22976201715072367, -0.0,
+  0.24432113687608858, -0.0, 0.012410085254130617, -0.0,
+  -0.0095999124747988586, -0.0, -0.004000969843057995, -0.0,
+  0.0065293826573369481, -0.0, 0.35239144096489089, -0.0,
+  -0.041033384785891448, -0.0, -0.44887129235860507, -0.0,
+  -0.011035851349546327, -0.0, -0.0013956243992372796, -0.0,
+  -0.029438250039676851, -0.0, 0.11413793734058159, -0.0,
+  -0.047953708888801835, -0.0, -0.20820900095370806, -0.0,
+  0.082854061144166546, -0.0, 0.23023973558473917, -0.0,
+  -0.095800346436218917, -0.0, -0.050100011862163465, -0.0,
+  0.086681102838358448, -0.0, -0.007154118588785648, -0.0,
+  -0.018654409112431596, -0.0, 0.3475601556371285, -0.0,
+  0.068462888256667909, -0.0, -0.32292672246673054, -0.0,
+  -0.043036695108499078, -0.0, 0.083298458679160747, -0.0,
+  0.19460426197021272, -0.0, -0.178298609918949, -0.0,
+  -0.084123768028301571, -0.0, 0.041019385084475654, -0.0,
+  -0.013375855055549351, -0.0, 0.14882146632910281, -0.0,
+  -0.17435478990301218, -0.0, -0.010894544769528851, -0.0,
+  0.022418000424945433, -0.0, 0.072989666495690428, -0.0,
+  -0.094268357401340597, -0.0, -0.028816382744518931, 0.0,
+  0.012202008805826975, 0.0, 0.04361061845168962, 0.0,
+  0.035130270290046457, 0.0, 0.080524505901152468, 0.0,
+  -0.16201070123611355, 0.0, 0.081207460285731309, 0.0,
+  -0.09223575068131773, 0.0, 0.014690195477814668, 0.0,
+  -0.0001646299844258215, 0.0, -0.0081887858701758381, 0.0,
+  0.013442090522723039, 0.0, 0.0024931656035851288, 0.0,
+  -0.093314654376731643, 0.0, 0.037484575951714283, 0.0,
+  0.00073876040772457218, 0.0, 0.024559876706886502, 0.0,
+  0.10076054385048835, 0.0, -0.042593897097556635, 0.0,
+  -0.12717102224819224, 0.0, 0.048842800320328575, 0.0,
+  -0.032511958387164822, 0.0, 0.082156545011689938, 0.0,
+  0.3737306021302822, 0.0, -0.48888401749848637, 0.0,
+  -0.022913796265592819, 0.0, 0.059729742228592515, 0.0,
+  0.0066236315354936404, 0.0, -0.023502539383826238, 0.0,
+  0.084311510244769752, 0.0, -0.00094718316173786614, 0.0,
+  -0.11602465692390337, 0.0, 0.0013387703048100743, 0.0,
+  0.03352299720572488, 0.0, -0.13206905669135835, 0.0,
+  0.063376740480403995, 0.0, -0.026760436827063167, 0.0,
+  -0.24208339497545842, 0.0, 0.088905467314368741, 0.0,
+  -0.057076521436642595, 0.0, 0.062244876387535723, 0.0,
+  0.0088216772274569352, 0.0, 0.13035058327689941, 0.0,
+  0.0095214129884683366, 0.0, -0.004647764177002192, 0.0,
+  0.1477349859953469, 0.0, -0.033071733014337253, 0.0,
+  -0.086501977220796777, 0.0, -0.043928193799485149, 0.0,
+  0.048293917789991932, 0.0, 0.06222602616431, 0.0,
+  -0.14503545628280651, 0.0, 0.094372741420826398, 0.0,
+  0.13360822926637181, 0.0, -0.14856234690123937, 0.0,
+  -0.35426474749476244, 0.0, 0.53510963490809105, 0.0,
+  -0.044928574825215568, 0.0, -0.070503138465522613, 0.0,
+  -0.002763698536138599, 0.0, 0.10981005205042377, 0.0,
+  0.060489677863706133, 0.0, -0.015709399216625165, 0.0,
+  -0.06587514541191597, 0.0, -0.10897252206582901, 0.0,
+  0.029525129895729436, 0.0, -0.20053764772708049, 0.0,
+  0.24684899652531825, 0.0, -0.18241886852268463, 0.0,
+  -0.051778607189798806, 0.0, 0.093435660427197822, 0.0,
+  -0.010755326591625054, 0.0, 0.016671339117401124, 0.0,
+  0.017328829037193308, 0.0, 0.03644646631031518, 0.0,
+  0.074663463936629704, 0.0, -0.0090878561657586066, 0.0,
+  0.010660258563817658, 0.0, 0.13579349153266501, 0.0,
+  -0.048370535034600252, 0.0, -0.1299191394417869, 0.0,
+  0.043381807513635483, 0.0, 0.15708063405663275, 0.0,
+  -0.2273776934458592, 0.0, -0.140577469462319, 0.0,
+  0.20713922003016932, 0.0, 0.01747580163259357, 0.0,
+  -0.015547494519129049, 0.0, -0.0074619282753147862, 0.0,
+  0.001556387288257831, 0.0, -0.2210965158964808, 0.0,
+  0.027823105999373234, 0.0, 0.23668157996308722, 0.0,
+  0.049275890814436424, 0.0, -0.081000750645282657, 0.0,
+  -0.17351739987737655, 0.0, 0.095892346942277384, 0.0,
+  -0.1187688372119972, 0.0, -0.36591106964089554, 0.0,
+  0.14654568889077929, 0.0, 0.14302831162343474, 0.0,
+  -0.034417188464727237, 0.0, -0.01601026534225114, 0.0,
+  0.28868258801764796, 0.0, -0.021165782385734015, 0.0,
+  -0.019053107010756503, 0.0, -0.10719107961029851, 0.0,
+  0.022724122693912711, 0.0, 0.17420795815701057, 0.0,
+  -0.10719820322990539, 0.0, -0.27186028094810899, 0.0,
+  0.39263046459378459, 0.0, 0.12145964616326123, 0.0,
+  -0.036706456445502349, 0.0, 0.1324284296123891, 0.0,
+  -0.068485910614415571, 0.0, 0.017333588915328935, 0.0,
+  -0.09261309517571388, 0.0, 0.1269828764269485, 0.0,
+  -0.030584948495854376, 0.0, -0.015531192418971254, 0.0,
+  -0.1286920460603366, 0.0, -0.056743503354208302, -0.0,
+  -0.024003363021180908, -0.0, -0.0034419262965725604, -0.0,
+  0.038356009929169578, -0.0, -0.097906066568669139, -0.0,
+  -0.057432664990933878, -0.0, -0.094548991081242331, -0.0,
+  -0.040229589281938476, -0.0, 0.039154264572053829, -0.0,
+  0.034512362478642561, -0.0, 0.01316939079591122, -0.0,
+  0.023888454727766684, -0.0, 0.00063486860887145371, -0.0,
+  0.019184151183192801, -0.0, 0.073338854116648422, -0.0,
+  0.0060059486028954407, -0.0, 0.17252810146834643, -0.0,
+  -0.0059486048459008525, -0.0, 0.0193455230492139, -0.0,
+  -0.0048774691195057011, -0.0, 0.03075934325968524, -0.0,
+  -0.055170082597213101, -0.0, -0.034391656568502037, -0.0,
+  -0.040622753118894399, -0.0, -0.079703640706782306, -0.0,
+  -0.047403389659830035, -0.0, -0.069731705966982804, -0.0,
+  -0.010001852876901505, -0.0, -0.019563816802145674, -0.0,
+  -0.45184580404262248, -0.0, -0.3352065209773708, -0.0,
+  -0.13790100461479063, -0.0, -0.12314345118069202, -0.0,
+  -0.075642711824043418, -0.0, -0.1293105287542505, -0.0,
+  -0.11928429895466991, -0.0, -0.0414176803708379, -0.0,
+  0.11461387215259052, -0.0, 0.20178459878374524, -0.0,
+  0.28034209545552624, -0.0, 0.31242987043246778, -0.0,
+  -0.027064769969949838, -0.0, -0.04484285072162706, -0.0,
+  0.029011023703211083, -0.0, 0.014503663629849015, -0.0,
+  0.19005445044617089, -0.0, 0.22710137439509764, -0.0,
+  0.087699134672960713, -0.0, 0.40023488721210504, -0.0,
+  0.103911125957, -0.0, 0.14664609961490285, -0.0,
+  0.051334088267905996, -0.0, 0.042971117372613526, -0.0,
+  -0.014463178505279735, -0.0, 0.0049593587462205381, -0.0,
+  -0.25074513248424185, -0.0, -0.17047697647441729, -0.0,
+  -0.010940921147621395, -0.0, 0.0091679825374586677, -0.0,
+  -0.012640504900427113, -0.0, -0.00099460439197865467, -0.0,
+  -0.091185269422280363, -0.0, 0.029551327078410339, -0.0,
+  -0.10549720216207065, -0.0, -0.0072428064066555253, -0.0,
+  -0.05961503415617752, -0.0, 0.016100712487611891, -0.0,
+  -0.076359174998479273, -0.0, 0.001233455708663614, -0.0,
+  0.024286212550682595, -0.0, 0.077229553953788832, -0.0,
+  -0.021090066646996818, -0.0, 0.0078008638226196849, -0.0,
+  -0.0017794409218984529, -0.0, -0.028180838198119413, -0.0,
+  0.10403427598065791, -0.0, -0.031627641482062124, -0.0,
+  0.13564744550063587, -0.0, -0.032781079112563082, -0.0,
+  0.028591542583158359, -0.0, -0.03511994446639527, -0.0,
+  0.060350084085430002, -0.0, -0.22629548493668405, -0.0,
+  -0.085217996605091537, -0.0, 0.013040473267646093, -0.0,
+  0.15052067399803565, -0.0, 0.024518415989033336, -0.0,
+  0.11111114882881599, -0.0, -0.0084230736055681543, -0.0,
+  0.036063680094256347, -0.0, -0.15303525704679108, -0.0,
+  0.086942987294800503, -0.0, -0.10424104381881469, -0.0,
+  -0.085751568124856292, -0.0, 8.9214560439483318e-05, -0.0,
+  0.193156198809185, -0.0, -0.037624877920828373, -0.0,
+  0.034113839810736769, -0.0, 0.071532591170271859, -0.0,
+  0.39973590534288017, -0.0, -0.3324546198498442, -0.0,
+  -0.27895803831172306, -0.0, 0.062921360330682075, -0.0,
+  0.20734913129693913, -0.0, -0.081193844662733425, -0.0,
+  -0.0083685967724540303, -0.0, -0.020234873007522913, -0.0,
+  0.14330116007096041, -0.0, -0.020672066020534164, -0.0,
+  0.16490866517482802, -0.0, -0.2254825205552688, -0.0,
+  -0.042543305240408121, -0.0, -0.14729587296517957, -0.0,
+  0.025026093070939101, -0.0, -0.32025113592092108, -0.0,
+  -0.1690832334826142, -0.0, 0.34260730560555691, -0.0,
+  0.32373581150742509, -0.0, -0.041592564195478791, -0.0,
+  0.069217612437734347, -0.0, -0.068438141807387054, -0.0,
+  0.0029188704115757974, -0.0, -0.045144488843637684, -0.0,
+  0.033038416388669903, -0.0, 0.03635348921990568, -0.0,
+  0.011564373285191804, -0.0, 0.061867248691474891, -0.0,
+  -0.0088030536894745451, -0.0, -0.054929082023496577, -0.0,
+  0.0036376961865728858, -0.0, 0.083664986163270921, -0.0,
+  -0.11465687802659748, -0.0, -0.0074773757455013799, -0.0,
+  0.0055333032151254858, -0.0, 0.00028088174423333986, -0.0,
+  -0.015980439367619254, -0.0, -0.0092928252595227585, -0.0,
+  0.0032002662391345418, -0.0, -0.021809708672467575, -0.0,
+  0.3796913207700498, -0.0, -0.38834686407175689, -0.0,
+  -0.29540934526799073, -0.0, 0.26521201660380345, -0.0,
+  -0.23070118673256884, -0.0, 0.37876016879582319, -0.0,
+  -0.06655972517843467, -0.0, 0.14104428301982547, -0.0,
+  0.084211387146874872, -0.0, -0.13602232815856463, -0.0,
+  0.013112270470623574, -0.0, -0.025771031977085381, -0.0,
+  -0.002788205176793318, -0.0, 0.008725045645208835, -0.0,
+  -0.035130590880914095, -0.0, 0.0020338397533081593, -0.0,
+  0.085205695516068422, -0.0, -0.034645121285412743, -0.0,
+  -0.056718064123357878, -0.0, 0.0030024932116005901, -0.0,
+  0.022744079980490314, -0.0, -0.068743949809611973, -0.0,
+  -0.073912056675534715, -0.0, 0.094982652865551298, -0.0,
+  0.068800756312578232, -0.0, 0.0029962241036747689, -0.0,
+  -0.023980502929217284, -0.0, -0.013376956845575633, -0.0,
+  0.06345019436422418, -0.0, 0.013776714658644789, -0.0,
+  -0.001759683772303711, -0.0, -0.062826829239668036, -0.0,
+  -0.0027424217332374544, -0.0, 0.18698099413589547, -0.0,
+  -0.10724354525791772, -0.0, 0.00047483999615372565, -0.0,
+  -0.015861831696647278, -0.0, 0.015382092563219679, -0.0,
+  0.30660151623791032, -0.0, -0.43493358662932924, -0.0,
+  -0.17403801279004211, -0.0, 0.039488935754482812, -0.0,
+  0.12590060743563192, -0.0, -0.012113098614941045, -0.0,
+  -0.012530737325150683, 0.0, 0.029133172527749655, 0.0,
+  0.012530792209408148, 0.0, -0.066803174807084156, 0.0,
+  0.024260639191152209, 0.0, -0.15444129192704029, 0.0,
+  0.12461271126098018, 0.0, -0.12907890564762545, 0.0,
+  0.050892680822104443, 0.0, -0.071997471345776984, 0.0,
+  -0.014986834901060252, 0.0, 0.019264407190832198, 0.0,
+  0.013473073578331121, 0.0, 0.0052017896778326399, 0.0,
+  0.087760217170166382, 0.0, 0.012042068713361512, 0.0,
+  -0.053740329595556607, 0.0, -0.36412244313565056, 0.0,
+  0.10281724311619242, 0.0, 0.34677802647098838, 0.0,
+  -0.082345379588420517, 0.0, -0.21640152063797763, 0.0,
+  0.34702547150791008, 0.0, -0.043226678452929324, 0.0,
+  -0.012080834939680625, 0.0, 0.10032942840092546, 0.0,
+  -0.14917809540785321, 0.0, 0.021200430296311128, 0.0,
+  -0.052675876132690237, 0.0, -0.12626669179581684, 0.0,
+  0.053974076519279386, 0.0, 0.016991856034922582, 0.0,
+  0.043754911582876671, 0.0, 0.03689759445268076, 0.0,
+  -0.15339243053722795, 0.0, 0.0064400687788841188, 0.0,
+  -0.069804280002562807, 0.0, 0.14921208372514236, 0.0,
+  -0.1641191937367972, 0.0, -0.14537797066551508, 0.0,
+  0.15778606083156613, 0.0, 0.15464169484715964, 0.0,
+  0.17212256750360713, 0.0, -0.028796140098913178, 0.0,
+  -0.029705431420244351, 0.0, 0.097609465446894847, 0.0,
+  -0.017285465355873671, 0.0, 0.091204195939648999, 0.0,
+  -0.15672347954832128, 0.0, -0.24001631579904659, 0.0,
+  0.2998623884268215, 0.0, 0.085594639478103279, 0.0,
+  -0.0058396455486958701, 0.0, 0.0083634058971194421, 0.0,
+  -0.053120928271633672, 0.0, -0.0016809526781693563, 0.0,
+  0.0097958396944332529, 0.0, -0.32219796159310959, 0.0,
+  0.03591053933090254, 0.0, 0.21525066117100305, 0.0,
+  0.0052022591011286782, 0.0, -0.03011148297239297, 0.0,
+  0.03812688464414709, 0.0, -0.029736608053083226, 0.0,
+  -0.043780892899568706, 0.0, -0.037306650586922119, 0.0,
+  0.054463991749760209, 0.0, 0.023883408883107232, 0.0,
+  0.045571124956892139, 0.0, 0.106093535942548, 0.0,
+  -0.12811808779772235, 0.0, 0.005530729156176196, 0.0,
+  -0.0085310281579577471, 0.0, 0.003583441369014661, 0.0,
+  0.085050023264732821, 0.0, 0.0037670592638976734, 0.0,
+  0.0056576972261169773, 0.0, -0.058649619219916654, 0.0,
+  -0.036610137376144741, 0.0, -0.072433621046574345, 0.0,
+  0.083606762848739857, 0.0, 0.03216874756387185, 0.0,
+  -0.16231532866685477, 0.0, 0.29542377547413762, 0.0,
+  -0.21113387078486082, 0.0, 0.071675983929738687, 0.0,
+  0.15386197379958352, 0.0, -0.051139182740934166, 0.0,
+  0.0053116261768407381, 0.0, -0.052710074009774822, 0.0,
+  0.032644270121389748, 0.0, -0.063491976416833754, 0.0,
+  0.064658633298142212, 0.0, 0.022144154632991183, 0.0,
+  -0.10926165718177637, 0.0, 0.12715872845231224, 0.0,
+  -0.05439927333000262, 0.0, -0.0040896720570496826, 0.0,
+  -0.20879901283454547, 0.0, 0.060354565007196367, 0.0,
+  0.59185271174628507, 0.0, -0.30187709003421132, 0.0,
+  -0.091256739531397096, 0.0, 0.069976194275663053, 0.0,
+  -0.12334691489137015, 0.0, -0.11331899591172562, 0.0,
+  -0.12435963585636163, 0.0, 0.014419818160852943, 0.0,
+  -0.024110119100304646, 0.0, 0.1099339456017404, 0.0,
+  0.075491836660396425, 0.0, -0.1993676522872854, 0.0,
+  0.038202449338465963, 0.0, 0.033879703617490188, 0.0,
+  0.1451675228807626, 0.0, -0.15667816724465414, 0.0,
+  -0.28023026822727504, 0.0, 0.33759985404824733, 0.0,
+  0.25052741764218539, 0.0, -0.027343770526467203, 0.0,
+  -0.14889008991360911, 0.0, -0.034390952075848691, 0.0,
+  0.029708473277238506, -0.0, -0.023346800579857174, -0.0,
+  -0.011728972903726605, -0.0, 0.0054121731441100634, -0.0,
+  0.0069175596315879401, -0.0, 0.010111128545306686, -0.0,
+  0.0037787671709665596, -0.0, 0.0044872117987873649, -0.0,
+  -0.067346040695675333, -0.0, 0.07207275030038876, -0.0,
+  0.010545982318854509, -0.0, -0.0089001486448639471, -0.0,
+  -0.0010736264433939555, -0.0, 0.022097535923802102, -0.0,
+  -0.027527223585644866, -0.0, -0.0038781006661283667, -0.0,
+  0.0075959011610090728, -0.0, 0.12748559621814623, -0.0,
+  0.074674409804513897, -0.0, -0.14371713554281407, -0.0,
+  -0.04640337297017956, -0.0, 0.080226226483202462, -0.0,
+  -0.15387660765182889, -0.0, -0.10102023246808775, -0.0,
+  0.094543051312032889, -0.0, 0.070427091542182366, -0.0,
+  0.011327079465878694, -0.0, -0.01088605903518566, -0.0,
+  -0.0075876743179837626, -0.0, 0.0071964671900211158, -0.0,
+  -0.0031760568902044753, -0.0, 0.0089190066615844488, -0.0,
+  0.0092091469372135738, -0.0, -0.017620151227488265, -0.0,
+  0.062597610519954175, -0.0, -0.12236620391625398, -0.0,
+  -0.020593256269997317, -0.0, 0.17206256748361992, -0.0,
+  -0.11418803107649057, -0.0, 0.36806868584927038, -0.0,
+  -0.24016718297668357, -0.0, -0.032049368556026407, -0.0,
+  0.11881136605080206, -0.0, -0.094431952772163472, -0.0,
+  -0.053659266941235219, -0.0, -0.056525587499820062, -0.0,
+  -0.0033851137679828786, -0.0, -0.0037698478487526148, -0.0,
+  0.064114656925176844, -0.0, 0.054042816610331924, -0.0,
+  -0.18912668849972622, -0.0, 0.075120112571211511, -0.0,
+  -0.003893130793953945, -0.0, -0.019865906271647152, -0.0,
+  0.027836815357672646, -0.0, -0.23588158011056651, -0.0,
+  0.23775405631457852, -0.0, -0.61548422054423824, -0.0,
+  0.080027334071304967, -0.0, 0.39484715132920212, -0.0,
+  0.12145680949864902, -0.0, 0.0071954691306834505, -0.0,
+  0.0040604319291758402, -0.0, -0.038159094878957411, -0.0,
+  0.0069173104010330916, -0.0, 0.025439747643568211, -0.0,
+  -0.063835851181011372, -0.0, 0.043499832532254326, -0.0,
+  -0.054244788689992544, -0.0, 0.020393089264495179, -0.0,
+  -0.016190830978704766, -0.0, -0.0074850920262741838, -0.0,
+  0.0094426613711051967, -0.0, 0.0036346877925297989, -0.0,
+  -0.0050780125224936627, -0.0, -0.038652461134281765, -0.0,
+  -0.013799084493575031, -0.0, 0.049522955404368761, -0.0,
+  0.0071841895045428542, -0.0, 0.15534864881379878, -0.0,
+  -0.064248545654860961, -0.0, -0.094239521547994837, -0.0,
+  -0.038124127109510429, -0.0, 0.066954521762927918, -0.0,
+  0.084607080302231907, -0.0, -0.014931524426963149, -0.0,
+  0.059448907115155512, -0.0, -0.1026431429589069, -0.0,
+  0.015603002678475034, -0.0, -0.022291638294349887, -0.0,
+  0.4446944891024926, -0.0, -0.38381001494781974, -0.0,
+  0.098222264168877291, -0.0, -0.043554395457791543, -0.0,
+  0.0090188935464637007, -0.0, -0.012563343297749694, -0.0,
+  -0.00039737977482685996, -0.0, -0.014631044941846817, -0.0,
+  -0.15590355159601832, -0.0, 0.04926875713104132, -0.0,
+  -0.23253946301267259, -0.0, 0.21158263655306489, -0.0,
+  0.0092709198619156056, -0.0, 0.10058015875132072, -0.0,
+  -0.0087317926062958316, -0.0, 0.0078953059749572018, -0.0,
+  -0.48230604703087382, -0.0, 0.18427504940192155, -0.0,
+  -0.16178602719067919, -0.0, 0.40455465075935004, -0.0,
+  0.051415088016894948, -0.0, -0.078156313101790359, -0.0,
+  0.081228024826331305, -0.0, -0.048330486021060354, -0.0,
+  0.06213403663747382, -0.0, -0.017244093184211169, -0.0,
+  0.13588670275671796, -0.0, -0.18739394552817318, -0.0,
+  -0.051016984875994952, -0.0, 0.016216812899987113, -0.0,
+  0.041226912604816715, -0.0, -0.014434640174290424, -0.0,
+  -0.048744380988478178, -0.0, 0.029749652674764891, -0.0,
+  0.059017843669474011, -0.0, 0.010813500562783462, -0.0,
+  0.020170617149680058, -0.0, 0.040745683262504134, -0.0,
+  -0.032127174312762082, -0.0, -0.0013378517671835989, -0.0,
+  0.08093211107731009, -0.0, -0.089017630636360451, -0.0,
+  -0.0058586501752514002, -0.0, 0.0032044180833840654, -0.0,
+  0.0025508625213153365, -0.0, -0.060293528632901321, -0.0,
+  0.037090505429366163, -0.0, 0.0048865766748563072, -0.0,
+  -0.036055654076369022, -0.0, 0.20010443554264201, -0.0,
+  0.56990357778274703, -0.0, -0.34090387987705589, -0.0,
+  -0.41531864120902379, -0.0, -0.10487051105901833, -0.0,
+  0.12075358326171595, -0.0, 0.014785515611403991, -0.0,
+  0.10366945849085506, -0.0, 0.19319421512770379, -0.0,
+  -0.16892440217233518, -0.0, 0.028937897771657235, -0.0,
+  -0.053983468444912378, -0.0, -0.21969811472001458, -0.0,
+  0.17264141805995331, -0.0, -0.036724102677314727, -0.0,
+  0.020303740950427768, -0.0, 0.020903781342923276, -0.0,
+  0.053332119954126712, -0.0, 0.039741611571447004, -0.0,
+  -0.0049709892587201975, -0.0, -0.060816412236720012, -0.0,
+  0.040348711593057508, -0.0, -0.039285113681133181, -0.0,
+  0.1089517001495143, -0.0, -0.019333725729959911, -0.0,
+  -0.084272709976172505, -0.0, -0.091888361452799577, -0.0,
+  -0.054665818767040318, -0.0, 0.24335176086928176, -0.0,
+  -0.06896097999315319, -0.0, 0.084825705083343209, -0.0,
+  -0.2043318815793545, -0.0, 0.060633087548880971, -0.0,
+  0.036409252459339764, -0.0, -0.08554229478680353, -0.0,
+  -0.099187778705680255, -0.0, 0.024863433116916502, -0.0,
+  -0.038423991451367524, -0.0, 0.048596222402323266, -0.0,
+  -0.045772428154887523, -0.0, 0.12980631895598563, -0.0,
+  0.022630080265669691, -0.0, -0.069377706093676522, -0.0,
+  -0.047161216400905065, -0.0, -0.087023798460830193, -0.0,
+  0.10217285356590791, -0.0, -0.047904102043943422, -0.0,
+  -0.16130414670815285, -0.0, 0.05530912922047828, -0.0,
+  -0.039077184342746402, -0.0, 0.049903557463378233, -0.0,
+  -0.036858329172032342, -0.0, 0.13607070518895761, -0.0,
+  -0.15417245014120626, -0.0, 0.014341889304020621, -0.0,
+  -0.011561910521866683, -0.0, 0.0093296358998935184, -0.0,
+  0.3039698132839207, -0.0, 0.0097563779554953253, -0.0,
+  0.052337655375139305, -0.0, -0.22475684860247486, -0.0,
+  0.083714692203161009, -0.0, 0.17472829717213934, -0.0,
+  -0.11192729695426923, -0.0, -0.15627045697398764, -0.0,
+  -0.14741540353690857, -0.0, 0.2210288121719837, -0.0,
+  -0.1434524523932855, -0.0, 0.10060548698373786, -0.0,
+  -0.52521807540582344, -0.0, 0.28207024567613115, -0.0,
+  -0.045201172994776939, -0.0, 0.078819219402624874, -0.0,
+  0.0032045856700559645, -0.0, -0.049806598970498529, -0.0,
+  -0.026313003335053761, -0.0, 0.079082543305498298, -0.0,
+  0.016625035876414354, -0.0, -0.091983522188327574, -0.0,
+  -0.043820791653584358, -0.0, -0.035816686640574212, -0.0,
+  0.030103805233057411, -0.0, -0.047078065706577993, -0.0,
+  0.1376983361134218, -0.0, -0.33156494933073338, -0.0,
+  0.022719249742221951, -0.0, 0.048963038049527438, -0.0,
+  0.39636508031770618, -0.0, 0.10325067734314353, -0.0,
+  -0.053884550060144767, -0.0, 0.073252617508243953, -0.0,
+  -0.043776645100242061, -0.0, 0.042045173099335802, -0.0,
+  -0.01159707688214782, -0.0, 0.084617439928676139, -0.0,
+  -0.027783021526316249, -0.0, -0.014698446398792166, -0.0,
+  0.027798421964866361, -0.0, -0.058275811603984484, -0.0,
+  0.0078633464012783389, -0.0, 0.023220450093436568, -0.0,
+  -0.049226868575477749, -0.0, -0.026602265730042037, -0.0,
+  0.021847555040631367, -0.0, 0.011556205400314689, -0.0,
+  0.070024027657233326, -0.0, -0.091389933379336, -0.0,
+  0.14029152210291973, -0.0, 0.20779575240647361, -0.0,
+  0.049093053135132521, -0.0, -0.011294015324146603, -0.0,
+  -0.0078821679059830774, -0.0, -0.00060671981170422708, -0.0,
+  -0.091049342756313045, -0.0, 0.075227926921049557, -0.0,
+  -0.036180944754102495, -0.0, 0.01826634445964059, -0.0,
+  -0.014189122375020664, -0.0, -0.4451909727181278, -0.0,
+  -0.0042747887952967493, -0.0, -0.063997936279655082, -0.0,
+  0.21397524858938105, -0.0, 0.045247009335048327, -0.0,
+  0.044913893574639221, -0.0, -0.034567742787207784, -0.0,
+  -0.048508431861763256, -0.0, -0.031279980673608404, -0.0,
+  0.041627685743055816, -0.0, -0.056830419562796913, -0.0,
+  0.0042577706150128299, -0.0, -0.060407292848682147, -0.0,
+  0.066978354084063205, -0.0, -0.016492333505963224, -0.0,
+  0.0012831936915577082, -0.0, 0.097172443104916753, -0.0,
+  -0.062787268920752357, -0.0, 0.097619343731657024, -0.0,
+  -0.056048859005000749, -0.0, 0.066915729283132205, -0.0,
+  -0.17148783006260754, -0.0, -0.28595511430536219, -0.0,
+  -0.096520963912596111, -0.0, 0.26605840735938552, -0.0,
+  -0.29808510004600536, -0.0, 0.24402425987250365, -0.0,
+  -0.17350436628184177, -0.0, 0.27972918781831851, -0.0,
+  0.18163175054251887, -0.0, 0.015040079051658337, -0.0,
+  -0.020553537223855792, -0.0, -0.083531455400779303, -0.0,
+  -0.0082119890862992952, -0.0, 0.0049127938144812111, -0.0,
+  0.034585429082973893, -0.0, 0.020747704899156866, -0.0,
+  0.13083735679053629, -0.0, -0.069024164612445649, -0.0,
+  0.0015602656183689491, -0.0, -0.2615424259992426, -0.0,
+  0.21667587204848049, -0.0, -0.050932410593950171, -0.0,
+  0.10045682927671634, -0.0, 0.2218189198223062, -0.0,
+  -0.091999103227959941, -0.0, -0.14070738527598911, -0.0,
+  -0.073734035137924508, -0.0, 0.1057797972070804, 0.0,
+  -0.045733104434633964, 0.0, -0.15107585538260498, 0.0,
+  -0.2357471900772877, 0.0, 0.072730636376317423, 0.0,
+  -0.036063547638223455, 0.0, 0.0084369614114019505, 0.0,
+  -0.03863332798305389, 0.0, -0.17609099133665396, 0.0,
+  0.16792427055087475, 0.0, -0.049643240940791554, 0.0,
+  0.034193728088460044, 0.0, 0.023029323988519736, 0.0,
+  0.57569531125031348, 0.0, -0.041698737209336798, 0.0,
+  0.085409932999461854, 0.0, -0.29538393490770898, 0.0,
+  0.016448373872881179, 0.0, 0.0085354648738050799, 0.0,
+  -0.067480370689698893, 0.0, 0.034397869861783947, 0.0,
+  0.007891172927204029, 0.0, -0.075108936766657378, 0.0,
+  0.06541461489851387, 0.0, -0.065723374254799946, 0.0,
+  0.14123795787201626, 0.0, -0.047060097974899739, 0.0,
+  0.0049396741159331925, 0.0, -0.024209913491264806, 0.0,
+  0.030204497108360116, 0.0, 0.01056816605559188, 0.0,
+  -0.20650963096102404, 0.0, 0.12596484495617657, 0.0,
+  0.10383744498171132, 0.0, -0.14313364834708384, 0.0,
+  -0.11767797149989456, 0.0, -0.047221808156313605, 0.0,
+  0.20909748205859841, 0.0, -0.19657411791476145, 0.0,
+  0.04835885077769668, 0.0, 0.045487846440490101, 0.0,
+  0.21255935361708519, 0.0, 0.050280581815228272, 0.0,
+  -0.13294765082424079, 0.0, -0.040166309600001893, 0.0,
+  0.013375191930935422, 0.0, 0.10002566335876793, 0.0,
+  -0.12481813926773601, 0.0, 0.057867715403742095, 0.0,
+  0.043437618814849727, 0.0, 0.051949721695508065, 0.0,
+  -0.075640536975825151, 0.0, -0.0071289473999305349, 0.0,
+  -0.24928440373991798, 0.0, 0.21785523684297498, 0.0,
+  -0.034402277492120562, 0.0, 0.093638818930732781, 0.0,
+  0.18330337684638487, 0.0, -0.056437555674294149, 0.0,
+  -0.11637730933826206, 0.0, -0.051904571650380975, 0.0,
+  0.44562601297223431, -0.0, -0.35861353592831502, -0.0,
+  0.056508829717904926, -0.0, 0.036469014780465082, -0.0,
+  -0.033516807518444297, -0.0, -0.02630470857691165, -0.0,
+  -0.043339586221454125, -0.0, -0.020568660005969849, -0.0,
+  -0.45111761028531894, -0.0, 0.40498171755559959, -0.0,
+  -0.036889910950331742, -0.0, 0.038466749999816745, -0.0,
+  -0.0011855127950435784, -0.0, -0.053311385553577194, -0.0,
+  -0.028678612220523685, -0.0, -0.0023771923421576613, -0.0,
+  -0.023787126462852092, -0.0, 0.030593701581548342, -0.0,
+  0.004275070116142878, -0.0, -0.010424137069410415, -0.0,
+  -0.024314551917305544, -0.0, -0.10611632534560643, -0.0,
+  0.17737578119074121, -0.0, -0.1465294853888903, -0.0,
+  0.13089951336162342, -0.0, -0.042917107942469515, -0.0,
+  -0.068890752628332011, -0.0, 0.015427431915585692, -0.0,
+  -0.008867663744545692, -0.0, -0.084338727347824008, -0.0,
+  0.10845653615303745, -0.0, -0.033798096913631545, -0.0,
+  -0.01644844059461802, -0.0, 0.038536711002408554, -0.0,
+  -0.054703909673819266, -0.0, 0.19845096141334218, -0.0,
+  0.01054044069189071, -0.0, 0.026806916423736272, -0.0,
+  0.057717332905136524, -0.0, -0.081213035646862095, -0.0,
+  -0.014004209700839373, -0.0, -0.030812668199558486, -0.0,
+  -0.12496837977286274, -0.0, 0.11372845775089155, -0.0,
+  0.011680631388869173, -0.0, -0.07441403370748656, -0.0,
+  0.051453992132160738, -0.0, -0.048678910071582142, -0.0,
+  0.054653829086078735, -0.0, 0.025671922074552392, -0.0,
+  -0.036752231528261119, -0.0, 0.007058779350343887, -0.0,
+  0.015550769243865009, -0.0, 0.22357755908249996, -0.0,
+  -0.28148555289647359, -0.0, -0.074739501092299349, -0.0,
+  0.12444443825396248, -0.0, -0.015861480363040498, -0.0,
+  0.057626205970337796, -0.0, -0.030570292599211665, -0.0,
+  0.023960836891058528, -0.0, -0.020912403867391863, -0.0,
+  0.0066797287971102947, -0.0, 0.083212779114875568, -0.0,
+  0.013080214662487738, -0.0, 0.051693998029593437, -0.0,
+  -0.017834100236560714, -0.0, 0.079803922428292831, -0.0,
+  -0.020165597735678966, -0.0, 0.0093300644949222498, -0.0,
+  -0.00042548750812199516, -0.0, -0.014151528990178059, -0.0,
+  0.0088655609366178143, -0.0, 0.0022615244966283461, -0.0,
+  -0.0014919808670109183, -0.0, -0.032560844269842425, -0.0,
+  0.021210984650592624, -0.0, -0.057117345167635183, -0.0,
+  -0.019084250611457954, -0.0, -0.028111332438413707, -0.0,
+  -0.0048911068341638874, -0.0, 0.092576405532841077, -0.0,
+  0.058319776561914345, -0.0, -0.015467277720958773, -0.0,
+  -0.089938135873066857, -0.0, 0.14392346768150427, -0.0,
+  -0.045603269630972908, -0.0, -0.27097274634753521, -0.0,
+  0.045189209066172624, -0.0, -0.044732013370429084, -0.0,
+  -0.16033871907037228, -0.0, 0.21195029676316932, -0.0,
+  -0.096512262056477643, -0.0, -0.0054081014552632024, -0.0,
+  -0.053294130053429839, -0.0, 0.16293468129167535, -0.0,
+  -0.32145394877106437, -0.0, -0.00066805869199666713, -0.0,
+  -0.16897777950447102, -0.0, -0.034321837642345705, -0.0,
+  -0.30831315265553233, -0.0, 0.24836745973478613, -0.0,
+  0.060822750363827997, -0.0, 0.2969040573749866, -0.0,
+  0.2390396045678399, -0.0, 0.052432437560537788, -0.0,
+  0.10266780579361855, -0.0, -0.014226887728877783, -0.0,
+  0.022818381228498625, -0.0, -0.02709744492333381, -0.0,
+  0.28878585219469605, -0.0, -0.54864121283954759, -0.0,
+  0.15085825322969201, -0.0, -0.14087986548818932, -0.0,
+  0.04360069174758948, -0.0, 0.017495560593242997, -0.0,
+  -0.059087630062680321, -0.0, 0.12601393066669936, -0.0,
+  0.021478645895742273, -0.0, 0.059229428805657687, -0.0,
+  -0.07178770748412576, -0.0, -0.027079314368687393, -0.0,
+  0.22399033785011677, -0.0, -0.18629353019482803, -0.0,
+  -0.064704916616415004, -0.0, -0.017685150978888068, -0.0,
+  0.0017154578811786577, -0.0, 0.10560350521159886, -0.0,
+  0.056235479831789476, -0.0, 0.050033549397916079, -0.0,
+  -0.17134552525705621, -0.0, 0.14105490990155933, -0.0,
+  0.029295358243033934, -0.0, -0.042079429810517731, -0.0,
+  -0.0025334396026284122, -0.0, 0.01376646836285223, -0.0,
+  0.040734359208536207, -0.0, -0.008283689856792056, -0.0,
+  0.003066549195183961, -0.0, -0.065550713816378101, -0.0,
+  0.056117255072157264, -0.0, 0.019442623828897717, -0.0,
+  -0.0156659244680625, -0.0, -0.075723590859017989, -0.0,
+  0.11506473223672289, -0.0, 0.28815854261846074, -0.0,
+  -0.29296695972360193, -0.0, -0.050859020739624942, -0.0,
+  0.17499032766546438, -0.0, -0.031414967006800215, -0.0,
+  0.013962281072718897, -0.0, -0.058084113933870918, -0.0,
+  0.050735665048669651, -0.0, -0.049360096428840962, -0.0,
+  0.023376496871086585, -0.0, -0.12988457440055629, -0.0,
+  0.1961656488863488, -0.0, -0.2290446806124726, -0.0,
+  -0.001833362605019881, -0.0, -0.25486663239304103, -0.0,
+  0.055981405193042295, -0.0, 0.27881579256352002, -0.0,
+  -0.09607507591272528, -0.0, -0.084207568422880588, -0.0,
+  0.1834223040904, -0.0, -0.090374840949789911, -0.0,
+  -0.014711412135440152, -0.0, 0.10199762768206237, -0.0,
+  -0.02724557224330923, -0.0, 0.029205151885900043, -0.0,
+  -0.059944418664448239, -0.0, 0.030935850042289274, -0.0,
+  -0.061230815200222999, -0.0, 0.05840978032104932, -0.0,
+  -0.095900091066670468, -0.0, 0.017736815224125572, -0.0,
+  0.10601199147218809, -0.0, 0.3544511000956716, -0.0,
+  -0.52752639223774611, -0.0, -0.024764437551811912, -0.0,
+  -0.036029586797885246, -0.0, 0.077370282828550047, -0.0,
+  -0.031657119295744537, -0.0, 0.031100208751691508, -0.0,
+  -0.01954556783760248, -0.0, 0.22724775402089697, -0.0,
+  0.035354894499300973, -0.0, -0.00465276939965493, -0.0,
+  -0.17115176160025081, -0.0, 0.0092843303064798956, -0.0,
+  -0.1252327938036866, -0.0, 0.097658697618133117, -0.0,
+  -0.073999399666741059, -0.0, -0.052155311370516363, -0.0,
+  0.064090477330966025, -0.0, 0.0061592724564167069, -0.0,
+  -0.10061142157047341, -0.0, -0.050654387943739623, -0.0,
+  0.043639153857468423, -0.0, -0.16638471801156546, -0.0,
+  -0.052911833919773388, -0.0, 0.018235284510212328, -0.0,
+  -0.033689592309370776, -0.0, 0.087146856401417477, -0.0,
+  -0.043594998277666122, -0.0, 0.057446827186655038, -0.0,
+  0.014976508357531554, -0.0, -0.068773584081006242, -0.0,
+  -0.011317714030858425, -0.0, 0.12976028834630005, -0.0,
+  -0.024073871832294487, -0.0, 0.02269706594359799, -0.0,
+  -0.30909995914010835, -0.0, 0.2931011826997838, -0.0,
+  -0.020473453593188258, -0.0, 0.011618637401303276, -0.0,
+  0.080037436455438177, -0.0, -0.075952879205862259, -0.0,
+  0.3838515002243334, -0.0, -0.018813504970155468, -0.0,
+  -0.1140045730861008, -0.0, 0.025963336860976741, -0.0,
+  0.11381926020890845, -0.0, -0.079743524450885894, -0.0,
+  -0.016685897886349041, -0.0, -0.052040609283306873, -0.0,
+  -0.087800544435902197, -0.0, -0.013859947116248503, -0.0,
+  -0.18045245254458411, -0.0, 0.1605848261797862, -0.0,
+  -0.034114125634076738, -0.0, 0.10919207383185119, -0.0,
+  0.17302230783316877, -0.0, -0.31249251011275214, -0.0,
+  0.15449100785197806, -0.0, -0.12219821360043208, -0.0,
+  -0.35388955288680674, -0.0, 0.42127296148029975, -0.0,
+  0.069210628685111464, -0.0, -0.06107388978671989, -0.0,
+  -0.022217677881507841, -0.0, 0.024961912194689403, -0.0,
+  0.018146439764037115, -0.0, -0.010408089988545779, -0.0,
+  -0.17205642606260413, 0.0, 0.15509495746259402, 0.0,
+  -0.17699749580552754, 0.0, -0.037587145629019159, 0.0,
+  -0.050305968608400815, 0.0, 0.075505701237759626, 0.0,
+  -0.046616813472063923, 0.0, 0.043287963639037079, 0.0,
+  -0.086298253478498038, 0.0, 0.085396965027541766, 0.0,
+  -0.041421734551118874, 0.0, 0.039857043715433936, 0.0,
+  -0.00061508722209128747, 0.0, -0.022374862079300034, 0.0,
+  0.1978075359497356, 0.0, -0.051038849876304901, 0.0,
+  0.17533276229050004, 0.0, -0.092490082533774845, 0.0,
+  0.070536059273364995, 0.0, -0.099908561744066579, 0.0,
+  0.10875931418058145, 0.0, -0.0002927389327289832, 0.0,
+  0.057840076296530693, 0.0, -0.0298024999266089, 0.0,
+  0.083257584070539042, 0.0, -0.10263777238635199, 0.0,
+  -0.015258916598907346, 0.0, -0.047624043261644301, 0.0,
+  0.0031380624503425055, 0.0, 0.021125070279089941, 0.0,
+  0.41158125863409561, 0.0, -0.07423400432774109, 0.0,
+  -0.20441828048409641, 0.0, -0.052038162370437256, 0.0,
+  0.14321220329305703, 0.0, -0.012170044375720957, 0.0,
+  0.056799655675182352, 0.0, -0.17866326953595252, 0.0,
+  -0.21484652606581134, 0.0, 0.13834724192392825, 0.0,
+  0.34168652937697225, 0.0, -0.065114115657369825, 0.0,
+  0.024524051144242914, 0.0, -0.059151432157329292, 0.0,
+  0.027734228315154642, 0.0, -0.24351208792857573, 0.0,
+  0.092362344800686419, 0.0, -0.14655216146550246, 0.0,
+  -0.090510995065294017, 0.0, -0.10571501162655272, 0.0,
+  0.25784223333877831, 0.0, -0.098760710042014546, 0.0,
+  0.086247622897032347, 0.0, 0.046093739116585368, 0.0,
+  0.2155275423645589, 0.0, -0.3303860330929132, 0.0,
+  -0.037320631963016042, 0.0, -0.091199782255160788, 0.0,
+  0.24844795479702012, 0.0, -0.14804928190009894, 0.0,
+  0.018624080932255448, 0.0, 0.033607234745976169, 0.0,
+  -0.010364435240342655, 0.0, 0.014121791251193359, 0.0,
+  -0.0061609115811890975, 0.0, -0.18239589040040685, 0.0,
+  -0.11001791357178829, 0.0, -0.18131416521334365, 0.0,
+  -0.082628223650283175, 0.0, 0.035299227097246172, 0.0,
+  0.0097012020086011813, 0.0, 0.013485237648718878, 0.0,
+  0.02462821677350727, 0.0, 0.010683107185807098, 0.0,
+  0.035544297607512987, 0.0, 0.0069684281908406675, 0.0,
+  0.0095753725139820153, 0.0, -0.013793191575162702, 0.0,
+  -0.048298413636977809, 0.0, 0.041048262343036532, 0.0,
+  -0.044914327966619892, 0.0, 0.069573853946696171, 0.0,
+  -0.0643638607076885, 0.0, -0.017600252084956799, 0.0,
+  -0.068651216962563683, 0.0, -0.057606068300178413, 0.0,
+  0.019897717418645103, 0.0, 0.015106045208187837, 0.0,
+  0.010161257343340805, 0.0, 0.0031381240873224392, 0.0,
+  0.256701086877971, 0.0, 0.19144852834555087, 0.0,
+  0.058505342729866072, 0.0, 0.09310032744349242, 0.0,
+  -0.12413441662591007, 0.0, -0.17299270929297064, 0.0,
+  -0.23411312775964818, 0.0, -0.068279063969908585, 0.0,
+  0.10088530537627562, 0.0, 0.39934254969738742, 0.0,
+  0.0060813043078491932, 0.0, 0.03009343097594145, 0.0,
+  -0.048683745108972089, 0.0, -0.041234457263033285, 0.0,
+  0.018451242114584179, 0.0, -0.00016004020129626711, 0.0,
+  -0.16050989127564938, 0.0, -0.18207173972414126, 0.0,
+  -0.079239073702728202, 0.0, -0.34576625783694342, 0.0,
+  0.40085852391406068, 0.0, 0.33959904465217289, 0.0,
+  0.26216666880160966, 0.0, 0.096930799223666778, 0.0,
+  -0.21028412054462597, 0.0, -0.064060576210339337, 0.0,
+  0.040569492016798249, 0.0, 0.031450710542095896, 0.0,
+  -0.034585420576149072, 0.0, -0.01374296772215221, 0.0,
+  -0.0068080023758737623, 0.0, -0.0039492513080931881, 0.0,
+  -0.091249636678403065, 0.0, 0.058038152531160195, 0.0,
+  0.36490169556158208, 0.0, 0.047200309558184481, 0.0,
+  0.0097907686512999376, 0.0, 0.016535269863746416, 0.0,
+  0.021200547488107041, 0.0, 0.018661972056754565, 0.0,
+  0.048124011525099174, 0.0, -0.044547078951915328, 0.0,
+  0.054669579110357393, 0.0, -0.057415502672743035, 0.0,
+  -0.0096270230982255373, 0.0, -0.034958419850103208, 0.0,
+  -0.16449628810479169, 0.0, 0.093585336531804578, 0.0,
+  -0.33536979674321959, 0.0, 0.0064100712831299247, 0.0,
+  -0.0046225070279966602, 0.0, 0.011337150959705038, 0.0,
+  -0.015418121593278699, 0.0, 0.036133458089543248, 0.0,
+  -0.06611573916800946, 0.0, 0.01451944382675328, 0.0,
+  -0.03107949727661298, 0.0, 0.0067505752152979747, 0.0,
+  0.18964081332938421, 0.0, -0.046113891407913943, 0.0,
+  0.053235784369824235, 0.0, -0.21002972332852549, 0.0,
+  0.31089470989906992, 0.0, -0.05330402545889032, 0.0,
+  0.011794177697831896, 0.0, -0.031031273184698539, 0.0,
+  -0.038328096433145831, 0.0, -0.20676762209268665, 0.0,
+  -0.018917383175744585, 0.0, 0.18086643532311444, 0.0,
+  -0.084006996520576541, 0.0, -0.048195895022421581, 0.0,
+  0.14355262439127636, 0.0, 0.039115161715670768, 0.0,
+  0.025740832040332003, 0.0, -0.1966287175105253, 0.0,
+  0.01444148490342612, 0.0, -0.2217184189951748, 0.0,
+  0.18663584571198003, 0.0, -0.077645200755700305, 0.0,
+  0.11137964147279013, 0.0, -0.014052023758147156, 0.0,
+  0.10906662806358731, 0.0, -0.014595832013088936, 0.0,
+  0.028671633833919252, 0.0, 0.40456562928465034, 0.0,
+  -0.46395061846760177, 0.0, 0.071807929528102124, 0.0,
+  -0.096983731618240587, 0.0, 0.027561647137377941, 0.0,
+  -0.0074867164994976698, 0.0, -0.03273122661590698, 0.0,
+  0.00055768306892524681, 0.0, -0.18688683390982511, -0.0,
+  0.16044737713040469, -0.0, -0.27589437704233827, -0.0,
+  -0.024372127897088706, -0.0, 0.046155253391025636, -0.0,
+  -0.012887475820794476, -0.0, 0.041983469992639619, -0.0,
+  -0.0089162506682096548, -0.0, -0.048580448746676226, -0.0,
+  0.041886632095016259, -0.0, 0.010778804591407414, -0.0,
+  -0.0047297952448284329, -0.0, 0.0066854990421006, -0.0,
+  -0.045269645411451433, -0.0, 0.25172004435983919, -0.0,
+  -0.085452691316296625, -0.0, 0.28110200902242749, -0.0,
+  0.074927713367542878, -0.0, -0.028697316631246788, -0.0,
+  0.05424104337440238, -0.0, -0.082809162482074788, -0.0,
+  0.074071145471617805, -0.0, 0.011164981024146167, -0.0,
+  -0.17416746528564675, -0.0, -0.28005025389892912, -0.0,
+  0.049755621209226615, -0.0, -0.049123816113155624, -0.0,
+  0.034146389401898292, -0.0, -0.028051701742750589, -0.0,
+  -0.12185993269319896, -0.0, 0.31283064679239808, -0.0,
+  -0.13062920830725874, -0.0, -0.030970295342131325, -0.0,
+  0.03952574196490663, -0.0, -0.07808468492423129, -0.0,
+  0.026007659305318787, -0.0, -0.027728862632255383, -0.0,
+  0.095358651454411955, -0.0, -0.035497935754704391, -0.0,
+  0.092487642926024294, -0.0, -0.035321228039240621, -0.0,
+  0.03301047206047359, -0.0, -0.082046964070629502, -0.0,
+  0.09478635802676233, -0.0, -0.010142989027969449, -0.0,
+  -0.15318643821889816, -0.0, 0.12187671397277842, -0.0,
+  -0.095443250440193209, -0.0, 0.025413335587046261, -0.0,
+  0.069476484299845584, -0.0, -0.12483932628544489, -0.0,
+  0.076040929041130703, -0.0, -0.043460446431395384, -0.0,
+  0.082847479881049527, -0.0, -0.17011955211113283, -0.0,
+  0.31002160287668312, -0.0, -0.0061751588173485925, -0.0,
+  0.1457708283620294, -0.0, -0.44025949371768358, -0.0,
+  0.27891601593337845, -0.0, -0.021781416932900803, -0.0,
+  0.079492786400889595, -0.0, -0.068292983849078129, -0.0,
+  0.14340124118373127, -0.0, 0.030869083508757215, -0.0,
+  -0.061509389913674765, -0.0, 0.01816662826876966, -0.0,
+  -0.069768450278194047, -0.0, 0.016403307754161663, -0.0,
+  0.0072551878977390599, -0.0, -0.050190185504779924, -0.0,
+  -0.0063727201979131599, -0.0, 0.0048797182607201424, -0.0,
+  -0.0041361065229179933, -0.0, 0.057824421111862014, -0.0,
+  -0.059069498057525843, -0.0, 0.039722649140102304, -0.0,
+  -0.072419162482246099, -0.0, -0.15468822847038899, -0.0,
+  0.17986041748660384, -0.0, -0.21830549622189568, -0.0,
+  0.29944100918462441, -0.0, 0.19662116736659771, -0.0,
+  0.061426283545753899, -0.0, -0.44987121750175274, -0.0,
+  -0.49673909466576327, -0.0, 0.023743029751374937, -0.0,
+  -0.022009622198186356, -0.0, 0.01544300334683674, -0.0,
+  -0.026139882373621203, -0.0, 0.01264173024511368, -0.0,
+  -0.16060752173884665, -0.0, 0.062171315356986293, -0.0,
+  -0.060415563757948938, -0.0, -0.012769371024374873, -0.0,
+  0.12041034139443751, -0.0, 0.046501685887351013, -0.0,
+  0.054553061679336087, -0.0, -0.03287495142053936, -0.0,
+  -0.10925630784101875, -0.0, 0.082266695623532504, -0.0,
+  0.10890430890487784, -0.0, 0.0025458746228082395, -0.0,
+  0.05059147848131041, -0.0, 0.070789713246891567, -0.0,
+  0.012938960873342953, -0.0, 0.042164683313742159, -0.0,
+  -0.049626798200240539, -0.0, 0.045590417354446029, -0.0,
+  0.0082057159213628807, -0.0, -0.17673390982730403, -0.0,
+  0.038512311446220443, -0.0, -0.098557450705262936, -0.0,
+  0.064360667175930933, -0.0, -0.073056520314931928, -0.0,
+  -0.08990822400775883, -0.0, 0.45164406933905787, -0.0,
+  0.18376350269459743, -0.0, -0.030551413102537828, -0.0,
+  0.035895020977717983, -0.0, -0.023283250593537204, -0.0,
+  0.008151832024652134, -0.0, 0.058063821862437928, 0.0,
+  -0.052284683526838231, 0.0, -0.0083397394127983533, 0.0,
+  -0.00206504023607108, 0.0, 0.040610577721208442, 0.0,
+  0.030761078366461025, 0.0, 0.036050795478760021, 0.0,
+  0.032530900269400018, 0.0, 0.011696170531889876, 0.0,
+  -0.015861427086882433, 0.0, 0.023924464073914093, 0.0,
+  -0.027546607015838408, 0.0, -0.0057169012898871897, 0.0,
+  -0.02901512126870192, 0.0, -0.02467860390778398, 0.0,
+  -0.0074318382707999082, 0.0, -0.0044463536154466677, 0.0,
+  -0.26447416393667533, 0.0, 0.15638927961209348, 0.0,
+  -0.25273320617751338, 0.0, 0.37125744564173019, 0.0,
+  -0.10467979868835202, 0.0, -0.0036401776548769769, 0.0,
+  0.12306209948750294, 0.0, 0.35306325978035058, 0.0,
+  -0.040376039051065508, 0.0, 0.035367612317700595, 0.0,
+  -0.028736399014112228, 0.0, 0.034981077896615344, 0.0,
+  0.049956121344178019, 0.0, -0.042659712609434491, 0.0,
+  0.014046457694452784, 0.0, -0.013860972024484578, 0.0,
+  0.009336604162703082, 0.0, -0.0043524027068096187, 0.0,
+  -0.0047390809189787712, 0.0, 0.012613247490471371, 0.0,
+  0.028926378607130564, 0.0, 0.020349036816040042, 0.0,
+  -0.11012684686656066, 0.0, 0.022894152227907905, 0.0,
+  0.017332615148205621, 0.0, -0.053526101658680186, 0.0,
+  -0.072158917161452077, 0.0, 0.011206292446581102, 0.0,
+  0.052249734883384788, 0.0, -0.036984277153093464, 0.0,
+  0.019171283724226201, 0.0, -0.0039946818593274104, 0.0,
+  -0.0090227179231106742, 0.0, -0.062427484497338141, 0.0,
+  -0.015878606378967614, 0.0, 0.01997438286065726, 0.0,
+  0.12520190942891132, 0.0, 0.0038023708283802526, 0.0,
+  -0.32495635538510731, 0.0, -0.034971201446557458, 0.0,
+  0.19733651271066621, 0.0, -0.59386019841128501, 0.0,
+  0.36153537163619731, 0.0, -0.01814539789532885, 0.0,
+  -0.5757452130585563, -0.0, 0.48323347502540304, -0.0,
+  0.2666550981031659, -0.0, 0.028712856417147367, -0.0,
+  -0.026903196649837653, -0.0, 0.09209134212244896, -0.0,
+  0.029233795736312712, -0.0, 0.047041794255706364, -0.0,
+  -0.34512036279041503, -0.0, 0.36711659310332651, -0.0,
+  -0.16478333496952222, -0.0, 0.15996460687908254, -0.0,
+  -0.0049016965199784957, -0.0, 0.0023541731577498581, -0.0,
+  -0.15045952912210037, -0.0, 0.076481799414999926, -0.0,
+  -0.22770101159515213, -0.0, 0.0054940020543388472, -0.0,
+  -0.0026058046312766535, -0.0, 0.022648094337796534, -0.0,
+  -0.023032999764755275, -0.0, -0.051554733646290381, -0.0,
+  0.070108816537164817, -0.0, 0.018873249166172071, -0.0,
+  -0.052517071415506246, -0.0, 0.0043628676623647051, -0.0,
+  -0.026400791177425931, -0.0, 0.015836214540256844, -0.0,
+  -0.012774874229955989, -0.0, 0.037985025008896126, -0.0,
+  -0.13108299463531925, -0.0, 0.12822393610117522, -0.0,
+  0.026419025075409046, -0.0, -0.0532516353712503, -0.0,
+  0.00054959361290535128, -0.0, -0.040222242978826039, -0.0,
+  -0.0063220420098876037, -0.0, -0.078158133301870852, -0.0,
+  0.14058450086875571, -0.0, 0.019215200215543713, -0.0,
+  -0.037312079129486468, -0.0, -0.058378337236774651, -0.0,
+  -0.027709535248045782, -0.0, 0.051516337892573143, -0.0,
+  -0.0050210328133551817, -0.0, 0.033419266693311307, -0.0,
+  -0.043176167655321347, -0.0, 0.078586953553191438, -0.0,
+  -0.0080587633272890553, -0.0, -0.059960051703299086, -0.0,
+  -0.0035355756934730763, -0.0, -0.0091070212834516995, -0.0,
+  0.00034063642927781979, -0.0, -0.083784744522641563, -0.0,
+  0.10021149099959992, -0.0, 0.012365144104464817, -0.0,
+  -0.018055350832531042, -0.0, 0.021927879660117982, -0.0,
+  -0.12909331544789451, -0.0, 0.11459003456507569, -0.0,
+  0.00058583946775419453, -0.0, -0.30243044061327146, 0.0,
+  0.22676629900420819, 0.0, 0.094879014612654605, 0.0,
+  -0.00075087835606825525, 0.0, -0.023569124635458606, 0.0,
+  -0.10995378847767881, 0.0, -0.07125038353709004, 0.0,
+  -0.067463764152562583, 0.0, -0.27459803438114444, 0.0,
+  0.30132611326354736, 0.0, 0.61472752300665456, 0.0,
+  -0.55197536081210008, 0.0, -0.00021832460797647813, 0.0,
+  0.0046958133161956791, 0.0, -0.027716045182869256, 0.0,
+  0.028478842210749956, 0.0, -0.05895201447449161, 0.0,
+  0.011256692810495666, 0.0, 0.0026575678208481616, 0.0,
+  -0.0069882039503605534, 0.0, -0.0021793422698082516, 0.0,
+  -0.053338557937578884, 0.0, 0.090597636645090268, 0.0,
+  -0.065790249686821525, 0.0, 0.009871700807666195, 0.0,
+  0.011949598310087252, 0.0, -0.057785171324153846, 0.0,
+  0.0051084180373158856, 0.0, -0.013096358566975514, 0.0,
+  -0.01303417608925677, 0.0, -0.044018514831747742, 0.0,
+  0.052948988123128843, 0.0, -0.0064291840154014563, 0.0,
+  0.043390489184948686, 0.0, 0.031399511221499934, 0.0,
+  0.13014167589697476, 0.0, 0.022367370427330897, 0.0,
+  -0.10991193742541451, 0.0, -0.010503543599641304, 0.0,
+  -0.035601191209694995, 0.0, 0.033202726835624384, 0.0,
+  0.052536165690605902, 0.0, 0.023641660787837564, 0.0,
+  0.018832214722506915, 0.0, 0.0019513800562382018, 0.0,
+  -0.01650132054830419, 0.0, -0.0017799640366758275, 0.0,
+  0.022595681634477272, 0.0, 0.0043137934992796556, 0.0,
+  0.023049302254153563, 0.0, 0.0048653095554206643, 0.0,
+  0.0056112288361683371, 0.0, 0.0065275384172458345, 0.0,
+  -0.2249217601266382, 0.0, 0.24832903785468133, 0.0,
+  -0.059433310780702318, 0.0, 0.11206386109463369, 0.0,
+  0.017524111608918876, 0.0, 0.0065828322986704003, 0.0,
+  -0.044831591007727836, 0.0, -0.0091675632082463404, 0.0,
+  -0.19294609511637137, 0.0, 0.17187006297130045, 0.0,
+  -0.2007562907741538, 0.0, -0.032321453936311854, 0.0,
+  0.066141215633325909, 0.0, -0.094809928723403186, 0.0,
+  0.055704367329728256, 0.0, -0.070069530170481079, 0.0,
+  -0.096360690184517844, 0.0, 0.10931001723006527, 0.0,
+  -0.020904453996691875, 0.0, 0.020160368508715287, 0.0,
+  0.0046638683636925048, 0.0, -0.0040652529008221479, 0.0,
+  0.12031224080753823, 0.0, -0.059293312423670468, 0.0,
+  0.20196913750274101, 0.0, -0.03790681734815439, 0.0,
+  0.036951062779572753, 0.0, -0.069180289870927614, 0.0,
+  0.096510273966844751, 0.0, -0.060535739411776125, 0.0,
+  0.038649669552731213, 0.0, -0.15101079885808444, 0.0,
+  0.037441780978693218, 0.0, -0.052923731192156584, 0.0,
+  0.29735879684501942, 0.0, -0.084782470211315075, 0.0,
+  0.083898026028556977, 0.0, 0.13532994544402865, 0.0,
+  -0.20849701492290187, 0.0, 0.037367872224611, 0.0,
+  0.010019461685121144, 0.0, 0.085065519640597775, 0.0,
+  -0.16073867417399998, 0.0, 0.096501122283345273, 0.0,
+  -0.049733380317892699, 0.0, 0.12539802513408166, 0.0,
+  -0.099511587302755028, 0.0, -0.036248736058996957, 0.0,
+  0.16848851262887496, 0.0, 0.062699959121090887, 0.0,
+  0.0021472586803629743, 0.0, -0.26959690211418064, 0.0,
+  0.019859913127500722, 0.0, 0.21046077781556916, 0.0,
+  -0.14890877633955824, 0.0, 0.090005980608585556, 0.0,
+  -0.096275932799954625, 0.0, 0.25309944715707816, 0.0,
+  -0.40055397147166832, 0.0, 0.14882899540730843, 0.0,
+  -0.14557203274245967, 0.0, 0.20746890263307385, 0.0,
+  -0.25858894312541564, 0.0, 0.13132513584025049, 0.0,
+  -0.053825918129444802, 0.0, -0.029579060020834221, 0.0,
+  0.24704953380006375, 0.0, -0.18578167584298, 0.0,
+  -0.00077779124818630691, 0.0, 0.1587574773192082, 0.0,
+  -0.14260113487826959, 0.0, 0.032294181528135797, 0.0,
+  0.0029599664515786465, 0.0, 0.067311498806181799, 0.0,
+  0.062903166895703286, 0.0, 0.10220583060843777, 0.0,
+  0.058579440617988192, 0.0, -0.00055568418308994194, 0.0,
+  -0.030239480407879205, 0.0, -0.0058374108061569722, 0.0,
+  -0.0066418324179118061, 0.0, -0.011875838719725203, 0.0,
+  0.024214413903079032, 0.0, -0.02130020768949396, 0.0,
+  0.0027346807132015969, 0.0, -0.038522671916827449, 0.0,
+  0.15439754139130291, 0.0, -0.070807256961998757, 0.0,
+  0.11240870296081351, 0.0, -0.19460907508001446, 0.0,
+  -0.023371787534896323, 0.0, 0.089814294519643761, 0.0,
+  -0.37013767581641466, 0.0, -0.0093223048822640483, 0.0,
+  -0.052380864940671616, 0.0, 0.23234774851445883, 0.0,
+  -0.07200943815189742, 0.0, 0.081450535746591862, 0.0,
+  0.071113086075377821, 0.0, -0.018382262110478574, 0.0,
+  -0.001306672103788779, 0.0, -0.052184012190743589, 0.0,
+  -0.060677891497324422, 0.0, -0.01632116965577711, 0.0,
+  -0.15368893402113301, 0.0, 0.015105859927753745, 0.0,
+  -0.18137970695718453, 0.0, 0.1553271547444553, 0.0,
+  -0.23256593737160469, 0.0, 0.53291405367885236, 0.0,
+  -0.083100824185700167, 0.0, -0.029646276406267581, 0.0,
+  -0.21031148738761948, 0.0, 0.069189976859997379, 0.0,
+  0.041980777166851488, 0.0, -0.035330199923587338, 0.0,
+  0.011136604673328136, 0.0, -0.012035421913680748, 0.0,
+  -0.097930199423495332, 0.0, -0.036654137644280112, 0.0,
+  -0.038681048916485716, 0.0, 0.029396487555969828, 0.0,
+  -0.26526870554237492, 0.0, 0.2620443288938854, 0.0,
+  -0.09112908368404371, 0.0, 0.3106100179015252, 0.0,
+  0.035781792610644403, 0.0, -0.23996603058229815, 0.0,
+  0.17138397155590271, 0.0, 0.018409074284508508, 0.0,
+  -0.0062510603084212513, 0.0, -0.025987814388212679, 0.0,
+  -0.026357997805472183, 0.0, 0.016239770077648298, 0.0,
+  0.33125371028491035, 0.0, 0.13418531596156408, 0.0,
+  0.41533394036771154, 0.0, 0.13425294820419684, 0.0,
+  -0.021663873052581779, 0.0, -0.026733140829639311, 0.0,
+  0.042592758803594505, 0.0, -0.063435819095589471, 0.0,
+  -0.013761473748392858, 0.0, -0.075057400237390187, 0.0,
+  0.0088977716977127232, 0.0, -0.026216573687103163, 0.0,
+  0.0016357611825094064, 0.0, -0.11033829814180943, 0.0,
+  0.058426217786205673, 0.0, -0.086665566348725465, 0.0,
+  0.15375987875472874, 0.0, -0.029547079949234722, 0.0,
+  0.0026672332707677231, 0.0, -0.0021393043905010892, 0.0,
+  -0.028740095046786485, 0.0, 0.055405980483294835, 0.0,
+  -0.0673838690278038, 0.0, 0.040274597638448394, 0.0,
+  -0.022118916936970053, 0.0, 0.015894158502675421, 0.0,
+  0.12535746473467602, 0.0, -0.023678846218173653, 0.0,
+  0.066084484327443863, 0.0, -0.037452246346675315, 0.0,
+  -0.43642346874874821, 0.0, -0.22560071491537192, 0.0,
+  -0.14312689787459992, 0.0, 0.091911496491695222, 0.0,
+  0.31420458137810142, 0.0, 0.09072285645728391, 0.0,
+  -0.047472080555921455, 0.0, -0.11231933314701582, 0.0,
+  -0.30213923572013074, 0.0, 0.093195557231243301, 0.0,
+  -0.02706690517816843, 0.0, -0.061511618756915659, 0.0,
+  0.066854019748742596, 0.0, -0.032204829990354497, 0.0,
+  0.047158267168234118, 0.0, -0.14179869311668714, 0.0,
+  -0.10643872174701027, 0.0, -0.054025171597033302, 0.0,
+  -0.040216564532544095, 0.0, -0.17334694459837302, 0.0,
+  0.049045585948092711, 0.0, 0.074783936021978678, 0.0,
+  0.024460651019610744, 0.0, -0.094687643009827613, 0.0,
+  0.32730237881440372, 0.0, -0.12866318627223094, 0.0,
+  0.038670062962941405, 0.0
+};
@@ -6,5 +6,8 @@
 RateModel ECMrestModel();
 
 extern const char* ECMrestModelText;
+extern const EigenSystemHash ECMrestModelEigenHash;
+extern const double ECMrestModelEigen[];
+extern const size_t ECMrestModelEigenSize;
 
 #endif /* ECMREST_MODEL_INCLUDED */
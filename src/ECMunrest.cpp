@@ -5,6 +5,7 @@ RateModel ECMunrestModel() {
   RateModel m;
   ParsedJson pj (ECMunrestModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, ECMunrestModelEigenHash, ECMunrestModelEigen, ECMunrestModelEigenSize);
   return m;
 }
 
@@ -3737,3 +3738,3760 @@ const char* ECMunrestModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash ECMunrestModelEigenHash = 0xa98803df76a6678cULL;
+const size_t ECMunrestModelEigenSize = 15006;
+const double ECMunrestModelEigen[] = {
+  1.3877787807814457e-16, 0.0, -0.15550576470060296, 0.0,
+  -0.2175313760049174, 0.0, -0.2421688551475969, 0.0,
+  -0.26670402505791013, 0.0, -0.27941151307963435, 0.0,
+  -0.27668728603228077, 0.0, -0.34037060087041432, 0.0,
+  -0.38115807021793841, 0.0, -0.4192502136141763, 0.0,
+  -0.43801217242706547, 0.0, -0.45940109440607718, 0.0,
+  -0.48165414689882197, 0.0, -0.50829756009478211, 0.0,
+  -0.5528861140785869, 0.0, -0.5950302399551487, 0.0,
+  -0.60064086536426875, 0.0, -0.67774716059123552, 0.0,
+  -0.63780738117502023, 0.0, -0.64282846312857478, 0.0,
+  -1.8806051267999502, 0.0, -0.77814524913859007, 0.0,
+  -1.8392730647290612, 0.0, -1.8286552006002015, 0.0,
+  -1.8046344397273626, 0.0, -1.7684452205828385, 0.0,
+  -0.85935347529865291, 0.0, -0.89494974222297419, 0.0,
+  -1.7035815853015297, 0.0, -0.94187509034245587, 0.0,
+  -0.95223384294550117, 0.0, -1.004068784360941, 0.0,
+  -1.0132522233711285, 0.0, -1.6764281305482061, 0.0,
+  -1.6425889290774462, 0.0, -1.625294982293924, 0.0,
+  -1.6182314406368465, 0.0, -1.5934694793144593, 0.0,
+  -1.5757341410819521, 0.0, -1.567734854876967, 0.0,
+  -1.5567111261890856, 0.0, -1.5489782939385326, 0.0,
+  -1.5219505222789815, 0.0, -1.4820587823301534, 0.0,
+  -1.0653658542044206, 0.0, -1.0750594516035803, 0.0,
+  -1.1223081254365608, 0.0, -1.1582412998054981, 0.0,
+  -1.1752822716113713, 0.0, -1.194896412067465, 0.0,
+  -1.2357934904476517, 0.0, -1.3839033869261559, 0.0,
+  -1.2622190018585813, 0.0, -1.3635362029142528, 0.0,
+  -1.3526609897022499, 0.0, -1.3343392452597926, 0.0,
+  -1.338634060743251, 0.0, -1.2855749416307694, 0.0,
+  -1.2920598660317677, 0.0, -1.3048517377911173, 0.0,
+  -1.3084824552602072, 0.0, -0.12803687993289564, 0.0,
+  0.22018054491756586, 0.0, 0.08629011005004722, 0.0,
+  0.015565383331976046, 0.0, -0.10814405763251143, 0.0,
+  0.19467533742939458, 0.0, 0.081062292531128885, 0.0,
+  -0.035898522883012964, 0.0, -0.092991588194032068, 0.0,
+  -0.3688353759610779, 0.0, 0.1432354747786046, 0.0,
+  -0.23147922774736868, 0.0, 0.10526960778513297, 0.0,
+  -0.018099055578260533, 0.0, 0.0018912655719597849, 0.0,
+  0.0026101735472414626, 0.0, -0.0079214462694222991, 0.0,
+  -0.028368770238264427, 0.0, 0.011243240289697899, 0.0,
+  0.00094715708593802949, 0.0, -0.0047672234165190589, 0.0,
+  -0.12582617886363867, 0.0, -0.00064278149398847137, 0.0,
+  -0.00093421097191465714, 0.0, -0.0024827628174556391, 0.0,
+  0.0017119588265117639, 0.0, 0.092618716794391043, 0.0,
+  0.047555018443114078, 0.0, -0.0035610102319199146, 0.0,
+  -0.0049330795014215232, 0.0, 0.024634908563473557, 0.0,
+  -0.41349160452650607, 0.0, -0.33202034635815941, 0.0,
+  -0.0017081936043464498, 0.0, -0.0013962196902701134, 0.0,
+  -0.011290699348881621, 0.0, 0.0020737099061867814, 0.0,
+  -6.3502546173366566e-06, 0.0, 0.0006290536222726894, 0.0,
+  -0.0032928247411394881, 0.0, 0.0053174724990835672, 0.0,
+  0.0053146835871331795, 0.0, -0.0057757333000846203, 0.0,
+  0.0029476159054768812, 0.0, -0.018037240506206965, 0.0,
+  0.046988092372392536, 0.0, -0.043347078521651754, 0.0,
+  0.017686928303629577, 0.0, -0.28641232241250686, 0.0,
+  0.030489237894149594, 0.0, -0.013019466621925503, 0.0,
+  -0.020354350267421228, 0.0, 0.0166771783114989, 0.0,
+  -0.00077868904062080018, 0.0, 0.00068137329856905553, 0.0,
+  -0.0090809718248304559, 0.0, -0.004422441798693234, 0.0,
+  0.0084854976801982882, 0.0, -0.008981187738073125, 0.0,
+  0.012188146596158531, 0.0, -0.00095474063226364187, 0.0,
+  -0.12803687993289514, 0.0, 0.22375273037755694, 0.0,
+  0.096957554692202949, 0.0, 0.016893278948945802, 0.0,
+  -0.10741692524692058, 0.0, 0.19845553902204505, 0.0,
+  0.083608825155073022, 0.0, -0.035538066381419556, 0.0,
+  -0.091788899493945059, 0.0, -0.37935249112588265, 0.0,
+  0.14213792781799978, 0.0, -0.22793739737933713, 0.0,
+  0.11788694097455817, 0.0, 0.00019725264624822689, 0.0,
+  -0.00359481819356706, 0.0, 0.0037853291099342297, 0.0,
+  0.016892317220611391, 0.0, 0.029523186711472249, 0.0,
+  -0.036930412091429186, 0.0, 0.008108611331708579, 0.0,
+  0.00025773191871072466, 0.0, 0.13334336779626962, 0.0,
+  0.00065492043494186304, 0.0, 0.0007905283485693949, 0.0,
+  0.001684388609776715, 0.0, -0.0016650493127094276, 0.0,
+  -0.097509558497563806, 0.0, -0.049330998262337361, 0.0,
+  0.0023926201078409656, 0.0, 0.0060341898384935581, 0.0,
+  -0.020455965274455135, 0.0, 0.40050942872498757, 0.0,
+  0.32527562168002139, 0.0, 0.0023600313480489385, 0.0,
+  0.0039330994291069728, 0.0, 0.012931886940123791, 0.0,
+  -0.0018585492654097427, 0.0, 0.00054567978111736846, 0.0,
+  -0.002842386702001739, 0.0, 0.0059233400601103854, 0.0,
+  -0.0081286370534983648, 0.0, -0.0068616942159422023, 0.0,
+  0.0049370298050605997, 0.0, -0.011978850034089066, 0.0,
+  0.014924512451071927, 0.0, -0.041661691140909306, 0.0,
+  0.043960747523216825, 0.0, -0.01672626928208203, 0.0,
+  0.28170498175276182, 0.0, -0.027426780282218875, 0.0,
+  3.5533854293787492e-05, 0.0, 0.023211860175065577, 0.0,
+  -0.01612644133801102, 0.0, 0.0034940033670506545, 0.0,
+  -0.0028522604342886507, 0.0, 0.0078753276993741919, 0.0,
+  0.0033254870108341884, 0.0, -0.011364279906404201, 0.0,
+  0.0026761514392337937, 0.0, -0.010090924665435383, 0.0,
+  0.00014052585447553844, 0.0, -0.12803687993289573, 0.0,
+  0.18493865492556685, 0.0, -0.082106373907136015, 0.0,
+  0.020282065092542063, 0.0, 0.0020843157180697883, 0.0,
+  -0.0056361095045565678, 0.0, -0.05119958435775273, 0.0,
+  0.0017171029501519954, 0.0, -0.16414104326684217, 0.0,
+  -0.033448432608237585, 0.0, -0.17113911213255298, 0.0,
+  0.12327973757248929, 0.0, -0.054430698659482975, 0.0,
+  -0.0094279415976525251, 0.0, 0.011962839251404726, 0.0,
+  -0.090387999936653335, 0.0, -0.12508863861010691, 0.0,
+  -0.074727509064995923, 0.0, 0.036790088707243096, 0.0,
+  -0.014026933428651526, 0.0, 0.19205324782263369, 0.0,
+  -0.32561526659365775, 0.0, -0.0046519932836445428, 0.0,
+  -0.0024696038064230107, 0.0, 0.0012334799054761374, 0.0,
+  0.0068667340680165067, 0.0, 0.26763941256415091, 0.0,
+  0.19244539589612733, 0.0, 0.03252307753030384, 0.0,
+  -0.016832789667885557, 0.0, -0.020686599031850595, 0.0,
+  0.27716797500327833, 0.0, -0.096674842879998266, 0.0,
+  0.016771834972282077, 0.0, 0.043390419366852714, 0.0,
+  0.17427789273370126, 0.0, -0.051390482179355108, 0.0,
+  -0.082196902877767389, 0.0, 0.074705208708759768, 0.0,
+  -0.15733066599418533, 0.0, 0.24894857749955424, 0.0,
+  0.22615758374044573, 0.0, -0.056477893337882494, 0.0,
+  0.076388503746632919, 0.0, 0.16691897271109671, 0.0,
+  -0.17948471785183626, 0.0, -0.07874581707051824, 0.0,
+  0.030769289369765862, 0.0, 0.045383584866213918, 0.0,
+  0.04821520616004963, 0.0, -0.15251893612569098, 0.0,
+  -0.10462004076941486, 0.0, -0.0027878332986823974, 0.0,
+  -0.022304958989145241, 0.0, 0.017012728678461049, 0.0,
+  0.0022597185934447005, 0.0, 0.0068793707072344595, 0.0,
+  -0.097677386684972015, 0.0, -0.10810244017205195, 0.0,
+  -0.041664239779202049, 0.0, -0.0077581520420807329, 0.0,
+  -0.12803687993289606, 0.0, 0.19154575172964572, 0.0,
+  -0.082550533695311054, 0.0, 0.022911528906813947, 0.0,
+  0.0076247725057955852, 0.0, -0.010663792175664995, 0.0,
+  -0.055758703657494177, 0.0, 0.0039898690423502588, 0.0,
+  -0.17771186384121851, 0.0, -0.037070686495838764, 0.0,
+  -0.20023921828459809, 0.0, 0.14873556352782666, 0.0,
+  -0.050404727670948453, 0.0, 0.012508999641376037, 0.0,
+  0.0055620508345703796, 0.0, -0.076760205996672659, 0.0,
+  -0.087025565586337145, 0.0, 0.014788208262516813, 0.0,
+  -0.019175629763705869, 0.0, -0.012295453321380025, 0.0,
+  0.031372318486593227, 0.0, -0.096689595844371562, 0.0,
+  0.0030332707382617319, 0.0, -0.0014932282138292077, 0.0,
+  -0.011861970170841368, 0.0, -0.0084692564575033213, 0.0,
+  0.07556683530049188, 0.0, 0.058658136210890638, 0.0,
+  0.040077350448450628, 0.0, -0.0084476795322330801, 0.0,
+  -0.0070452626385839037, 0.0, 0.079601675984191461, 0.0,
+  -0.032896079091303321, 0.0, -0.010095469923560753, 0.0,
+  -0.18931472236489763, 0.0, -0.61871286897065159, 0.0,
+  0.14433318329087233, 0.0, 0.10343378801241901, 0.0,
+  -0.053657441257926437, 0.0, 0.13741740780740982, 0.0,
+  -0.25998340726676922, 0.0, -0.22938607513038728, 0.0,
+  0.058209640977332867, 0.0, 0.030856643436416097, 0.0,
+  0.035231357082011625, 0.0, -0.048672766163198947, 0.0,
+  -0.02417357446481197, 0.0, 0.036718637944843979, 0.0,
+  0.020745941924557112, 0.0, 0.027108522312689912, 0.0,
+  -0.18003124040703503, 0.0, 0.10072094094524058, 0.0,
+  0.023046764213168616, 0.0, -0.01956003857881676, 0.0,
+  0.015695325472411367, 0.0, 0.035001242617103058, 0.0,
+  0.0084285617299215791, 0.0, -0.13965393855429867, 0.0,
+  -0.21169225240988465, 0.0, -0.050003516543440561, 0.0,
+  -0.034929991759422283, 0.0, -0.1280368799328955, 0.0,
+  -0.063247668197427678, 0.0, -0.0072086248488520922, 0.0,
+  -0.0089083023246430762, 0.0, 0.027765054108040466, 0.0,
+  -0.010546038060955876, 0.0, 0.032791716857301666, 0.0,
+  -0.02988198429453794, 0.0, 0.19069671221022458, 0.0,
+  -0.14600976242749469, 0.0, -0.1289163436412159, 0.0,
+  0.0060437953946083246, 0.0, -0.065096819844236917, 0.0,
+  -0.032252420369697339, 0.0, -0.10447856817502464, 0.0,
+  -0.058246599531955219, 0.0, -0.1008505355089493, 0.0,
+  0.23445595566560845, 0.0, 0.37124839653866437, 0.0,
+  0.056694564562910187, 0.0, 0.0073873345303189075, 0.0,
+  -0.0644710316848746, 0.0, 0.26429543938433936, 0.0,
+  0.26449668796160508, 0.0, 0.39325411762665097, 0.0,
+  -0.1415003090051698, 0.0, -0.017469336108255355, 0.0,
+  -0.14786976202179206, 0.0, 0.20486435435704126, 0.0,
+  -0.12703161369363103, 0.0, -0.16718535111023899, 0.0,
+  -0.070652208748703496, 0.0, 0.062447274571122285, 0.0,
+  -0.22123092160840213, 0.0, -0.17466663191386872, 0.0,
+  0.10596876763309376, 0.0, 0.031566275484638584, 0.0,
+  0.033947591479881356, 0.0, 0.058954175026493298, 0.0,
+  -0.032345859023694058, 0.0, -0.0063853093935806599, 0.0,
+  -0.049490648553999581, 0.0, 0.050737466077073398, 0.0,
+  0.0091149230910623977, 0.0, 0.021206199183390766, 0.0,
+  -0.016044277031806775, 0.0, -0.091145831166029631, 0.0,
+  0.082778892710286392, 0.0, 0.023789483102648046, 0.0,
+  0.13369955895730851, 0.0, 0.010574579053677469, 0.0,
+  -0.034319985744151946, 0.0, 0.071758993064909432, 0.0,
+  -0.053465673152239601, 0.0, 0.0036154579424873021, 0.0,
+  0.25638583517815317, 0.0, 0.29568736690751946, 0.0,
+  0.081555280415061576, 0.0, 0.077744126202563532, 0.0,
+  -0.067478276010126625, 0.0, -0.029134573635125012, 0.0,
+  -0.1280368799328955, 0.0, -0.06518630039775565, 0.0,
+  -0.0068971768727349855, 0.0, -0.0038928611962473435, 0.0,
+  0.030361400563128471, 0.0, -0.01291028294765564, 0.0,
+  0.032106656229512379, 0.0, -0.026401495210312362, 0.0,
+  0.1973723109616721, 0.0, -0.15095389613888824, 0.0,
+  -0.13045337312838234, 0.0, 0.01699512930948785, 0.0,
+  -0.053384748207099986, 0.0, -0.0090253724756365426, 0.0,
+  -0.11744921590583614, 0.0, -0.065834125593163761, 0.0,
+  -0.075971427842364936, 0.0, 0.24288356041804399, 0.0,
+  0.34164679954009919, 0.0, 0.065704433621725039, 0.0,
+  -0.0048049742165538999, 0.0, 0.10853393102516096, 0.0,
+  -0.20913869443229138, 0.0, -0.22291357751541685, 0.0,
+  -0.33061286284477326, 0.0, 0.10598999882590658, 0.0,
+  0.030833159045909955, 0.0, 0.013068901344678474, 0.0,
+  -0.022449962035138701, 0.0, -0.12753117873230521, 0.0,
+  -0.17113337681835972, 0.0, 0.08468554881568463, 0.0,
+  -0.11666876698666416, 0.0, -0.50520124148388956, 0.0,
+  -0.27027165096266625, 0.0, 0.087592723650855964, 0.0,
+  -0.11662505034369115, 0.0, -0.038193075410066703, 0.0,
+  0.08792512837743989, 0.0, -0.042348795548533373, 0.0,
+  0.021126808427444507, 0.0, -0.11058617754868486, 0.0,
+  0.03121358666076339, 0.0, 0.14243515378367155, 0.0,
+  -0.043577374068734943, 0.0, 0.021536628508920578, 0.0,
+  0.099200244988453645, 0.0, -0.063047259669378325, 0.0,
+  -0.024461507539368176, 0.0, -0.17908601617473816, 0.0,
+  0.044581215550911039, 0.0, 0.029427448118316123, 0.0,
+  -0.024860659163521266, 0.0, -0.016843974858420135, 0.0,
+  0.04276473128529653, 0.0, -0.21278319001341484, 0.0,
+  -0.2581607090449809, 0.0, -0.057967186933659917, 0.0,
+  -0.051040971043923633, 0.0, 0.02462993821226633, 0.0,
+  -0.010347335375046491, 0.0, -0.12803687993289589, 0.0,
+  -0.063440142399440666, 0.0, -0.0092761846267929646, 0.0,
+  -0.011592639052381832, 0.0, 0.030125114212928558, 0.0,
+  -0.011667350274585124, 0.0, 0.024093262304965585, 0.0,
+  -0.018578814106131627, 0.0, 0.17851509076832989, 0.0,
+  -0.14431362791334335, 0.0, -0.11521584569647218, 0.0,
+  0.025728401870467953, 0.0, -0.06147969651001587, 0.0,
+  -0.051316608728793268, 0.0, -0.10137861010910255, 0.0,
+  -0.05244919265810459, 0.0, -0.099482815501710231, 0.0,
+  0.21666352559503849, 0.0, 0.34879549532396353, 0.0,
+  0.060087523261588803, 0.0, -0.010689005991656758, 0.0,
+  -0.080269553385842157, 0.0, -0.24689501341346762, 0.0,
+  -0.22936986892721223, 0.0, -0.3241241494577809, 0.0,
+  0.097501401430468621, 0.0, -0.022852205130674406, 0.0,
+  -0.15221193770898064, 0.0, -0.12336041710038136, 0.0,
+  -0.15112835451184758, 0.0, -0.19717417039266624, 0.0,
+  -0.034152719525773353, 0.0, 0.048443719162054054, 0.0,
+  0.43705080198510837, 0.0, 0.24825551376740421, 0.0,
+  -0.032606014764454488, 0.0, 0.18521627112225847, 0.0,
+  0.25811965089633504, 0.0, -0.092994512753032846, 0.0,
+  0.037456434895930646, 0.0, 0.03304866118928363, 0.0,
+  0.070203178307246303, 0.0, -0.15026529402154645, 0.0,
+  -0.10289227538793953, 0.0, 0.026549696396233353, 0.0,
+  -0.0078711586726225181, 0.0, -0.083779708530999975, 0.0,
+  0.012154398034807407, 0.0, 0.0070761476831466413, 0.0,
+  0.14171779968768194, 0.0, -0.04293479551809503, 0.0,
+  -0.058485941350223856, 0.0, -0.0095596213713479324, 0.0,
+  0.0085676662504311496, 0.0, -0.037901010949322196, 0.0,
+  0.21122503104796281, 0.0, 0.26161447506057056, 0.0,
+  0.073173257686061588, 0.0, 0.063829393656061884, 0.0,
+  -0.039307557810324301, 0.0, 0.020885527778056995, 0.0,
+  -0.12803687993289625, 0.0, -0.065649403763027511, 0.0,
+  -0.0064688077477179397, 0.0, -0.004177317536578999, 0.0,
+  0.030617011848675334, 0.0, -0.015777040160882272, 0.0,
+  0.022174245908817565, 0.0, -0.019741644207995294, 0.0,
+  0.18557543583792685, 0.0, -0.14704084376971852, 0.0,
+  -0.11901592523372452, 0.0, 0.033183388905480025, 0.0,
+  -0.048507826942522196, 0.0, -0.013555166322206972, 0.0,
+  -0.11239104629159295, 0.0, -0.056224205674695937, 0.0,
+  -0.0598565680520034, 0.0, 0.23079765132826702, 0.0,
+  0.31278177164619742, 0.0, 0.071362717597722725, 0.0,
+  0.0058128732312484731, 0.0, 0.12375839721880513, 0.0,
+  0.1923577785574736, 0.0, 0.19586644742566012, 0.0,
+  0.26513732055056871, 0.0, -0.052952481007941789, 0.0,
+  0.037492767732610066, 0.0, 0.040752675301098704, 0.0,
+  -0.12176060012065852, 0.0, -0.13809379272845587, 0.0,
+  -0.15517047517249472, 0.0, 0.10132073623498478, 0.0,
+  -0.15968450177858315, 0.0, 0.43988440367857606, 0.0,
+  0.30503386238826719, 0.0, -0.21674573089010027, 0.0,
+  -0.13802620940605737, 0.0, -0.336779744263629, 0.0,
+  -0.079277535845454411, 0.0, 0.050591530193601617, 0.0,
+  -0.06140272821064495, 0.0, 0.12206264287522611, 0.0,
+  0.081387503568048455, 0.0, -0.058709558514706571, 0.0,
+  -0.0669054465509136, 0.0, 0.027799637026141258, 0.0,
+  0.16006845448658, 0.0, -0.042461747444373782, 0.0,
+  -0.017060859730949181, 0.0, -0.20634797722527898, 0.0,
+  0.021917435092255237, 0.0, 0.080338025015620387, 0.0,
+  -0.030497063290746411, 0.0, 0.090044395918499678, 0.0,
+  -0.012149874759013472, 0.0, -0.35554710384485366, 0.0,
+  -0.40829754158576331, 0.0, -0.12217314597782207, 0.0,
+  -0.10844209117683189, 0.0, 0.094987736698175423, 0.0,
+  0.016718851305283392, 0.0, -0.12803687993289553, 0.0,
+  0.15270070969837737, 0.0, 0.1920041229926715, 0.0,
+  -0.038078161589187295, 0.0, -0.17997817186370216, 0.0,
+  0.26339001966152548, 0.0, 0.15181015294568964, 0.0,
+  0.00050407635188892382, 0.0, 0.14265596598568095, 0.0,
+  0.29529515961196218, 0.0, 0.022876780876466909, 0.0,
+  0.2466938215022422, 0.0, -0.17973267219109262, 0.0,
+  0.0010865435687432087, 0.0, 0.011175271672528323, 0.0,
+  -0.0096086721447758688, 0.0, 0.0015596130581221562, 0.0,
+  -0.015379008706795505, 0.0, 0.010703690235269292, 0.0,
+  0.0097199497115942699, 0.0, -0.0031649310010755886, 0.0,
+  -0.068428370821287013, 0.0, -0.0015447686633819529, 0.0,
+  0.0011625916065042651, 0.0, -0.001418428642063937, 0.0,
+  -0.0010539691022819272, 0.0, 0.028963160941103485, 0.0,
+  0.0091368837191026682, 0.0, -0.0047273319334814878, 0.0,
+  -0.0017720225465808069, 0.0, 0.016473778289417412, 0.0,
+  -0.27218808630544333, 0.0, -0.15108459123980583, 0.0,
+  -0.002503043183975292, 0.0, 0.0017580564189797739, 0.0,
+  -0.0018157806778035578, 0.0, 0.0015066274391452679, 0.0,
+  0.0019410827957474415, 0.0, 0.00013822924635304508, 0.0,
+  0.0013249947501239763, 0.0, -0.00038620738288126739, 0.0,
+  -0.00037197993898321603, 0.0, -0.0045961114632748655, 0.0,
+  -0.0014674188796139302, 0.0, 0.015796856354315297, 0.0,
+  0.012618243162607365, 0.0, 0.059507242375052456, 0.0,
+  -0.070482177551696432, 0.0, 0.59747547021953451, 0.0,
+  -0.087456811259131031, 0.0, -0.033753039412660349, 0.0,
+  0.007470855010459276, 0.0, -0.12470460753669289, 0.0,
+  0.0054126037366137086, 0.0, 0.0031919922238400449, 0.0,
+  0.040087644413515595, 0.0, -0.039797938730516777, 0.0,
+  -0.038837578112658082, 0.0, 0.07406785221416326, 0.0,
+  -0.069827457238906723, 0.0, 0.021624632477356368, 0.0,
+  -0.1280368799328952, 0.0, 0.16002276317451772, 0.0,
+  0.20461184200254973, 0.0, -0.036734228083394653, 0.0,
+  -0.18353870418188753, 0.0, 0.27417104428662531, 0.0,
+  0.15808842639817863, 0.0, 0.0011777896635922806, 0.0,
+  0.15002215289742335, 0.0, 0.30497101782897051, 0.0,
+  0.020982949502889085, 0.0, 0.26160054260820231, 0.0,
+  -0.17770043371289326, 0.0, 0.018280684062483392, 0.0,
+  0.0026772818079775569, 0.0, -0.014047032877283127, 0.0,
+  0.019525570634312504, 0.0, 0.0097711218776977728, 0.0,
+  -0.016342306572546855, 0.0, 0.015097349958873066, 0.0,
+  0.00077187205820026096, 0.0, 0.0811227831437797, 0.0,
+  0.00219792023377419, 0.0, -0.0016705008169748451, 0.0,
+  0.00064266456562381464, 0.0, 0.00060606201651231949, 0.0,
+  -0.028342399567726904, 0.0, -0.0083755622320917673, 0.0,
+  0.0036243341104273755, 0.0, 0.0018987994723118698, 0.0,
+  -0.015484209118174301, 0.0, 0.26936488217846821, 0.0,
+  0.14514977221057604, 0.0, 0.0027603820111625774, 0.0,
+  -0.00040628864869523868, 0.0, 0.0025658030960981197, 0.0,
+  -0.0010073967843916422, 0.0, -0.001443648385483206, 0.0,
+  0.00145097700785547, 0.0, 0.00026011162629122986, 0.0,
+  -0.00088855722989156759, 0.0, 0.00059684569989977511, 0.0,
+  0.0036323486748430943, 0.0, -0.0053994964649259694, 0.0,
+  -0.017906696959461788, 0.0, -0.011572278647379031, 0.0,
+  -0.062094808801111165, 0.0, 0.072218757481743473, 0.0,
+  -0.59367409021699546, 0.0, 0.086887592505259931, 0.0,
+  0.03206100927252848, 0.0, -0.0048970530506412015, 0.0,
+  0.12249858070987309, 0.0, -0.0022379421113015835, 0.0,
+  -0.0052684200250784526, 0.0, -0.040381702073443819, 0.0,
+  0.038822279638390987, 0.0, 0.038482489640712707, 0.0,
+  -0.075451363613315184, 0.0, 0.072719261934465831, 0.0,
+  -0.023145637296169308, 0.0, -0.12803687993289628, 0.0,
+  0.058191961823249552, 0.0, -0.033865724168563413, 0.0,
+  0.13163010452379476, 0.0, 0.02501665876304152, 0.0,
+  -0.45265073214675228, 0.0, 0.62380107163730558, 0.0,
+  -0.0044386154619268404, 0.0, -0.19306062600420756, 0.0,
+  0.051085514679364064, 0.0, 0.028825500860417089, 0.0,
+  -0.013852393350315118, 0.0, -0.0110712929772964, 0.0,
+  -0.041457403286022217, 0.0, -0.0033370675036607559, 0.0,
+  0.00821257824719125, 0.0, -0.012385342568987361, 0.0,
+  -0.027853741249487897, 0.0, 0.010337299257803455, 0.0,
+  -0.0012830996439242369, 0.0, -0.0026621926957897399, 0.0,
+  -0.092583036064897914, 0.0, -0.0013893788041834823, 0.0,
+  -0.0013672785337099547, 0.0, -0.00033358246647817013, 0.0,
+  0.002211221618623911, 0.0, 0.010349305479428762, 0.0,
+  -0.04246473127081251, 0.0, -0.011131570122341748, 0.0,
+  -0.01412921897703525, 0.0, 0.036594697611281403, 0.0,
+  -0.2225106768389862, 0.0, 0.20238463320989092, 0.0,
+  -0.002070591414595039, 0.0, -0.00045785427415427551, 0.0,
+  -0.00087183669180338895, 0.0, 0.0073429221465066922, 0.0,
+  0.015183638313796667, 0.0, -0.0041177734078791705, 0.0,
+  0.0026154472644318708, 0.0, 0.0066552044072836405, 0.0,
+  0.0034119869931653764, 0.0, -0.0091322382709319912, 0.0,
+  0.004367743520668081, 0.0, -0.58095390003940728, 0.0,
+  -0.66762737783788506, 0.0, 0.28922396857366001, 0.0,
+  -0.053019065935745562, 0.0, -0.062559981583113863, 0.0,
+  -0.0058070780660079068, 0.0, -0.039846056749477721, 0.0,
+  -9.3525396737988189e-05, 0.0, -0.027897760669314701, 0.0,
+  -0.0010114961899352535, 0.0, -0.0012281596726260438, 0.0,
+  -0.018975712373007991, 0.0, -0.016566032946305993, 0.0,
+  0.022950621865551826, 0.0, 0.024566826846647224, 0.0,
+  0.0032644341685407977, 0.0, 0.0099411905611144543, 0.0,
+  -0.128036879932896, 0.0, 0.059040960838462136, 0.0,
+  -0.035688244013105143, 0.0, 0.13861290437831575, 0.0,
+  0.028238920354767275, 0.0, -0.47664825092271018, 0.0,
+  0.65419914501081988, 0.0, -0.0029673241986800034, 0.0,
+  -0.20864347135037151, 0.0, 0.054922674125102218, 0.0,
+  0.029698602700995922, 0.0, -0.0067615845106114864, 0.0,
+  -0.0049215629984444738, 0.0, -0.029245394827525337, 0.0,
+  -0.0047522252435624563, 0.0, 0.0061734316432941064, 0.0,
+  0.007777269660664804, 0.0, -0.016111477648791485, 0.0,
+  -0.02736093167696026, 0.0, 0.0018308613683171988, 0.0,
+  0.00039085550856894055, 0.0, 0.082645749383151085, 0.0,
+  0.00061306158359624731, 0.0, 0.00097688970771351203, 0.0,
+  -2.5493922069141351e-05, 0.0, -0.002943503310216302, 0.0,
+  -0.013619380343753035, 0.0, 0.030431175420570607, 0.0,
+  0.0095056647852564541, 0.0, -0.0022405885742757762, 0.0,
+  -0.047498525105309629, 0.0, 0.18680240819665081, 0.0,
+  -0.17157021435397496, 0.0, 0.0046344211305992681, 0.0,
+  0.0033828719477225523, 0.0, 0.0019081515077945818, 0.0,
+  -0.0066374392998708957, 0.0, -0.012143716530829912, 0.0,
+  0.00053115531564479053, 0.0, -4.730789562402669e-05, 0.0,
+  -0.0051476813876269456, 0.0, -0.00070437410134574616, 0.0,
+  0.0062174472903976513, 0.0, -0.016712674109143323, 0.0,
+  0.47679167311810139, 0.0, 0.55366861175413584, 0.0,
+  -0.23595991566300906, 0.0, 0.045127753529880008, 0.0,
+  0.051050522462153962, 0.0, 0.0065597310913514508, 0.0,
+  0.023060797027818977, 0.0, 0.0012530539528599447, 0.0,
+  0.02298172224834176, 0.0, 0.0038074569443371244, 0.0,
+  -0.0010341516279176197, 0.0, 0.012104519854078509, 0.0,
+  0.01120953248436485, 0.0, -0.017584486271612167, 0.0,
+  -0.019733243528222002, 0.0, -0.00065012844284591947, 0.0,
+  -0.0055000137742031215, 0.0, -0.12803687993289656, 0.0,
+  0.25854739601089721, 0.0, 0.861933898646848, 0.0,
+  0.041722034182670675, 0.0, 0.2975130623262458, 0.0,
+  -0.32534553735907129, 0.0, -0.18564674606641032, 0.0,
+  -0.034938729599628952, 0.0, 0.0044968991351242143, 0.0,
+  0.012303825709175905, 0.0, -0.0044455770778373599, 0.0,
+  -0.02028751623888143, 0.0, 0.0050606920162688468, 0.0,
+  -0.01178233004622053, 0.0, 0.0071990463704949626, 0.0,
+  0.00015876563639969434, 0.0, -0.0097845677221267829, 0.0,
+  -0.0068423821028449688, 0.0, 0.0027483786484189159, 0.0,
+  -0.0027447228918955112, 0.0, -0.00082149240757922043, 0.0,
+  -0.010061962858528391, 0.0, -0.0012067793514786531, 0.0,
+  0.002211632541264507, 0.0, -0.00024997812307526573, 0.0,
+  0.0010686102235825919, 0.0, 0.0012213012888823917, 0.0,
+  -0.0015680182054526202, 0.0, -0.0023098212804850342, 0.0,
+  0.0014825907753469219, 0.0, 0.00039002610289654233, 0.0,
+  -0.0062109820976158307, 0.0, -0.00065176136517344665, 0.0,
+  -0.00084297195740814298, 0.0, -0.00027425791699935392, 0.0,
+  0.0015690224895651267, 0.0, -0.0013275722852245278, 0.0,
+  0.00068659024828933099, 0.0, -0.00064681113389671008, 0.0,
+  -0.00054785496247628104, 0.0, 0.0031805129059132666, 0.0,
+  -0.0022743893885837762, 0.0, -0.00092174929106759789, 0.0,
+  0.0039751246848817676, 0.0, 0.0029420728231368781, 0.0,
+  -6.6544490696539627e-05, 0.0, -0.0020432834589343982, 0.0,
+  -0.0052773973422407389, 0.0, -0.0006492543040919756, 0.0,
+  -0.002786955180850449, 0.0, 0.0077826270940767831, 0.0,
+  -0.0020638391355302273, 0.0, 7.3449235573588083e-05, 0.0,
+  -0.0003727718911698625, 0.0, 0.0024461549065310814, 0.0,
+  0.0014749038359871561, 0.0, -0.00055817805650139286, 0.0,
+  0.0021759326701943074, 0.0, 0.003618476713887236, 0.0,
+  0.0013564851465087159, 0.0, -0.0031218847815393555, 0.0,
+  -0.12803687993289559, 0.0, 0.18791961291182402, 0.0,
+  -0.088300834695320282, 0.0, 0.022113024624106907, 0.0,
+  0.0072882289418205346, 0.0, -0.005287335770588094, 0.0,
+  -0.052252922194977479, 0.0, 0.0024585637721529423, 0.0,
+  -0.16772949810374824, 0.0, -0.027103700520135814, 0.0,
+  -0.18302825413765828, 0.0, 0.12436501211134451, 0.0,
+  -0.042509423742056983, 0.0, 0.016701022346471937, 0.0,
+  0.006100693364233991, 0.0, -0.10830768839576199, 0.0,
+  -0.11218265546814075, 0.0, -0.030846969223234613, 0.0,
+  -0.0076432226701348633, 0.0, -0.004843900463555346, 0.0,
+  0.17062078460532928, 0.0, -0.11083293721529848, 0.0,
+  0.00066999136026616617, 0.0, -0.0093668608603117553, 0.0,
+  0.0068764031971564488, 0.0, 0.0011475329184635664, 0.0,
+  0.07332826441240807, 0.0, 0.045846558131264384, 0.0,
+  -0.063182671782525707, 0.0, 0.013665815038420353, 0.0,
+  0.0064119529852608948, 0.0, 0.036843281902117962, 0.0,
+  -0.011367442914325657, 0.0, -0.015731920377706394, 0.0,
+  0.10041886219645026, 0.0, 0.30485283823784287, 0.0,
+  -0.055906127011742329, 0.0, 0.041716678053182105, 0.0,
+  -0.089930281178642102, 0.0, 0.17355326423061296, 0.0,
+  -0.24060758266424073, 0.0, -0.23255407701295103, 0.0,
+  0.077852262082707416, 0.0, -0.18384102614160849, 0.0,
+  0.026922110654197952, 0.0, -0.033377799274161207, 0.0,
+  -0.044530483390543156, 0.0, -0.0051979800136631926, 0.0,
+  -0.0075986847884300128, 0.0, -0.069007102661394371, 0.0,
+  0.49682174354181513, 0.0, 0.1174310251267611, 0.0,
+  -0.037733892873791128, 0.0, 0.058722179174625196, 0.0,
+  -0.032854571069484889, 0.0, -0.042014573021447746, 0.0,
+  -0.012118249971027019, 0.0, 0.20978860084511108, 0.0,
+  0.32176336712841125, 0.0, 0.097412603942348228, 0.0,
+  0.041242736338350502, 0.0, -0.12803687993289575, 0.0,
+  0.18310241866680338, 0.0, -0.084585451701842229, 0.0,
+  0.024195605810568881, 0.0, 0.010172592279102204, 0.0,
+  -0.0075325382434163462, 0.0, -0.050180369180160597, 0.0,
+  0.0046375025387201075, 0.0, -0.15599951787639357, 0.0,
+  -0.028327911339099263, 0.0, -0.18017644616840775, 0.0,
+  0.13063203370628379, 0.0, -0.029665893192012058, 0.0,
+  0.041149816142129397, 0.0, 0.00088064049635768154, 0.0,
+  -0.10582610106922995, 0.0, -0.077605364837657717, 0.0,
+  0.046188598078992726, 0.0, -0.068112706575984894, 0.0,
+  0.0033613070149334373, 0.0, -0.0061904500577386404, 0.0,
+  0.17238196118099991, 0.0, -0.0063993249058763822, 0.0,
+  0.0077151264622902773, 0.0, -0.013853646767245684, 0.0,
+  -0.00097561234188221931, 0.0, -0.1458756638376662, 0.0,
+  -0.094988555840965508, 0.0, 0.09348479357530419, 0.0,
+  0.01735174048335816, 0.0, 0.012506897214130609, 0.0,
+  -0.11693365974037015, 0.0, 0.057393340480339484, 0.0,
+  0.022315944100125235, 0.0, -0.12856865851877536, 0.0,
+  -0.38090007677738452, 0.0, 0.072072028796122942, 0.0,
+  -0.043765792451467271, 0.0, 0.081550690046529248, 0.0,
+  -0.18099201581029931, 0.0, 0.25678030583065914, 0.0,
+  0.22194860178033801, 0.0, -0.087666951265330154, 0.0,
+  0.039567983788451153, 0.0, -0.059936936009398867, 0.0,
+  0.070982528908824491, 0.0, 0.013754130436951431, 0.0,
+  -0.044698556852003773, 0.0, -0.023033102892383493, 0.0,
+  -0.063367365008969639, 0.0, 0.32011793814421369, 0.0,
+  -0.15192793275181188, 0.0, -0.042427180779633603, 0.0,
+  0.018447338403819093, 0.0, -0.010336326138015483, 0.0,
+  -0.04313376779438384, 0.0, -0.010154086070538229, 0.0,
+  0.19794248576085616, 0.0, 0.29894540439888057, 0.0,
+  0.065701088763239976, 0.0, 0.051192221743591226, 0.0,
+  -0.12803687993289611, 0.0, 0.18343439221010674, 0.0,
+  -0.088855020182189728, 0.0, 0.018776842037289118, 0.0,
+  0.0092542938252323809, 0.0, -0.0084180618727013237, 0.0,
+  -0.056505946060878887, 0.0, 0.0059126322569253596, 0.0,
+  -0.17355555427698854, 0.0, -0.029148386666783002, 0.0,
+  -0.18887830541627279, 0.0, 0.13815862105402918, 0.0,
+  -0.046681873213247446, 0.0, 0.0052852166808021418, 0.0,
+  0.007039893835723279, 0.0, -0.096675263307124476, 0.0,
+  -0.1104055373652721, 0.0, -0.030755839901094088, 0.0,
+  -0.0027170233719666448, 0.0, -0.0046185867747426217, 0.0,
+  -0.96360651907407702, 0.0, -0.16839547191396212, 0.0,
+  0.015580515627373408, 0.0, 0.028853475246488746, 0.0,
+  0.0079461280038103151, 0.0, -0.0059561983773274534, 0.0,
+  0.12069517757339072, 0.0, 0.086674249917223098, 0.0,
+  -0.056052058170975416, 0.0, 0.0012696093662614915, 0.0,
+  -0.0079508228627862814, 0.0, 0.12697376065615859, 0.0,
+  -0.028119993099325891, 0.0, -0.018970529226028297, 0.0,
+  0.061613080764829638, 0.0, 0.18821685583202563, 0.0,
+  -0.040633360116303127, 0.0, -0.0099451978161158496, 0.0,
+  -0.0019318036587316562, 0.0, 0.016481944049838198, 0.0,
+  -0.0070965540012446057, 0.0, -0.006274278186704901, 0.0,
+  -0.0050183336158177222, 0.0, -0.026749247990407215, 0.0,
+  0.067243405621888672, 0.0, -0.066354634774496962, 0.0,
+  -0.031693004105834512, 0.0, -0.00065220351365496412, 0.0,
+  0.011816224977176826, 0.0, 0.0037664619466470724, 0.0,
+  0.032063505053379661, 0.0, -0.032917759474806955, 0.0,
+  -0.011464321704957941, 0.0, 0.0102380978893096, 0.0,
+  -0.0087251792668122385, 0.0, -0.012696597916222747, 0.0,
+  -0.0072222917817061317, 0.0, 0.024888325005662092, 0.0,
+  0.030981258048867779, 0.0, 0.013861143490768535, 0.0,
+  0.0025303880432686874, 0.0, -0.12803687993289545, 0.0,
+  0.18476133386034449, 0.0, -0.084347544823855869, 0.0,
+  0.022863801125143957, 0.0, 0.014265054746875354, 0.0,
+  -0.013788003329890275, 0.0, -0.057503697174004428, 0.0,
+  0.0080497891130849493, 0.0, -0.16623043074409555, 0.0,
+  -0.02877545553385942, 0.0, -0.19477100647268067, 0.0,
+  0.15474576602985468, 0.0, -0.031409494926415718, 0.0,
+  0.041836535753610987, 0.0, 0.0037683127830001675, 0.0,
+  -0.091122207587860132, 0.0, -0.060827326970899799, 0.0,
+  0.085636622282118297, 0.0, -0.086365592266336957, 0.0,
+  0.0039614573912422832, 0.0, 0.041332340985342969, 0.0,
+  0.19593564732434332, 0.0, 0.00088326362793474447, 0.0,
+  -0.0034380596930576679, 0.0, 0.0098688751077985557, 0.0,
+  0.0038210343463897329, 0.0, -0.17538342043621327, 0.0,
+  -0.12161134225986404, 0.0, -0.048537344350268512, 0.0,
+  0.0040630758938010724, 0.0, 0.014939457563886529, 0.0,
+  -0.18021582484773582, 0.0, 0.066019901602776876, 0.0,
+  -0.0056779384967910488, 0.0, 0.086369229467448669, 0.0,
+  0.25956919968722697, 0.0, -0.054673417995331396, 0.0,
+  -0.0086907460970910445, 0.0, -0.0073580863591615822, 0.0,
+  0.011572078488808642, 0.0, -0.0030887688858913832, 0.0,
+  0.0044153772261172376, 0.0, 0.0069582112125823221, 0.0,
+  0.034280304521912316, 0.0, -0.11759534708095315, 0.0,
+  0.12626395632767881, 0.0, 0.071248378732029466, 0.0,
+  -0.0091990814246186263, 0.0, -0.021690932708196844, 0.0,
+  0.019969964477495616, 0.0, -0.24620391199584443, 0.0,
+  0.04197412915220175, 0.0, 0.034121883471836145, 0.0,
+  -0.021565442854532005, 0.0, 0.0081951635000695622, 0.0,
+  0.031401532062649153, 0.0, 0.0050622614026268747, 0.0,
+  -0.10560346345671066, 0.0, -0.1809008335681366, 0.0,
+  -0.043152457569153618, 0.0, -0.030143439814948023, 0.0,
+  -0.1280368799328965, 0.0, -0.095015476602856447, 0.0,
+  -0.029381037921876491, 0.0, -0.1544474537140868, 0.0,
+  0.43083209627059399, 0.0, 0.20963814582979332, 0.0,
+  0.088775174083105285, 0.0, 0.0046222027189119635, 0.0,
+  -0.096016482143143428, 0.0, 0.056496393703178119, 0.0,
+  0.019529470919102981, 0.0, -0.049663255584355026, 0.0,
+  -0.024816633183225294, 0.0, -0.02253964650949539, 0.0,
+  0.0083390444590211322, 0.0, 0.0075164580160956233, 0.0,
+  -0.0061697070138498405, 0.0, -0.0094136120522781298, 0.0,
+  0.013102719515559341, 0.0, -0.012391815274155515, 0.0,
+  -0.0067380558727298768, 0.0, -0.13092364659314026, 0.0,
+  -0.016646030886411707, 0.0, -0.021914573655256703, 0.0,
+  -0.027121981914683825, 0.0, 0.01532138954387164, 0.0,
+  -0.061279201380145053, 0.0, -0.22056444060091221, 0.0,
+  -0.057119179968305928, 0.0, 0.37570334269387806, 0.0,
+  -0.13673037897167881, 0.0, 0.10293807976685844, 0.0,
+  -0.1659299671925078, 0.0, 0.012082463200937839, 0.0,
+  0.026237418618583641, 0.0, -0.036471762512502975, 0.0,
+  0.0239399017155471, 0.0, 0.13594674714565025, 0.0,
+  -0.035923953429743798, 0.0, 0.015121933180345439, 0.0,
+  0.15931584437398752, 0.0, 0.15174128893116282, 0.0,
+  0.63383834468801059, 0.0, -0.090370337701589046, 0.0,
+  -0.05640169964302745, 0.0, 0.0017915015217199481, 0.0,
+  0.029560742019325386, 0.0, 0.049404699265140364, 0.0,
+  0.016639255754658581, 0.0, -0.0056434846038821438, 0.0,
+  0.046214090645830104, 0.0, 0.059777753236021858, 0.0,
+  0.041444423136030327, 0.0, -0.27856132949844503, 0.0,
+  0.13499997978063524, 0.0, 0.01202082003263596, 0.0,
+  -0.038766854146419567, 0.0, -0.0017901312209368421, 0.0,
+  -0.0047351678192086724, 0.0, -0.011220968771431023, 0.0,
+  -0.031942027032196438, 0.0, -0.12803687993289584, 0.0,
+  -0.094792975049640918, 0.0, -0.027714191588347252, 0.0,
+  -0.14336120869670971, 0.0, 0.41165382481742968, 0.0,
+  0.19823981062444249, 0.0, 0.083422700309677869, 0.0,
+  0.0057858723603408614, 0.0, -0.089833035705282005, 0.0,
+  0.050989245266172809, 0.0, 0.020926270218463158, 0.0,
+  -0.034271358155256879, 0.0, -0.010949440843036111, 0.0,
+  0.010928284587658686, 0.0, -0.0014902580731757484, 0.0,
+  -0.00083526269261851433, 0.0, 0.021556464205090865, 0.0,
+  -0.0027240163388519969, 0.0, -0.026836720309760122, 0.0,
+  -0.0071485017018759209, 0.0, 0.00081533047252025129, 0.0,
+  0.099394768183997659, 0.0, 0.0073313375322092691, 0.0,
+  0.018195627676922184, 0.0, 0.012345063952850796, 0.0,
+  -0.012085184799764328, 0.0, 0.039723323390310677, 0.0,
+  0.16470618155568681, 0.0, 0.030820566091392727, 0.0,
+  -0.23312168728102722, 0.0, 0.11106729772051312, 0.0,
+  -0.068371074752445041, 0.0, 0.10954659173064095, 0.0,
+  0.033829670623194939, 0.0, 0.010674258225451006, 0.0,
+  0.01355593949544727, 0.0, -0.0099449163715517441, 0.0,
+  -0.10196998284396457, 0.0, -0.010511309270571076, 0.0,
+  0.0034201046194827682, 0.0, -0.10043440770881266, 0.0,
+  -0.068628557912958271, 0.0, -0.42525450796018321, 0.0,
+  -0.091884122961590931, 0.0, 0.037001435477707623, 0.0,
+  -0.0073980657480779916, 0.0, -0.040733851748998635, 0.0,
+  -0.024594358009964182, 0.0, -0.012116705085784957, 0.0,
+  -0.034881071254925011, 0.0, 0.053093985600745422, 0.0,
+  0.019797112402269539, 0.0, -0.013099721362262748, 0.0,
+  -0.6660083595519547, 0.0, 0.37186245583776117, 0.0,
+  -0.01682577659748704, 0.0, -0.055627776374974666, 0.0,
+  0.025052702843031991, 0.0, 0.028985591978093077, 0.0,
+  -0.034832271777853065, 0.0, -0.047070720428072858, 0.0,
+  -0.12803687993289581, 0.0, -0.099297696849744821, 0.0,
+  -0.030245608914461635, 0.0, -0.15878711014258651, 0.0,
+  0.43524528848093397, 0.0, 0.20909530047063801, 0.0,
+  0.086105788613127468, 0.0, 0.011731242398605185, 0.0,
+  -0.10199848840925071, 0.0, 0.055079271066808849, 0.0,
+  0.028501729881768835, 0.0, -0.035567268701839148, 0.0,
+  -0.020832424957998363, 0.0, -0.038324146073822098, 0.0,
+  0.0094545952999161367, 0.0, 0.0086486943995017634, 0.0,
+  -0.0085581811484982291, 0.0, -0.012366986455560397, 0.0,
+  0.010952424455326758, 0.0, -0.011015969127001838, 0.0,
+  0.010597262499482805, 0.0, -0.1398027066817413, 0.0,
+  0.01429843350544927, 0.0, 0.015173336527407728, 0.0,
+  0.021511605336564345, 0.0, -0.011562173311084698, 0.0,
+  -0.068632930899606578, 0.0, -0.22681101040187199, 0.0,
+  0.047979401505406735, 0.0, 0.37214636294201764, 0.0,
+  -0.15445377624971807, 0.0, 0.12920119785223713, 0.0,
+  -0.17188452991729833, 0.0, -0.023052878978310706, 0.0,
+  -0.028578263986583287, 0.0, 0.023613308552649259, 0.0,
+  -0.022114589238274703, 0.0, -0.11233806863718705, 0.0,
+  0.03516067410920868, 0.0, -0.016522010302495005, 0.0,
+  -0.11905321968597379, 0.0, -0.12127538516011523, 0.0,
+  -0.47417455012703708, 0.0, 0.10476140741070541, 0.0,
+  -0.051677342602158657, 0.0, 0.0067990312455068072, 0.0,
+  0.045008152208955925, 0.0, -0.018050397110843455, 0.0,
+  -0.0032674577818384469, 0.0, 0.013576530197764355, 0.0,
+  -0.063285485809636374, 0.0, -0.053340495385207805, 0.0,
+  -0.026625506758443378, 0.0, 0.42249978919785497, 0.0,
+  -0.22181290270044512, 0.0, -0.020148314604781361, 0.0,
+  0.022406427286363512, 0.0, -0.019119416881464804, 0.0,
+  -0.014130150452533564, 0.0, 0.020558231321596912, 0.0,
+  0.045142842707035169, 0.0, -0.12803687993289634, 0.0,
+  -0.096095821885306368, 0.0, -0.027240679694521579, 0.0,
+  -0.14366678914170447, 0.0, 0.41272267344333291, 0.0,
+  0.19442056834260352, 0.0, 0.078798497714337015, 0.0,
+  0.010625604305300247, 0.0, -0.09420689237280834, 0.0,
+  0.048352360302451006, 0.0, 0.030192224847277509, 0.0,
+  -0.015511116537817393, 0.0, -0.0018288626387954997, 0.0,
+  0.015234749591939295, 0.0, 0.00060029011092128384, 0.0,
+  0.0033793516531443022, 0.0, 0.033177465902091509, 0.0,
+  -0.0047780766069010034, 0.0, -0.046161916408010102, 0.0,
+  -0.010234758648012626, 0.0, -0.0016448708882834753, 0.0,
+  0.15289157064680509, 0.0, -0.005261722688310851, 0.0,
+  -0.0084040791973336391, 0.0, -0.0069934696984131819, 0.0,
+  0.0085198975388632147, 0.0, 0.0765309678750212, 0.0,
+  0.28717971285179184, 0.0, -0.022232131027530785, 0.0,
+  -0.48962066586859021, 0.0, 0.20170931781760301, 0.0,
+  -0.15923650130521125, 0.0, 0.22622691083252161, 0.0,
+  -0.019227248158714356, 0.0, -0.0070479196960461041, 0.0,
+  -0.006146019451494374, 0.0, 0.0077154570374765342, 0.0,
+  0.071198704287128087, 0.0, 0.0053947733218830283, 0.0,
+  -0.0031101796456624248, 0.0, 0.059122254737049205, 0.0,
+  0.037460982256051913, 0.0, 0.2554486665010457, 0.0,
+  0.06167663017164049, 0.0, 0.072539656592786106, 0.0,
+  -0.005051568106952879, 0.0, -0.043814023623168961, 0.0,
+  0.0027847528490703428, 0.0, -0.0019189774653836837, 0.0,
+  0.011736090040177454, 0.0, -0.031780983829657244, 0.0,
+  -0.017184026788575047, 0.0, -0.0020159480791614309, 0.0,
+  0.41036316741402362, 0.0, -0.221539021751159, 0.0,
+  0.021697535720432298, 0.0, 0.055267145972372221, 0.0,
+  -0.0062407770771353019, 0.0, -0.010338706637476106, 0.0,
+  0.02248232713269192, 0.0, 0.018852186763247548, 0.0,
+  -0.12803687993289606, 0.0, -0.041676240036097073, 0.0,
+  0.066553345259235536, 0.0, -0.091415511185818046, 0.0,
+  -0.10333079184374526, 0.0, 0.060310165954126943, 0.0,
+  0.040961543267531514, 0.0, 0.076547263126472642, 0.0,
+  0.030380017265344603, 0.0, 0.30376740418826248, 0.0,
+  -0.37454172217185561, 0.0, -0.25640930092842362, 0.0,
+  0.547036553189715, 0.0, 0.0094416069055725318, 0.0,
+  -0.083864145003736554, 0.0, 0.12160862935975109, 0.0,
+  -0.17305566124437913, 0.0, 0.003861577691808699, 0.0,
+  0.028763335225765602, 0.0, -0.16184220315137449, 0.0,
+  0.0019911034618381265, 0.0, -0.076679813262958849, 0.0,
+  -0.001112904078484183, 0.0, -0.002050936538148803, 0.0,
+  -0.0091051468492823091, 0.0, 0.0021998278156082681, 0.0,
+  -0.038382099123450752, 0.0, -0.0090212109793570607, 0.0,
+  -0.008189159064440928, 0.0, -0.0052092373133261517, 0.0,
+  0.0084638125804694913, 0.0, -0.092803768193741892, 0.0,
+  0.0030852738289117764, 0.0, -0.002675595715443397, 0.0,
+  0.0011293811665309794, 0.0, -0.0051283759315380395, 0.0,
+  0.0059671299572763258, 0.0, 0.011446401402556917, 0.0,
+  0.0018703910204754899, 0.0, 0.010854317453028485, 0.0,
+  0.022594864532291589, 0.0, -8.8814035758167966e-06, 0.0,
+  -0.020094579883477546, 0.0, 0.021516587841945743, 0.0,
+  0.061260431770994557, 0.0, -0.016316273960595783, 0.0,
+  0.078778008401580196, 0.0, -0.02530016735860325, 0.0,
+  0.18869994211321803, 0.0, -0.0015761085577231119, 0.0,
+  0.068393623712310309, 0.0, -0.029908478485253624, 0.0,
+  0.30143135632483276, 0.0, -0.054919086761962346, 0.0,
+  -0.07193368808541023, 0.0, -0.30937744823078206, 0.0,
+  0.29730375485873967, 0.0, 0.19244335274761584, 0.0,
+  -0.31428946961109261, 0.0, 0.39156301631892992, 0.0,
+  -0.14994897675517413, 0.0, -0.12803687993289567, 0.0,
+  -0.039388212346085978, 0.0, 0.067706806221296351, 0.0,
+  -0.086456078337080591, 0.0, -0.098459932102736958, 0.0,
+  0.059181725120759476, 0.0, 0.04016157330745776, 0.0,
+  0.079302164672420572, 0.0, 0.032998789553064324, 0.0,
+  0.29409013977019494, 0.0, -0.3663891709420331, 0.0,
+  -0.24181915402320342, 0.0, 0.54606752511359058, 0.0,
+  0.034267479785503811, 0.0, -0.1005789179505293, 0.0,
+  0.10574254078620554, 0.0, -0.1508522604784257, 0.0,
+  0.010537016941620164, 0.0, 0.0071713154788949031, 0.0,
+  -0.15071490473778706, 0.0, -0.00095309583061250526, 0.0,
+  0.041168330355211613, 0.0, -0.0013083294097355959, 0.0,
+  0.0033332330659218584, 0.0, 0.0076852809840422731, 0.0,
+  -0.0012141703702151119, 0.0, 0.0040336954133969082, 0.0,
+  0.030394827664955274, 0.0, 0.0081918229289600665, 0.0,
+  -0.0051583754865690782, 0.0, -0.011928755228960771, 0.0,
+  0.098315161503688381, 0.0, -0.010635724826430928, 0.0,
+  0.0054526980773038601, 0.0, 0.0052367849667587004, 0.0,
+  0.00020230398625092444, 0.0, -0.0037284933529721669, 0.0,
+  -0.011718737622254723, 0.0, -0.0054347942100331937, 0.0,
+  -0.010255292793302485, 0.0, -0.020966201445708328, 0.0,
+  0.0021149502132259395, 0.0, 0.017196542688557949, 0.0,
+  -0.029751972008429578, 0.0, -0.062228990276211364, 0.0,
+  0.017781998649783123, 0.0, -0.07967692366925519, 0.0,
+  0.029566867788321811, 0.0, -0.18598705183472986, 0.0,
+  0.002649501582205747, 0.0, -0.082857476822458198, 0.0,
+  0.02873700115782064, 0.0, -0.31057059128898318, 0.0,
+  0.058361946768414746, 0.0, 0.064943593136641484, 0.0,
+  0.30310772989002133, 0.0, -0.29532204418638136, 0.0,
+  -0.18931192193494725, 0.0, 0.30214334268721893, 0.0,
+  -0.38330298151519349, 0.0, 0.14721833613516325, 0.0,
+  -0.12803687993289606, 0.0, -0.083042659345249098, 0.0,
+  0.0096912917659080222, 0.0, -0.096433891163424351, 0.0,
+  -0.050803119785036183, 0.0, -0.021743872030147434, 0.0,
+  -0.019557573595942037, 0.0, 0.055221364681809, 0.0,
+  -0.037217122939489526, 0.0, 0.0097170280980480046, 0.0,
+  -0.009050292283956313, 0.0, 0.067535771356277238, 0.0,
+  0.11973313809729914, 0.0, -0.18480067575460574, 0.0,
+  0.029688899779507387, 0.0, -0.04398318229506943, 0.0,
+  0.14269341740442984, 0.0, -0.065670972424668683, 0.0,
+  -0.018313131299129565, 0.0, 0.59913772037266766, 0.0,
+  0.0053322330490487109, 0.0, -0.12771020905623029, 0.0,
+  0.010073971447986713, 0.0, -0.013685399373419697, 0.0,
+  0.014069122426893449, 0.0, -0.012278665304143484, 0.0,
+  -0.077770293202591212, 0.0, -0.019302833363933715, 0.0,
+  0.032548113359692092, 0.0, 0.0028329006135224886, 0.0,
+  -0.0060269431788770849, 0.0, -0.052234654078875682, 0.0,
+  0.091116197076604108, 0.0, 0.0025629769016892287, 0.0,
+  -0.0070450132639439146, 0.0, -0.0021791490677044306, 0.0,
+  -0.00071004529445949387, 0.0, -0.017087521170490325, 0.0,
+  -0.01475841131336964, 0.0, -0.0131357741363681, 0.0,
+  0.0085276752475095842, 0.0, -0.019826868475518174, 0.0,
+  0.014087597733417948, 0.0, 0.0067587576830641328, 0.0,
+  0.13791731494072348, 0.0, -0.025535889387901488, 0.0,
+  0.067298488614237942, 0.0, -0.26888197688942556, 0.0,
+  -0.062138881936826963, 0.0, -0.040530128704530592, 0.0,
+  0.0064940114646627935, 0.0, 0.018029695075601208, 0.0,
+  -0.10422038299529131, 0.0, -0.086317238371032806, 0.0,
+  -0.28635020499213149, 0.0, 0.14037245878390381, 0.0,
+  -0.19765018018779895, 0.0, 0.38762744394940307, 0.0,
+  -0.25269370404651276, 0.0, -0.074588406099135959, 0.0,
+  -0.00078263431640725656, 0.0, -0.12803687993289617, 0.0,
+  -0.078578756366482094, 0.0, 0.010869121227028686, 0.0,
+  -0.090024360385223032, 0.0, -0.045490232295879791, 0.0,
+  -0.023525868887724923, 0.0, -0.020490747394670744, 0.0,
+  0.059898640257477702, 0.0, -0.034965083871199398, 0.0,
+  0.0080890378801175295, 0.0, -0.013251194691855544, 0.0,
+  0.080501585063860834, 0.0, 0.1387008189403468, 0.0,
+  -0.14006590865924889, 0.0, 0.00046894165546495305, 0.0,
+  -0.048125796860477132, 0.0, 0.18527908958676378, 0.0,
+  -0.053799940583360212, 0.0, -0.046712667668199169, 0.0,
+  0.60857772897174411, 0.0, -0.0014703042099507182, 0.0,
+  0.027486930374263828, 0.0, -0.010492903392937167, 0.0,
+  0.015460520033858113, 0.0, -0.011633052684959981, 0.0,
+  0.010399819408833071, 0.0, 0.0016767436375483323, 0.0,
+  0.042875198640374097, 0.0, -0.027365147777208533, 0.0,
+  -0.0085316923974817268, 0.0, -0.0024186676816795446, 0.0,
+  0.042291384324967485, 0.0, -0.071955088809397771, 0.0,
+  -0.0042611741548464676, 0.0, -0.0023167774975170162, 0.0,
+  -0.00047096757663883855, 0.0, -0.0032164207931446179, 0.0,
+  0.0080261667232830111, 0.0, -0.0011398207320845797, 0.0,
+  -0.00068593782904011441, 0.0, 0.0012767521504244903, 0.0,
+  -0.0057652932547276577, 0.0, -0.0038731833883968972, 0.0,
+  0.020609327576927065, 0.0, -0.11180962306307766, 0.0,
+  0.017712040987142009, 0.0, -0.067914410782970419, 0.0,
+  0.22978700416934947, 0.0, 0.049690705249382634, 0.0,
+  0.023246277728868083, 0.0, 0.0030009563894434032, 0.0,
+  -0.015542401051672644, 0.0, 0.084799731618877133, 0.0,
+  0.068720777679434727, 0.0, 0.25276971609784554, 0.0,
+  -0.10782643172450745, 0.0, 0.1646427346745071, 0.0,
+  -0.32005237952363158, 0.0, 0.20896067009306474, 0.0,
+  0.062374905201596269, 0.0, -0.016540658529839995, 0.0,
+  -0.12803687993289636, 0.0, -0.088863597606975334, 0.0,
+  0.026292175179008642, 0.0, -0.12812287858419755, 0.0,
+  -0.075381502644980058, 0.0, -0.045897963423273624, 0.0,
+  -0.020465594834465785, 0.0, 0.3839319236348992, 0.0,
+  -0.083546431508668792, 0.0, -0.00304877416633113, 0.0,
+  0.086783725058900835, 0.0, -0.058483210141439923, 0.0,
+  -0.056101821775473931, 0.0, 0.36470651467511456, 0.0,
+  -0.18450693970256032, 0.0, -0.17808386007166782, 0.0,
+  0.18851912183064365, 0.0, -0.016695665917458503, 0.0,
+  0.038585242167596553, 0.0, -0.078532806091652141, 0.0,
+  -0.0064319003426112822, 0.0, -0.063864981606212692, 0.0,
+  0.11962127315208072, 0.0, -0.16118232461492157, 0.0,
+  0.024738280168637376, 0.0, -0.046431497603121007, 0.0,
+  0.087660060751666727, 0.0, -0.14267091333763934, 0.0,
+  0.051539064568112122, 0.0, 0.0085250880484274132, 0.0,
+  0.010745686972844531, 0.0, -0.071185576696402159, 0.0,
+  0.092671845266552533, 0.0, 0.0085081807233874911, 0.0,
+  0.029631352498489427, 0.0, -0.011378692432661172, 0.0,
+  -0.052260877753461388, 0.0, 0.037033836072428959, 0.0,
+  -0.21056516691176974, 0.0, -0.33628550844482341, 0.0,
+  -0.12069566791619529, 0.0, -0.038092494676612021, 0.0,
+  0.013080984107432116, 0.0, -0.0010384055996070824, 0.0,
+  0.12371731287492141, 0.0, -0.032258057212421871, 0.0,
+  0.073622083481859196, 0.0, -0.3244290982384393, 0.0,
+  -0.018393260961453699, 0.0, -0.038548369705315146, 0.0,
+  0.079989762865644923, 0.0, -0.033061283080390809, 0.0,
+  0.2355228953082894, 0.0, 0.15297983664325243, 0.0,
+  0.35971680429284841, 0.0, 0.37495139572903879, 0.0,
+  -0.24514073119362628, 0.0, -0.22473939785085972, 0.0,
+  0.029866448122871533, 0.0, 0.36963301107894031, 0.0,
+  -0.39714729420478934, 0.0, -0.12803687993289639, 0.0,
+  -0.080903202584775347, 0.0, 0.02278491793749534, 0.0,
+  -0.10679308896360994, 0.0, -0.058152058095286424, 0.0,
+  -0.03944202924708122, 0.0, -0.018442040722790536, 0.0,
+  0.31050791150413143, 0.0, -0.060930720718613669, 0.0,
+  -0.0055517127642643474, 0.0, 0.061707398566537522, 0.0,
+  -0.032014249455189769, 0.0, -0.02061750645023579, 0.0,
+  0.32733595329134879, 0.0, -0.17011580939245571, 0.0,
+  -0.16745975663123555, 0.0, 0.19083796313576984, 0.0,
+  -0.018047869771045898, 0.0, -0.0061138619454273596, 0.0,
+  -0.025347891161939751, 0.0, 0.0025322235680222496, 0.0,
+  0.15043215291519732, 0.0, -0.16858712477608173, 0.0,
+  0.20478465229703699, 0.0, -0.033391417869165572, 0.0,
+  0.038624711450877612, 0.0, 0.36236212886143654, 0.0,
+  -0.25967713978975776, 0.0, -0.0089778284708254535, 0.0,
+  0.016168261047125713, 0.0, 0.047748145637991714, 0.0,
+  -0.015869335751144489, 0.0, 0.042843459075868486, 0.0,
+  -0.00075853134954156464, 0.0, -0.0021354407286576604, 0.0,
+  -0.002667763578791592, 0.0, 0.020649160888183461, 0.0,
+  -0.074874761831791939, 0.0, -0.16336191049858531, 0.0,
+  0.068807039344679993, 0.0, 0.21957836374174491, 0.0,
+  -0.20051979844465906, 0.0, 0.0051926270804835339, 0.0,
+  0.10320917456991241, 0.0, 0.021702998082267441, 0.0,
+  0.0018757060038001733, 0.0, -0.014174800641187745, 0.0,
+  0.039506774674734714, 0.0, -0.0030438012098531341, 0.0,
+  0.018373528210076075, 0.0, -0.040292339347565057, 0.0,
+  0.0034934473109306339, 0.0, -0.094909410682054426, 0.0,
+  -0.066662222202171897, 0.0, -0.13845280453905165, 0.0,
+  -0.15779369177016103, 0.0, 0.11258780741438572, 0.0,
+  0.084769739828751758, 0.0, -0.010030893491826691, 0.0,
+  -0.14914291040531386, 0.0, 0.16243966865680856, 0.0,
+  -0.12803687993289589, 0.0, -0.090568293073609238, 0.0,
+  0.024719199070596599, 0.0, -0.12759966547349633, 0.0,
+  -0.070847613308102214, 0.0, -0.046798748794660658, 0.0,
+  -0.025491626192502916, 0.0, 0.36343783988397227, 0.0,
+  -0.084759713053890642, 0.0, -0.01037872842573866, 0.0,
+  0.092748509944008573, 0.0, -0.040345967960670262, 0.0,
+  -0.057819259699887958, 0.0, 0.28527378003694875, 0.0,
+  -0.14482104238424867, 0.0, -0.13227249101759919, 0.0,
+  0.14198842045026028, 0.0, -0.014498563095311293, 0.0,
+  0.040168096852513692, 0.0, -0.046831189775838611, 0.0,
+  0.023092348292937027, 0.0, -0.13643762497351211, 0.0,
+  -0.40060501907555551, 0.0, 0.52926825498109564, 0.0,
+  -0.10510230613244502, 0.0, 0.16366100470347794, 0.0,
+  -0.12749448619934547, 0.0, 0.031857857646721957, 0.0,
+  -0.26075601469697268, 0.0, -0.0075146961128612702, 0.0,
+  -0.030005646913713047, 0.0, -0.01943220034928405, 0.0,
+  0.032935474671611474, 0.0, -0.026721904230387991, 0.0,
+  -0.062466780044137415, 0.0, 0.013696522275420011, 0.0,
+  0.068266102090564815, 0.0, 0.12379562490904843, 0.0,
+  0.75257762177153964, 0.0, 0.37828526543251972, 0.0,
+  -0.31201117084278351, 0.0, 0.50613753186099253, 0.0,
+  -0.045859010693065756, 0.0, -0.19693120243706475, 0.0,
+  0.064231208583519842, 0.0, -0.014429344067129327, 0.0,
+  0.043693784687709521, 0.0, -0.18968558602035557, 0.0,
+  -0.03195155331032442, 0.0, -0.028136409386855816, 0.0,
+  0.024617576264062288, 0.0, 0.0073454033646451504, 0.0,
+  0.075007692593674638, 0.0, 0.044917402977018524, 0.0,
+  0.059052177386482385, 0.0, 0.14709118606885535, 0.0,
+  -0.12095538614860205, 0.0, -0.081355236006636161, 0.0,
+  0.0042382091454319908, 0.0, 0.13479530788784874, 0.0,
+  -0.15108930291911379, 0.0, -0.12803687993289609, 0.0,
+  -0.078349672425697195, 0.0, 0.025012849724134555, 0.0,
+  -0.10156341870764181, 0.0, -0.048491051425168907, 0.0,
+  -0.041691845557238719, 0.0, -0.023758524643884605, 0.0,
+  0.2812004078635329, 0.0, -0.057457809956834742, 0.0,
+  -0.012466976314687288, 0.0, 0.062771859153203921, 0.0,
+  -0.0064463054795240483, 0.0, -0.010497664074010763, 0.0,
+  0.24917877714336958, 0.0, -0.13681743313564323, 0.0,
+  -0.12582494469218702, 0.0, 0.15665774983210404, 0.0,
+  -0.0085803261522468446, 0.0, -0.0044536781943015956, 0.0,
+  -0.0055020291883676447, 0.0, -0.009959030117739064, 0.0,
+  0.097502203487126585, 0.0, 0.45546047369726878, 0.0,
+  -0.55870419533972071, 0.0, 0.096442652907603205, 0.0,
+  -0.11182016549605983, 0.0, 0.20092864190878368, 0.0,
+  -0.12068500316094112, 0.0, 0.080304235661552231, 0.0,
+  -0.0026107086384362646, 0.0, 0.020823594993164697, 0.0,
+  0.0053377877805985512, 0.0, -0.01191124159716384, 0.0,
+  0.001583599722193607, 0.0, -0.0040830780846444203, 0.0,
+  -0.0015248400333428499, 0.0, -0.01311876185328429, 0.0,
+  0.053352596967795006, 0.0, 0.31758825172850197, 0.0,
+  0.10564022237997103, 0.0, -0.23095631772027642, 0.0,
+  0.29974706678004504, 0.0, -0.0078394750509145853, 0.0,
+  -0.17761448252622233, 0.0, -0.041865428950362812, 0.0,
+  0.013101228086791501, 0.0, -0.023586358669561474, 0.0,
+  0.19278927213347433, 0.0, 0.029522476507649442, 0.0,
+  0.033014625725283096, 0.0, -0.049499227648532908, 0.0,
+  0.043414125330245724, 0.0, -0.096589400793231958, 0.0,
+  -0.067785001006289466, 0.0, -0.19589163277578317, 0.0,
+  -0.20113877759186116, 0.0, 0.10146738337190653, 0.0,
+  0.099638153564665793, 0.0, -0.024741008325562759, 0.0,
+  -0.15178695551726953, 0.0, 0.19524536121595062, 0.0,
+  -0.12803687993289598, 0.0, 0.18134126528978828, 0.0,
+  -0.11783661830661939, 0.0, 0.029959822545810418, 0.0,
+  0.022248583536533754, 0.0, -0.044321919838577896, 0.0,
+  -0.062069395628659214, 0.0, -0.021337170952645021, 0.0,
+  0.038338759466025898, 0.0, 0.15655539718217135, 0.0,
+  0.14324744120596603, 0.0, -0.14602783509040618, 0.0,
+  -0.015443888970098126, 0.0, -0.043459984721682068, 0.0,
+  -0.013874556761335859, 0.0, -0.0093827700179730349, 0.0,
+  -0.020122251703729301, 0.0, -0.32774253346870391, 0.0,
+  0.22990299854746316, 0.0, 0.004577845148845368, 0.0,
+  -0.0098403060691782222, 0.0, 0.036816022945266293, 0.0,
+  -0.0096813860022260702, 0.0, -0.0039487821052392501, 0.0,
+  0.015840414107676053, 0.0, -0.068721151650109072, 0.0,
+  0.020317239359264383, 0.0, 0.010649370641364581, 0.0,
+  -0.0720740774199808, 0.0, -0.0042802178593754877, 0.0,
+  0.0022051731954332424, 0.0, 0.0010885722795501279, 0.0,
+  0.039300210688427734, 0.0, -0.026831144725459201, 0.0,
+  0.0054946485762985353, 0.0, -0.035232207289947616, 0.0,
+  0.014968713811571974, 0.0, 0.014456597758027495, 0.0,
+  0.00049292060594349654, 0.0, -0.034706059916508193, 0.0,
+  0.081574131680697867, 0.0, 0.066710095563206354, 0.0,
+  -0.065418245589972279, 0.0, 0.033966204808429705, 0.0,
+  -0.071642021581040716, 0.0, 0.06984438450680526, 0.0,
+  0.063025636257221934, 0.0, 0.019865921653094486, 0.0,
+  -0.0060842661100100181, 0.0, -0.02850994557383963, 0.0,
+  0.1085397745818429, 0.0, 0.54699672665221677, 0.0,
+  0.020968680086745854, 0.0, 0.016443405263727059, 0.0,
+  -0.021827561442344344, 0.0, 0.056465097434096521, 0.0,
+  0.048832580797247872, 0.0, -0.048398860028168032, 0.0,
+  -0.072107239093568615, 0.0, -0.027116313556341337, 0.0,
+  -0.0085039123483963176, 0.0, -0.12803687993289611, 0.0,
+  0.1810685876778228, 0.0, -0.11710424542854841, 0.0,
+  0.031910608298194108, 0.0, 0.025733702328132942, 0.0,
+  -0.046172736900320414, 0.0, -0.062178646703733166, 0.0,
+  -0.020043668273056571, 0.0, 0.038810804266111658, 0.0,
+  0.14960905556434775, 0.0, 0.13110631608758194, 0.0,
+  -0.12813521019611407, 0.0, -0.0047561783346146812, 0.0,
+  -0.018636878835542173, 0.0, -0.017548256641326226, 0.0,
+  -0.019038604214633, 0.0, 0.0031759032383883545, 0.0,
+  -0.21794711681954235, 0.0, 0.1528452528993838, 0.0,
+  0.013827385013529651, 0.0, -0.00041221437215963036, 0.0,
+  0.27952056453267704, 0.0, 0.0049219850376312638, 0.0,
+  0.0015811543641005693, 0.0, -0.0080274647804495797, 0.0,
+  0.029029414521640109, 0.0, -0.15462543920204549, 0.0,
+  -0.079246049890872958, 0.0, 0.028431033458834899, 0.0,
+  -0.002284447806954192, 0.0, -0.0065483821445339553, 0.0,
+  -0.044421968864713834, 0.0, -0.13237492870111925, 0.0,
+  0.01375234989145685, 0.0, -0.0042545803629586857, 0.0,
+  0.025702299892467324, 0.0, -0.0091283186440224966, 0.0,
+  -0.0079799508706289417, 0.0, 0.012697841394216204, 0.0,
+  0.01005391240471438, 0.0, -0.033204460019291351, 0.0,
+  -0.079638279169734261, 0.0, 0.038355256500300874, 0.0,
+  -0.12945487167666053, 0.0, 0.17317384676764888, 0.0,
+  -0.20622026354857176, 0.0, -0.20528384435691499, 0.0,
+  0.0040016073236484682, 0.0, 0.012801392516576093, 0.0,
+  0.039071072504615514, 0.0, 0.043859545727822066, 0.0,
+  -0.37869415299890041, 0.0, -0.0630546615040984, 0.0,
+  0.0052664176490054143, 0.0, 0.0010380720955822439, 0.0,
+  -0.03956206701093138, 0.0, -0.031465645158654354, 0.0,
+  -0.10009004816469634, 0.0, -0.10432519423147357, 0.0,
+  -0.016479333751041887, 0.0, 0.012028091918617746, 0.0,
+  -0.12803687993289622, 0.0, 0.16585213135391424, 0.0,
+  -0.10736510067690382, 0.0, 0.022861303126319111, 0.0,
+  0.018232240713641414, 0.0, -0.039564728704654273, 0.0,
+  -0.059616973939388432, 0.0, -0.013494959367769442, 0.0,
+  0.028999434124629943, 0.0, 0.13156927807324609, 0.0,
+  0.11957666305158184, 0.0, -0.11425702439505156, 0.0,
+  -0.022110240844426188, 0.0, -0.054721915911226604, 0.0,
+  -0.011609720084117252, 0.0, 0.015463021330056228, 0.0,
+  -0.014972416546324972, 0.0, -0.29439412904263712, 0.0,
+  0.20726023741391089, 0.0, -0.0059676606189243316, 0.0,
+  0.017172634245579011, 0.0, -0.11238928142445741, 0.0,
+  0.016089513057159839, 0.0, 0.0079816475067433709, 0.0,
+  -0.026106122291578018, 0.0, 0.11686603692128267, 0.0,
+  0.10984314417870231, 0.0, 0.071234959029343736, 0.0,
+  0.12542506605617293, 0.0, -0.012759980422851931, 0.0,
+  -0.0071991234032244521, 0.0, 0.08605491138052225, 0.0,
+  0.13217775468492382, 0.0, 0.040691678025672244, 0.0,
+  -0.015630871205709485, 0.0, 0.0096088897359225423, 0.0,
+  -0.010861976473427275, 0.0, -0.014685715184367985, 0.0,
+  -0.015214660146651293, 0.0, 0.055961336827789455, 0.0,
+  -0.12374933271456072, 0.0, -0.029115656821736693, 0.0,
+  0.078766580184590387, 0.0, 0.11822433317770215, 0.0,
+  -0.17649520586819425, 0.0, 0.23820980113407134, 0.0,
+  0.28405559371051109, 0.0, -0.03348974255381431, 0.0,
+  -0.0084989911982494126, 0.0, 0.007545072217053167, 0.0,
+  -0.48169168241715143, 0.0, -0.40836481756743037, 0.0,
+  0.10945269139485789, 0.0, -0.040184289340585211, 0.0,
+  0.045938315962818735, 0.0, -0.044184956228637218, 0.0,
+  -0.055943522903035177, 0.0, 0.32756028592390252, 0.0,
+  0.37693452590693749, 0.0, 0.1127151351326685, 0.0,
+  -0.019386464131115742, 0.0, -0.12803687993289598, 0.0,
+  0.13371964006847276, 0.0, -0.068628697710047246, 0.0,
+  0.0097031382333150895, 0.0, 0.00074104465390246749, 0.0,
+  -0.023242431572752902, 0.0, -0.043790638112102695, 0.0,
+  0.015416277104418771, 0.0, -0.063147336411171456, 0.0,
+  -0.01976871325505011, 0.0, -0.11382445478681262, 0.0,
+  0.083085669690899144, 0.0, -0.036776948390665636, 0.0,
+  -0.068186858209132034, 0.0, -0.025420413044480859, 0.0,
+  0.69405820595554568, 0.0, 0.58751773721395584, 0.0,
+  0.11444470377792866, 0.0, 0.082071283498471356, 0.0,
+  -0.13071038880323871, 0.0, 9.693308517657337e-05, 0.0,
+  -0.024940165722158517, 0.0, 0.00017757553113546142, 0.0,
+  -0.00034949967281484629, 0.0, 0.00087945140327669086, 0.0,
+  -0.0023744868286654577, 0.0, 0.020755748222984337, 0.0,
+  -0.0081545309703003766, 0.0, -0.0075270950514078746, 0.0,
+  0.0042952267955576225, 0.0, -0.0017695197105477632, 0.0,
+  -0.0038605088264594156, 0.0, 0.0034272949548800574, 0.0,
+  -0.00032568920589915785, 0.0, 1.5508852768668195e-05, 0.0,
+  0.011147098626475374, 0.0, -0.0041908682789704877, 0.0,
+  0.0002580702099847581, 0.0, 0.0022016786825896891, 0.0,
+  -0.0005535752395918887, 0.0, 0.0076190163493578735, 0.0,
+  0.0057429766914704177, 0.0, -0.0037175744417190155, 0.0,
+  0.013012350934150645, 0.0, 0.011120107443659674, 0.0,
+  -0.0065263357667193272, 0.0, -0.0039302044063587805, 0.0,
+  -0.01459316805808294, 0.0, -0.0048442646393478672, 0.0,
+  -0.0060180833719499192, 0.0, 0.038430098434864945, 0.0,
+  -0.0014811994558771402, 0.0, -0.006346836143002234, 0.0,
+  -0.00060697727846372449, 0.0, 0.0010852056811249766, 0.0,
+  0.002860702919998136, 0.0, 0.0021709444489622799, 0.0,
+  0.0018888037717262444, 0.0, 0.0049264075735294651, 0.0,
+  -0.0051082857062592262, 0.0, 0.0011774235977752099, 0.0,
+  -0.12803687993289617, 0.0, -0.027923111396870631, 0.0,
+  -0.029101188847122466, 0.0, -0.025751817735743088, 0.0,
+  0.0082502126472396454, 0.0, -0.032940682089026917, 0.0,
+  0.0041147896382537691, 0.0, -0.015027701132929464, 0.0,
+  0.20343582955899078, 0.0, -0.094209511629802331, 0.0,
+  -0.089116416910220125, 0.0, -0.068787586343681512, 0.0,
+  -0.11807667452016568, 0.0, -0.14558971368098378, 0.0,
+  -0.29457326227990566, 0.0, 0.040216194789042051, 0.0,
+  -0.056829508990688178, 0.0, -0.16738266772043664, 0.0,
+  -0.21372826556175489, 0.0, -0.05561458684688099, 0.0,
+  -0.013775741458097478, 0.0, -0.11625965817421205, 0.0,
+  -0.22640371764521949, 0.0, -0.13062070790126598, 0.0,
+  0.2485131396790837, 0.0, 0.028718739200890731, 0.0,
+  -0.023973964079099328, 0.0, -0.074961597149693915, 0.0,
+  0.03410520920933903, 0.0, -0.011404022133300891, 0.0,
+  -0.0159879482350383, 0.0, -0.094540386307449473, 0.0,
+  0.1405062453125866, 0.0, 0.32243331223599891, 0.0,
+  -0.44910010987944876, 0.0, 0.14629175712756837, 0.0,
+  -0.10865223901336184, 0.0, -0.10196090944253579, 0.0,
+  0.067639775275901717, 0.0, -0.012094691724846889, 0.0,
+  -0.052461902575341328, 0.0, -0.056450515649447593, 0.0,
+  0.071946168391783069, 0.0, 0.20361505825951545, 0.0,
+  0.016484689048908388, 0.0, 0.020761877433923711, 0.0,
+  -0.059341531375476542, 0.0, 0.073486823898779488, 0.0,
+  0.037584470867299484, 0.0, 0.3491194635771438, 0.0,
+  0.09813632987283169, 0.0, 0.072705555303862565, 0.0,
+  -0.14501766756732043, 0.0, -0.020950735821408589, 0.0,
+  0.01932139160186537, 0.0, -0.086233730939762637, 0.0,
+  -0.10467815426834845, 0.0, -0.067460358461895506, 0.0,
+  -0.0084841145463399915, 0.0, 0.050805015322525855, 0.0,
+  -0.065316116573610847, 0.0, -0.12803687993289598, 0.0,
+  -0.029370775175883587, 0.0, -0.028540640765297411, 0.0,
+  -0.02142252699153788, 0.0, 0.01189161481977458, 0.0,
+  -0.034003951220326734, 0.0, 0.0033531187759562441, 0.0,
+  -0.010566031026715515, 0.0, 0.20452106154324257, 0.0,
+  -0.097752766593788981, 0.0, -0.091124105650045681, 0.0,
+  -0.052492412251566888, 0.0, -0.099500324640153875, 0.0,
+  -0.11162382226385255, 0.0, -0.31464749278761578, 0.0,
+  0.029307856025487654, 0.0, -0.023708953622566677, 0.0,
+  -0.14655062921217327, 0.0, -0.26313364449214299, 0.0,
+  -0.043011112244043297, 0.0, 0.0054979018323032432, 0.0,
+  0.094598783292503985, 0.0, 0.17628107450077152, 0.0,
+  0.062157497485915862, 0.0, -0.19487472196726965, 0.0,
+  -0.057206272887356947, 0.0, 0.010183985833811733, 0.0,
+  0.048320137727301558, 0.0, -0.18558569977522105, 0.0,
+  -0.0038253401971819656, 0.0, -0.012873407775707481, 0.0,
+  0.085945364568930455, 0.0, -0.15630731720726598, 0.0,
+  0.098857191447883089, 0.0, -0.15671807216184316, 0.0,
+  0.044148707047124945, 0.0, -0.034815341960927053, 0.0,
+  -0.015189284977439937, 0.0, -0.00011565767359828573, 0.0,
+  -0.0025060770661883688, 0.0, -0.0010057866129508958, 0.0,
+  -0.018793762420411655, 0.0, 0.0044206556721379511, 0.0,
+  0.038702396868575309, 0.0, -0.012174431992520371, 0.0,
+  -0.036521331981033037, 0.0, 0.047998688420348164, 0.0,
+  -0.075283595889421934, 0.0, -0.041398626247141052, 0.0,
+  -0.44884042260429358, 0.0, -0.02070001837945264, 0.0,
+  -0.059757936656671638, 0.0, 0.19983543257344366, 0.0,
+  -0.001987797314609329, 0.0, 0.0056120403059149648, 0.0,
+  0.15615433628568584, 0.0, 0.16881171821836419, 0.0,
+  0.066128262095335538, 0.0, -0.011995067243619302, 0.0,
+  -0.092275331605428917, 0.0, 0.060072311889547848, 0.0,
+  -0.12803687993289598, 0.0, -0.029620890520267305, 0.0,
+  -0.030598091842764238, 0.0, -0.030084438964473156, 0.0,
+  0.0093472019222645714, 0.0, -0.035233594898048788, 0.0,
+  -0.0013549737295967643, 0.0, -0.0045628210226191929, 0.0,
+  0.1970959028697043, 0.0, -0.098602118848945333, 0.0,
+  -0.081804502242706661, 0.0, -0.04799390243631501, 0.0,
+  -0.11445550645941964, 0.0, -0.16377680559939642, 0.0,
+  -0.2948435407140893, 0.0, 0.047174284348030136, 0.0,
+  -0.052007018576735689, 0.0, -0.17266769299339926, 0.0,
+  -0.21509297437552649, 0.0, -0.052844905336155518, 0.0,
+  0.016545305203626601, 0.0, -0.13796737902236672, 0.0,
+  0.27289062032336281, 0.0, 0.14772782104155646, 0.0,
+  -0.29425867844837522, 0.0, -0.051987293109317351, 0.0,
+  -0.028345723172279257, 0.0, -0.077716278173938308, 0.0,
+  -0.084483697082480061, 0.0, -0.032156542755570644, 0.0,
+  -0.04508283253624349, 0.0, -0.072038402090234141, 0.0,
+  0.15307924247395308, 0.0, -0.250551278480733, 0.0,
+  0.28898919613717161, 0.0, -0.095026179405048344, 0.0,
+  0.094154884671364902, 0.0, 0.11694408337655278, 0.0,
+  -0.046863302944120382, 0.0, 0.0087201713118549226, 0.0,
+  0.047555788064589884, 0.0, 0.034373574360842332, 0.0,
+  -0.057443820211174675, 0.0, -0.03579194584142336, 0.0,
+  0.022376732275420853, 0.0, 0.034767352426194664, 0.0,
+  -0.053559712709140818, 0.0, 0.031601426322444871, 0.0,
+  0.029362329383808772, 0.0, 0.43419176193484543, 0.0,
+  -0.0057331705814492413, 0.0, -0.00015907756256997843, 0.0,
+  -0.22414826322424997, 0.0, 0.0042615907377810507, 0.0,
+  0.0067119338347213404, 0.0, -0.15748277099837962, 0.0,
+  -0.17249425407429012, 0.0, -0.041637401926613152, 0.0,
+  0.01773757817112823, 0.0, 0.088700442392843803, 0.0,
+  -0.057981022441631586, 0.0, -0.12803687993289603, 0.0,
+  -0.026963441513625095, 0.0, -0.028265436111757657, 0.0,
+  -0.02659830989949372, 0.0, 0.01317255356088993, 0.0,
+  -0.036494663324726506, 0.0, -0.0033422969910836494, 0.0,
+  -0.0026882886579060066, 0.0, 0.19290991405166638, 0.0,
+  -0.096853292695873033, 0.0, -0.081939287756125842, 0.0,
+  -0.033238815896082748, 0.0, -0.09475122860669849, 0.0,
+  -0.12785440786455887, 0.0, -0.29959562714029164, 0.0,
+  0.041050284784191808, 0.0, -0.013142118829412323, 0.0,
+  -0.1324084777095314, 0.0, -0.25462973386058591, 0.0,
+  -0.038473704293800516, 0.0, -0.012672811571308156, 0.0,
+  0.043499251030394967, 0.0, -0.37176673526498466, 0.0,
+  -0.12881311610743287, 0.0, 0.40387382696981855, 0.0,
+  0.13875477308677064, 0.0, 0.0036463134368196369, 0.0,
+  0.023295252786315123, 0.0, 0.39185896269091819, 0.0,
+  -0.027181079224481854, 0.0, -0.023561576814709294, 0.0,
+  0.049238767103373195, 0.0, -0.10197736527291482, 0.0,
+  -0.25639522266367754, 0.0, 0.44680538563004174, 0.0,
+  -0.1359642412838355, 0.0, 0.062356692330228086, 0.0,
+  -0.015943736318324318, 0.0, -0.010827314989422208, 0.0,
+  0.00017467205124433401, 0.0, -0.0013087618463596966, 0.0,
+  0.04576052678554688, 0.0, -0.013574492004533794, 0.0,
+  -0.27533700668904015, 0.0, -0.025086157853062827, 0.0,
+  -0.014531007595486929, 0.0, 0.041107471444308041, 0.0,
+  0.0062063391015092948, 0.0, -0.010077962184110939, 0.0,
+  -0.21136201287741313, 0.0, -0.070778557481787477, 0.0,
+  0.037945787075823904, 0.0, 0.1180576572751693, 0.0,
+  0.024629990798284134, 0.0, -0.033755257907350067, 0.0,
+  0.047505565412211827, 0.0, 0.05248769475728262, 0.0,
+  0.010595150545928959, 0.0, -0.010278800954459445, 0.0,
+  -0.005859913944644168, 0.0, 0.025485078334755339, 0.0,
+  -0.12803687993289606, 0.0, -0.11040347700460071, 0.0,
+  0.020782162585789622, 0.0, -0.043175491909605679, 0.0,
+  -0.067229058916771514, 0.0, -0.010323637718063074, 0.0,
+  -0.0065058500006263667, 0.0, -0.076020640902275699, 0.0,
+  0.011645922297676425, 0.0, 0.032227652197015108, 0.0,
+  -0.1704871054040866, 0.0, -0.27155975723275533, 0.0,
+  -0.15223139302771826, 0.0, -0.075506095539897303, 0.0,
+  0.28956185710289151, 0.0, -0.18518729731728345, 0.0,
+  0.19394053610797912, 0.0, -0.022906756397749656, 0.0,
+  -0.040102699137489359, 0.0, -0.082335983700604409, 0.0,
+  -0.001511434910409711, 0.0, -0.070054392090034237, 0.0,
+  -0.0017589345642304885, 0.0, 0.0045128629722080557, 0.0,
+  0.00018727474415541711, 0.0, -0.00069427559554093347, 0.0,
+  -0.027648350639144673, 0.0, -0.076263386133070696, 0.0,
+  0.0023123028805902843, 0.0, -0.042995734061629258, 0.0,
+  -0.0079431760868349782, 0.0, -0.06897519684395384, 0.0,
+  0.063805209513948538, 0.0, 0.002351163858463884, 0.0,
+  -0.0025297539690403658, 0.0, 0.012620390453135278, 0.0,
+  0.027533464746397011, 0.0, 0.053285798999424969, 0.0,
+  8.6124052553660849e-05, 0.0, 0.0037051175720689464, 0.0,
+  0.01122125639762774, 0.0, -0.0019037222380234291, 0.0,
+  -0.029700290445281188, 0.0, -0.00025698555505009079, 0.0,
+  0.11083652349199524, 0.0, -0.023392671657971036, 0.0,
+  0.14109341468099207, 0.0, 0.16146663937386188, 0.0,
+  0.0319712793560454, 0.0, 0.063963171309286082, 0.0,
+  0.059284419423904895, 0.0, -0.015221636218166665, 0.0,
+  0.39242805273080733, 0.0, 0.061645136080730627, 0.0,
+  0.15401471897336977, 0.0, -0.020769446108291682, 0.0,
+  -0.16882705603088949, 0.0, 0.029080698914354438, 0.0,
+  -0.039183245762098119, 0.0, -0.12502628799667828, 0.0,
+  0.27547008962258729, 0.0, -0.1280368799328962, 0.0,
+  -0.11450406084479954, 0.0, 0.02207510260142392, 0.0,
+  -0.040694967426479621, 0.0, -0.068165295814893265, 0.0,
+  -0.011234191742837888, 0.0, -0.0049626348261989674, 0.0,
+  -0.079856328264890766, 0.0, 0.022050320239252973, 0.0,
+  0.034812719484131838, 0.0, -0.20739923834619239, 0.0,
+  -0.31544689981292923, 0.0, -0.16793423049119405, 0.0,
+  -0.065325218460662873, 0.0, 0.33702235615689358, 0.0,
+  -0.24525477361346065, 0.0, 0.2758957954395988, 0.0,
+  -0.022731911203141376, 0.0, -0.073548810164002054, 0.0,
+  -0.096874619414792904, 0.0, 0.00052273978106766338, 0.0,
+  0.059776064293429229, 0.0, 0.0022615251726221509, 0.0,
+  -0.005076719599506908, 0.0, -0.0017239832639639114, 0.0,
+  0.00044114692604843304, 0.0, 0.034301234560029065, 0.0,
+  0.033256404340634232, 0.0, -0.004378164569433126, 0.0,
+  -0.037996345954542959, 0.0, -0.09220589076144152, 0.0,
+  0.081440236265901009, 0.0, -0.084974705006839166, 0.0,
+  -0.0040303335427897564, 0.0, 0.0048001167548441569, 0.0,
+  -0.011917237631290331, 0.0, -0.021598328143925653, 0.0,
+  -0.050599704403220098, 0.0, 0.0018492293183750346, 0.0,
+  -0.00092537483083819639, 0.0, -0.01331585784173697, 0.0,
+  0.0077283143646777724, 0.0, 0.024045322349120345, 0.0,
+  -0.0081800842862093364, 0.0, -0.12430528764607508, 0.0,
+  0.024147211357483236, 0.0, -0.13474207790004486, 0.0,
+  -0.13845303835431999, 0.0, -0.026736424524621515, 0.0,
+  -0.062927408433367263, 0.0, -0.056509743855612173, 0.0,
+  0.013041475409181727, 0.0, -0.35170110865080323, 0.0,
+  -0.049384811348454745, 0.0, -0.13912555340303492, 0.0,
+  0.020655836631545566, 0.0, 0.14784595619363947, 0.0,
+  -0.028165499030803291, 0.0, 0.03476972674170193, 0.0,
+  0.11761666139828435, 0.0, -0.24779557073449718, 0.0,
+  -0.12803687993289634, 0.0, -0.094207153140172528, 0.0,
+  0.010109017186543919, 0.0, -0.10849545987661215, 0.0,
+  -0.062506586525785238, 0.0, -0.035146304326552087, 0.0,
+  -0.027433872668595052, 0.0, 0.15803636142869243, 0.0,
+  -0.042727295471710863, 0.0, -0.022514419164677293, 0.0,
+  0.073674171374089992, 0.0, -0.0070313174979104694, 0.0,
+  -0.078754620908958309, 0.0, -0.1822660852844806, 0.0,
+  0.18885917537763378, 0.0, 0.21130241557459076, 0.0,
+  -0.29128668296340071, 0.0, 0.023625722259871123, 0.0,
+  -0.010260865213834453, 0.0, -0.030986692377062953, 0.0,
+  0.00022408555195923703, 0.0, 0.016177184706015344, 0.0,
+  0.0020377669453371466, 0.0, 0.0017012095934784046, 0.0,
+  0.0032313977790775781, 0.0, -0.0029540705217695981, 0.0,
+  0.013622006183173952, 0.0, -0.044212224005114098, 0.0,
+  0.0094340279892204931, 0.0, 0.0059688085771586246, 0.0,
+  -0.0012876569361966591, 0.0, -0.038388295267330431, 0.0,
+  0.064714102198336648, 0.0, -0.0016278963998902192, 0.0,
+  -0.0028431207227327228, 0.0, 0.00065900180085447571, 0.0,
+  4.4714509888630998e-05, 0.0, 0.0033600853548020723, 0.0,
+  -0.0024370406378463523, 0.0, -0.047874684421284702, 0.0,
+  -0.047631679721743425, 0.0, 0.0027267716558701063, 0.0,
+  0.025179976117541594, 0.0, -0.0058155712516169827, 0.0,
+  0.10020320258752716, 0.0, -0.011182996133992894, 0.0,
+  0.086089179040125835, 0.0, -0.29767604267125924, 0.0,
+  -0.071220521498152251, 0.0, -0.0041786858037077259, 0.0,
+  -0.018482403827005053, 0.0, 0.027790357373593279, 0.0,
+  0.055811124505641109, 0.0, -0.068199042057598983, 0.0,
+  -0.14279915632446993, 0.0, -0.10490371999090693, 0.0,
+  0.091462622005270541, 0.0, -0.23896815393820803, 0.0,
+  0.15012422069183526, 0.0, -0.043155766445010083, 0.0,
+  0.076935339036417638, 0.0, -0.12803687993289595, 0.0,
+  -0.096476056586784487, 0.0, 0.011605717714130714, 0.0,
+  -0.11084759713936231, 0.0, -0.061810100939716284, 0.0,
+  -0.039345432107533163, 0.0, -0.02943234539977637, 0.0,
+  0.1817260294917323, 0.0, -0.044675986199291452, 0.0,
+  -0.028336030800826691, 0.0, 0.077737129519979173, 0.0,
+  0.00028352347948604667, 0.0, -0.074824113191926056, 0.0,
+  -0.15746702066337301, 0.0, 0.18796748265777852, 0.0,
+  0.23571232687694532, 0.0, -0.2921057352762701, 0.0,
+  0.037712559669224884, 0.0, -0.036152976116779742, 0.0,
+  -0.021600488012525371, 0.0, -6.2628805592664961e-05, 0.0,
+  0.16172110245238652, 0.0, -0.0014869208934656869, 0.0,
+  0.00028944274342972647, 0.0, -0.002528547304853804, 0.0,
+  0.0034503878696177034, 0.0, 0.1242715940762147, 0.0,
+  -0.019059883474449493, 0.0, -0.0099132769397108893, 0.0,
+  -0.0054198680967645994, 0.0, 0.002626412484618161, 0.0,
+  0.039120806486792468, 0.0, -0.070239411251258863, 0.0,
+  -0.00031513012232233098, 0.0, -0.0011240207403540755, 0.0,
+  0.0010227154321775637, 0.0, -0.00098271878979123528, 0.0,
+  -0.0051358262944913588, 0.0, 0.011343363325980044, 0.0,
+  0.059849373683152941, 0.0, 0.052713199176754558, 0.0,
+  -0.0022264291368505472, 0.0, -0.024375510934300397, 0.0,
+  0.011078334961167126, 0.0, -0.11051607143022235, 0.0,
+  0.0097061129752644797, 0.0, -0.098200787243979029, 0.0,
+  0.28964723896729788, 0.0, 0.071029016367825895, 0.0,
+  -0.0040106877052904092, 0.0, 0.032473641643145236, 0.0,
+  -0.028774733331142988, 0.0, -0.044786539701869521, 0.0,
+  0.071602010843789962, 0.0, 0.16134651302767189, 0.0,
+  0.13159337572714888, 0.0, -0.10564344004564777, 0.0,
+  0.22861344999624428, 0.0, -0.14531289419799359, 0.0,
+  0.065354626798652588, 0.0, -0.11495574068852664, 0.0,
+  -0.12803687993289598, 0.0, -0.086395545805176832, 0.0,
+  0.003047918870947935, 0.0, 0.0034593329871506814, 0.0,
+  -0.012651086184003905, 0.0, -0.020547271558217221, 0.0,
+  0.015898253586515847, 0.0, -0.018289585067202605, 0.0,
+  0.11274438238343641, 0.0, -0.076162918578039876, 0.0,
+  -0.11014600769624949, 0.0, -0.072541791379975823, 0.0,
+  -0.094040639615020238, 0.0, -0.056244861456654062, 0.0,
+  -0.057423968858813318, 0.0, -0.06523111420358195, 0.0,
+  -0.019979397075553802, 0.0, 0.1286274495778035, 0.0,
+  0.19431843484605338, 0.0, 0.013917996012308398, 0.0,
+  -0.00057249375121775563, 0.0, 0.009042127855207624, 0.0,
+  -0.041984932948032863, 0.0, -0.066850698854323182, 0.0,
+  -0.11976495861405115, 0.0, 0.093827079403706617, 0.0,
+  -0.031652468759257528, 0.0, 0.14132678700740645, 0.0,
+  -0.20059081620333646, 0.0, 0.35832315499397832, 0.0,
+  0.5475325376531659, 0.0, -0.10719316949398611, 0.0,
+  0.17757639985565665, 0.0, -0.10697701193093934, 0.0,
+  0.11637204638374583, 0.0, -0.20759869851301721, 0.0,
+  -0.28219318129600113, 0.0, -0.49631823290443872, 0.0,
+  -0.0069973574640623147, 0.0, 0.023556268031059587, 0.0,
+  -0.076912975803019104, 0.0, 0.039528255449777658, 0.0,
+  0.077689231713056833, 0.0, -0.07959649907406352, 0.0,
+  0.086604538964368608, 0.0, -0.020760706385909107, 0.0,
+  -0.042374766343328582, 0.0, 0.091154249318011207, 0.0,
+  0.026305799907999309, 0.0, 0.21225879678818535, 0.0,
+  -0.017710209488213963, 0.0, -0.011859652840880204, 0.0,
+  0.068721175038236007, 0.0, 0.0068952863632466667, 0.0,
+  -0.015774640807442113, 0.0, 0.18997333046370352, 0.0,
+  0.19534869023306625, 0.0, 0.057908585590230634, 0.0,
+  0.04680180024044496, 0.0, -0.044585753203644794, 0.0,
+  -0.0015502808944753727, 0.0, -0.12803687993289595, 0.0,
+  -0.087322672001771781, 0.0, 0.0030961741604293934, 0.0,
+  0.0063911304600365445, 0.0, -0.0074682814801964037, 0.0,
+  -0.020441535276938812, 0.0, 0.014398035065863733, 0.0,
+  -0.01419228582956871, 0.0, 0.11632577484264139, 0.0,
+  -0.080197569552499362, 0.0, -0.11030605538563437, 0.0,
+  -0.058122747075754981, 0.0, -0.078141149927677761, 0.0,
+  -0.031230822876407667, 0.0, -0.078165725273903502, 0.0,
+  -0.073673537004214903, 0.0, 0.0093142691981458314, 0.0,
+  0.12804648547052216, 0.0, 0.15489517978301351, 0.0,
+  0.028834449278116184, 0.0, 0.00023013957774500738, 0.0,
+  0.16920663945777784, 0.0, 0.0255185095387527, 0.0,
+  0.048891994723190071, 0.0, 0.079295965747709168, 0.0,
+  -0.073699193669418947, 0.0, 0.039520316899300884, 0.0,
+  0.26850057445709835, 0.0, 0.1619082486536618, 0.0,
+  0.35503614195830802, 0.0, 0.45862831264249182, 0.0,
+  0.030747429435685463, 0.0, 0.0012245780779379354, 0.0,
+  0.09252805939740183, 0.0, -0.077168280337023609, 0.0,
+  0.15984542315082328, 0.0, 0.23816472481906245, 0.0,
+  0.41904451909286783, 0.0, -0.015007477947170741, 0.0,
+  -0.0043556926584062908, 0.0, 0.068506022181758483, 0.0,
+  -0.0060357349942566701, 0.0, -0.081037720691351664, 0.0,
+  0.019585586304160608, 0.0, -0.011125234661163221, 0.0,
+  0.018810044103963343, 0.0, -0.0011555596176944301, 0.0,
+  -0.07295820152190452, 0.0, -0.018633030781365845, 0.0,
+  -0.090041394554564405, 0.0, -0.033445544241794328, 0.0,
+  0.002645415014348125, 0.0, -0.093184997436705372, 0.0,
+  0.016455773573336951, 0.0, -0.01276316590703884, 0.0,
+  -0.12070138738406405, 0.0, -0.13085586647983302, 0.0,
+  -0.046972448229949761, 0.0, -0.036023076299223925, 0.0,
+  0.068511460114495201, 0.0, -0.002347671105679937, 0.0,
+  -0.12803687993289628, 0.0, -0.091863932054469494, 0.0,
+  0.022074950889165008, 0.0, -0.12084536720309702, 0.0,
+  -0.076341127354748184, 0.0, -0.047456128258230916, 0.0,
+  -0.029348338412621359, 0.0, 0.34477039074346977, 0.0,
+  -0.075641560412435693, 0.0, -0.021973680050387016, 0.0,
+  0.10899883092794946, 0.0, -0.050856534523843047, 0.0,
+  -0.11694084552534849, 0.0, 0.18043793071841319, 0.0,
+  -0.061582031668340836, 0.0, -0.029967685181275884, 0.0,
+  0.017543149385136292, 0.0, 0.0016766996626982624, 0.0,
+  0.060517808494608027, 0.0, -0.13455633665780922, 0.0,
+  -0.002187018285603188, 0.0, -0.30387892006122286, 0.0,
+  0.1006034427096532, 0.0, -0.12959177269209748, 0.0,
+  0.038314421828316736, 0.0, -0.041693084287709993, 0.0,
+  -0.5715941145566541, 0.0, 0.37574275597307288, 0.0,
+  0.095914679747487547, 0.0, -0.037593898179188658, 0.0,
+  -0.096181437253462232, 0.0, 0.044816380722814991, 0.0,
+  -0.06634755874502439, 0.0, 0.0055764307460742374, 0.0,
+  -0.0092855707495543074, 0.0, 0.00014741417977310331, 0.0,
+  0.061657540464277516, 0.0, -0.12968003176101042, 0.0,
+  -0.078152110742723865, 0.0, 0.36937702001362055, 0.0,
+  0.41162215642656719, 0.0, -0.19055036236967196, 0.0,
+  -0.032365306258534246, 0.0, 0.09011840125195214, 0.0,
+  -0.038197054853279462, 0.0, 0.0065191134724432043, 0.0,
+  -0.0035173492108305907, 0.0, -0.010659107116970035, 0.0,
+  -0.020374192410835424, 0.0, -0.017103196749906072, 0.0,
+  0.003094637869641904, 0.0, -0.015713210117894682, 0.0,
+  0.00026123020165038914, 0.0, 0.00041899824728052956, 0.0,
+  0.025207176343699348, 0.0, 3.0407793486890105e-05, 0.0,
+  0.022443789262877347, 0.0, -0.059658979043663539, 0.0,
+  0.046088081403988929, 0.0, -0.029034859495428948, 0.0,
+  -0.00031913052780779963, 0.0, -0.12803687993289606, 0.0,
+  -0.089221201708089226, 0.0, 0.024351568349082805, 0.0,
+  -0.11494730571858369, 0.0, -0.071253965049262832, 0.0,
+  -0.048132255044498098, 0.0, -0.030452344471241063, 0.0,
+  0.32251593880521978, 0.0, -0.072201715810215061, 0.0,
+  -0.023538677190460312, 0.0, 0.10226156134051756, 0.0,
+  -0.036258628925605219, 0.0, -0.10273287315398466, 0.0,
+  0.15775736511662991, 0.0, -0.050804662870098743, 0.0,
+  -0.0058521519491647519, 0.0, 0.018687548248480387, 0.0,
+  0.014563872060642821, 0.0, 0.038868485676725323, 0.0,
+  -0.11580417229598805, 0.0, 0.001231203567593398, 0.0,
+  -0.17131868534916619, 0.0, -0.13558080474166365, 0.0,
+  0.17087535481113966, 0.0, -0.041310179131829043, 0.0,
+  0.041107527863312864, 0.0, -0.42151176021760323, 0.0,
+  0.33808865569910362, 0.0, -0.083754832110609703, 0.0,
+  -0.031021541440363433, 0.0, -0.069851985649026491, 0.0,
+  0.085468804619430225, 0.0, -0.13332138068731231, 0.0,
+  -0.0005415722426324683, 0.0, 0.017860869578578107, 0.0,
+  0.009242734990623655, 0.0, -0.10800942555690998, 0.0,
+  0.14517298566948655, 0.0, -0.15402936007324838, 0.0,
+  -0.64078894026256816, 0.0, -0.43799778604477374, 0.0,
+  0.049446423312917327, 0.0, 0.070392426617551851, 0.0,
+  -0.0067731288773127587, 0.0, -0.16137510981549652, 0.0,
+  0.023509565328880763, 0.0, -0.11322685821145945, 0.0,
+  0.41237236434678609, 0.0, 0.058097974902896234, 0.0,
+  0.005004986715548802, 0.0, -0.019641382179012932, 0.0,
+  0.03242828920132345, 0.0, -0.15636880454266303, 0.0,
+  -0.068242481943350114, 0.0, -0.15235360009029475, 0.0,
+  -0.19715936557606806, 0.0, 0.11281377705967779, 0.0,
+  0.26205728188736338, 0.0, -0.10912579558090367, 0.0,
+  -0.195599150234473, 0.0, 0.19654059712125482, 0.0,
+  -0.12803687993289559, 0.0, 0.13397373916007016, 0.0,
+  -0.10367957415889753, 0.0, 0.028685220544479226, 0.0,
+  0.030223752756781779, 0.0, -0.052932703625996842, 0.0,
+  -0.038007426340461198, 0.0, -0.025344330103814067, 0.0,
+  0.11877597652451161, 0.0, 0.13203644316967361, 0.0,
+  0.17815283826852824, 0.0, -0.11179937198759091, 0.0,
+  0.032911484645671563, 0.0, 0.0092087768363457133, 0.0,
+  0.022492586849892401, 0.0, -0.043582694964792654, 0.0,
+  -0.022626474419538103, 0.0, 0.23075645916405849, 0.0,
+  -0.083456843877327921, 0.0, 0.022576062940770986, 0.0,
+  -0.0081782783921698372, 0.0, -0.20030620688271733, 0.0,
+  0.081171088350380463, 0.0, 0.037928040373871853, 0.0,
+  -0.096870401179954782, 0.0, 0.3168111915947785, 0.0,
+  0.091056368974235885, 0.0, 0.019369093557431785, 0.0,
+  0.23922751549436339, 0.0, 0.012319139246662489, 0.0,
+  0.015811474420466775, 0.0, -0.021808319342987117, 0.0,
+  0.14683909411879273, 0.0, 0.035342630498885114, 0.0,
+  0.026462415806178294, 0.0, 0.025709944167620419, 0.0,
+  -0.014079043085743245, 0.0, -0.021093806762038474, 0.0,
+  -0.026158294919175592, 0.0, 0.033241177352592632, 0.0,
+  -0.058087539167252927, 0.0, 0.064770288408867102, 0.0,
+  0.015579664793871016, 0.0, 0.096561656535298482, 0.0,
+  -0.14762977717338741, 0.0, 0.13372996541701143, 0.0,
+  0.032769168128231836, 0.0, 9.3206676765784826e-05, 0.0,
+  -0.0014989260068177773, 0.0, -0.096690018398850705, 0.0,
+  0.34249558434107691, 0.0, -0.18877047284691742, 0.0,
+  -0.058400159877330944, 0.0, -0.0065626885148808633, 0.0,
+  -0.0063271185567839883, 0.0, 0.047662945501206845, 0.0,
+  0.054379697402266454, 0.0, -0.20595284560934424, 0.0,
+  -0.26289905921693046, 0.0, -0.10511257479752492, 0.0,
+  0.019815460951495951, 0.0, -0.1280368799328955, 0.0,
+  0.13129734628116546, 0.0, -0.099974525775141154, 0.0,
+  0.03024645555855238, 0.0, 0.032761031937923124, 0.0,
+  -0.052078754330227441, 0.0, -0.03724193829825137, 0.0,
+  -0.022024694669681582, 0.0, 0.1162960507727745, 0.0,
+  0.11892536581778811, 0.0, 0.15786244716477579, 0.0,
+  -0.089779170112957038, 0.0, 0.04284987492565559, 0.0,
+  0.036924502374836549, 0.0, 0.013711470817060811, 0.0,
+  -0.052403865422266854, 0.0, 0.0019867793576597344, 0.0,
+  0.29346214251279729, 0.0, -0.14703112746896108, 0.0,
+  0.028329253988760461, 0.0, 0.0017500371808049382, 0.0,
+  0.057380218164476124, 0.0, -0.065351408250785073, 0.0,
+  -0.030235352225679041, 0.0, 0.076246005409128362, 0.0,
+  -0.18824913523694375, 0.0, -0.037952539315478921, 0.0,
+  -0.0024555657406117276, 0.0, -0.080032582012299056, 0.0,
+  0.005241673201984382, 0.0, -0.0083097269703202234, 0.0,
+  0.020714698746000283, 0.0, -0.11660733605804197, 0.0,
+  -0.087815160035910139, 0.0, 0.079947989622938351, 0.0,
+  -0.0064543829345931822, 0.0, 0.0083529899313268194, 0.0,
+  0.036819780428776289, 0.0, -0.15255085937543914, 0.0,
+  0.12758593893155259, 0.0, -0.13739430701041352, 0.0,
+  0.26021785469020098, 0.0, -0.018230004886191264, 0.0,
+  0.4973508757028588, 0.0, 0.13453738314663055, 0.0,
+  -0.12714346486920064, 0.0, -0.063250440685355361, 0.0,
+  -0.012270241839970891, 0.0, -0.0036842887788682108, 0.0,
+  0.029526189619921525, 0.0, -0.053416613043709447, 0.0,
+  0.065212833800151582, 0.0, 0.017275844627904005, 0.0,
+  -0.035005567817990774, 0.0, 0.022098142970800899, 0.0,
+  -0.00042534441532417867, 0.0, -0.0019257005259103702, 0.0,
+  0.1143451046954503, 0.0, 0.15060327433963203, 0.0,
+  0.026889454971682547, 0.0, -0.0016666791235644036, 0.0,
+  -0.128036879932896, 0.0, 0.12817611190348172, 0.0,
+  -0.10235161408132003, 0.0, 0.025699093941041671, 0.0,
+  0.030258393661801823, 0.0, -0.052686333451765557, 0.0,
+  -0.042041172780428113, 0.0, -0.020151219437135638, 0.0,
+  0.11238786864648494, 0.0, 0.12259910288557703, 0.0,
+  0.16965190092777691, 0.0, -0.095839313444983476, 0.0,
+  0.029625221995205241, 0.0, 0.00053001631096505895, 0.0,
+  0.020956564081446596, 0.0, -0.033304634404460381, 0.0,
+  -0.023726156370739517, 0.0, 0.22252772319514477, 0.0,
+  -0.084818123990486785, 0.0, 0.022567557216179372, 0.0,
+  0.017248575506636221, 0.0, -0.22575524466433117, 0.0,
+  -0.16402903340597577, 0.0, -0.074663792882241828, 0.0,
+  0.19341423988826192, 0.0, -0.62051399513064831, 0.0,
+  0.10147534691571071, 0.0, 0.03248836188716555, 0.0,
+  -0.45997737807363293, 0.0, 0.0015210409449152849, 0.0,
+  0.0039709825080345039, 0.0, 0.015971164433252614, 0.0,
+  0.15330774366893934, 0.0, -0.088479808850272998, 0.0,
+  -0.020918893509561328, 0.0, -0.067280760613760843, 0.0,
+  0.037129189842390505, 0.0, 0.040236126475917719, 0.0,
+  0.050566551066228038, 0.0, -0.064920985340492468, 0.0,
+  0.10738669888665028, 0.0, -0.14332438199129313, 0.0,
+  -0.031215068773691027, 0.0, -0.32942572869801862, 0.0,
+  -0.14434888111247254, 0.0, 0.15963974138248999, 0.0,
+  0.077269143749065086, 0.0, -0.02633178835676258, 0.0,
+  -0.0075313576121757578, 0.0, -0.044304900158012056, 0.0,
+  0.057413187757118143, 0.0, -0.39007509134790724, 0.0,
+  -0.047084063636946019, 0.0, 0.010197655295989799, 0.0,
+  -0.014008427184783814, 0.0, -0.015414845082312383, 0.0,
+  -0.0060674886459400222, 0.0, -0.087083373564163249, 0.0,
+  -0.1144699051675503, 0.0, -0.032948546345107341, 0.0,
+  0.017213584865755353, 0.0, -0.12803687993289603, 0.0,
+  0.13338749267074357, 0.0, -0.10273910928922671, 0.0,
+  0.028753507489850581, 0.0, 0.035287492656549194, 0.0,
+  -0.056532459525978601, 0.0, -0.044422036910440062, 0.0,
+  -0.019915242941127304, 0.0, 0.11225385466331268, 0.0,
+  0.12301466785115316, 0.0, 0.16274296125640048, 0.0,
+  -0.081717444280660273, 0.0, 0.043949786140770358, 0.0,
+  0.029713511318049342, 0.0, 0.019809011663503542, 0.0,
+  -0.035905009979654463, 0.0, 0.012444432216109773, 0.0,
+  0.35049884725576141, 0.0, -0.16385642449251053, 0.0,
+  0.033196025924182034, 0.0, -0.0042928368399151118, 0.0,
+  -0.01147464732408989, 0.0, 0.058790601988347214, 0.0,
+  0.026810275133926514, 0.0, -0.067816160523755484, 0.0,
+  0.15695807521642788, 0.0, -0.0088432685467788059, 0.0,
+  0.0093182385672523921, 0.0, 0.062221510064875758, 0.0,
+  -0.0071085003198904885, 0.0, -0.007667168917609676, 0.0,
+  0.010065116246340574, 0.0, -0.079242892963321224, 0.0,
+  0.0743913181455612, 0.0, -0.071537572096805307, 0.0,
+  0.011258798744884384, 0.0, -0.010357766236947563, 0.0,
+  -0.024886102712845384, 0.0, 0.11078166513172079, 0.0,
+  -0.092570236855591848, 0.0, 0.10426438837725359, 0.0,
+  -0.17691817006801869, 0.0, 0.0092101316374165517, 0.0,
+  -0.28764277411996142, 0.0, 0.073699248049103619, 0.0,
+  -0.069829025229736233, 0.0, -0.018052016559129996, 0.0,
+  0.017701889906241094, 0.0, 0.0072160886346530782, 0.0,
+  0.068274423601985657, 0.0, -0.2281692892280037, 0.0,
+  0.29601163058212071, 0.0, 0.050052113393642142, 0.0,
+  0.028292918099138697, 0.0, -0.0053173760836946003, 0.0,
+  -0.030451427132218104, 0.0, -0.038521179690811397, 0.0,
+  0.11602424756232486, 0.0, 0.14649997626916375, 0.0,
+  0.076812621615459209, 0.0, -0.021553078712342383, 0.0,
+  -0.12803687993289622, 0.0, -0.032935391596712937, 0.0,
+  -0.033295516217118917, 0.0, 0.042916661366251073, 0.0,
+  0.041296842648507526, 0.0, -0.026266532002515764, 0.0,
+  0.017953910177328943, 0.0, -0.020194576609158972, 0.0,
+  0.214926693791402, 0.0, -0.1289330476144788, 0.0,
+  -0.002239653108656973, 0.0, 0.17183792091411954, 0.0,
+  0.10749756213681114, 0.0, 0.17496902020435198, 0.0,
+  0.22184965337218573, 0.0, 0.041231493680650259, 0.0,
+  -0.016691998302872938, 0.0, -0.13804055341880839, 0.0,
+  -0.0028157514069308454, 0.0, -0.040698875076902057, 0.0,
+  -0.0065443215115182545, 0.0, -0.14786417201003879, 0.0,
+  -0.036097865884391546, 0.0, 0.01048390489733546, 0.0,
+  -0.14491207850440771, 0.0, -0.26877246200733573, 0.0,
+  -0.037433650596764803, 0.0, -0.10343493397233659, 0.0,
+  0.21126684640569587, 0.0, 0.02216297300129319, 0.0,
+  0.067632474646881338, 0.0, -0.082546017135094629, 0.0,
+  0.16001908072171364, 0.0, 0.075523460137862639, 0.0,
+  0.15931717118989427, 0.0, 0.00090051690439564482, 0.0,
+  0.016691047923725742, 0.0, -0.076272495588714309, 0.0,
+  0.17864300093498262, 0.0, -0.053067492277587634, 0.0,
+  -0.031213705787258711, 0.0, -0.15342782458302323, 0.0,
+  0.078690472759898822, 0.0, 0.18581959664012057, 0.0,
+  -0.0311583057390502, 0.0, -0.006461854341286836, 0.0,
+  -0.37528958154776593, 0.0, 0.034622721229976172, 0.0,
+  0.0044469671967886397, 0.0, -0.2148874164761668, 0.0,
+  -0.053198513841588198, 0.0, 0.065827144921695238, 0.0,
+  0.066441797138926909, 0.0, -0.016438312721378117, 0.0,
+  0.012666793702123855, 0.0, -0.040333657311492126, 0.0,
+  -0.055953458540000764, 0.0, -0.0061339590112542714, 0.0,
+  0.028327099219464701, 0.0, 0.025614694714823048, 0.0,
+  0.013935792379469512, 0.0, -0.12803687993289603, 0.0,
+  -0.035306267295015709, 0.0, -0.029106787847196103, 0.0,
+  0.037318559078783398, 0.0, 0.039976372841149431, 0.0,
+  -0.023955833174540274, 0.0, 0.014057837848830227, 0.0,
+  -0.014101880013632204, 0.0, 0.1873143431986074, 0.0,
+  -0.11448973319382053, 0.0, -0.0016477163451276066, 0.0,
+  0.16369302791553916, 0.0, 0.10984933044299451, 0.0,
+  0.18581315281339861, 0.0, 0.17958993364486897, 0.0,
+  0.018361635550082953, 0.0, 0.014780163732657373, 0.0,
+  -0.1025678651735953, 0.0, -0.053469640932783009, 0.0,
+  -0.024179854849075127, 0.0, 0.003145529758617122, 0.0,
+  0.099346836072120803, 0.0, 0.04090313482028142, 0.0,
+  -0.032708744406051801, 0.0, 0.12034718875806553, 0.0,
+  0.18152954271458624, 0.0, 0.0057338578294183068, 0.0,
+  0.085845101716681999, 0.0, -0.18496406439553384, 0.0,
+  0.020633001297618143, 0.0, -0.017205298807065436, 0.0,
+  0.063413297896198789, 0.0, -0.12605525642603763, 0.0,
+  -0.0033257935875620763, 0.0, 0.11986429604220254, 0.0,
+  -0.028404306572235281, 0.0, 0.062701919565576233, 0.0,
+  0.051687482458060402, 0.0, 0.12782104009274886, 0.0,
+  -0.065297687769957424, 0.0, 0.026932512196510043, 0.0,
+  -0.16599928585928395, 0.0, 0.011291713113816219, 0.0,
+  0.17300549140315669, 0.0, 0.040126539374311487, 0.0,
+  -0.0068936601601967424, 0.0, 0.29498088477698275, 0.0,
+  -0.02579667025858013, 0.0, -0.0062083019517199418, 0.0,
+  0.15522237185541743, 0.0, 0.11106720712123727, 0.0,
+  -0.055084030702700494, 0.0, -0.043722127538667555, 0.0,
+  -0.028424962433050507, 0.0, 0.02079357724574114, 0.0,
+  0.053965273828603728, 0.0, 0.055267047324153697, 0.0,
+  0.016098442502982074, 0.0, -0.0095743401841856465, 0.0,
+  -0.047530790887426899, 0.0, -0.043669304805287468, 0.0,
+  -0.1280368799328962, 0.0, -0.034684641582028164, 0.0,
+  -0.034084542030733349, 0.0, 0.039503181487447324, 0.0,
+  0.041543941445191551, 0.0, -0.026755321580498936, 0.0,
+  0.012136206387984886, 0.0, -0.014645898758818427, 0.0,
+  0.20680570174362509, 0.0, -0.12737664818711703, 0.0,
+  0.0025537813845659791, 0.0, 0.18283845843931729, 0.0,
+  0.10837604414963635, 0.0, 0.16209697680332333, 0.0,
+  0.21565776107208587, 0.0, 0.044651034183938787, 0.0,
+  -0.016063281110053829, 0.0, -0.13735441187198333, 0.0,
+  -0.010952086908450542, 0.0, -0.033014223499469413, 0.0,
+  0.0075567306432179782, 0.0, -0.14746644985254601, 0.0,
+  0.043755352579063697, 0.0, -0.015938043417822803, 0.0,
+  0.17609059379335112, 0.0, 0.3377665112804783, 0.0,
+  -0.036252499207786261, 0.0, -0.093007663321988038, 0.0,
+  -0.26081362462566576, 0.0, -0.00021896864463432313, 0.0,
+  0.040637045905136872, 0.0, -0.0444693626355726, 0.0,
+  0.13195010678852412, 0.0, -0.1039289173002866, 0.0,
+  -0.20040305350313817, 0.0, -0.014062921338732918, 0.0,
+  -0.027840571290615478, 0.0, 0.081424804081023622, 0.0,
+  -0.22856610804984806, 0.0, 0.073988375991605515, 0.0,
+  0.038808225358781936, 0.0, 0.2102155536761191, 0.0,
+  -0.10165271632559514, 0.0, -0.2025880866117574, 0.0,
+  -0.015814377868807353, 0.0, 0.0055371081571798739, 0.0,
+  -0.3034393755403012, 0.0, -0.012150850693872214, 0.0,
+  -0.003744746997081922, 0.0, -0.15768938800570234, 0.0,
+  -0.1391205740650823, 0.0, 0.0023160459931664931, 0.0,
+  0.0096548816652293219, 0.0, 0.022703033825780157, 0.0,
+  -0.025001168479203799, 0.0, -0.05819749939718985, 0.0,
+  -0.063413890860174557, 0.0, -0.003542056472727918, 0.0,
+  0.020797395937479691, 0.0, 0.061405712018878587, 0.0,
+  0.056938721739143647, 0.0, -0.12803687993289606, 0.0,
+  -0.033417405971610734, 0.0, -0.028079463577485222, 0.0,
+  0.033566409367768467, 0.0, 0.041728362762056041, 0.0,
+  -0.025751857433486295, 0.0, 0.005589082948603958, 0.0,
+  -0.0094176949141619327, 0.0, 0.17519281869657535, 0.0,
+  -0.11234386470731396, 0.0, -2.0935660065301904e-05, 0.0,
+  0.17766660057824601, 0.0, 0.11098089284629768, 0.0,
+  0.17574372329710092, 0.0, 0.17645516298572014, 0.0,
+  0.03023267045346352, 0.0, 0.021785772796151827, 0.0,
+  -0.093048767090778278, 0.0, -0.061514272928941044, 0.0,
+  -0.015289624920388859, 0.0, -0.0062178077723568214, 0.0,
+  0.086958442776108119, 0.0, -0.0650128640184158, 0.0,
+  0.058058215543039061, 0.0, -0.19165824886441912, 0.0,
+  -0.28875479925303005, 0.0, 0.0018208727219812648, 0.0,
+  0.077162761200063656, 0.0, 0.29530715449248807, 0.0,
+  -0.0071824511192983042, 0.0, -0.0296425515045191, 0.0,
+  0.049972925159766188, 0.0, -0.13051485178898684, 0.0,
+  0.02145871004005457, 0.0, -0.17103086517908755, 0.0,
+  0.051404925288023616, 0.0, -0.081700875693829167, 0.0,
+  -0.06635664473425959, 0.0, -0.17034366955603861, 0.0,
+  0.080211528307777433, 0.0, -0.048458350198367126, 0.0,
+  0.20472331076879641, 0.0, -0.0079521642192901271, 0.0,
+  -0.28598781733960282, 0.0, 0.015285637128718827, 0.0,
+  0.0038017425834643128, 0.0, 0.3167499346716911, 0.0,
+  0.0099908470248484225, 0.0, 0.005028231853948989, 0.0,
+  0.19106843894583439, 0.0, 0.03169012386906396, 0.0,
+  0.008248483123714347, 0.0, -0.029198977940522577, 0.0,
+  0.039695588999212918, 0.0, -0.011982072394045659, 0.0,
+  0.03433574690452125, 0.0, 0.050200476141764094, 0.0,
+  -0.015433531074390709, 0.0, -0.047773365245969826, 0.0,
+  -0.018450995858688569, 0.0, -0.02568309475367507, 0.0,
+  -0.12803687993289609, 0.0, -0.15625748601472128, 0.0,
+  0.023162551780424777, 0.0, -0.084708603530308721, 0.0,
+  -0.083017008622927393, 0.0, -0.024937924791861535, 0.0,
+  -0.02989359387147001, 0.0, -0.30997153758060358, 0.0,
+  -0.13271113550701136, 0.0, 0.048736499127612791, 0.0,
+  0.031239033178305155, 0.0, -0.075886930040754808, 0.0,
+  -0.089678075841984339, 0.0, 0.25886701142147739, 0.0,
+  -0.066226333750054697, 0.0, 0.17130397241545003, 0.0,
+  -0.12857484057141502, 0.0, -0.0074450204769938855, 0.0,
+  -0.0050774990381017605, 0.0, 0.097523861913650853, 0.0,
+  -0.00017826608370228114, 0.0, -0.070583226509235028, 0.0,
+  0.00072681337948438715, 0.0, 0.0012603904760617117, 0.0,
+  -0.0068455827582187753, 0.0, 6.1689528338176267e-05, 0.0,
+  -0.039228562306749537, 0.0, -0.070227844160849942, 0.0,
+  -0.0014104415402445031, 0.0, -0.0099995803994863183, 0.0,
+  0.020526927068729599, 0.0, -0.055672885170187023, 0.0,
+  0.070711944723903575, 0.0, -0.00051047519980955739, 0.0,
+  0.0018265175145640055, 0.0, 0.0013631670731140708, 0.0,
+  0.00305496491345496, 0.0, 0.011627129174966588, 0.0,
+  -0.0027145939767231147, 0.0, 0.001802544685371838, 0.0,
+  0.0066956067925643533, 0.0, -0.003634351860279363, 0.0,
+  -0.013159240128865737, 0.0, 0.0047021061526285549, 0.0,
+  0.14326484309669368, 0.0, -0.026590065506377707, 0.0,
+  0.19010845232414433, 0.0, 0.29163712412739329, 0.0,
+  -0.060153084888974792, 0.0, -0.16748945851550284, 0.0,
+  -0.029348903390308642, 0.0, -0.010250879624318598, 0.0,
+  -0.13946996668391498, 0.0, -0.04121445654694425, 0.0,
+  -0.11732665821851106, 0.0, 0.023766222338270547, 0.0,
+  -0.0070428247638303935, 0.0, -0.085575688497434174, 0.0,
+  0.046594905294240194, 0.0, 0.082037794491868862, 0.0,
+  -0.069782156911447304, 0.0, -0.12803687993289578, 0.0,
+  -0.15305797290390674, 0.0, 0.022256452380011126, 0.0,
+  -0.074932725321562144, 0.0, -0.07179284274898616, 0.0,
+  -0.022169346753791851, 0.0, -0.027603814672081572, 0.0,
+  -0.28727719153552245, 0.0, -0.11967198439026387, 0.0,
+  0.041670077356593345, 0.0, 0.029539981326797689, 0.0,
+  -0.058506344104622035, 0.0, -0.069086592759174503, 0.0,
+  0.26740681911762543, 0.0, -0.080768837133765467, 0.0,
+  0.15239860183364878, 0.0, -0.10110437767897647, 0.0,
+  -0.0073070773693776547, 0.0, -0.021282958185918376, 0.0,
+  0.10267219597613073, 0.0, -1.5244989014336895e-05, 0.0,
+  0.05319612808404553, 0.0, -0.00060827424678084219, 0.0,
+  -0.0044796777345111113, 0.0, 0.0070708254022970041, 0.0,
+  0.001511428236996262, 0.0, 0.029306257436949656, 0.0,
+  0.072925617436334272, 0.0, 0.0017474710172440482, 0.0,
+  -0.00071914698144594192, 0.0, -0.031973806242839832, 0.0,
+  0.077381383545523902, 0.0, -0.093509235181514272, 0.0,
+  -0.0012473759075694426, 0.0, 0.0057923446289928219, 0.0,
+  -0.0041716968220652656, 0.0, -0.0017176290426614044, 0.0,
+  -0.013993040538545094, 0.0, 0.0034675323056991567, 0.0,
+  -0.0022760492702588726, 0.0, -0.010730012303220331, 0.0,
+  0.0086318304113710068, 0.0, 0.013110536921355579, 0.0,
+  -0.010791691757065906, 0.0, -0.17832529080514409, 0.0,
+  0.034179189226311184, 0.0, -0.23634784340991627, 0.0,
+  -0.36006982076759947, 0.0, 0.069261198026743617, 0.0,
+  0.19787134345002333, 0.0, 0.02534905695504695, 0.0,
+  0.012907322700673286, 0.0, 0.1459102715885047, 0.0,
+  0.054467656741775811, 0.0, 0.13597354185220784, 0.0,
+  -0.031557342153962747, 0.0, 0.012927699276548875, 0.0,
+  0.10365385495754764, 0.0, -0.056570077246155162, 0.0,
+  -0.091304530717172344, 0.0, 0.074463517219411746, 0.0,
+  -0.12803687993289589, 0.0, -0.12430064181616847, 0.0,
+  0.010222176009408272, 0.0, -0.10257278405116678, 0.0,
+  -0.062659398670290453, 0.0, -0.033179234502213835, 0.0,
+  -0.033077509822548333, 0.0, -0.13038024575182033, 0.0,
+  -0.087824615618824861, 0.0, -0.0067987904047643608, 0.0,
+  0.14866047169006349, 0.0, 0.19804817895186835, 0.0,
+  0.1176222930448554, 0.0, -0.19345348330301645, 0.0,
+  -0.050498632646818885, 0.0, -0.15663036873661523, 0.0,
+  0.081989726914204641, 0.0, 0.011603034603894551, 0.0,
+  0.037760268332815802, 0.0, -0.22210919350715341, 0.0,
+  0.00063787905465974239, 0.0, -0.037160536915029463, 0.0,
+  -0.0010787985798745648, 0.0, -0.0025311074351598052, 0.0,
+  0.011018656950151445, 0.0, -0.0013001088920820002, 0.0,
+  -0.021602096601278303, 0.0, -0.03578997883990722, 0.0,
+  0.0080516255425231477, 0.0, 0.011881423340823195, 0.0,
+  -0.00086783993923300444, 0.0, -0.036368051634706619, 0.0,
+  0.061952824804829561, 0.0, -0.00075661302517856057, 0.0,
+  -0.0016633959083833497, 0.0, 0.0015448382917668604, 0.0,
+  0.0058163043439278077, 0.0, -0.0079939636172493642, 0.0,
+  0.0073773739951282415, 0.0, -0.0019955053776162216, 0.0,
+  -0.010016817784191155, 0.0, 0.0062852703814740805, 0.0,
+  0.020045588469565317, 0.0, -0.0087968159726817853, 0.0,
+  0.08637425910856468, 0.0, -0.01139439442717345, 0.0,
+  0.060284376507087796, 0.0, -0.073843545509547429, 0.0,
+  -0.059725133628205876, 0.0, -0.079729566886885733, 0.0,
+  -0.031514040755587711, 0.0, 0.03073050818822028, 0.0,
+  -0.17773680940028391, 0.0, 0.10192016004972057, 0.0,
+  0.31845253500456466, 0.0, -0.087035561947202703, 0.0,
+  0.095680801812577362, 0.0, 0.098283629299586672, 0.0,
+  -0.048370355856930072, 0.0, -0.075089432100001602, 0.0,
+  -0.010255507354355622, 0.0, -0.12803687993289609, 0.0,
+  -0.12251033643646682, 0.0, 0.011043336227328837, 0.0,
+  -0.098396999632498247, 0.0, -0.05761939485693722, 0.0,
+  -0.034068727566198991, 0.0, -0.033172445818228272, 0.0,
+  -0.12538000460877183, 0.0, -0.085105671807068281, 0.0,
+  -0.0087041741031441099, 0.0, 0.1456796996973346, 0.0,
+  0.20527055805271571, 0.0, 0.12894912451607699, 0.0,
+  -0.15637000732712292, 0.0, -0.069140550370076909, 0.0,
+  -0.15608756653868677, 0.0, 0.1096249887756839, 0.0,
+  0.016233365646948082, 0.0, 0.017901227342781167, 0.0,
+  -0.20610943661244074, 0.0, -0.00012759307455557817, 0.0,
+  0.060083909057138112, 0.0, -0.0010113069296489093, 0.0,
+  0.0076811434451008707, 0.0, -0.012555967889298083, 0.0,
+  0.001443705811206951, 0.0, 0.024996631264551355, 0.0,
+  0.039443282200927403, 0.0, -0.011062315544991888, 0.0,
+  -0.0080762927954227803, 0.0, -0.010534114276284354, 0.0,
+  0.037558746605391033, 0.0, -0.068084270406079311, 0.0,
+  0.0010291159147494814, 0.0, -0.0058958188980727574, 0.0,
+  -0.00042371986822053017, 0.0, -0.011873404745564611, 0.0,
+  0.0075446170545157669, 0.0, -0.0074184536221740156, 0.0,
+  0.0023741207741389608, 0.0, 0.015668845832819207, 0.0,
+  -0.013750624665833506, 0.0, -0.019286041946604202, 0.0,
+  0.019618046383822425, 0.0, -0.10234103965521653, 0.0,
+  0.011110302963073469, 0.0, -0.082085200619480728, 0.0,
+  0.093886779644674734, 0.0, 0.069079060773343068, 0.0,
+  0.080781835070778518, 0.0, 0.044929284790418925, 0.0,
+  -0.033687350690896588, 0.0, 0.20712230046765973, 0.0,
+  -0.12213692674690373, 0.0, -0.35646151539458748, 0.0,
+  0.10624473054687099, 0.0, -0.11437702205491201, 0.0,
+  -0.10938570291592642, 0.0, 0.055547148867165247, 0.0,
+  0.08813817026216271, 0.0, -0.005853537930997273, 0.0,
+  -0.12803687993289603, 0.0, -0.18687758100010168, 0.0,
+  0.0324441413723527, 0.0, 0.4359442290716225, 0.0,
+  0.0062187285245808507, 0.0, 0.079135106129300067, 0.0,
+  -0.028577282118503768, 0.0, 0.049847123244281748, 0.0,
+  -0.080197424455821953, 0.0, 0.050025448592290078, 0.0,
+  0.026385302260817176, 0.0, -0.014931094924555523, 0.0,
+  -0.0049366512821038431, 0.0, -0.039831170551488486, 0.0,
+  -0.031811276829046164, 0.0, 0.0077570938457137166, 0.0,
+  -0.012940665304250283, 0.0, -0.00094712019751258991, 0.0,
+  -0.0018099372870199974, 0.0, -0.0019062550725092741, 0.0,
+  -0.00042788470777705361, 0.0, -0.063310158949753503, 0.0,
+  -0.0012713549581946054, 0.0, -0.0047129186424244357, 0.0,
+  -0.003584507362177448, 0.0, 0.011492562144720275, 0.0,
+  -0.032430061318267075, 0.0, -0.10532559036579354, 0.0,
+  -0.01415512465671934, 0.0, -0.062066652962498359, 0.0,
+  0.1101063425929814, 0.0, 0.034170193723190995, 0.0,
+  -0.042088860154008395, 0.0, 0.0041212673450103272, 0.0,
+  -0.011252085276050941, 0.0, 0.026391572709631998, 0.0,
+  0.1096787590856515, 0.0, -0.02372704911936753, 0.0,
+  -0.023569643607133005, 0.0, -0.0049219156139859244, 0.0,
+  -0.00905833679445869, 0.0, 0.026218488730662255, 0.0,
+  -0.016241032338132174, 0.0, -0.033912204725711846, 0.0,
+  -0.0020294034281044581, 0.0, -0.0049072447783395255, 0.0,
+  -0.0065737210378336167, 0.0, 0.0484027383913491, 0.0,
+  0.0098365519451604228, 0.0, -0.011906770801919013, 0.0,
+  0.051824685467401335, 0.0, -0.017282393120544068, 0.0,
+  0.20412501510157685, 0.0, 0.040143861070481533, 0.0,
+  -0.092596308014129949, 0.0, -0.16249489163461767, 0.0,
+  -0.041323802569306518, 0.0, 0.050878701193097398, 0.0,
+  0.093250638980045875, 0.0, -0.39840473627195849, 0.0,
+  -0.53871629712471802, 0.0, -0.12803687993289614, 0.0,
+  -0.1760612133412425, 0.0, 0.029941274070865012, 0.0,
+  0.39233054536559397, 0.0, 0.0094791716651964446, 0.0,
+  0.070790683644077659, 0.0, -0.025808745865861491, 0.0,
+  0.043899431664230396, 0.0, -0.065415554163522696, 0.0,
+  0.039313145543582707, 0.0, 0.019684271647575829, 0.0,
+  -0.0048943975178095409, 0.0, 0.0064086265170483483, 0.0,
+  -0.0019235366525577877, 0.0, -0.035258080276694664, 0.0,
+  0.0025170093983872743, 0.0, 0.0057398763879144311, 0.0,
+  -0.001155915805269725, 0.0, -0.024922331602986719, 0.0,
+  0.012437334113379757, 0.0, 0.00016433902003991751, 0.0,
+  0.13228096373422193, 0.0, -0.0016572399661771882, 0.0,
+  0.0047564356731794417, 0.0, 0.0051272740741250466, 0.0,
+  -0.0048328107543360258, 0.0, 0.097480518629086105, 0.0,
+  0.23957358709004237, 0.0, 0.011067293952243207, 0.0,
+  0.19522925665524185, 0.0, -0.35443137509726408, 0.0,
+  -0.1964880189252855, 0.0, 0.22520141548904368, 0.0,
+  0.0074095355344035614, 0.0, 0.022763095077032492, 0.0,
+  -0.047107550753216029, 0.0, -0.17207919842303779, 0.0,
+  0.073625094831745161, 0.0, 0.0093961097462833265, 0.0,
+  0.016436553472753669, 0.0, 0.022985941517164064, 0.0,
+  -0.013646027278695487, 0.0, -0.012707944747135004, 0.0,
+  0.0068757112994096391, 0.0, 0.063027286467476906, 0.0,
+  -0.018197554904510926, 0.0, -0.049380928366113505, 0.0,
+  0.023187374404886392, 0.0, -0.0067274226588271407, 0.0,
+  -0.023476731643140451, 0.0, -0.025677332661757094, 0.0,
+  0.00023639446213305796, 0.0, -0.0083080684060462921, 0.0,
+  -0.0017827461754304833, 0.0, 0.014577722826144297, 0.0,
+  0.028252165854002965, 0.0, 0.011852553800506859, 0.0,
+  -0.0057585880106133715, 0.0, -0.0067804219268174622, 0.0,
+  0.054775991050998063, 0.0, 0.084208034986909222, 0.0,
+  -0.12803687993289614, 0.0, -0.1840120601771279, 0.0,
+  0.031606679560184613, 0.0, 0.41744425366715449, 0.0,
+  0.0044958580097593402, 0.0, 0.075132720209982393, 0.0,
+  -0.030967159942790083, 0.0, 0.055972664956892487, 0.0,
+  -0.083035161523252507, 0.0, 0.046958638757552386, 0.0,
+  0.035945921340647995, 0.0, -0.0047907982410027314, 0.0,
+  -0.0056202721316730214, 0.0, -0.059425972365861002, 0.0,
+  -0.02671745787854013, 0.0, 0.010219679884246055, 0.0,
+  -0.019609727761044755, 0.0, -0.00039009707454869562, 0.0,
+  0.0042100174934120264, 0.0, -0.0065998612021086226, 0.0,
+  0.00074685908539050109, 0.0, -0.13074032432226512, 0.0,
+  0.0038001739154053886, 0.0, 0.013513490183524782, 0.0,
+  0.015091211490851209, 0.0, -0.021126251574083734, 0.0,
+  -0.092912416921679022, 0.0, -0.23797578574447512, 0.0,
+  0.038813802969131499, 0.0, -0.20770566089549986, 0.0,
+  0.30170789790145014, 0.0, 0.20576077150445465, 0.0,
+  -0.23039505922597633, 0.0, 0.010064730188668542, 0.0,
+  0.028247414686820078, 0.0, -0.076938004132147117, 0.0,
+  -0.32396656512065092, 0.0, 0.16966205685121089, 0.0,
+  0.037130906378308341, 0.0, 0.023946397699355186, 0.0,
+  0.048336658763329758, 0.0, -0.045315940714145658, 0.0,
+  -0.017361532185925271, 0.0, 0.045037509806450528, 0.0,
+  -0.064290703692799961, 0.0, 0.023018350975507217, 0.0,
+  0.059766510231492612, 0.0, -0.08179379681110982, 0.0,
+  -0.0062345891951579614, 0.0, 0.028187280495343536, 0.0,
+  -0.0054858777986031195, 0.0, 0.0021759880033959695, 0.0,
+  -0.13969328430645778, 0.0, -0.032369031791709961, 0.0,
+  0.055600119554193049, 0.0, 0.079961245150610566, 0.0,
+  0.028117750989240332, 0.0, -0.025206740933625231, 0.0,
+  -0.046654740938315419, 0.0, 0.19388023251351669, 0.0,
+  0.25590660528651099, 0.0, -0.12803687993289603, 0.0,
+  -0.17617877538151824, 0.0, 0.03145429533496296, 0.0,
+  0.39529954282072371, 0.0, 0.0077378170629960304, 0.0,
+  0.068520387132027183, 0.0, -0.03025259576924336, 0.0,
+  0.052191444685287539, 0.0, -0.075517731975668523, 0.0,
+  0.040679503254406502, 0.0, 0.032455879024623241, 0.0,
+  0.0055024149447841751, 0.0, 0.0034730860025669989, 0.0,
+  -0.035672694100047052, 0.0, -0.034585563650164269, 0.0,
+  0.012903490194718994, 0.0, -0.0033933297609254668, 0.0,
+  0.0055731207950438207, 0.0, -0.0096452468519594228, 0.0,
+  0.0016090533921027327, 0.0, -0.00085711419624417929, 0.0,
+  0.0013825602106649116, 0.0, -0.0017380559314992218, 0.0,
+  -0.022981932127976102, 0.0, -0.029262294099762082, 0.0,
+  0.027201386364916241, 0.0, -0.0060159955913823187, 0.0,
+  -0.010416143557856384, 0.0, -0.063550998100711534, 0.0,
+  -0.03721177866787919, 0.0, 0.0092304003479306215, 0.0,
+  0.036350870699237273, 0.0, -0.04948821433183493, 0.0,
+  -0.048488682921746462, 0.0, -0.081411223150043219, 0.0,
+  0.19077569916979423, 0.0, 0.73944051836138525, 0.0,
+  -0.41742457666779481, 0.0, -0.037663784256978951, 0.0,
+  -0.070721434222818125, 0.0, -0.11976145222414808, 0.0,
+  0.056251739152811349, 0.0, 0.092373421725569213, 0.0,
+  -0.024323262899216661, 0.0, -0.028107516625133146, 0.0,
+  0.0091776787441889031, 0.0, 0.019069683072800183, 0.0,
+  0.0022963863390382563, 0.0, 0.0058574492049890403, 0.0,
+  0.010360766926129214, 0.0, -0.024930399646898069, 0.0,
+  0.030176867831056484, 0.0, -0.11793884196685697, 0.0,
+  -0.017440749405508438, 0.0, 0.038703583494482233, 0.0,
+  0.096939817924827101, 0.0, -0.0013827978212237828, 0.0,
+  -0.039577197687221864, 0.0, -0.073160851828633522, 0.0,
+  0.27205029064461306, 0.0, 0.32787404562485667, 0.0,
+  -0.16724818481531062, -0.0, -0.1667405201093706, -0.0,
+  -0.12648661404146658, -0.0, -0.12275332589624752, -0.0,
+  -0.092145049241198748, -0.0, -0.084045844624897378, -0.0,
+  -0.080960805258031801, -0.0, -0.068112983084632261, -0.0,
+  -0.13462486978899407, -0.0, -0.13040734761657111, -0.0,
+  -0.050305667245513219, -0.0, -0.057912827608365261, -0.0,
+  -0.099533523269185645, -0.0, -0.11845770146137188, -0.0,
+  -0.13119618046733825, -0.0, -0.057475454938632299, -0.0,
+  -0.2225680173102603, -0.0, -0.081421608606500578, -0.0,
+  -0.081288834760331857, -0.0, -0.087201176027967203, -0.0,
+  -0.095276949965534208, -0.0, -0.083342924262826815, -0.0,
+  -0.086224897747315926, -0.0, -0.13408596417807286, -0.0,
+  -0.16190599006357484, -0.0, -0.066316631048230504, -0.0,
+  -0.11406054408530887, -0.0, -0.037559378013301073, -0.0,
+  -0.063715825708569859, -0.0, -0.1933733916055991, -0.0,
+  -0.18558659603910571, -0.0, -0.10008023910635055, -0.0,
+  -0.16542059187392802, -0.0, -0.098846223359604149, -0.0,
+  -0.1396624657171662, -0.0, -0.10247016833738992, -0.0,
+  -0.083428836751524085, -0.0, -0.17398059983869671, -0.0,
+  -0.15871160752927627, -0.0, -0.24281993396413673, -0.0,
+  -0.2085252305213407, -0.0, -0.08052343258829972, -0.0,
+  -0.10700790978586765, -0.0, -0.076118464985991979, -0.0,
+  -0.053015815752607297, -0.0, -0.14855050318423504, -0.0,
+  -0.143856557210853, -0.0, -0.085295480824134073, -0.0,
+  -0.17671417902452716, -0.0, -0.1476679476185247, -0.0,
+  -0.20944683721827739, -0.0, -0.12899369666618485, -0.0,
+  -0.1428334175727288, -0.0, -0.22329436835106475, -0.0,
+  -0.19748157061058716, -0.0, -0.26966368156898479, -0.0,
+  -0.23903978446144575, -0.0, -0.1318600496981843, -0.0,
+  -0.18478214273584792, -0.0, -0.12797836725430428, -0.0,
+  -0.079843942904964937, -0.0, 0.26244885018617026, -0.0,
+  0.26589723097678319, -0.0, 0.16671573094107062, -0.0,
+  0.16757534080178618, -0.0, -0.041535634042292068, -0.0,
+  -0.039046031376459206, -0.0, -0.036605242435256723, -0.0,
+  -0.03186874832490777, -0.0, 0.14651114789570119, -0.0,
+  0.14872642758996973, -0.0, 0.02086335903395584, -0.0,
+  0.024368708103521392, -0.0, 0.18340613747893891, -0.0,
+  0.1586498733806998, -0.0, 0.17120624095155207, -0.0,
+  0.075139361769941543, -0.0, 0.29307458938430875, -0.0,
+  -0.055136392660300564, -0.0, -0.054917577440867532, -0.0,
+  -0.061711462189141308, -0.0, -0.065252427189700715, -0.0,
+  -0.024754923266877196, -0.0, -0.024204899170106708, -0.0,
+  -0.079357666140022681, -0.0, -0.090671831264253128, -0.0,
+  -0.042000133057102783, -0.0, -0.065766612345588005, -0.0,
+  -0.024243699577261399, -0.0, -0.035578597140405996, -0.0,
+  0.24991807977906386, -0.0, 0.23949367021396023, -0.0,
+  0.11829699439001939, -0.0, 0.15764822619721458, -0.0,
+  -0.019671080195674883, -0.0, -0.029234753297666932, -0.0,
+  -0.021632159671482631, -0.0, -0.0160322999913061, -0.0,
+  -0.13689509711691841, -0.0, -0.12951912410452232, -0.0,
+  -0.16303187972256347, -0.0, -0.14337798505860949, -0.0,
+  -0.049581304818231121, -0.0, -0.066595857676274559, -0.0,
+  -0.049835563298475695, -0.0, -0.033711481288437636, -0.0,
+  0.14183980483419112, -0.0, 0.13461390727852562, -0.0,
+  0.077917935050885498, -0.0, 0.1679928607328518, -0.0,
+  -0.034661981775070801, -0.0, -0.052702343912950832, -0.0,
+  -0.031886732546858164, -0.0, -0.034017851553792382, -0.0,
+  -0.24866972954376634, -0.0, -0.21542041047579508, -0.0,
+  -0.23889119875962653, -0.0, -0.20871191375969592, -0.0,
+  -0.1756203175822246, -0.0, -0.23186116231581103, -0.0,
+  -0.16783679283251643, -0.0, -0.1002535780522868, -0.0,
+  0.1322205558950629, -0.0, 0.14811510426731575, -0.0,
+  -0.09514763163483414, -0.0, -0.09283883799936718, -0.0,
+  -0.006085565958954286, -0.0, -0.0053108514289088053, -0.0,
+  -0.0068805118314173254, -0.0, -0.0040367391640998085, -0.0,
+  0.23681673749444218, -0.0, 0.24446087943902137, -0.0,
+  -0.015608236014621885, -0.0, -0.018935487583417419, -0.0,
+  0.78599517775274974, -0.0, -0.095830698395865763, -0.0,
+  -0.1016701366598725, -0.0, -0.046788694785373182, -0.0,
+  -0.17199338568346023, -0.0, -0.021917113410106766, -0.0,
+  -0.020639998243770746, -0.0, -0.024163576595149585, -0.0,
+  -0.023778383575148394, -0.0, 0.050817718984552326, -0.0,
+  0.053486177249432651, -0.0, 0.011905332544050996, -0.0,
+  0.016122555931302292, -0.0, 0.015974435334741972, -0.0,
+  0.023810003024128459, -0.0, 0.0085060773886279986, -0.0,
+  0.014601148986026781, -0.0, -0.20876299938605555, -0.0,
+  -0.19911124553506745, -0.0, -0.098443719175644137, -0.0,
+  -0.10400922758690662, -0.0, -0.026354049353372103, -0.0,
+  -0.036519091703169256, -0.0, -0.028725548920592432, -0.0,
+  -0.021604709037543683, -0.0, 0.033125931912924705, -0.0,
+  0.032098738459678859, -0.0, 0.022488982912792256, -0.0,
+  0.022172116705669855, -0.0, 0.0022485483246883794, -0.0,
+  0.0030354131112871239, -0.0, 0.015394525616772178, -0.0,
+  0.011827934970210004, -0.0, -0.14110547820086464, -0.0,
+  -0.13176363222050805, -0.0, -0.079982920971091401, -0.0,
+  -0.16633503600817245, -0.0, -0.045045201538869629, -0.0,
+  -0.055852758845805602, -0.0, -0.040281208797289754, -0.0,
+  -0.036744739893716995, -0.0, 0.047384981574742836, -0.0,
+  0.040267906878463558, -0.0, 0.025254708312173992, -0.0,
+  0.024185052051126241, -0.0, 0.039194584342707228, -0.0,
+  0.050688194078155058, -0.0, 0.037058853685735305, -0.0,
+  0.02300903891045214, -0.0, 0.020922770547587809, -0.0,
+  0.022638782339694127, -0.0, 0.020618387521963238, -0.0,
+  0.022603999944626526, -0.0, -0.0065972799387575753, -0.0,
+  -0.0026295602349085691, -0.0, -0.0075431907782686327, -0.0,
+  -0.0022867850749035881, -0.0, -0.041200190823064753, -0.0,
+  -0.038500905055226596, -0.0, 0.053219415283707217, -0.0,
+  0.064517330899884096, -0.0, 0.033375886566673736, -0.0,
+  0.021052777941513386, -0.0, 0.02551265467776961, -0.0,
+  0.0086736706820565532, -0.0, 0.040898666646927678, -0.0,
+  -0.10106909798601364, -0.0, -0.093661371050294442, -0.0,
+  -0.11128472209406585, -0.0, -0.11001253960821984, -0.0,
+  -0.061233147760401049, -0.0, -0.059913705277452975, -0.0,
+  -0.10392283103547531, -0.0, -0.11714423481357145, -0.0,
+  -0.068288425868466437, -0.0, -0.097898614651188223, -0.0,
+  -0.038518191344690998, -0.0, -0.052009488846552383, -0.0,
+  0.046562244808898479, -0.0, 0.04759700740961062, -0.0,
+  0.018388541117210971, -0.0, 0.012900298146127082, -0.0,
+  -0.020458129784439047, -0.0, -0.024046305624684183, -0.0,
+  -0.024776349880064632, -0.0, -0.01783479775046581, -0.0,
+  -0.06037207138542134, -0.0, -0.051909560804024583, -0.0,
+  -0.21173558853677915, -0.0, -0.18577311016820205, -0.0,
+  0.002238786125833463, -0.0, 0.0054965669533728161, -0.0,
+  -0.073929536963356232, -0.0, -0.048978130405165778, -0.0,
+  0.034247610788461821, -0.0, 0.034970521619650953, -0.0,
+  0.017617399081985289, -0.0, 0.040837597628835584, -0.0,
+  0.050934274784076916, -0.0, 0.062819811957480917, -0.0,
+  0.040954207051023872, -0.0, 0.038532986759806875, -0.0,
+  -0.15202088306274272, -0.0, -0.11893127085858665, -0.0,
+  -0.22230670493827531, -0.0, -0.18903838711405566, -0.0,
+  0.46200016088901652, -0.0, 0.58265312434967043, -0.0,
+  0.42937129906348953, -0.0, 0.25366832793082927, -0.0,
+  -0.18566491876618874, -0.0, -0.1838567788300873, -0.0,
+  0.0027062869851593296, -0.0, 0.009607843862342853, -0.0,
+  0.026262514730608397, -0.0, 0.026194120797608522, -0.0,
+  0.025036251157922074, -0.0, 0.021407131742460752, -0.0,
+  -0.24872011554191839, -0.0, -0.24569453772637198, -0.0,
+  0.012918497242019539, -0.0, 0.016787600936524687, -0.0,
+  0.30397732859040555, -0.0, 0.008862394662890247, -0.0,
+  0.01369993820165271, -0.0, 0.0054599853854544857, -0.0,
+  0.032591322080658305, -0.0, 0.36009202798786816, -0.0,
+  0.34350165316339881, -0.0, 0.38960291627123905, -0.0,
+  0.40365650199508574, -0.0, -0.088402443714789503, -0.0,
+  -0.087148115108098612, -0.0, -0.069926127941427135, -0.0,
+  -0.075604361442085724, -0.0, -0.051316026917715737, -0.0,
+  -0.068087330482876421, -0.0, -0.027315515096951445, -0.0,
+  -0.031715728757020896, -0.0, 0.044163639844915309, -0.0,
+  0.049024667582267235, -0.0, 0.018730706498417314, -0.0,
+  0.0012583449985493409, -0.0, 0.0083712632954972572, -0.0,
+  0.017048505621831717, -0.0, 0.0098320675276486694, -0.0,
+  0.011281112748670136, -0.0, -0.12006699301821422, -0.0,
+  -0.11105491719035589, -0.0, -0.15580302944326974, -0.0,
+  -0.13230731045781155, -0.0, -0.010457211037559392, -0.0,
+  -0.0082035595977317417, -0.0, -0.059650538561205939, -0.0,
+  -0.038777540766081378, -0.0, 0.046088045768343286, -0.0,
+  0.048378568543668593, -0.0, 0.026493398311548167, -0.0,
+  0.06401149592080578, -0.0, 0.06259921197281651, -0.0,
+  0.085949424272688646, -0.0, 0.05501004049970102, -0.0,
+  0.061182462305950508, -0.0, -0.19028766135070158, -0.0,
+  -0.14553702774671268, -0.0, -0.17345006244554553, -0.0,
+  -0.14138543089599184, -0.0, 0.0084174512883988476, -0.0,
+  0.017980268201729072, -0.0, 0.0059062922186500491, -0.0,
+  0.0063419996213117166, -0.0, 0.36229239978234329, 0.0,
+  0.36820633056501501, 0.0, -0.0079325143020920839, 0.0,
+  -0.014565715224040043, 0.0, -0.010813050099525144, 0.0,
+  -0.012073658309370362, 0.0, -0.01051075540652938, 0.0,
+  -0.01195755278021091, 0.0, 0.3945585740060748, 0.0,
+  0.39784190187985147, 0.0, -0.25337689821060233, 0.0,
+  -0.30715645601914526, 0.0, -0.36033056762276372, 0.0,
+  -0.0069692664164576028, 0.0, -0.01099637169336703, 0.0,
+  -0.0053837068678438006, 0.0, -0.034146878635132764, 0.0,
+  0.18993144068290166, 0.0, 0.17931170772032934, 0.0,
+  0.20288665795897184, 0.0, 0.20611847881185674, 0.0,
+  0.055930169101305091, 0.0, 0.056781542066294044, 0.0,
+  -0.032441959442751876, 0.0, -0.042383367841283964, 0.0,
+  -0.033869028957711218, 0.0, -0.050058930188910764, 0.0,
+  -0.019558678504425536, 0.0, -0.029558698673514437, 0.0,
+  -0.095367885321670343, 0.0, -0.095349649017942198, 0.0,
+  -0.044059889207877498, 0.0, -0.042781696829676426, 0.0,
+  -0.036230935078036305, 0.0, -0.052844034085418864, 0.0,
+  -0.040173648991880452, 0.0, -0.03387914363442434, 0.0,
+  -0.019985750152313499, 0.0, -0.019839804890112674, 0.0,
+  -0.094962223792155021, 0.0, -0.091293488704337955, 0.0,
+  -0.018410403837306622, 0.0, -0.024339758565885564, 0.0,
+  -0.040194737719075724, 0.0, -0.028394127746131068, 0.0,
+  -0.087495371292747842, 0.0, -0.083363727379981045, 0.0,
+  -0.050004705316808201, 0.0, -0.1111619488962117, 0.0,
+  -0.043159444808286915, 0.0, -0.055830557046465938, 0.0,
+  -0.038403034145002034, 0.0, -0.040928446567818626, 0.0,
+  -0.061961932627376308, 0.0, -0.048715407893455742, 0.0,
+  -0.09955789274396197, 0.0, -0.090617687748713246, 0.0,
+  0.11610991271474266, 0.0, 0.14555360948501783, 0.0,
+  0.1069923071036071, 0.0, 0.060876357358449887, 0.0,
+  0.20243218889344405, 0.0, 0.20815773280524816, 0.0,
+  -0.096696393981797121, 0.0, -0.10219866254386858, 0.0,
+  0.045116503850439263, 0.0, 0.040291236929760131, 0.0,
+  0.029125252842375909, 0.0, 0.02255163515775031, 0.0,
+  0.3051584429978153, 0.0, 0.30782324677975981, 0.0,
+  0.46855686639208777, 0.0, 0.5656971860930593, 0.0,
+  -0.27590272838004837, 0.0, -0.092421531453480518, 0.0,
+  -0.098300181554585114, 0.0, -0.048492641798476482, 0.0,
+  -0.19109873035637379, 0.0, 0.10792709488569067, 0.0,
+  0.1012545196864961, 0.0, 0.11211248191219476, 0.0,
+  0.11209985736345354, 0.0, 0.050973484382267009, 0.0,
+  0.051706207179708405, 0.0, -0.03915593227884967, 0.0,
+  -0.049535892531705358, 0.0, -0.02026497646752556, 0.0,
+  -0.031408246581767746, 0.0, -0.014296022050566917, 0.0,
+  -0.02260299870893474, 0.0, -0.17921464958008115, 0.0,
+  -0.17230074211255189, 0.0, -0.089087657321252761, 0.0,
+  -0.10816085717628848, 0.0, 0.0060730519278913838, 0.0,
+  0.006992426643644997, 0.0, -0.0020731350827750063, 0.0,
+  -0.0041635185362938112, 0.0, -0.01690067872442428, 0.0,
+  -0.011760351048788741, 0.0, -0.099465101814208423, 0.0,
+  -0.091639509869437252, 0.0, 0.019114853600900681, 0.0,
+  0.023004795880726157, 0.0, -0.033355911752589715, 0.0,
+  -0.024106016992089852, 0.0, -0.084302774115611462, 0.0,
+  -0.079994700184016998, 0.0, -0.053542681879408763, 0.0,
+  -0.11721120811931808, 0.0, 0.039586268244298943, 0.0,
+  0.043963434458503182, 0.0, 0.023374951505687937, 0.0,
+  0.011919818952775553, 0.0, -0.099667869812635604, 0.0,
+  -0.081394479786983373, 0.0, -0.13318476316465572, 0.0,
+  -0.11839870662619488, 0.0, -0.056264366533534893, 0.0,
+  -0.071207571789853055, 0.0, -0.059174857209055735, 0.0,
+  -0.03606649144594487, 0.0, -0.05397538325324594, 0.0,
+  -0.053271225625944954, 0.0, 0.0019525341753150981, 0.0,
+  0.004403009797118598, 0.0, -0.02475364637159418, 0.0,
+  -0.019948144797439303, 0.0, -0.01352229951512436, 0.0,
+  -0.01208845962959915, 0.0, 0.00061006956917593509, 0.0,
+  0.0013807897138528036, 0.0, -0.0020073457285909213, 0.0,
+  -0.0015448898186022205, 0.0, -0.031263257651062262, 0.0,
+  0.0026181982122291904, 0.0, 0.0054696948072210424, 0.0,
+  0.0030550690370764878, 0.0, 0.016106641885835299, 0.0,
+  0.0033833459707881433, 0.0, 0.0042282191569020088, 0.0,
+  0.0091965321480372893, 0.0, 0.0091012119323429629, 0.0,
+  0.057353000667677234, 0.0, 0.061471735281772126, 0.0,
+  0.066565346513319607, 0.0, 0.087184167144357963, 0.0,
+  0.228894007616221, 0.0, 0.31839471608056447, 0.0,
+  0.12271743719908074, 0.0, 0.16107235357991365, 0.0,
+  -0.037092943155499318, 0.0, -0.033441177066052596, 0.0,
+  -0.012141648566374508, 0.0, 0.022925922565966678, 0.0,
+  -0.013353969280980002, 0.0, -0.013266285199462451, 0.0,
+  -0.0042032829509825011, 0.0, -0.0020162753037931409, 0.0,
+  -0.11890225557147584, 0.0, -0.11393988348001494, 0.0,
+  0.34498411763341558, 0.0, 0.3406696862709212, 0.0,
+  -0.013239874713470599, 0.0, -0.013652933436372989, 0.0,
+  0.23592704354015379, 0.0, 0.15371433601780743, 0.0,
+  -0.033846415884920246, 0.0, -0.028483758944545103, 0.0,
+  -0.015452014135903898, 0.0, -0.031638417215274231, 0.0,
+  -0.026808883900483985, 0.0, -0.026552692406417808, 0.0,
+  -0.016984089091007556, 0.0, -0.01209294806693763, 0.0,
+  -0.62223914679508086, 0.0, -0.51001795053706223, 0.0,
+  -0.3160763470264758, 0.0, -0.26943636624902528, 0.0,
+  0.0590896037155638, 0.0, 0.072925033852514698, 0.0,
+  0.064397690546889194, 0.0, 0.037462696736778954, 0.0,
+  -0.13104611176462225, 0.0, -0.12895861979713966, 0.0,
+  -0.17493665499826486, 0.0, -0.18380983753627245, 0.0,
+  0.14805881649905756, 0.0, 0.13977243584797538, 0.0,
+  0.12177799400135404, 0.0, 0.1065048664021299, 0.0,
+  0.16182078245264669, 0.0, 0.16484528015147004, 0.0,
+  -0.081833228516856857, 0.0, -0.10181192089354199, 0.0,
+  0.0037713912189082754, 0.0, -0.16741401441480164, 0.0,
+  -0.17245012334058268, 0.0, -0.084050440925932293, 0.0,
+  -0.31173986922772712, 0.0, -0.065872558239562159, 0.0,
+  -0.06152987541510755, 0.0, -0.074943701511360011, 0.0,
+  -0.075629213742466825, 0.0, 0.02133417300039241, 0.0,
+  0.023974511079421917, 0.0, -0.042047983965849599, 0.0,
+  -0.047699799403820693, 0.0, -0.046684146351959548, 0.0,
+  -0.058558617599726491, 0.0, -0.02682420942453272, 0.0,
+  -0.030847178444362328, 0.0, 0.062467457830957966, 0.0,
+  0.060690163906735345, 0.0, 0.024454394801833493, 0.0,
+  -0.088016413621644959, 0.0, 0.16943634973574548, 0.0,
+  0.24067822782377538, 0.0, 0.17017435286929766, 0.0,
+  0.13560940092747181, 0.0, 0.017072368396189329, 0.0,
+  0.029487819076203799, 0.0, -0.087419597436473873, 0.0,
+  -0.078496775969186347, 0.0, 0.076495564420160853, 0.0,
+  0.10488439963367222, 0.0, -0.048514276897952978, 0.0,
+  -0.032253141968247939, 0.0, 0.14866947182996951, 0.0,
+  0.14096577754031911, 0.0, 0.080772684790975824, 0.0,
+  0.1671443582564294, 0.0, 0.26742109234685613, 0.0,
+  0.33057035340028357, 0.0, 0.22477606226597222, 0.0,
+  0.21084591409189099, 0.0, -0.24969175203581384, 0.0,
+  -0.1991306570487226, 0.0, -0.19955277831928309, 0.0,
+  -0.17141457823977835, 0.0, -0.089103080289553091, 0.0,
+  -0.10184977768055049, 0.0, -0.089540117834908631, 0.0,
+  -0.050805411741492022, 0.0, -0.47076757311471984, -0.0,
+  -0.48272150975962186, -0.0, -0.032287386870686365, -0.0,
+  -0.034727734722479336, -0.0, -0.10267541330963034, -0.0,
+  -0.096821795405362399, -0.0, -0.089165063393916652, -0.0,
+  -0.076432919085967596, -0.0, 0.30338505509737679, -0.0,
+  0.3035101294522497, -0.0, 0.019612242111328809, -0.0,
+  0.024273868973078139, -0.0, 0.009345921025405891, -0.0,
+  -0.024502164447555208, -0.0, -0.028362747913730661, -0.0,
+  -0.012785258065446684, -0.0, -0.048876210155028625, -0.0,
+  0.035105322241648126, -0.0, 0.031631664145546294, -0.0,
+  0.036654144283020273, -0.0, 0.035157507958881513, -0.0,
+  0.1932068248842376, -0.0, 0.19351993555930921, -0.0,
+  0.0099432723886073229, -0.0, 0.0099947594201744913, -0.0,
+  -0.001542979905710248, -0.0, -0.0048325347567777016, -0.0,
+  -0.0029749186808248089, -0.0, -0.0060620708654104483, -0.0,
+  0.23103475563176964, -0.0, 0.21189321307308853, -0.0,
+  0.10048827357227401, -0.0, -0.024956319177078981, -0.0,
+  -0.071066903380004098, -0.0, -0.10418886854016374, -0.0,
+  -0.077107434951091486, -0.0, -0.061665624936160318, -0.0,
+  0.042789976784726763, -0.0, 0.042165688886639498, -0.0,
+  -0.041721281821196075, -0.0, -0.045093109575360439, -0.0,
+  -0.046803509231828959, -0.0, -0.065492210159627473, -0.0,
+  -0.01276454613297172, -0.0, -0.009523576183219128, -0.0,
+  0.14968576556125521, -0.0, 0.1305619769450779, -0.0,
+  0.079804222894788668, -0.0, 0.16589788705270392, -0.0,
+  -0.14529914076132192, -0.0, -0.18300076653961869, -0.0,
+  -0.1253922988184723, -0.0, -0.12245929263042124, -0.0,
+  0.083050960283376621, -0.0, 0.062800548695765915, -0.0,
+  -0.013991577138773879, -0.0, -0.015878530837309231, -0.0,
+  0.050340414341939491, -0.0, 0.055438357157083791, -0.0,
+  0.045863228491149766, -0.0, 0.024787354354983152, -0.0,
+  0.19349701083679499, -0.0, 0.19143149324622385, -0.0,
+  -0.17484615930901018, -0.0, -0.1985384671085704, -0.0,
+  -0.095949395153453465, -0.0, -0.088559226493362619, -0.0,
+  -0.075344106424415039, -0.0, -0.065478275632310123, -0.0,
+  0.02487610974270129, -0.0, 0.02210196326412325, -0.0,
+  0.011712673345143965, -0.0, 0.013892264454801883, -0.0,
+  -0.0035740430336841924, -0.0, -0.17512320384414923, -0.0,
+  -0.19093320540111436, -0.0, -0.087685291623897307, -0.0,
+  -0.35014612217721658, -0.0, 0.012843766797441458, -0.0,
+  0.013739944632519353, -0.0, 0.020075012175344655, -0.0,
+  0.02323513598253488, -0.0, -0.25213387187394559, -0.0,
+  -0.25517467634344648, -0.0, -0.009801852884416519, -0.0,
+  -0.017329267554464529, -0.0, 0.046486087848607624, -0.0,
+  0.056850584264755942, -0.0, 0.028137634782389957, -0.0,
+  0.032305358337779061, -0.0, 0.22374113813550564, -0.0,
+  0.19653163903960841, -0.0, 0.096662276590695345, -0.0,
+  -0.15208535806631862, -0.0, -0.071150843461824001, -0.0,
+  -0.10279576894471357, -0.0, -0.067707520759050968, -0.0,
+  -0.055216722968618834, -0.0, -0.23958223748500992, -0.0,
+  -0.2658753674316241, -0.0, 0.14449800534015003, -0.0,
+  0.13093307439198348, -0.0, -0.071639623688695517, -0.0,
+  -0.095340514368013357, -0.0, 0.067015323296264639, -0.0,
+  0.043790522086300417, -0.0, 0.21376132287748364, -0.0,
+  0.18343016169112245, -0.0, 0.11688183128232184, -0.0,
+  0.23229286317244099, -0.0, -0.0026713405191855322, -0.0,
+  -0.0027875233369958679, -0.0, 0.0026608136585482191, -0.0,
+  -2.4153426000092939e-05, -0.0, 0.056342694140443149, -0.0,
+  0.047119323274668515, -0.0, 0.32380251776309316, -0.0,
+  0.28127522550898326, -0.0, 0.028102021663282094, -0.0,
+  0.029379310835938078, -0.0, 0.037157667162182433, -0.0,
+  0.020931367691328237, -0.0, -0.25806765954070443, 0.0,
+  -0.25334765123913, 0.0, 0.10394327913846306, 0.0,
+  0.12170494835472265, 0.0, 0.0037122900833027671, 0.0,
+  0.0095214011877047724, 0.0, 0.013885060460810702, 0.0,
+  0.015066444753709595, 0.0, 0.22138271754393718, 0.0,
+  0.22740543891843207, 0.0, -0.0046451728000910068, 0.0,
+  -0.002610257761826093, 0.0, -0.013460413554202346, 0.0,
+  0.098202300840191631, 0.0, 0.11424337509658591, 0.0,
+  0.052932274112858203, 0.0, 0.22958403136907057, 0.0,
+  -0.026954731441389022, 0.0, -0.018570447069070555, 0.0,
+  -0.020674404224710029, 0.0, -0.0098512434575062924, 0.0,
+  -0.14245006591026019, 0.0, -0.1389899923079754, 0.0,
+  0.060363905300850305, 0.0, 0.086881536683293972, 0.0,
+  -0.025853170115671783, 0.0, -0.024341027606185246, 0.0,
+  -0.010101332723182614, 0.0, -0.0027379047997377949, 0.0,
+  -0.18823158816397365, 0.0, -0.15851677832083619, 0.0,
+  -0.076223939217313172, 0.0, 0.091616952282559089, 0.0,
+  -0.04532421563646253, 0.0, -0.048869329614792227, 0.0,
+  -0.032782619980684269, 0.0, -0.018485103119961328, 0.0,
+  -0.31493895415995088, 0.0, -0.33372988544936633, 0.0,
+  -0.011381020114477005, 0.0, 0.00039410122551550633, 0.0,
+  -0.038937736453937735, 0.0, -0.04145931846837797, 0.0,
+  -0.025804588038729627, 0.0, -0.012813771387405941, 0.0,
+  -0.11070663150088236, 0.0, -0.086092514911162848, 0.0,
+  -0.054491637773190313, 0.0, -0.09626010218297866, 0.0,
+  0.16914742614223388, 0.0, 0.22854100567989794, 0.0,
+  0.15721579826128065, 0.0, 0.16915925578312629, 0.0,
+  -0.11295485422165108, 0.0, -0.077017546434145975, 0.0,
+  0.35600283643297692, 0.0, 0.32708226528790341, 0.0,
+  -0.013123964197886509, 0.0, -0.0060286404564006534, 0.0,
+  -0.0040869995692577495, 0.0, 0.0029285689860430657, 0.0,
+  0.1609147961280453, -0.0, 0.17965462902129506, -0.0,
+  -0.062924538258220711, -0.0, -0.056550454794786625, -0.0,
+  -0.054823068609022488, -0.0, -0.041007661717319892, -0.0,
+  -0.045492321075127809, -0.0, -0.030197659384014315, -0.0,
+  -0.22114844453140203, -0.0, -0.21179812502138726, -0.0,
+  -0.005090340324348493, -0.0, -0.0026050099124601575, -0.0,
+  0.0046037406175573736, -0.0, -0.046023546393229343, -0.0,
+  -0.035572155479200548, -0.0, -0.02452235943817959, -0.0,
+  -0.063893292941520921, -0.0, -0.01846775486440641, -0.0,
+  -0.0081349408835400729, -0.0, -0.016603273795433516, -0.0,
+  -0.0015925772056264861, -0.0, 0.4166934205047802, -0.0,
+  0.4303388938131138, -0.0, 0.14673348956667154, -0.0,
+  0.20524543363433512, -0.0, -0.034004076240119953, -0.0,
+  -0.02149330193055347, -0.0, -0.019848261816549494, -0.0,
+  -0.0061132414391153371, -0.0, -0.027295116149704608, -0.0,
+  -0.0080674502889695101, -0.0, -0.020224293961653619, -0.0,
+  -0.05560282052068681, -0.0, -0.10667330618282111, -0.0,
+  -0.12700937076630239, -0.0, -0.10719282154834109, -0.0,
+  -0.072249126339450756, -0.0, -0.24206756797079179, -0.0,
+  -0.24360123212072846, -0.0, -0.17478008392501782, -0.0,
+  -0.14260401389832145, -0.0, -0.069210090281405123, -0.0,
+  -0.076423555808281682, -0.0, -0.08135566752720548, -0.0,
+  -0.049779031658654445, -0.0, 0.044684115184475293, -0.0,
+  0.056339213856900133, -0.0, 0.023095065413906296, -0.0,
+  0.070983878492150543, -0.0, 0.14508296271982749, -0.0,
+  0.2102823308724448, -0.0, 0.12777130928943023, -0.0,
+  0.14488038908491127, -0.0, -0.18301876181356591, -0.0,
+  -0.12469582377521783, -0.0, 0.28989696100709139, -0.0,
+  0.28172160112576566, -0.0, -0.0059494558632773899, -0.0,
+  0.010823220911475483, -0.0, -0.0065739359914255037, -0.0,
+  0.0025344812032107966, -0.0, -0.023004171539031618, -0.0,
+  0.00024995006892216342, -0.0, -0.0090625563782501008, -0.0,
+  0.011669308426590563, -0.0, -0.022585181701998202, -0.0,
+  -0.0057646195600197549, -0.0, -0.031573449904535263, -0.0,
+  -0.0070165564352040345, -0.0, 0.0011116337213177747, -0.0,
+  0.018116895344838239, -0.0, -0.015849234124222296, -0.0,
+  -0.012871273827091896, -0.0, -0.0089123007224726231, -0.0,
+  0.015034729862945323, -0.0, 0.041027812439903319, -0.0,
+  0.0023085244858420204, -0.0, 0.070763245569093067, -0.0,
+  -0.013946847421827823, -0.0, 0.0067510630667719463, -0.0,
+  -0.025397098284190976, -0.0, 0.011030937831775009, -0.0,
+  0.0059800376770265916, -0.0, 0.022454538007166232, -0.0,
+  -0.18831119744226271, -0.0, -0.17233942140357847, -0.0,
+  0.18380412230405974, -0.0, 0.2837385982156766, -0.0,
+  0.08142720339803132, -0.0, 0.12065564248066173, -0.0,
+  -0.063866858508688534, -0.0, -0.026285065204028301, -0.0,
+  -0.041619695594345335, -0.0, -0.085719478743764774, -0.0,
+  -0.10936542462858767, -0.0, -0.11847476765516478, -0.0,
+  -0.12753785736636492, -0.0, -0.081062718538626483, -0.0,
+  -0.099832537021869505, -0.0, -0.078791402675338115, -0.0,
+  -0.33634073844009976, -0.0, -0.24953846043293088, -0.0,
+  -0.034418695175308746, -0.0, -0.025397360233861032, -0.0,
+  0.10437755762009805, -0.0, 0.063560069449957346, -0.0,
+  0.010395977873870499, -0.0, 0.040367660846212454, -0.0,
+  0.00034356152949542411, -0.0, 0.039903835795254895, -0.0,
+  0.19635260593248668, -0.0, 0.29576006278522865, -0.0,
+  0.15890321155227499, -0.0, 0.19076509869314595, -0.0,
+  0.43928234658429188, -0.0, 0.40131770625194435, -0.0,
+  -0.3964498740220419, -0.0, -0.28406185307842985, -0.0,
+  -0.039914029635988287, -0.0, -0.0027011564293849682, -0.0,
+  -0.057796578928393932, -0.0, -0.021645476756979219, -0.0,
+  0.0024076610449387287, -0.0, -0.0045624645088644276, -0.0,
+  0.011517553818030055, -0.0, 0.0051969631555797129, -0.0,
+  -0.073279185740078773, -0.0, -0.075135950373692389, -0.0,
+  -0.062474468230214908, -0.0, -0.058269733474196866, -0.0,
+  0.011451563937238353, -0.0, 0.0026575262625053429, -0.0,
+  -0.0012778012889821029, -0.0, -0.0020948513123447967, -0.0,
+  0.0054541335092960844, -0.0, 0.0055007754214413821, -0.0,
+  0.00087942996730943713, -0.0, 0.0030798526834980872, -0.0,
+  0.0063839741066023508, -0.0, 0.0051681770572302582, -0.0,
+  -0.00092209103081467372, -0.0, 0.0062754764202930897, -0.0,
+  0.00043534188271939509, -0.0, -0.053201818163981639, -0.0,
+  -0.066011722203380307, -0.0, 0.030301131013595436, -0.0,
+  0.00057791390663803493, -0.0, -0.093135784556729259, -0.0,
+  -0.14769355053294381, -0.0, -0.041402968202884458, -0.0,
+  -0.066354467784486601, -0.0, -0.020421951887853, -0.0,
+  -0.024789170794585667, -0.0, -0.008844056316174357, -0.0,
+  -0.032007635271162377, -0.0, -0.22163320229321315, -0.0,
+  -0.33449173942004012, -0.0, -0.22996962860481934, -0.0,
+  -0.19025368384891889, -0.0, 0.3834631128397733, -0.0,
+  0.40714472949443775, -0.0, 0.34906302020042718, -0.0,
+  0.29834773935019554, -0.0, -0.035196291153381999, -0.0,
+  -0.063666893396462657, -0.0, -0.035680049700954723, -0.0,
+  -0.020501726630717285, -0.0, 0.025432845298790425, -0.0,
+  0.015013955435052968, -0.0, 0.013605907613625644, -0.0,
+  0.026644993669010353, -0.0, 0.24935978199683748, -0.0,
+  0.28631045878152006, -0.0, 0.21174589380579306, -0.0,
+  0.19184284841541943, -0.0, -0.11256150720203736, -0.0,
+  -0.12140926195486314, -0.0, -0.10365338623318349, -0.0,
+  -0.12580109956621793, -0.0, -0.031928296832778515, -0.0,
+  -0.049590681588840654, -0.0, -0.026026340947830458, -0.0,
+  -0.02101930004017136, -0.0, 0.0026835708143529893, 0.0,
+  0.0038799583126626082, 0.0, -0.070280947300734767, 0.0,
+  -0.057923082053388614, 0.0, -0.032993230835295102, 0.0,
+  -0.034013363522667914, 0.0, -0.02610332855196873, 0.0,
+  -0.023541573785734259, 0.0, -0.0079519004492616743, 0.0,
+  -0.011260791664994461, 0.0, 0.0025396782357818338, 0.0,
+  0.0021977772659756943, 0.0, 9.7142247908545728e-05, 0.0,
+  -0.078868730663061812, 0.0, -0.085348570269074484, 0.0,
+  -0.034157025516985726, 0.0, -0.12467209364542886, 0.0,
+  0.003762141944231624, 0.0, -0.00041738443081678776, 0.0,
+  0.0046361252104354655, 0.0, 0.001979262951520803, 0.0,
+  0.062303922719512655, 0.0, 0.056048590108118523, 0.0,
+  -0.036253691159563575, 0.0, -0.047898632363140528, 0.0,
+  -0.072598772748456622, 0.0, -0.117416236945503, 0.0,
+  -0.030540081182228524, 0.0, -0.049282908088958445, 0.0,
+  -0.011153471166277112, 0.0, -0.021720207744641135, 0.0,
+  0.0095131633105383206, 0.0, 0.70577736620968867, 0.0,
+  0.024436742895511194, 0.0, 0.025162049801645669, 0.0,
+  0.029715636226267536, 0.0, 0.021053030790714519, 0.0,
+  -0.19805886245115223, 0.0, -0.23928111441103334, 0.0,
+  0.31540680675190941, 0.0, 0.30215039621945172, 0.0,
+  -0.032289352756879088, 0.0, -0.04846292966600993, 0.0,
+  -0.014022501087273475, 0.0, -0.0019072310355007875, 0.0,
+  -0.039798845297379037, 0.0, -0.046342050718868877, 0.0,
+  -0.017462762817385635, 0.0, -0.039003960881856536, 0.0,
+  0.037428081800969994, 0.0, 0.023641086536919671, 0.0,
+  0.035406440978195515, 0.0, 0.026545358858929377, 0.0,
+  0.23514051608699438, 0.0, 0.18500770603532177, 0.0,
+  -0.25964543582781369, 0.0, -0.22936162739734231, 0.0,
+  0.0062877395440722973, 0.0, 0.0028590852110009068, 0.0,
+  0.0080400013295452658, 0.0, 0.0063333200384987163, 0.0,
+  -0.0084466391192893411, -0.0, 0.017957605476563891, -0.0,
+  -0.10087428713290991, -0.0, -0.068108006372082364, -0.0,
+  -0.059247258692014651, -0.0, -0.040708451302267273, -0.0,
+  -0.051350057323973394, -0.0, -0.025993200649428491, -0.0,
+  0.001338628924163377, -0.0, 0.016233936485850815, -0.0,
+  -0.0039723086211092933, -0.0, 0.0028715737402773308, -0.0,
+  -0.0062091058936149411, -0.0, -0.084724119295927575, -0.0,
+  -0.0649128955818669, -0.0, -0.040456780495505072, -0.0,
+  -0.08631366042611005, -0.0, -0.0032027442841930757, -0.0,
+  0.011171885376224532, -0.0, -0.0047579717877938568, -0.0,
+  0.020153436121475198, -0.0, -0.091954416175154707, -0.0,
+  -0.082928260564944817, -0.0, 0.12198468360344229, -0.0,
+  0.1912526099337731, -0.0, 0.079706898274384361, -0.0,
+  0.13877724357664403, -0.0, 0.034000817983611785, -0.0,
+  0.063638105980752785, -0.0, -0.024807976243279978, -0.0,
+  0.0037577848744994305, -0.0, -0.0095534070189631226, -0.0,
+  0.61962452451178307, -0.0, -0.035813934107211398, -0.0,
+  -0.021111064761473224, -0.0, -0.033976407199004272, -0.0,
+  -0.0069903613104563261, -0.0, 0.21512330494815662, -0.0,
+  0.27917197450159248, -0.0, -0.45094441489176751, -0.0,
+  -0.38834412536173335, -0.0, -0.010257055462740862, -0.0,
+  0.0063545194347757218, -0.0, 0.0085136467999297107, -0.0,
+  0.006316490116653849, -0.0, -0.021429353145860856, -0.0,
+  0.001822205475567757, -0.0, -0.012902428343644089, -0.0,
+  0.0140205331829429, -0.0, -0.015714935991267266, -0.0,
+  0.019736543560900124, -0.0, -0.013210546807611991, -0.0,
+  0.019839048697404219, -0.0, -0.18304244580758494, -0.0,
+  -0.12729594769348998, -0.0, 0.14096131580710733, -0.0,
+  0.1670697397760959, -0.0, -0.010878972667380853, -0.0,
+  0.0067620843568741845, -0.0, -0.016000228148084043, -0.0,
+  -0.0017273728417089437, -0.0, -0.036147156278309063, 0.0,
+  0.037503914404867431, 0.0, -0.07201074213436813, 0.0,
+  0.013829963685992914, 0.0, 0.16459077474351108, 0.0,
+  0.15552011919412312, 0.0, 0.13363888354849937, 0.0,
+  0.11976598756843587, 0.0, -0.015773419471550001, 0.0,
+  0.0097077527369861024, 0.0, -0.010675117512770798, 0.0,
+  -0.0071085718430449916, 0.0, -0.0051885847436938101, 0.0,
+  -0.027838640033109319, 0.0, 0.046166631312138988, 0.0,
+  -0.01346735235293337, 0.0, 0.14520932284932525, 0.0,
+  -0.0058393995034887363, 0.0, -0.0016869912118955472, 0.0,
+  -0.0082159623615120653, 0.0, -0.0034682721478684481, 0.0,
+  0.0024519167771726554, 0.0, 0.0069218563196374473, 0.0,
+  -0.067085549316815457, 0.0, -0.066361611940193493, 0.0,
+  -0.0084352588699918313, 0.0, -0.015683161016342005, 0.0,
+  -0.0041487337889408995, 0.0, -0.004165079792951591, 0.0,
+  -0.48283832517729769, 0.0, -0.30815551755031045, 0.0,
+  -0.2244655480072571, 0.0, 0.14423062439252035, 0.0,
+  -0.12604997965909717, 0.0, -0.15593356444678907, 0.0,
+  -0.13479716238746578, 0.0, -0.084159703090070148, 0.0,
+  -0.030362437583828113, 0.0, -0.0274863362601394, 0.0,
+  0.043706058698651844, 0.0, 0.059912416145602304, 0.0,
+  0.07890929300564016, 0.0, 0.10438924524539479, 0.0,
+  0.00097233856804650372, 0.0, 0.0058823995162785988, 0.0,
+  0.26115611984028159, 0.0, 0.32162808157067962, 0.0,
+  0.14460468375907509, 0.0, 0.47187851631485817, 0.0,
+  -0.15529774315079195, 0.0, -0.16366557354738157, 0.0,
+  -0.13498431791308474, 0.0, -0.10125411090971335, 0.0,
+  -0.012665311640093461, 0.0, -0.010993664829819937, 0.0,
+  0.023837804885091355, 0.0, 0.029563168136563508, 0.0,
+  -0.00095146002647352346, 0.0, -0.0016272654918143322, 0.0,
+  -0.00038034829382264739, 0.0, 0.0033901010656609771, 0.0,
+  0.017767414134529196, 0.0, -0.058183069014582124, 0.0,
+  0.043969013502134176, 0.0, -0.022240995567097799, 0.0,
+  0.32322720950342765, 0.0, 0.27130945100925119, 0.0,
+  0.26681915618541396, 0.0, 0.2012994814733072, 0.0,
+  0.013615391956710464, 0.0, -0.020136627440219049, 0.0,
+  0.0049135493533797514, 0.0, -0.014971901852355163, 0.0,
+  0.0025847423772195435, 0.0, -0.0085548250670068864, 0.0,
+  -0.08443463872123709, 0.0, -0.0014755268327949328, 0.0,
+  -0.18162466759796361, 0.0, 0.010080276444099742, 0.0,
+  -0.020612546958670024, 0.0, 0.0090241006006465535, 0.0,
+  -0.041556885910932193, 0.0, 0.022650578435695377, 0.0,
+  0.0058425553601976462, 0.0, -0.023201563301054391, 0.0,
+  -0.071460969886396927, 0.0, 0.024177701177742872, 0.0,
+  -0.0065890436807649949, 0.0, 0.014255122938057727, 0.0,
+  -0.0026812509835015541, 0.0, 0.42006129794621427, 0.0,
+  0.26802165271599904, 0.0, 0.19599078185711458, 0.0,
+  0.12827798092208328, 0.0, -0.1996150868441523, 0.0,
+  -0.34723812775154234, 0.0, -0.20825478780593568, 0.0,
+  -0.20072276193740912, 0.0, -0.065924333502928395, 0.0,
+  -0.1102949585049143, 0.0, -0.023541798561931657, 0.0,
+  -0.07123181068615772, 0.0, 0.14784532745148521, 0.0,
+  0.15661202457375259, 0.0, 0.04352557671422231, 0.0,
+  0.019470378262001539, 0.0, -0.11714058912605979, 0.0,
+  -0.19985281501787558, 0.0, -0.068357473704133045, 0.0,
+  -0.27359376200533508, 0.0, -0.0039287271530806696, 0.0,
+  -0.10581625671082169, 0.0, -0.013348629837664924, 0.0,
+  -0.083018913008127262, 0.0, -0.010712699915994169, 0.0,
+  -0.039712742904922306, 0.0, 0.096211913263377732, 0.0,
+  0.040431915455883601, 0.0, -0.002255007974788263, 0.0,
+  -0.043513096407320068, 0.0, 0.0050908674016051578, 0.0,
+  -0.0072765688398824741, 0.0, 0.0010425006105308783, 0.0,
+  0.0088977567393322184, 0.0, -0.011676164237186339, 0.0,
+  -0.0099327774629727437, 0.0, 0.034380035665249969, 0.0,
+  0.036341580787940954, 0.0, 0.032014890055932645, 0.0,
+  0.031988521951048239, 0.0, 0.0086115674312373536, 0.0,
+  0.012956737981449307, 0.0, -0.000424785995736146, 0.0,
+  0.00069778740043338519, 0.0, -0.0017978803021376083, 0.0,
+  -0.0037761688384518981, 0.0, 0.0029021661060238289, 0.0,
+  -0.0017469658585126105, 0.0, 0.0058024397342135645, 0.0,
+  -0.006639991162457076, 0.0, -0.0038241843108760085, 0.0,
+  -0.006321759130496876, 0.0, -0.0064173886823758412, 0.0,
+  -0.088767381427725944, 0.0, -0.08552277490820652, 0.0,
+  0.52869216482554693, 0.0, 0.64844308645599802, 0.0,
+  -0.034274131885522481, 0.0, -0.019026993286143927, 0.0,
+  -0.011575679011467728, 0.0, -0.002307082356630671, 0.0,
+  0.0058257347210925563, 0.0, 0.016888051867631901, 0.0,
+  -0.0039304777619083965, 0.0, -0.14229595975136414, 0.0,
+  -0.036177761249918394, 0.0, -0.039532408173701024, 0.0,
+  -0.035636370561969895, 0.0, -0.021123850408024541, 0.0,
+  -0.094272146284935771, 0.0, -0.10118394133979268, 0.0,
+  -0.049516786185015468, 0.0, -0.029642516169547554, 0.0,
+  0.0073755070075105442, 0.0, 0.020305815429581511, 0.0,
+  -0.067404217111582995, 0.0, -0.040403831143614781, 0.0,
+  0.022070655237408365, 0.0, 0.02681993327137993, 0.0,
+  0.012667866160352814, 0.0, 0.038605606957576546, 0.0,
+  -0.039551370472268352, 0.0, -0.033328854580777022, 0.0,
+  -0.028026087153263421, 0.0, -0.014372077538688108, 0.0,
+  0.14331166879840138, 0.0, 0.13343578528328789, 0.0,
+  -0.39416847481407041, 0.0, -0.32423579397808511, 0.0,
+  -0.001654196660644866, 0.0, 0.015124470963949191, 0.0,
+  -0.0055585851099722288, 0.0, 0.00084548386293513498, 0.0,
+  -0.012811344309992742, -0.0, 0.00069052140149565024, -0.0,
+  0.39033186573528611, -0.0, 0.06187962420879272, -0.0,
+  0.010937739033243609, -0.0, -0.0064889599271713422, -0.0,
+  -0.013905285950517534, -0.0, 0.0063619248909982697, -0.0,
+  -0.0068463220931727405, -0.0, 0.0016173915360524072, -0.0,
+  -0.0021519104069403576, -0.0, 0.0003637129728417525, -0.0,
+  -0.0013138346636172725, -0.0, 0.32476036488505966, -0.0,
+  -0.013050020692996664, -0.0, -0.88991787790101484, -0.0,
+  0.14781569346038509, -0.0, -0.0088154009631074195, -0.0,
+  0.001064957697259413, -0.0, 0.014848542239560581, -0.0,
+  -0.0025181839107823239, -0.0, 0.0026664309799312724, -0.0,
+  -0.0013204958548837533, -0.0, 0.011488417929788542, -0.0,
+  -0.0038250569185172508, -0.0, -0.0068537703247830515, -0.0,
+  0.0046409326938225016, -0.0, 0.013936517851357119, -0.0,
+  -0.010196054446301017, -0.0, -0.03057546747484462, -0.0,
+  -0.0012292423676122945, -0.0, 0.027615508144603156, -0.0,
+  0.0002576495513696331, -0.0, -0.02187977485320456, -0.0,
+  0.012337991615068539, -0.0, 0.027242064509871634, -0.0,
+  -0.016988574941306678, -0.0, -0.0042253049409590494, -0.0,
+  0.0013330978458941203, -0.0, 0.00087431107016461328, -0.0,
+  -0.00020984591713460601, -0.0, -0.00074073150258898075, -0.0,
+  0.00039570813391692094, -0.0, -0.0026749164429451331, -0.0,
+  0.001048825162641066, -0.0, -0.019521078227600217, -0.0,
+  0.0040452440032305616, -0.0, 0.023639976498847786, -0.0,
+  -0.012189434676360312, -0.0, -0.015528111852920802, -0.0,
+  0.010586085307305438, -0.0, 0.015662829328043207, -0.0,
+  -0.014270359158578523, -0.0, -0.00063960857594209291, -0.0,
+  -4.8375055120744452e-05, -0.0, 0.0027639398396937204, -0.0,
+  -0.00049007785165840645, -0.0, -0.00090658344688935297, -0.0,
+  0.00048794230829781826, -0.0, 0.0015358295458594918, -0.0,
+  -0.001099634731214691, -0.0, -0.17185506064211026, -0.0,
+  0.18156932372952572, -0.0, -0.33634055011284952, -0.0,
+  -0.096926586245489721, -0.0, -0.048513938227326955, -0.0,
+  0.074492351456794628, -0.0, -0.053070792161135444, -0.0,
+  0.068838988735122439, -0.0, -0.075230058737699529, -0.0,
+  0.086392254624901743, -0.0, -0.038034546001562412, -0.0,
+  0.039086357179631416, -0.0, -0.0081786569399358439, -0.0,
+  -0.1072166043478715, -0.0, 0.18468980099728555, -0.0,
+  -0.079039235570967745, -0.0, 0.35612799735732109, -0.0,
+  -0.087053788478249211, -0.0, 0.0659818256375517, -0.0,
+  -0.09955608875852813, -0.0, 0.11896009231767946, -0.0,
+  -0.052189085343310682, -0.0, 0.02898850686325841, -0.0,
+  -0.13984239057155101, -0.0, 0.036342856854810084, -0.0,
+  -0.034587179784946527, -0.0, 0.14012189895639104, -0.0,
+  -0.041848745820317564, -0.0, 0.050733129243992613, -0.0,
+  0.058138455597466561, -0.0, 0.42363348003925999, -0.0,
+  -0.091855070161602534, -0.0, -0.033691380754737169, -0.0,
+  -0.093846704564978775, -0.0, 0.10789346986047445, -0.0,
+  -0.11545261341204278, -0.0, 0.029636565432747869, -0.0,
+  -0.099532771461260092, -0.0, 0.077475771969091792, -0.0,
+  0.032078731409445151, -0.0, 0.27539446519694022, -0.0,
+  0.0059459715652612532, -0.0, 0.14786425028083844, -0.0,
+  -0.18889501653676566, -0.0, -0.07417201642329331, -0.0,
+  -0.24299561616249757, -0.0, 0.06740960186227353, -0.0,
+  -0.15725112989163639, -0.0, -0.016559249438171834, -0.0,
+  -0.17831139554015052, -0.0, 0.16992518508341459, -0.0,
+  -0.15534297506389028, -0.0, 0.10143118191107285, -0.0,
+  -0.12870907863830136, -0.0, 0.085789966861442232, -0.0,
+  -0.081834106344381527, -0.0, 0.11728926724807934, -0.0,
+  -0.068173649495798405, -0.0, 0.19961227926193531, -0.0,
+  -0.13663942556398281, -0.0, 0.0009014796633366565, -0.0,
+  -0.0013857187815998811, -0.0, 0.0014076024661115365, -0.0,
+  -0.0075846225275237981, -0.0, 0.0047994864393385425, -0.0,
+  0.31391495145416537, -0.0, -0.22656924852597998, -0.0,
+  -0.25765434059954023, -0.0, 0.16888457283833835, -0.0,
+  -0.0026806435740350486, -0.0, 0.003694573531123574, -0.0,
+  -0.00090092348592528306, -0.0, 0.00045764550208800107, -0.0,
+  -0.0015482731189073974, -0.0, 0.0010230169499040659, -0.0,
+  -0.01082195385741992, -0.0, 0.011542890331177311, -0.0,
+  0.002533981439809813, -0.0, -0.017470313567197752, -0.0,
+  0.0076818255178326732, -0.0, 0.016071674486775305, -0.0,
+  -0.006461987700021112, -0.0, -0.0011955749145670068, -0.0,
+  -0.0014541195640768707, -0.0, 0.017411426765946474, -0.0,
+  -0.021898225149968538, -0.0, 0.10225421087931842, -0.0,
+  -0.24786212483656522, -0.0, -0.1939479097821713, -0.0,
+  0.37406608534190844, -0.0, -0.024131514328470702, -0.0,
+  0.011774357580465477, -0.0, 0.02075589956094168, -0.0,
+  0.0003786369719848926, -0.0, -0.2884655535275204, -0.0,
+  0.31734796653057634, -0.0, 0.36044282415955931, -0.0,
+  -0.39979470831858815, -0.0, -0.0039445805833057523, -0.0,
+  0.0046265839004538487, -0.0, 0.0063780684461156104, -0.0,
+  -0.0039966562787609669, -0.0, -0.043577877073288467, -0.0,
+  0.035198285652904546, -0.0, 0.098708190388350991, -0.0,
+  -0.09265182564561944, -0.0, 0.15542677003911676, -0.0,
+  -0.1211811134805558, -0.0, -0.18034207944946642, -0.0,
+  0.13391512475134504, -0.0, -0.068709706198424508, -0.0,
+  0.11042838631877025, -0.0, 0.072752848534284348, -0.0,
+  -0.1196959488419045, -0.0, 0.0020919485973598991, -0.0,
+  -0.0015483756318876146, -0.0, -0.003749843571821748, -0.0,
+  -0.0031160433957992065, -0.0, -0.0021608786660989848, -0.0,
+  -0.0039472599009661435, -0.0, 0.0062688858720906316, -0.0,
+  -0.0017887763701784868, -0.0, -0.0023766211122201618, 0.0,
+  0.0020049898321482192, 0.0, -0.0047514419427517529, 0.0,
+  -0.0027881300623637741, 0.0, 0.37071983131057784, 0.0,
+  -0.28497472425896408, 0.0, -0.28246507630971873, 0.0,
+  0.20292872261739486, 0.0, 0.0023807075741848725, 0.0,
+  -0.0033136171430113376, 0.0, -0.0010462307574658669, 0.0,
+  0.00086054557984146661, 0.0, 0.003348389127141005, 0.0,
+  -0.016877609902333852, 0.0, 0.01539635140908858, 0.0,
+  0.025225171109069182, 0.0, -0.011639377236449406, 0.0,
+  -0.027141027084524698, 0.0, 0.022498393791888439, 0.0,
+  0.020125978589413712, 0.0, -0.012179558803631604, 0.0,
+  -0.0026000070825325291, 0.0, 0.0043717160256135706, 0.0,
+  -0.027912219336234109, 0.0, 0.038075059335097833, 0.0,
+  -0.16258985536243548, 0.0, 0.35529280947693509, 0.0,
+  0.30237634426882221, 0.0, -0.54148050133489489, 0.0,
+  -0.011614846071773528, 0.0, 0.0044634888216136199, 0.0,
+  0.012150508473530762, 0.0, -0.00087940699977199208, 0.0,
+  -0.19639285703195197, 0.0, 0.13204647144915754, 0.0,
+  0.23025725131768709, 0.0, -0.1634669083224129, 0.0,
+  0.011942810600511944, 0.0, -0.012255906569334332, 0.0,
+  0.0062834148488251562, 0.0, 0.00091806800028477087, 0.0,
+  -0.08188074883948239, 0.0, 0.079580600401120735, 0.0,
+  -0.15004482679422002, 0.0, 0.13779658411904069, 0.0,
+  0.085701437401203423, 0.0, -0.066160422354553869, 0.0,
+  -0.096870076796120155, 0.0, 0.072065307232628273, 0.0,
+  0.023548480328410774, 0.0, -0.10420564689413475, 0.0,
+  -0.031272101615715031, 0.0, 0.1261383324366343, 0.0,
+  0.0042809135439266467, 0.0, -0.01345633898264526, 0.0,
+  -0.010382133600165993, 0.0, 0.027928630377246886, 0.0,
+  -0.0094527190913051874, 0.0, 0.013368885408848688, 0.0,
+  0.026306172877438961, 0.0, -0.027911429992207228, 0.0,
+  -0.0043244336852011995, -0.0, 0.0029249338180289829, -0.0,
+  0.0016248349114510365, -0.0, -0.015164311305190551, -0.0,
+  0.37737913191751515, -0.0, -0.2893800506299572, -0.0,
+  -0.27328689432622694, -0.0, 0.18807599156626253, -0.0,
+  -0.0019886821910275396, -0.0, 0.00087280859200057604, -0.0,
+  -0.00017476430140476979, -0.0, -1.5376022998279374e-05, -0.0,
+  -0.00025912181460326528, -0.0, 0.0084831516538093274, -0.0,
+  -0.018928574015082404, -0.0, 0.0047563145743120235, -0.0,
+  0.022875100246888155, -0.0, -0.022998192051458952, -0.0,
+  0.010450975708682728, -0.0, 0.019535645217099495, -0.0,
+  -0.0069392596726460679, -0.0, -0.0079029327277962084, -0.0,
+  0.0069012066883003638, -0.0, 0.019646397378303877, -0.0,
+  -0.019615040433964441, -0.0, 0.017085376568118524, -0.0,
+  -0.039664583235033267, -0.0, -0.04111149150363877, -0.0,
+  0.063995444494186857, -0.0, 0.031900378895711685, -0.0,
+  -0.015515208314937995, -0.0, -0.027209671486015261, -0.0,
+  0.0015150745834391394, -0.0, 0.25582444051332504, -0.0,
+  -0.28344435346030949, -0.0, -0.31402145811467802, -0.0,
+  0.35090898942730286, -0.0, 0.00033932247986945356, -0.0,
+  -0.0028495372066373787, -0.0, 0.0081716047995880059, -0.0,
+  -0.0054911371234836314, -0.0, -0.100434898423491, -0.0,
+  0.088368924564598383, -0.0, 0.030372804451538365, -0.0,
+  -0.02280841584580056, -0.0, -0.1498641730418718, -0.0,
+  0.11422978361130721, -0.0, 0.17180945613627358, -0.0,
+  -0.12480649635414526, -0.0, -0.22285553269618893, -0.0,
+  0.26250788474077041, -0.0, 0.2365577837725551, -0.0,
+  -0.28509522238400464, -0.0, -0.015919183583071678, -0.0,
+  0.014542172169354014, -0.0, 0.030944517656400036, -0.0,
+  -0.031257409391001127, -0.0, -0.004922381930377806, -0.0,
+  0.0098668636744154419, -0.0, 0.020113760130906499, -0.0,
+  -0.024332287670071347, -0.0, 0.002514036777900601, -0.0,
+  -0.0024377274649085689, -0.0, 0.0076262615157619701, -0.0,
+  -0.0091284165565871031, -0.0, -0.11448439488701169, -0.0,
+  0.078216437544847028, -0.0, 0.069311065541990832, -0.0,
+  -0.031668909759504878, -0.0, -0.0012458623854542706, -0.0,
+  0.00069396253780728775, -0.0, 0.00097671101096436039, -0.0,
+  -0.0014967738836846321, -0.0, 0.00093391123610198263, -0.0,
+  0.0011935630136816809, -0.0, -0.0011238681806647012, -0.0,
+  -0.0030058580663020001, -0.0, 0.0074672483704491359, -0.0,
+  0.010953545866273996, -0.0, -0.0086258339230919634, -0.0,
+  -0.0088527605029584937, -0.0, 0.0071275310206684395, -0.0,
+  0.0016098088920627268, -0.0, -0.00091924064062063856, -0.0,
+  -0.014456107826093759, -0.0, 0.014784464980011038, -0.0,
+  -0.027036598108667112, -0.0, 0.038682771750932647, -0.0,
+  0.053973490232881054, -0.0, -0.062558214459447467, -0.0,
+  -0.11668204757316684, -0.0, 0.047304426465032884, -0.0,
+  0.10269600500380592, -0.0, -0.0034488653063599779, -0.0,
+  0.024925412182376105, -0.0, -0.070152032279579044, -0.0,
+  -0.046774758401152916, -0.0, 0.10164382927696403, -0.0,
+  -0.0010605951132966326, -0.0, 0.00061476459229037426, -0.0,
+  -0.006298281883348072, -0.0, 0.006317473466598696, -0.0,
+  0.066338764092492744, -0.0, -0.06924613140773124, -0.0,
+  -0.027865763291241775, -0.0, 0.019135671477718622, -0.0,
+  0.41322971190740038, -0.0, -0.23778231483450116, -0.0,
+  -0.46472335742338294, -0.0, 0.24354092992047979, -0.0,
+  -0.34848806311842079, -0.0, 0.33383972851906268, -0.0,
+  0.38256212861780603, -0.0, -0.36213953291693907, -0.0,
+  0.00012095006832033528, -0.0, 0.0026207826347078773, -0.0,
+  -0.0030783577256411625, -0.0, 0.0030301616080762989, -0.0,
+  0.013305983917580342, -0.0, -0.0078410944702506143, -0.0,
+  -0.023739737394381153, -0.0, 0.01906996574134295, -0.0,
+  0.16142621453008696, -0.0, -0.16943465077950437, -0.0,
+  0.35278371147479337, -0.0, 0.096667033742605324, -0.0,
+  -0.016774991049617296, -0.0, 0.027005247327989288, -0.0,
+  -0.019280434769072676, -0.0, 0.026612844262942591, -0.0,
+  0.040633585283067479, -0.0, -0.038517010160261836, -0.0,
+  0.0054255280098943516, -0.0, -0.0082195115185751469, -0.0,
+  0.0012667942481986317, -0.0, 0.09052084456146843, -0.0,
+  -0.19944259990268817, -0.0, 0.072291331776848697, -0.0,
+  -0.40678523655152005, -0.0, -0.05199560848684906, -0.0,
+  0.033650410309146374, -0.0, -0.062368999511273414, -0.0,
+  0.075986937538829416, -0.0, -0.033335835716354872, -0.0,
+  0.0036245131461835845, -0.0, -0.10867031989813727, -0.0,
+  0.0028290685693387729, -0.0, 0.060581233637111993, -0.0,
+  0.43071711705701043, -0.0, -0.049902658733916673, -0.0,
+  0.13341450659480786, -0.0, 0.040942588977518748, -0.0,
+  -0.29904837191734118, -0.0, 0.11456057374644817, -0.0,
+  0.035780125062602454, -0.0, -0.024695272402275859, -0.0,
+  0.014822156063575873, -0.0, -0.030269056295106334, -0.0,
+  0.0031701811263488465, -0.0, -0.050128411474108972, -0.0,
+  0.056732553554335333, -0.0, 0.034469842554747797, -0.0,
+  0.27005011662268447, -0.0, -0.026560959443055549, -0.0,
+  0.044070724414807395, -0.0, -0.4534105906540396, -0.0,
+  -0.23287830649692373, -0.0, 0.14096079657645161, -0.0,
+  -0.05689634800532422, -0.0, 0.090198737002490953, -0.0,
+  -0.01628538765784792, -0.0, -0.057605282550740301, -0.0,
+  0.012515108441032964, -0.0, -0.048732683921098564, -0.0,
+  0.0027103370853521738, -0.0, -0.091283871690824872, -0.0,
+  0.060311596234236757, -0.0, -0.06070608885273298, -0.0,
+  0.062268092560283039, -0.0, -0.044563048725575587, -0.0,
+  0.18771186298855669, -0.0, -0.12391509455297496, -0.0,
+  -0.005005683364057034, -0.0, 0.07740953541924811, 0.0,
+  -0.080056712019546686, 0.0, 0.23691294205998353, 0.0,
+  0.070080666107179154, 0.0, -0.13261360280303694, 0.0,
+  0.010690352338636407, 0.0, -0.1199389458371334, 0.0,
+  0.027016103968453199, 0.0, 0.011971817498817658, 0.0,
+  -0.010630476340997003, 0.0, -0.020791316397884393, 0.0,
+  0.017152609130433101, 0.0, -0.0015189978940849853, 0.0,
+  0.052857513835877779, 0.0, -0.12129116572817103, 0.0,
+  0.048485201304988068, 0.0, -0.26343503499177812, 0.0,
+  -0.17478810289089586, 0.0, 0.13030992375411102, 0.0,
+  -0.19249664689602111, 0.0, 0.26630437200667895, 0.0,
+  -0.007317626990259677, 0.0, 0.025507568813184431, 0.0,
+  -0.025190748638336535, 0.0, 0.067562506869527139, 0.0,
+  -0.092086208206134779, 0.0, -0.28827425037599497, 0.0,
+  0.011645862351106206, 0.0, -0.074840609435163491, 0.0,
+  0.020042751899464369, 0.0, -0.14313997047506172, 0.0,
+  0.069387015320503592, 0.0, -0.01312880659038063, 0.0,
+  -0.072116660144427594, 0.0, 0.065681726831967546, 0.0,
+  -0.077507929821077251, 0.0, 0.018915608178296885, 0.0,
+  -0.12913786489352497, 0.0, 0.051371314167386523, 0.0,
+  -0.10448727234665579, 0.0, -0.038682590009292056, 0.0,
+  0.11076013058775619, 0.0, 0.2796390343544749, 0.0,
+  0.27836673254812122, 0.0, 0.17445070965324141, 0.0,
+  0.028004003143685702, 0.0, -0.0034380953874514641, 0.0,
+  0.026970595116600864, 0.0, 0.016026619131525248, 0.0,
+  -0.14865864637591655, 0.0, 0.17499515298849727, 0.0,
+  -0.11676801996515096, 0.0, 0.10726901219412192, 0.0,
+  -0.15262434049405646, 0.0, 0.14016622631654027, 0.0,
+  -0.093933519466917206, 0.0, 0.091765604309043916, 0.0,
+  -0.13517109463435217, 0.0, 0.43085945524908209, 0.0,
+  -0.29641899343597505, 0.0, -0.0080944179628560167, 0.0,
+  -0.0056740553460349827, -0.0, 0.0038007896370825054, -0.0,
+  0.039191793176529675, -0.0, 0.046869595255080332, -0.0,
+  0.17984457379361224, -0.0, -0.017975906071058086, -0.0,
+  -0.095150172821723084, -0.0, -0.079012465595847681, -0.0,
+  -0.0060631781243740837, -0.0, 0.0045028680564364581, -0.0,
+  -0.0053349735845947439, -0.0, 0.0052446462216219885, -0.0,
+  -0.0021903155620335095, -0.0, -0.071305038939003001, -0.0,
+  0.11684795018109377, -0.0, -0.030692545955627641, -0.0,
+  -0.10291950791284814, -0.0, -0.044307839648273922, -0.0,
+  0.023868792150182134, -0.0, 0.039859890517260216, -0.0,
+  -0.020180311816051635, -0.0, -0.00650229957562395, -0.0,
+  0.0067293354415891224, -0.0, 0.041578428656683972, -0.0,
+  -0.042210417491439237, -0.0, 0.032562513488753803, -0.0,
+  -0.0097558626113724636, -0.0, -0.093306448584764556, -0.0,
+  0.048746641742099903, -0.0, -0.13278063448547991, -0.0,
+  0.050268761545358566, -0.0, 0.11958910230975754, -0.0,
+  -0.011862491216745727, -0.0, 0.032117352027612039, -0.0,
+  -0.24693528256263333, -0.0, -0.082476323530089476, -0.0,
+  0.31146188376417511, -0.0, 0.0038326969159066387, -0.0,
+  -0.0066200261619292237, -0.0, 0.021824305394550932, -0.0,
+  -0.019694038475954398, -0.0, -0.15388357194927382, -0.0,
+  0.16506074053762482, -0.0, 0.069555909846586467, -0.0,
+  -0.042303300650205107, -0.0, 0.3385666608905975, -0.0,
+  -0.10968706707507561, -0.0, -0.37378462056774148, -0.0,
+  0.10475406322147228, -0.0, 0.29721896781621299, -0.0,
+  -0.36907964976936602, -0.0, -0.32052189132122783, -0.0,
+  0.4018488499215736, -0.0, -0.0030004873039315145, -0.0,
+  0.0032877250241112161, -0.0, 0.020685449445302519, -0.0,
+  -0.025192726043249399, -0.0, -0.017782215397861092, -0.0,
+  0.019483203971593973, -0.0, 0.047324027193781044, -0.0,
+  -0.048341851992808042, -0.0, -0.0086630938727551132, 0.0,
+  0.010564613514194961, 0.0, -0.022356002865047245, 0.0,
+  -0.010888403109932675, 0.0, -0.12290719699107652, 0.0,
+  -0.11254497593098083, 0.0, -0.12847371002995991, 0.0,
+  -0.098763745476941167, 0.0, -0.0025048863866663773, 0.0,
+  0.0026000078367602471, 0.0, -0.007463259845994023, 0.0,
+  -0.001362480765132314, 0.0, 0.0015494735385551397, 0.0,
+  0.016997785038382604, 0.0, 0.023903292618529481, 0.0,
+  0.00076620684602936057, 0.0, 0.0094953545233336552, 0.0,
+  0.32120199215294037, 0.0, -0.19897891975984394, 0.0,
+  0.34074509568271005, 0.0, -0.48982514867250115, 0.0,
+  -0.0045586512647072695, 0.0, -0.0046702392862540479, 0.0,
+  0.0039884867217070963, 0.0, -0.014504127156493215, 0.0,
+  0.0059362860706563382, 0.0, 0.019363873832439815, 0.0,
+  -0.0029636253937669953, 0.0, -0.0017466231603593704, 0.0,
+  -0.0086907264868048752, 0.0, -0.004451653356709045, 0.0,
+  -0.013408859345438479, 0.0, 0.0074605211093350743, 0.0,
+  -0.011836181745285303, 0.0, -0.0056097468339703456, 0.0,
+  -0.034598740770050436, 0.0, -0.023810931054104988, 0.0,
+  -0.078545206297476827, 0.0, -0.063320453493289686, 0.0,
+  0.015218276852862518, 0.0, -0.011866996658360265, 0.0,
+  0.30296373493306894, 0.0, 0.39891644434994949, 0.0,
+  -0.030046983281799517, 0.0, -0.017268806172315597, 0.0,
+  0.019215336058461704, 0.0, 0.0079175915951658783, 0.0,
+  0.0013622613015302517, 0.0, -0.013189941748806224, 0.0,
+  0.034364319568956234, 0.0, 0.045376365249386111, 0.0,
+  -0.00029658140065333459, 0.0, -0.010771991438730609, 0.0,
+  -0.023445151283119827, 0.0, -0.0014912062914656003, 0.0,
+  0.033642202649315639, 0.0, -0.0202710262820767, 0.0,
+  -0.085934005235028574, 0.0, 0.37878990165914123, 0.0,
+  -0.27911192442479948, 0.0, -0.03119722013471431, 0.0,
+  0.038704414293208596, -0.0, -0.032041236071479379, -0.0,
+  -0.024579995310744538, -0.0, -0.0081241622383269301, -0.0,
+  -0.14471660320241114, -0.0, -0.13511361011938464, -0.0,
+  -0.14995915116711833, -0.0, -0.099285796293491602, -0.0,
+  0.02083371146583941, -0.0, -0.018968772236100849, -0.0,
+  0.017293512364680831, -0.0, -0.025840625767109909, -0.0,
+  0.00036467935931638304, -0.0, 0.0071351279062712505, -0.0,
+  0.01541412598675594, -0.0, -0.0042928194945043279, -0.0,
+  0.031235302634850259, -0.0, -0.10458100907656384, -0.0,
+  0.0848135488709372, -0.0, -0.12652286134027557, -0.0,
+  0.18053521963290198, -0.0, 0.0066264801994404959, -0.0,
+  -0.009662198321313948, -0.0, -0.0075915166415212922, -0.0,
+  -0.0036786396743455404, -0.0, 0.0066942938619869883, -0.0,
+  0.051161124423708348, -0.0, -0.01058691724408603, -0.0,
+  0.012463819648591222, -0.0, 0.004005784220264502, -0.0,
+  -0.01141638888176242, -0.0, -0.006768245208078799, -0.0,
+  -0.0027497493438796926, -0.0, -0.014845709100172926, -0.0,
+  -0.01688967774813048, -0.0, -0.043396707064595294, -0.0,
+  -0.018465823144782921, -0.0, -0.012982046075915202, -0.0,
+  -0.13747239229283914, -0.0, -0.0029371940541574808, -0.0,
+  0.0051448139746693893, -0.0, 0.41417162759932818, -0.0,
+  0.46102542272652225, -0.0, -0.068774812698474005, -0.0,
+  -0.034788230302701478, -0.0, 0.022064527370028213, -0.0,
+  -0.011229606782121539, -0.0, 0.0031817945079624039, -0.0,
+  -0.012727835713858531, -0.0, 0.093818751520002033, -0.0,
+  -0.033851986438910436, -0.0, 0.049242347714509228, -0.0,
+  -0.039773475556115656, -0.0, 0.043057602230362133, -0.0,
+  -0.059315615810885257, -0.0, -0.0021984177639287885, -0.0,
+  -0.023654640169895023, -0.0, 0.13638722845680837, -0.0,
+  -0.6152339470057111, -0.0, 0.36271989432508533, -0.0,
+  0.006923260061662698, -0.0, -0.51093477092175643, -0.0,
+  0.49339102628806297, -0.0, 0.25901502992612946, -0.0,
+  0.072192624319843857, -0.0, -0.048098895059836909, -0.0,
+  0.052585123989526444, -0.0, -0.02042854617430391, -0.0,
+  0.050987719490749657, -0.0, -0.2707271169145769, -0.0,
+  0.25952570926379109, -0.0, -0.082699925522748768, -0.0,
+  0.07992719843494181, -0.0, -0.0045673785161099746, -0.0,
+  0.032244746005912379, -0.0, -0.11334388216857924, -0.0,
+  0.053917996968018314, -0.0, -0.29634187939538925, -0.0,
+  0.061923157145513712, -0.0, -0.041062052587984538, -0.0,
+  0.08323888076408692, -0.0, -0.11209024608978251, -0.0,
+  -0.057144139198982306, -0.0, 0.062631171460226148, -0.0,
+  -0.051746310731909835, -0.0, 0.050588542565309251, -0.0,
+  -0.034878019256952678, -0.0, -0.013373082920604497, -0.0,
+  -0.0053923456288582448, -0.0, 0.0025127308314551408, -0.0,
+  0.001555218218628307, -0.0, -0.060909040684257384, -0.0,
+  0.063629915406400978, -0.0, -0.0047181470243626402, -0.0,
+  -0.069042228884098764, -0.0, 0.088682823781759818, -0.0,
+  -0.054537957675401476, -0.0, 0.030350140658665006, -0.0,
+  -0.088660693146556113, -0.0, 0.095495974583920604, -0.0,
+  -0.068868482434710471, -0.0, 0.06027035633783645, -0.0,
+  -0.063771516120844529, -0.0, 0.024308717374025436, -0.0,
+  0.025203691346425177, -0.0, 0.033477300298695688, -0.0,
+  -0.023935013407226976, -0.0, 0.022016365888246254, -0.0,
+  0.010064679567004355, -0.0, 0.013140973587590445, -0.0,
+  -0.090057463759702958, -0.0, 0.098127672153074955, -0.0,
+  -0.04238056513216306, -0.0, 0.052735364132729202, -0.0,
+  -0.091845704227426259, -0.0, 0.11290168222468168, -0.0,
+  -0.072456915858315513, -0.0, 0.066331318361382452, -0.0,
+  0.033288791263976346, -0.0, -0.26824610381084507, -0.0,
+  0.19455235611433794, -0.0, 0.021443424501341121, -0.0,
+  -0.43171714088450941, 0.0, 0.4216633437957133, 0.0,
+  -0.095067313819760454, 0.0, -0.031394284232762727, 0.0,
+  0.044736157253891892, 0.0, -0.076233179768101358, 0.0,
+  0.030491969582732745, 0.0, -0.084560170446361924, 0.0,
+  -0.15813159487790696, 0.0, 0.14716061745454606, 0.0,
+  0.079153045372760397, 0.0, -0.077248462594126252, 0.0,
+  -0.00050434900846712963, 0.0, -0.010468856920505762, 0.0,
+  0.058540425579252202, 0.0, -0.01256524058214447, 0.0,
+  0.11423805774537997, 0.0, -0.10503588198539855, 0.0,
+  0.069231373735520518, 0.0, -0.11652854230223701, 0.0,
+  0.16757348128465657, 0.0, 0.0019991051167072543, 0.0,
+  -0.0071297279949611219, 0.0, 0.094984356646125701, 0.0,
+  -0.090572761906433805, 0.0, 0.047779703147877668, 0.0,
+  0.037992086670035757, 0.0, 0.0096173517315101178, 0.0,
+  -0.0059003466855930206, 0.0, 0.059083304072777044, 0.0,
+  -0.19099655164678608, 0.0, 0.10284421922630592, 0.0,
+  0.0044077223832042645, 0.0, 0.10797641155792446, 0.0,
+  -0.16971967647833863, 0.0, 0.12195144062456494, 0.0,
+  -0.066144411438233269, 0.0, 0.086303844820766432, 0.0,
+  -0.10485074895994125, 0.0, 0.12216771417483951, 0.0,
+  -0.11387087388340744, 0.0, 0.11116823431754411, 0.0,
+  0.0010187685802599416, 0.0, -0.039263422224030571, 0.0,
+  -0.054951358294646181, 0.0, 0.16958561268430158, 0.0,
+  -0.13041535182177214, 0.0, 0.1016630873901645, 0.0,
+  -0.10886916714601209, 0.0, 0.18370932055218911, 0.0,
+  -0.20526171244478689, 0.0, 0.13232789859406521, 0.0,
+  -0.14493155210007355, 0.0, 0.12275628373874373, 0.0,
+  -0.14356687869833959, 0.0, 0.12988432857379187, 0.0,
+  -0.12652902381127365, 0.0, -0.043147295639332499, 0.0,
+  0.3235223553806606, 0.0, -0.22923604533001285, 0.0,
+  -0.030719697862554608, 0.0, -0.0033140427672106172, 0.0,
+  0.0045647660858429001, 0.0, 0.024608477863614964, 0.0,
+  -0.014375382566752942, 0.0, -0.23647075564223285, 0.0,
+  -0.49253858605664508, 0.0, 0.41045575075603102, 0.0,
+  0.34755862419382172, 0.0, -0.0039088881428790065, 0.0,
+  0.0041757150467618808, 0.0, -0.0012082892924336025, 0.0,
+  0.003113363788365671, 0.0, -0.00097328965889259241, 0.0,
+  -0.02161745906449113, 0.0, 0.033962219191462494, 0.0,
+  -0.01264798868523502, 0.0, -0.014659293669348301, 0.0,
+  0.011411816076337867, 0.0, 0.031899822881941563, 0.0,
+  -0.023318849341750113, 0.0, -0.021250276325107429, 0.0,
+  -0.002586716483211507, 0.0, 0.0054538569566469127, 0.0,
+  0.0039864618805390446, 0.0, -0.0080029813557076987, 0.0,
+  0.0065451373686532975, 0.0, -0.0010036183138312314, 0.0,
+  -0.011642477278771631, 0.0, 0.0011704485734950129, 0.0,
+  -0.060186005495995044, 0.0, 0.029606231017000804, 0.0,
+  0.047240396915899617, 0.0, -0.00062496045793869481, 0.0,
+  0.36970863109310709, 0.0, 0.16015760924502734, 0.0,
+  -0.2978198749774601, 0.0, -0.24813368272952904, 0.0,
+  0.0047450776663514379, 0.0, -0.0074200918911592724, 0.0,
+  -0.0045853311280502265, 0.0, -0.00076226877878235, 0.0,
+  -0.099924583594274946, 0.0, 0.11485474419031323, 0.0,
+  0.0049238627520643407, 0.0, -0.00033305921158347288, 0.0,
+  0.06090214678258854, 0.0, -0.14654086940422487, 0.0,
+  -0.087544688471743806, 0.0, 0.15249417532173093, 0.0,
+  0.12936825558552922, 0.0, -0.0080803226455739945, 0.0,
+  -0.15551221098142076, 0.0, 0.035554374554201407, 0.0,
+  -0.0013222452695013198, 0.0, -0.0028574821647252822, 0.0,
+  -0.0023667690260705926, 0.0, 0.0028536065100291112, 0.0,
+  0.0063038174373885054, 0.0, 0.015882197350122855, 0.0,
+  0.01494164130327643, 0.0, -0.04490988751561574, 0.0,
+  -0.0023414378254792119, -0.0, 0.0065757233885434278, -0.0,
+  0.055030805943747499, -0.0, -0.23301566335396454, -0.0,
+  -0.16137988847048976, -0.0, -0.22776353740976568, -0.0,
+  0.20153068487349432, -0.0, 0.20832692986905241, -0.0,
+  0.0023731520411493486, -0.0, -0.0005312564418449554, -0.0,
+  -0.00023094663843756114, -0.0, 0.0019643903289888495, -0.0,
+  -0.00027371336842909347, -0.0, 0.11927407476546319, -0.0,
+  -0.16913121265876027, -0.0, 0.035507721187566045, -0.0,
+  0.19274772501230372, -0.0, 0.021420432798464555, -0.0,
+  0.0087003367332899248, -0.0, -0.024987663242108351, -0.0,
+  -0.0067331184032860614, -0.0, 0.00094379296197275963, -0.0,
+  0.0045275670219660979, -0.0, -0.0094718016100469992, -0.0,
+  -0.0037610984508522349, -0.0, 0.019703409756807136, -0.0,
+  -0.0024422516923753839, -0.0, -0.023525289171555056, -0.0,
+  -0.0026085697860177954, -0.0, 0.010653789077288299, -0.0,
+  -0.0079171850538118753, -0.0, -0.015685522049987098, -0.0,
+  2.5723893456833343e-05, -0.0, -0.44511343279416721, -0.0,
+  -0.21946549275812793, -0.0, 0.29692482918352531, -0.0,
+  0.37376793937342417, -0.0, -0.0044131284513526546, -0.0,
+  0.0076388494378364967, -0.0, -0.0069222470701641881, -0.0,
+  -0.0023501760356770796, -0.0, 0.093959005194953399, -0.0,
+  -0.082798441442801171, -0.0, -0.0070870595780235931, -0.0,
+  0.0094945744914460995, -0.0, 0.03941586621278044, -0.0,
+  0.11532000926659489, -0.0, -0.017890900051269223, -0.0,
+  -0.12675732124581693, -0.0, 0.23589366832559414, -0.0,
+  0.25172775604675063, -0.0, -0.2592031541555565, -0.0,
+  -0.24494680498123175, -0.0, 0.0040894892386681521, -0.0,
+  0.011469604023666835, -0.0, -0.0044976488675745425, -0.0,
+  -0.014131289122810222, -0.0, -0.014876943329435025, -0.0,
+  0.042175357241989959, -0.0, 0.036247889853469127, -0.0,
+  -0.065176902033033085, -0.0, -0.015751846363898626, 0.0,
+  0.017986731930606563, 0.0, 0.18388067031166003, 0.0,
+  -0.63353648143106944, 0.0, 0.081451502769125883, 0.0,
+  0.061409206821223493, 0.0, -0.022020224948229652, 0.0,
+  -0.12314865261243362, 0.0, -0.0020390970568887612, 0.0,
+  0.0027910948657496955, 0.0, -0.00036584849062992156, 0.0,
+  0.0009218002807219669, 0.0, 0.0013027100308338998, 0.0,
+  0.30123314451816885, 0.0, -0.41685159056752707, 0.0,
+  0.090238141662809537, 0.0, 0.48190909894796291, 0.0,
+  -0.024771119860858826, 0.0, 0.0091919939780511113, 0.0,
+  0.017176251686953848, 0.0, -0.004884622296897366, 0.0,
+  -0.0035653141190648487, 0.0, 0.00014550782180292325, 0.0,
+  -0.0024373588252083775, 0.0, -0.00063606739993306738, 0.0,
+  -0.0062945403994694111, 0.0, -0.0025382359402942993, 0.0,
+  0.0042911916496174195, 0.0, -0.00081043989625083812, 0.0,
+  -0.056831062835449329, 0.0, 0.039789437900583001, 0.0,
+  0.008021780150403628, 0.0, 0.015381568548445856, 0.0,
+  0.12062272857089869, 0.0, 0.05143359793554475, 0.0,
+  -0.081225039155241235, 0.0, -0.094621559815755416, 0.0,
+  0.018315670691856963, 0.0, -0.015777329696015249, 0.0,
+  0.0013348121443011432, 0.0, 0.0017789454477511644, 0.0,
+  -0.13944280732640688, 0.0, 0.14268072183456157, 0.0,
+  9.3600569943181542e-05, 0.0, 0.0040874754809466073, 0.0,
+  0.031858437498576538, 0.0, -0.0077452172132923451, 0.0,
+  -0.047870297387877916, 0.0, 0.016596353040956906, 0.0,
+  0.0011092445913770807, 0.0, -0.049625764383772628, 0.0,
+  -0.015131892508870405, 0.0, 0.061246851953291832, 0.0,
+  0.0025390781518179954, 0.0, -0.0068720849964246941, 0.0,
+  0.0034749990991507431, 0.0, -0.00084488622275916332, 0.0,
+  0.029028708712854324, 0.0, -0.072610551403855389, 0.0,
+  -0.08213470323981982, 0.0, 0.12706157679564864, 0.0,
+  0.0037265181110908681, 0.0, -0.0033297302411072218, 0.0,
+  -0.069842709712061635, 0.0, 0.19036770705648326, 0.0,
+  0.031252817061326529, 0.0, -0.10531783219263383, 0.0,
+  0.16111937799514497, 0.0, -0.10101486395710371, 0.0,
+  0.0021793399993005318, 0.0, -0.0014115505742392453, 0.0,
+  0.0039689868351329375, 0.0, -0.0041301816555131717, 0.0,
+  -0.0014197810515986949, 0.0, -0.071156819673093966, 0.0,
+  0.10159720489632187, 0.0, -0.025093369156503818, 0.0,
+  -0.13074732231713437, 0.0, 0.020943818342870211, 0.0,
+  -0.0086861205935905104, 0.0, -0.02072025233914504, 0.0,
+  0.0078984763884002579, 0.0, 0.005343527538282794, 0.0,
+  -0.0034542986445983744, 0.0, -0.0010229706978684716, 0.0,
+  -0.0055953801617459418, 0.0, -0.037238568363969347, 0.0,
+  0.025306475730879911, 0.0, 0.027549728201466679, 0.0,
+  -0.0089811920844025048, 0.0, 0.031101047789311109, 0.0,
+  -0.018202507507074969, 0.0, -0.011680219735323299, 0.0,
+  -0.0074488186729387449, 0.0, -0.11539648546844096, 0.0,
+  -0.052244934782967156, 0.0, 0.10366547127922786, 0.0,
+  0.055897589437916596, 0.0, 0.051470159046959771, 0.0,
+  -0.036831774802941655, 0.0, 0.00011666125188493605, 0.0,
+  -0.0022018193846266654, 0.0, -0.24415331003411231, 0.0,
+  0.27383385436209623, 0.0, 0.050427802037378691, 0.0,
+  -0.061526317965140138, 0.0, -0.022471966884822187, 0.0,
+  0.012911165300919691, 0.0, 0.034027913156174511, 0.0,
+  -0.019666692330890113, 0.0, 0.026482785559815182, 0.0,
+  0.14110696930855485, 0.0, -0.038586950025980594, 0.0,
+  -0.12538637883538026, 0.0, 0.0073295585372152409, 0.0,
+  -0.003644599140120977, 0.0, 0.016852463831388272, 0.0,
+  -0.030495747423477968, 0.0, 0.15539233199215452, 0.0,
+  -0.34165060509391393, 0.0, -0.44548242737996269, 0.0,
+  0.63436474783672681, 0.0, -1.2044111278392012e-05, -0.0,
+  0.001031813537761343, -0.0, -0.11790228673998444, -0.0,
+  0.14398521700114528, -0.0, 0.035473429830457121, -0.0,
+  -0.036401818830538203, -0.0, 0.23698349259306103, -0.0,
+  -0.26013457048968508, -0.0, 0.0029634087857368457, -0.0,
+  -0.0021349401209290542, -0.0, 0.0086619360139755519, -0.0,
+  -0.0079753288306377412, -0.0, 0.00077497771762336475, -0.0,
+  0.056039625800543114, -0.0, -0.065114572790202982, -0.0,
+  -0.0064821346921745751, -0.0, -0.021935221618694177, -0.0,
+  0.12552513764676743, -0.0, -0.093999480174420072, -0.0,
+  -0.11108911388187148, -0.0, 0.076927592943234646, -0.0,
+  0.010818322247654322, -0.0, -0.011458709944243847, -0.0,
+  -0.025982718754296665, -0.0, 0.014736464461242434, -0.0,
+  0.027851164786489212, -0.0, -0.096848544970247197, -0.0,
+  0.052728558130630709, -0.0, 0.038550062537318429, -0.0,
+  0.031701880114701264, -0.0, -0.016794575506815464, -0.0,
+  -0.016667314987104435, -0.0, 0.00048411624168547826, -0.0,
+  -0.11429204112791452, -0.0, -0.02405687673822467, -0.0,
+  0.13589325815640199, -0.0, -0.015084415934405113, -0.0,
+  0.10513190007196827, -0.0, -0.091070742571032301, -0.0,
+  0.009252452280491149, -0.0, -0.012144821719654539, -0.0,
+  -0.45321546132501694, -0.0, 0.50850854253285027, -0.0,
+  -0.11194000897296813, -0.0, 0.087279744154362293, -0.0,
+  -0.035534589100634451, -0.0, 0.060066601993213349, -0.0,
+  0.03891924384513968, -0.0, -0.049871277610005968, -0.0,
+  -0.12772514453302114, -0.0, 0.12276692941769211, -0.0,
+  0.11910977893412857, -0.0, -0.10748217677520747, -0.0,
+  0.029442350255649542, -0.0, -0.031337249286297289, -0.0,
+  -0.024445945220877844, -0.0, 0.020451708640210193, -0.0,
+  -0.035479637335956979, -0.0, 0.15427944702340482, -0.0,
+  0.2462314374389106, -0.0, -0.37795683044010941, -0.0,
+  0.0015766383988552, 0.0, -0.0071024360754435439, 0.0,
+  0.14160496124218347, 0.0, -0.09870661204961062, 0.0,
+  0.081408469882748649, 0.0, 0.11074197797066025, 0.0,
+  -0.11282755097768159, 0.0, -0.080921339462775854, 0.0,
+  0.00027887414740363544, 0.0, 0.0028356042040453559, 0.0,
+  -0.0031042906551233583, 0.0, 0.00046097706791653665, 0.0,
+  -0.00096478353580787071, 0.0, -0.15964387904711252, 0.0,
+  0.16033629758841705, 0.0, -0.0016639045943465109, 0.0,
+  -0.02454203984099115, 0.0, -0.043833567893154894, 0.0,
+  -0.012804739029770189, 0.0, 0.04594757062857259, 0.0,
+  0.0077027192019700165, 0.0, 0.0023360609108391129, 0.0,
+  -0.0070226142137548046, 0.0, -0.029655547624764918, 0.0,
+  -0.0027655561967768237, 0.0, -0.20926278626875752, 0.0,
+  -0.27923461994366505, 0.0, 0.42359683940485887, 0.0,
+  0.30324577816856541, 0.0, 0.0014284225815996826, 0.0,
+  0.0353150254340888, 0.0, -0.022818842419237342, 0.0,
+  0.0054579119729900273, 0.0, 0.10019481688991272, 0.0,
+  -0.00024206788555686877, 0.0, -0.071963679938855191, 0.0,
+  -0.013536923631863984, 0.0, 0.00022454753929853681, 0.0,
+  0.0043982760120597963, 0.0, -0.0088680907125619751, 0.0,
+  0.035447325378306908, 0.0, -0.0084438276399539224, 0.0,
+  -0.024066149703438212, 0.0, -0.089148440998647466, 0.0,
+  -0.12237479533554352, 0.0, -0.05823265323902789, 0.0,
+  -0.32887233372159375, 0.0, 0.064635687722371354, 0.0,
+  0.29337446129798161, 0.0, 0.39532589565110726, 0.0,
+  0.4011983819695249, 0.0, -0.44183828169762585, 0.0,
+  -0.36461862198284517, 0.0, -0.0090837603953750744, 0.0,
+  0.010261955040839498, 0.0, 0.029813109762804452, 0.0,
+  -0.026574591270540106, 0.0, -0.046574614602755013, 0.0,
+  0.026019029809118105, 0.0, 0.071212320026216899, 0.0,
+  -0.045065993320296642, 0.0, -0.0078613082126354171, -0.0,
+  0.014098490389711994, -0.0, -0.28406828055543443, -0.0,
+  0.24079075817327786, -0.0, -0.042545682059994872, -0.0,
+  -0.050806830554710893, -0.0, 0.043287853632304162, -0.0,
+  0.049189511645405845, -0.0, 0.0025462687981601746, -0.0,
+  0.0004842020465321825, -0.0, 0.0018781387620540992, -0.0,
+  -3.9108683293109355e-05, -0.0, -0.00077839452352679794, -0.0,
+  0.29346808780871247, -0.0, -0.33895762115903205, -0.0,
+  0.013522458197674888, -0.0, 0.036765368403759144, -0.0,
+  0.017575665862474051, -0.0, 0.0039685794920118816, -0.0,
+  -0.020566009171859769, -0.0, -0.0042299780645232527, -0.0,
+  0.012913264542676084, -0.0, -0.012622504863096514, -0.0,
+  -0.025142229484530917, -0.0, -0.0015853036727949046, -0.0,
+  -0.31834307182503346, -0.0, 0.11202968236953158, -0.0,
+  0.20281618607705704, -0.0, 0.096081863336739431, -0.0,
+  -0.095800289427115298, -0.0, 0.026634619553785335, -0.0,
+  0.079946822867862713, -0.0, -0.0013071668380446027, -0.0,
+  -0.017065525991864647, -0.0, -0.0049961897242236384, -0.0,
+  0.012755199659270874, -0.0, 0.00020801967001564416, -0.0,
+  0.0092016902969480115, -0.0, -0.0020964821446706793, -0.0,
+  -0.16594151676085309, -0.0, 0.17814884638042089, -0.0,
+  0.027076564612157038, -0.0, -0.006653312209701427, -0.0,
+  0.4013513142257899, -0.0, -0.48493692042333686, -0.0,
+  0.070488021248642507, -0.0, 0.26199757466094692, -0.0,
+  -0.079045275768568582, -0.0, -0.23351111998320184, -0.0,
+  -0.11186123213046051, -0.0, -0.19522543717231003, -0.0,
+  0.13623753532149688, -0.0, 0.16354279412625861, -0.0,
+  0.0057455102560039243, -0.0, -0.0064161281000769226, -0.0,
+  -0.0076813960256483542, -0.0, 0.0081009843139504389, -0.0,
+  -0.0092642911036430672, -0.0, 0.043354636602462887, -0.0,
+  0.043746322530963805, -0.0, -0.080604229230872765, -0.0,
+  0.010163211823870614, 0.0, -0.015488993456907726, 0.0,
+  0.35984753154236809, 0.0, -0.36470625414973418, 0.0,
+  -0.0067238538299715976, 0.0, 0.020291514005879724, 0.0,
+  0.030576868237790506, 0.0, -0.047794935612741854, 0.0,
+  -0.00059416926059431942, 0.0, -0.0013241944965762349, 0.0,
+  0.0038259793753004905, 0.0, -0.0034068321779204564, 0.0,
+  0.0036176858523497019, 0.0, -0.32571437281552112, 0.0,
+  0.38498801981444697, 0.0, -0.0046611624731429362, 0.0,
+  -0.0078561991269052306, 0.0, 0.14823916492407505, 0.0,
+  -0.093299159810976598, 0.0, -0.1186390878282004, 0.0,
+  0.064372910611892334, 0.0, 0.021520025829700813, 0.0,
+  -0.020659354796240207, 0.0, 0.013067072004570524, 0.0,
+  0.0023622933456982848, 0.0, -0.091469951706303079, 0.0,
+  0.28621296006973712, 0.0, -0.13392228379170154, 0.0,
+  -0.16816727008050708, 0.0, 0.18026586047311147, 0.0,
+  -0.070421835428973581, 0.0, -0.14153228293278447, 0.0,
+  0.014402994265624115, 0.0, -0.059260925433553283, 0.0,
+  -0.0016052765735037125, 0.0, 0.055688451834361372, 0.0,
+  -0.0012477889228313785, 0.0, 0.022310362229381823, 0.0,
+  -0.024151391187723522, 0.0, -0.13217354723771271, 0.0,
+  0.12561522954491219, 0.0, -0.070776031335094955, 0.0,
+  0.083773940442661565, 0.0, 0.35805774901159332, 0.0,
+  -0.26536379864375603, 0.0, -0.098610104133712587, 0.0,
+  -0.22587216379836295, 0.0, 0.10467448330178203, 0.0,
+  0.2105579818091376, 0.0, -0.052673949520084057, 0.0,
+  0.06446366359662771, 0.0, 0.057207976188463017, 0.0,
+  -0.079097501193962208, 0.0, 0.017085670360989107, 0.0,
+  -0.0242153697292752, 0.0, -0.030868572403517574, 0.0,
+  0.042802733775219648, 0.0, -0.013649791291013184, 0.0,
+  0.0485385287334082, 0.0, 0.07069317769107486, 0.0,
+  -0.10927563551622424, 0.0, 0.0091291182762887058, 0.0,
+  -0.011750667007450791, 0.0, 0.29379589924525706, 0.0,
+  -0.28919469736433673, 0.0, -0.04683657819968233, 0.0,
+  -0.095456850240767249, 0.0, 0.058374288571749061, 0.0,
+  0.085389147416801592, 0.0, -0.00051432166927648946, 0.0,
+  0.00079938158287360414, 0.0, 0.0017628456483265414, 0.0,
+  -0.00041895575113643077, 0.0, -0.0023250066802552507, 0.0,
+  -0.28292887083759666, 0.0, 0.29906363808790326, 0.0,
+  -0.0037037033565025346, 0.0, 0.010093007070708038, 0.0,
+  0.12689176966982871, 0.0, -0.057296194581355563, 0.0,
+  -0.10861380086806657, 0.0, 0.036657007961936203, 0.0,
+  -7.6022184870842311e-06, 0.0, 0.0018729355955017235, 0.0,
+  -0.027304073986142641, 0.0, -0.0095868145585703852, 0.0,
+  -0.025944892658230474, 0.0, -0.23489983163807246, 0.0,
+  0.19524366071212496, 0.0, 0.19615178506059933, 0.0,
+  0.13248853089762483, 0.0, -0.15179535443326178, 0.0,
+  -0.02992712056878493, 0.0, 0.009757007329692511, 0.0,
+  -0.057308362764877219, 0.0, -0.026957737795155076, 0.0,
+  0.036175300864620355, 0.0, 0.039210033267396416, 0.0,
+  -0.0034016874998015782, 0.0, 0.012597474189867957, 0.0,
+  0.0068002223744896752, 0.0, -0.004768233274323931, 0.0,
+  0.032690377415371584, 0.0, -0.0066333979386990856, 0.0,
+  -0.1489669094934267, 0.0, 0.026923426934527941, 0.0,
+  0.098818888637113939, 0.0, 0.38446495762014349, 0.0,
+  -0.12555560547547176, 0.0, -0.32109522206197527, 0.0,
+  -0.232691421847493, 0.0, -0.3570837060305212, 0.0,
+  0.27849880883462635, 0.0, 0.30032198873053906, 0.0,
+  -0.008334791659544186, 0.0, 0.017507312305610295, 0.0,
+  0.017407501113402297, 0.0, -0.033758459757591855, 0.0,
+  0.035506747932836071, 0.0, -0.025897404557463272, 0.0,
+  -0.059563138331169781, 0.0, 0.046128351757731424, 0.0,
+  -0.011133553213540434, 0.0, 0.0094879447291343136, 0.0,
+  -0.082335722539745818, 0.0, 0.082355656519841877, 0.0,
+  0.053884769021696095, 0.0, 0.030236057753733413, 0.0,
+  -0.14021637972092901, 0.0, 0.06389294018449021, 0.0,
+  -0.0071315034053258449, 0.0, 0.0054595247282857593, 0.0,
+  -0.0052949198824460871, 0.0, 0.0041500385153849587, 0.0,
+  -0.001057419791742251, 0.0, 0.10629180510722464, 0.0,
+  -0.1325630050165639, 0.0, -0.003324353449383408, 0.0,
+  0.017849481685718368, 0.0, 0.59481708205497985, 0.0,
+  -0.39842361300517826, 0.0, -0.47656904303997627, 0.0,
+  0.28051541450369233, 0.0, -0.019302471084530353, 0.0,
+  0.017089882442449616, 0.0, 0.021771357357580415, 0.0,
+  -0.0072276351686236268, 0.0, 0.0099983450087544699, 0.0,
+  0.0068263384688955053, 0.0, -0.019852185216571228, 0.0,
+  -0.0057570439256006464, 0.0, -0.14580111744470381, 0.0,
+  0.082042095175683283, 0.0, 0.090856409360340229, 0.0,
+  -0.0070878495310148374, 0.0, 0.081965859217831949, 0.0,
+  0.0071159295384017121, 0.0, -0.067843150752812012, 0.0,
+  -0.013052840148975117, 0.0, -0.05955617061528045, 0.0,
+  0.043984994215791107, 0.0, 0.070470101284072259, 0.0,
+  -0.058583805982994765, 0.0, 0.072102172687052254, 0.0,
+  -0.099946673332727304, 0.0, -0.028394549831402081, 0.0,
+  0.043012692591316688, 0.0, 0.026674573346670779, 0.0,
+  -0.030226070623011452, 0.0, -0.030687079822989637, 0.0,
+  0.018758688859832139, 0.0, 0.13392869542895697, 0.0,
+  0.027258307555893164, 0.0, -0.15113070984152183, 0.0,
+  -0.013091228789495014, 0.0, -0.03386677380425053, 0.0,
+  0.029840925997875269, 0.0, 0.062302649322378202, 0.0,
+  -0.053134737662147949, 0.0, -0.024682668550203641, 0.0,
+  -0.027064534509941483, 0.0, -0.025608837250178949, 0.0,
+  0.085006914289845442, 0.0, 0.0040309340905350091, 0.0,
+  -0.016331635277186087, 0.0, 0.079003432950794927, 0.0,
+  0.030971008161737087, 0.0, 0.0068674958843661709, 0.0,
+  0.097882899958862846, 0.0, -0.0681131528210904, 0.0,
+  -0.032697316299151909, 0.0, -0.0016152985060488886, 0.0,
+  -0.0057574306541166827, 0.0, 0.0017965836156541223, 0.0,
+  -0.0079139646762815697, 0.0, 0.0032351433239570164, 0.0,
+  -0.17806523190027876, 0.0, 0.042446169639967543, 0.0,
+  -0.012570929402641937, 0.0, 0.062385092168689399, 0.0,
+  -0.060164314978576237, 0.0, -0.061072368814629199, 0.0,
+  0.074695950694854629, 0.0, 0.048048725880030174, 0.0,
+  0.014662753318721364, 0.0, -0.02097595958481378, 0.0,
+  0.0074100918007999304, 0.0, 0.027283503124956594, 0.0,
+  -0.00056307062320454866, 0.0, 0.096255850660536865, 0.0,
+  -0.060479238900523029, 0.0, -0.092533520025381177, 0.0,
+  0.053705298060548551, 0.0, -0.19644383212073671, 0.0,
+  0.096745015876310778, 0.0, 0.017600245698756702, 0.0,
+  0.16456723278202437, 0.0, 0.044196813629858493, 0.0,
+  -0.029988597280468252, 0.0, -0.18782533311830515, 0.0,
+  -0.00036558042157451912, 0.0, -0.010615485510261013, 0.0,
+  -0.011546493368999187, 0.0, 0.018888892500721201, 0.0,
+  -0.052407040976137048, 0.0, 0.017136646996748849, 0.0,
+  0.056088896144939754, 0.0, -0.0029360819989679584, 0.0,
+  0.11728763456271576, 0.0, 0.58501357290800693, 0.0,
+  -0.2297507457885852, 0.0, -0.41562174248608769, 0.0,
+  0.22436295155994485, 0.0, 0.29628324175969434, 0.0,
+  -0.2136760192732432, 0.0, -0.33400329690256453, 0.0,
+  0.008585065087853316, 0.0, -0.017425670489551973, 0.0,
+  -0.019396410147878938, 0.0, 0.038344169727960592, 0.0,
+  -0.036563069946104094, 0.0, 0.010388456479589629, 0.0,
+  0.047128577083889893, 0.0, -0.015879513840635458, 0.0,
+  -0.032275138979371475, -0.0, 0.026624282725019745, -0.0,
+  0.22588473462661443, -0.0, 0.046269973619798642, -0.0,
+  0.020906024484183532, -0.0, -0.039184464361710816, -0.0,
+  0.02299698967484291, -0.0, -0.04875599083530667, -0.0,
+  0.022752680961903856, -0.0, -0.02498355050983549, -0.0,
+  -0.31267646782085956, -0.0, 0.29542010219134512, -0.0,
+  0.0031329928783454084, -0.0, 0.034119999668275336, -0.0,
+  -0.084130281376282076, -0.0, 0.041349354114843487, -0.0,
+  -0.28002029398501554, -0.0, -0.049132456881251271, -0.0,
+  0.032180003207484209, -0.0, -0.048212441716616754, -0.0,
+  0.073943491448125079, -0.0, 0.054624239035948825, -0.0,
+  -0.057406630182666202, -0.0, 0.19785121638284484, -0.0,
+  -0.19367729550719637, -0.0, 0.08777878112800222, -0.0,
+  0.026484500278157509, -0.0, 0.025810778121136919, -0.0,
+  -0.028539047405752357, -0.0, -0.14821807161079384, -0.0,
+  0.34384722385263389, -0.0, -0.18898087669686231, -0.0,
+  0.01968045640349041, -0.0, 0.017433213631948087, -0.0,
+  -0.018191353995970726, -0.0, 0.02453187411405448, -0.0,
+  -0.022391694019981697, -0.0, 0.20631002466815698, -0.0,
+  -0.21107408013380746, -0.0, 0.26031701209857883, -0.0,
+  -0.24655888668050283, -0.0, 0.074610430513223289, -0.0,
+  -0.012736839408742465, -0.0, -0.031106884163238473, -0.0,
+  -0.091533192721072604, -0.0, -0.23463062821393227, -0.0,
+  0.20706621762349353, -0.0, -0.13172738048030466, -0.0,
+  0.13933847919927428, -0.0, -0.049226242324793008, -0.0,
+  0.089917065531390505, -0.0, -0.02182514875267073, -0.0,
+  0.023358770788812579, -0.0, 0.34225831696920195, -0.0,
+  -0.37676983542564313, -0.0, 0.2491973424503566, -0.0,
+  -0.26173188020337967, -0.0, -0.0028629794892587662, -0.0,
+  0.12460205946459392, -0.0, -0.088028105736614987, -0.0,
+  -0.024010492236648764, -0.0, 0.10604468584959531, 0.0,
+  -0.093738441762724403, 0.0, -0.30634565622355431, 0.0,
+  -0.080623004686170952, 0.0, -0.019949492026343784, 0.0,
+  0.02442494789572627, 0.0, -0.0085991033672213613, 0.0,
+  0.025551047518399091, 0.0, 0.022922599768389503, 0.0,
+  -0.020363884600163366, 0.0, -0.45320086970567475, 0.0,
+  0.43267754463377706, 0.0, -8.9376051853321312e-05, 0.0,
+  -0.053353225864593769, 0.0, 0.12566442332396136, 0.0,
+  -0.051462794311683428, 0.0, 0.37921179168813079, 0.0,
+  0.0019683237952268728, 0.0, -0.0081150045543169399, 0.0,
+  0.0080003513843562753, 0.0, -0.0064946199411977041, 0.0,
+  -0.018349718507559412, 0.0, 0.020689640476899515, 0.0,
+  -0.046203405886728846, 0.0, 0.038696457440107461, 0.0,
+  -0.028866913204323535, 0.0, 0.0028869541760293753, 0.0,
+  -0.0073131530765576875, 0.0, 0.011264165071818828, 0.0,
+  0.18225014900537445, 0.0, -0.51643732957073907, 0.0,
+  0.32169746888554279, 0.0, -0.014567957542226595, 0.0,
+  0.027692769236504575, 0.0, -0.068828134177520858, 0.0,
+  0.048073833240713508, 0.0, -0.016358805961856918, 0.0,
+  -0.054918710573802147, 0.0, 0.051714860436379392, 0.0,
+  -0.036642255149184177, 0.0, 0.027311379381451874, 0.0,
+  -0.02255818164127146, 0.0, 0.027160976379587753, 0.0,
+  0.00669604317443409, 0.0, 0.016818595702374834, 0.0,
+  0.26806649910721964, 0.0, -0.24681036146517574, 0.0,
+  0.18374127274873486, 0.0, -0.16651258387678392, 0.0,
+  -0.012876062797652049, 0.0, -0.019483337770136458, 0.0,
+  0.0096380944655847598, 0.0, 0.0073274391086827545, 0.0,
+  -0.080119247251346865, 0.0, 0.09108104654872215, 0.0,
+  -0.041462300162226781, 0.0, 0.035837340522522305, 0.0,
+  -0.0087315358148645529, 0.0, -0.045374590679727558, 0.0,
+  0.039751219439430018, 0.0, 0.0098881377995071098, 0.0,
+  -0.053052678356980951, 0.0, 0.053640434758402022, 0.0,
+  -0.072888351703978782, 0.0, -0.021715018776776056, 0.0,
+  -0.061460329567617496, 0.0, 0.061011971588084753, 0.0,
+  -0.049636337957769019, 0.0, 0.079785086724118173, 0.0,
+  0.058624775141409048, 0.0, -0.059257513561475864, 0.0,
+  0.10647245387285424, 0.0, -0.099999786063054277, 0.0,
+  -0.0014882780113595444, 0.0, -0.038601730962247068, 0.0,
+  0.01320506060692082, 0.0, -0.013330053519070333, 0.0,
+  0.11604429969665962, 0.0, 0.017613314027693026, 0.0,
+  -0.024231061799908037, 0.0, 0.028721002459980802, 0.0,
+  -0.030548300399371009, 0.0, 0.048046283584141092, 0.0,
+  -0.050274911438912322, 0.0, 0.066035078559433871, 0.0,
+  -0.080465723860400601, 0.0, 0.035728651730022237, 0.0,
+  -0.01183146346762848, 0.0, 0.012009477824679721, 0.0,
+  -0.01099750790064284, 0.0, 0.089186684980865585, 0.0,
+  -0.27879658319750322, 0.0, 0.20803564267494076, 0.0,
+  -0.004757631240406535, 0.0, -0.042924465796687718, 0.0,
+  0.049056340101258561, 0.0, -0.040162594192737593, 0.0,
+  0.025097069922722037, 0.0, 0.17963610783617293, 0.0,
+  -0.15649411107785829, 0.0, 0.15297447508148757, 0.0,
+  -0.14985100087254538, 0.0, -0.024969834567137011, 0.0,
+  -0.00090488691064841435, 0.0, -0.0019592577735203865, 0.0,
+  -0.043927953774002583, 0.0, 0.035622599848864997, 0.0,
+  -0.066585441981771493, 0.0, 0.048230103069818592, 0.0,
+  -0.023344425431987059, 0.0, -0.40554477982905368, 0.0,
+  0.45212003148468566, 0.0, -0.28643526995259666, 0.0,
+  0.33107960644650358, 0.0, 0.31064564166017572, 0.0,
+  -0.34155786096709162, 0.0, 0.11896338183209292, 0.0,
+  -0.1435889835248253, 0.0, -0.0063432316844484844, 0.0,
+  -0.066773680988730669, 0.0, 0.05597325097957534, 0.0,
+  0.011142214617180452, 0.0, 0.020929116085471652, 0.0,
+  -0.01973228114951479, 0.0, 0.027535888324666562, 0.0,
+  0.031890174030416475, 0.0, 0.053967049861851038, 0.0,
+  -0.037490352114604941, 0.0, 0.0069621813617918677, 0.0,
+  -0.020462788832516607, 0.0, -0.067133867635784897, 0.0,
+  0.066632964043455284, 0.0, -0.01887061458227975, 0.0,
+  0.018490793276821644, 0.0, -0.0037164323345665285, 0.0,
+  -0.0043564723827076973, 0.0, -0.041490794554819639, 0.0,
+  -0.00026521776459913411, 0.0, -0.01448585983105424, 0.0,
+  0.028460661946915169, 0.0, -0.014145016138965946, 0.0,
+  -0.011136434355916327, 0.0, 0.0018772043910235149, 0.0,
+  -0.014918638382351801, 0.0, 0.018037446911169694, 0.0,
+  -0.25508332555214924, 0.0, 0.26322397205470882, 0.0,
+  -0.15222266236614995, 0.0, 0.03188189101472759, 0.0,
+  -0.050406875800693515, 0.0, 0.086909497285915016, 0.0,
+  0.027179564352558225, 0.0, 0.0052543395410397393, 0.0,
+  -0.023713584267957818, 0.0, -0.017079541695859079, 0.0,
+  0.05139331324837048, 0.0, -0.07439043846878117, 0.0,
+  0.022910849529422475, 0.0, 0.0036634371708186993, 0.0,
+  0.19875620174006892, 0.0, -0.15547058753386658, 0.0,
+  -0.51140536375763446, 0.0, 0.4273316517640191, 0.0,
+  0.051932144557616411, 0.0, -0.05523661536453349, 0.0,
+  -0.0057404760164043549, 0.0, 0.15467925070492911, 0.0,
+  9.7962127748028364e-05, 0.0, -0.012488775063985184, 0.0,
+  -0.015890714904193866, 0.0, 0.02213237863252945, 0.0,
+  0.036172997331511698, 0.0, -0.038227378581669663, 0.0,
+  -0.011089506805582811, 0.0, 0.010096461545703549, 0.0,
+  0.46074182208317893, 0.0, -0.50309540838818312, 0.0,
+  -0.14088736887628248, 0.0, 0.1587858104033644, 0.0,
+  0.045156495120875703, 0.0, 0.030314375930381336, 0.0,
+  -0.07406175379311096, 0.0, 0.001297250923649848, 0.0,
+  -0.35146617195621288, 0.0, 0.3446403308442777, 0.0,
+  0.042118586166482237, 0.0, 0.018685161032601913, 0.0,
+  0.016083754359918288, 0.0, -0.015084464043241298, 0.0,
+  0.0042034136176422512, 0.0, -0.0085263122421615368, 0.0,
+  0.5901681873299196, 0.0, -0.56804216841090338, 0.0,
+  -0.023091064022946601, 0.0, 0.021692288937852584, 0.0,
+  -0.00047414877648956907, 0.0, -0.0066043814687080597, 0.0,
+  -0.022171958582029649, 0.0, 0.004983008043450904, 0.0,
+  -0.03542186336541038, 0.0, 0.009940403070851549, 0.0,
+  -0.0072267969922358375, 0.0, -0.0020905605286240751, 0.0,
+  -0.0013414921640296062, 0.0, 0.11539073001423729, 0.0,
+  -0.11766459863678001, 0.0, -0.061133206196139114, 0.0,
+  0.059029417384527161, 0.0, -0.008949764498186203, 0.0,
+  -0.00254731201268931, 0.0, -0.0088052316743910501, 0.0,
+  0.013801634457277071, 0.0, -0.0086324751055777468, 0.0,
+  0.01743147910821231, 0.0, -0.0062408843278641581, 0.0,
+  -0.005879600933829097, 0.0, 0.027258310898192376, 0.0,
+  -0.042422480092461974, 0.0, 0.022075897825050469, 0.0,
+  -0.006169064799883381, 0.0, 0.040812317682528541, 0.0,
+  -0.031134538904291569, 0.0, -0.1268878110748477, 0.0,
+  0.10867379413540211, 0.0, 0.015541903630147631, 0.0,
+  -0.014629510729814856, 0.0, -0.011378914766472429, 0.0,
+  0.022599397569115203, 0.0, -0.0016337467681292411, 0.0,
+  -0.0038887833204369194, 0.0, -0.0047133502221619753, 0.0,
+  0.0093562900309404635, 0.0, 0.0048181529697417071, 0.0,
+  -0.0095406300860993234, 0.0, -0.003544225855281078, 0.0,
+  0.0052695744181128819, 0.0, -0.098552147908793894, 0.0,
+  0.10035684310788527, 0.0, -0.11817075464111607, 0.0,
+  0.12115658738495061, 0.0, 0.009516703620696414, 0.0,
+  -0.0091209301949868038, 0.0, -0.0058542980227035057, 0.0,
+  0.0034314756859154822, 0.0, 0.041373162933601312, 0.0,
+  -0.037104511721487876, 0.0, 0.049481098966200572, 0.0,
+  0.026999135235838197, 0.0, 0.099956887107301468, 0.0,
+  -0.12212052514447277, 0.0, 0.093091485719700565, 0.0,
+  -0.11403570680264916, 0.0, -0.095527778089185167, 0.0,
+  0.091932816864434247, 0.0, -0.0023702017792794419, 0.0,
+  0.0030822761651170716, 0.0, -0.0022506610940522969, 0.0,
+  -0.066323561070213977, 0.0, -0.067452427139909996, 0.0,
+  0.001756413405823223, 0.0, 0.036062081536935006, 0.0,
+  -0.0037281876585230946, 0.0, -0.023005488215435535, 0.0,
+  0.0096055419625577405, 0.0, 0.0090723964577033439, 0.0,
+  -0.0010657751829019149, 0.0, 0.0018535641146435549, 0.0,
+  -0.044093243196908223, 0.0, 0.030537050019837902, 0.0,
+  -0.020741454715219869, 0.0, 0.017003516259072645, 0.0,
+  -0.0085742828835227314, 0.0, 0.017067284794276012, 0.0,
+  -0.044730509428404765, 0.0, 0.058831873757167912, 0.0,
+  0.0061266416197158467, 0.0, -0.0080771567660138065, 0.0,
+  0.27999152373401182, 0.0, -0.50860708933971455, 0.0,
+  0.36098551070282481, 0.0, -0.14307174235805051, 0.0,
+  0.090290395110359842, 0.0, -0.081032507572427859, 0.0,
+  -0.0082325579408812771, 0.0, -0.0067855991120338854, 0.0,
+  0.1386751740363176, 0.0, -0.07817517016967529, 0.0,
+  -0.010562775636020105, 0.0, 0.0021528765089280158, 0.0,
+  -0.11653771855935147, 0.0, 0.034462581696062256, 0.0,
+  -0.030661156054554745, 0.0, 0.097890417640642449, 0.0,
+  -0.2574589329538628, 0.0, 0.26377817766985845, 0.0,
+  -0.16503714348569268, 0.0, 0.22142646395051785, 0.0,
+  -0.30344220819130924, 0.0, 0.31704449494686882, 0.0,
+  -0.17444262204399077, 0.0, 0.15667317505928646, 0.0,
+  -0.012738490587700923, 0.0, -0.035197221090094835, 0.0,
+  0.029268501241887564, 0.0, 0.0067118867660497065, 0.0,
+  -0.016717547325573366, 0.0, 4.548847997421224e-05, 0.0,
+  -0.14811065073189916, 0.0, -0.16966767060124646, 0.0,
+  0.0074808862392038711, 0.0, 0.02876643924801053, 0.0,
+  -0.026687148595245701, 0.0, 0.011461397794965859, 0.0,
+  -0.03488639860044071, 0.0, 0.032099421629968088, 0.0,
+  -0.015389347938629708, 0.0, 0.010253379671383716, 0.0,
+  0.0059472138464174351, 0.0, 0.45183706272529051, 0.0,
+  0.32244018253491014, 0.0, 0.014148531606342224, 0.0,
+  -0.4207030514871557, 0.0, 0.028888969204422878, 0.0,
+  0.033135549853474722, 0.0, -0.042368629506391808, 0.0,
+  -0.023247333133719773, 0.0, 0.043762518261191125, 0.0,
+  -0.054850721909919985, 0.0, 0.0066851987925270681, 0.0,
+  0.0037302724840643743, 0.0, 0.040726287299239584, 0.0,
+  -0.035283842735031948, 0.0, 0.007098746041773977, 0.0,
+  -0.024213841428493615, 0.0, 0.16114008394822332, 0.0,
+  0.062492614007068854, 0.0, -0.37011393541241261, 0.0,
+  0.04880665265065956, 0.0, 0.074474543302679289, 0.0,
+  -0.022195676789514691, 0.0, -0.0045103502602729714, 0.0,
+  -0.045335232906611324, 0.0, 0.079187995696545513, 0.0,
+  -0.068857299316588946, 0.0, -0.034455673824326905, 0.0,
+  0.051988532616450409, 0.0, -0.010948734740632793, 0.0,
+  -0.027477176545318088, 0.0, 0.0018084970857180703, 0.0,
+  -0.0079945762720106967, 0.0, 0.39061332987498465, 0.0,
+  -0.058996190028353448, 0.0, 0.037597211756769063, 0.0,
+  -0.3095612151427099, 0.0, -0.060311995044046739, 0.0,
+  0.17859842050510163, 0.0, -0.13777734314792345, 0.0,
+  0.034751353182107293, 0.0, -0.050313856230054792, 0.0,
+  0.038433181387779944, 0.0, -0.065244590181485901, 0.0,
+  0.082455124099666766, 0.0, 0.052464781183763652, 0.0,
+  -0.036427373803060617, 0.0, -0.0053901475055802353, 0.0,
+  -0.01528231586602391, 0.0, -0.022846408445535881, -0.0,
+  0.025974690273357581, -0.0, -0.088809358280084905, -0.0,
+  0.082975966962724287, -0.0, -0.021223567421321074, -0.0,
+  0.016598472710088755, -0.0, -0.031777928502269084, -0.0,
+  0.036724029893013148, -0.0, 0.0067498618514613183, -0.0,
+  -0.0042858419425093643, -0.0, -3.1575174036956391e-05, -0.0,
+  0.00048701666330645393, -0.0, -0.0013786197661425496, -0.0,
+  0.093356687490974768, -0.0, -0.13376980689005022, -0.0,
+  -0.012697317084612941, -0.0, 0.062696562697846014, -0.0,
+  0.032664690399138073, -0.0, 0.010800205699858916, -0.0,
+  -0.031216101691283239, -0.0, -0.010987833427692131, -0.0,
+  -0.016728705456628669, -0.0, 0.016629278759726293, -0.0,
+  0.016224487274398035, -0.0, -0.016888081180169025, -0.0,
+  -0.01471436211647016, -0.0, 0.0026741694091684267, -0.0,
+  0.0018515409485418517, -0.0, 0.018564260386700029, -0.0,
+  0.7098731043019274, -0.0, -0.47166590727300051, -0.0,
+  -0.27428113184948932, -0.0, -0.0016443807886897129, -0.0,
+  0.048231076644237925, -0.0, -0.056011161512810936, -0.0,
+  -0.0001093970617669242, -0.0, 0.021246090826218172, -0.0,
+  -0.01777302870892741, -0.0, 0.013891037934745887, -0.0,
+  0.045287437572967548, -0.0, -0.040268847250269933, -0.0,
+  -0.006409048179501769, -0.0, 0.0018998047758384624, -0.0,
+  -0.0080270176822936946, -0.0, 0.011537953007078335, -0.0,
+  -0.18819473571566922, -0.0, 0.062959607989744884, -0.0,
+  -0.22329218354338523, -0.0, 0.35105846754277037, -0.0,
+  0.065236482771843296, -0.0, -0.077428134954114519, -0.0,
+  0.0020050026383508102, -0.0, 0.0079068445011967609, -0.0,
+  -0.015361661239273282, -0.0, 0.017106533837487344, -0.0,
+  0.055614941106220818, -0.0, -0.054042611372155422, -0.0,
+  -0.015293834805174218, -0.0, 0.00029315450823305238, -0.0,
+  0.0018689270156778705, -0.0, 0.016170200920486034, -0.0,
+  0.020693547770441339, -0.0, -0.019949437821239323, -0.0,
+  -0.0026161481668310299, -0.0, 0.020989118292311187, -0.0,
+  0.049056810801943768, -0.0, -0.015501718788627588, -0.0,
+  -0.0057420435143715563, -0.0, -0.015411286383916457, -0.0,
+  -0.12455431135174926, -0.0, 0.11851793814080448, -0.0,
+  -0.01041207353690329, -0.0, 0.0098743453026826876, -0.0,
+  5.4238494508008216e-05, -0.0, -0.033162394569914218, -0.0,
+  -0.041296793761830639, -0.0, -0.004888569014843692, -0.0,
+  0.056343876213879915, -0.0, 0.025035527479445201, -0.0,
+  -0.0079003062182581088, -0.0, -0.017225474465951348, -0.0,
+  -0.001425010804863966, -0.0, 0.18638378672712877, -0.0,
+  -0.19867534948854121, -0.0, -0.10367808162918669, -0.0,
+  0.10186110032865917, -0.0, 0.11587948482550889, -0.0,
+  -0.080314818895460049, -0.0, 0.020901389873408543, -0.0,
+  -0.045659143049600406, -0.0, 0.03008283606379342, -0.0,
+  -0.086818998857068799, -0.0, 0.081269155746187788, -0.0,
+  -0.0077892891421598807, -0.0, -0.10634864607323631, -0.0,
+  0.20706331796968613, -0.0, -0.17040557401309209, -0.0,
+  0.073073737013120171, -0.0, 0.50653777451019844, -0.0,
+  -0.41412685719217796, -0.0, 0.10054398132362449, -0.0,
+  -0.069287850412707713, -0.0, 0.041054789089365162, -0.0,
+  -0.0739797479419569, -0.0, 0.00014752457632629878, -0.0,
+  -0.061504449115331233, -0.0, -0.064363422874299858, -0.0,
+  0.018438259407668481, -0.0, -0.029795517201589558, -0.0,
+  0.065621293375083004, -0.0, 0.072791149622122242, -0.0,
+  -0.067940081282214806, -0.0, 0.0092398817402805644, -0.0,
+  -0.030942004603307333, -0.0, -0.23105184237787385, -0.0,
+  0.21377819563918207, -0.0, -0.35559103885701876, -0.0,
+  0.36732291180440269, -0.0, 0.19969189289129766, -0.0,
+  -0.011389667119574494, -0.0, -0.13263650267156538, -0.0,
+  -0.069863413825797166, -0.0, -0.001406016026487484, -0.0,
+  0.0062896903729562853, -0.0, -0.030458659904092782, -0.0,
+  -0.025921956080322918, -0.0, -0.05318777724406059, -0.0,
+  -0.015283598708355073, -0.0, 0.007488626237259639, -0.0,
+  0.066214238016758645, -0.0, 0.0078667676811339914, -0.0,
+  -0.0031507627756596022, -0.0, -0.0005493459924722459, -0.0,
+  0.002380534975061029, -0.0, -0.00040056899427500951, -0.0,
+  0.075098326780784028, -0.0, 0.026128814272661945, -0.0,
+  0.0063528191306794169, -0.0, -0.051818630819622742, -0.0,
+  -0.2448642034177653, -0.0, -0.58448769716839355, -0.0,
+  0.39775315599918731, -0.0, 0.42210550373786188, -0.0,
+  -0.049414776680312487, -0.0, 0.054328442379864297, -0.0,
+  -0.12495270204693404, -0.0, 0.120120125675744, -0.0,
+  0.10952706347560598, -0.0, -0.082088065554777212, -0.0,
+  0.018213685184902944, -0.0, -0.0466278851498741, -0.0,
+  0.034328376966973807, -0.0, 0.010551803604846475, -0.0,
+  -0.043417960794971976, -0.0, -0.0010839938046163402, -0.0,
+  -0.02235754724024341, -0.0, -0.0029972060486155062, -0.0,
+  0.0047144820352632956, -0.0, 0.022184274657500631, -0.0,
+  0.11578823532509562, -0.0, -0.084618804480927928, -0.0,
+  -0.17878348834521812, -0.0, 0.16119390806066336, -0.0,
+  0.0059943125365088659, -0.0, 0.019010738130311126, -0.0,
+  0.00034432378491367719, -0.0, -0.039059354105759149, -0.0,
+  -0.010524966317930802, -0.0, -0.054366526270203108, -0.0,
+  0.0093905525011852668, -0.0, 0.053977645339473676, -0.0,
+  -0.026206454735494242, -0.0, -0.064274469624714684, -0.0,
+  0.031616746759632885, -0.0, 0.061212042859376682, -0.0,
+  -0.099355552615503454, -0.0, 0.11612615861876298, -0.0,
+  0.29672036327741613, -0.0, -0.31519692511480141, -0.0,
+  0.05714749149926994, -0.0, -0.0035564303512880522, -0.0,
+  -0.044723014603643023, -0.0, -0.015033908860319084, -0.0,
+  0.00079430520802478124, -0.0, -0.0033149059865727171, -0.0,
+  0.014998900682828003, -0.0, 0.013429024940486162, -0.0,
+  0.0023220748081968644, -0.0, 0.025052027515942613, -0.0,
+  -0.021387818990742494, -0.0, -0.0057682302654688119, -0.0,
+  0.0029952150377997411, -0.0, -0.0047887629581516017, -0.0,
+  -0.00043063828107773927, -0.0, -0.00041744558910365536, -0.0,
+  0.0016970483659899315, -0.0, -0.027126888956344315, -0.0,
+  -0.0094520994433700493, -0.0, -0.0034954062851380936, -0.0,
+  0.012713386965548317, -0.0, 0.076615081566216131, -0.0,
+  0.2106949458383259, -0.0, -0.13481866853439523, -0.0,
+  -0.14712245597964138, -0.0, -0.041787072683832999, -0.0,
+  0.039031018821352487, -0.0, -0.2676219335707794, -0.0,
+  0.28525209579352884, -0.0, 0.16627389432210193, -0.0,
+  -0.1100723105219301, -0.0, 0.015459491111723797, -0.0,
+  -0.086996962262903224, -0.0, -0.029420010297394935, -0.0,
+  0.0013428113692544525, -0.0, 0.032045296284179986, -0.0,
+  0.0012512454626179617, -0.0, 0.013311879267665524, -0.0,
+  0.0054631279641552816, -0.0, 0.004793867242381792, -0.0,
+  -0.019629014931741975, -0.0, 0.18676863215783029, -0.0,
+  -0.15390632986549119, -0.0, -0.24168564984172783, -0.0,
+  0.23450876553256897, -0.0, -0.0088536560328195506, -0.0,
+  -0.0095195228824184481, -0.0, 0.013373808734626937, -0.0,
+  -0.056298789342067182, -0.0, -0.0065512019304228815, -0.0,
+  0.022157784188002926, -0.0, -0.008328298551644844, -0.0,
+  -0.0065495228531033478, -0.0, 0.013037485032512232, -0.0,
+  0.030355955203586468, -0.0, -0.02247862188890613, -0.0,
+  -0.011928961953707006, -0.0, -0.18260613210419552, -0.0,
+  0.187163806581748, -0.0, 0.59856050374351444, -0.0,
+  -0.59391422067273325, -0.0, -0.085103572727819682, -0.0,
+  0.018775459476860414, -0.0, 0.049596745245787797, -0.0,
+  0.021539421720287989, -0.0, -0.016391818311415132, 0.0,
+  0.014172392665352739, 0.0, 0.0030848376769075808, 0.0,
+  0.046371390750055273, 0.0, 0.25497607091187435, 0.0,
+  -0.19301317375536861, 0.0, 0.18456680412148688, 0.0,
+  -0.26137282807069623, 0.0, 0.058246418218853249, 0.0,
+  -0.056835550729834497, 0.0, -0.010302636877173903, 0.0,
+  0.0075658151724395314, 0.0, 0.0015844059806069068, 0.0,
+  -0.053715131862985703, 0.0, -0.061076195709226795, 0.0,
+  -0.0078759540613237786, 0.0, 0.075430499751525007, 0.0,
+  0.010563483638880034, 0.0, -0.014761803058364931, 0.0,
+  -0.018962450321674394, 0.0, 0.022311647936738944, 0.0,
+  -0.27828562811726754, 0.0, 0.28207402160821121, 0.0,
+  0.20314148218107353, 0.0, -0.18841763168937301, 0.0,
+  0.26836805618376636, 0.0, -0.1942488545418318, 0.0,
+  0.059626378429793944, 0.0, -0.13831730309424392, 0.0,
+  0.11784473572796898, 0.0, -0.079242646400795674, 0.0,
+  -0.047726122745910281, 0.0, 0.0051073511718050463, 0.0,
+  -0.091996360774407024, 0.0, 0.2353786916005764, 0.0,
+  -0.17416620464636198, 0.0, 0.042775399092480147, 0.0,
+  -0.038999508071348055, 0.0, 0.035382203094130926, 0.0,
+  -0.27492144387177053, 0.0, 0.29615974560111835, 0.0,
+  0.16510046897351391, 0.0, -0.13939960189818731, 0.0,
+  2.4980913712583596e-05, 0.0, -0.11281224729710838, 0.0,
+  0.076416720455811146, 0.0, -0.00066039501752286026, 0.0,
+  -0.014190528709916583, 0.0, -0.058078105182877142, 0.0,
+  -0.064281682198549739, 0.0, 0.12198925588450993, 0.0,
+  -0.081022605279462853, 0.0, 0.052930953466892874, 0.0,
+  0.057275820082787858, 0.0, -0.067260544949774584, 0.0,
+  -0.25331014737691132, 0.0, 0.27410122624097183, 0.0,
+  -0.23125244765341377, 0.0, 0.0563436706109358, 0.0,
+  0.11044587594477354, 0.0, 0.083536748185545531, 0.0,
+  -0.0074495637258560924, -0.0, 0.0055847496323838414, -0.0,
+  0.0087639639067717198, -0.0, 0.010420631542949997, -0.0,
+  0.27441767274374657, -0.0, -0.21853132136085895, -0.0,
+  0.21332604874195854, -0.0, -0.28010055323972738, -0.0,
+  -0.053962638441497734, -0.0, 0.050990632115421132, -0.0,
+  -0.0083934930477473756, -0.0, 0.0065383711612365496, -0.0,
+  -0.00055956357622264404, -0.0, -0.014458076177054163, -0.0,
+  -0.013417429821286348, -0.0, -0.0041808515577216945, -0.0,
+  0.011347877130949126, -0.0, -0.031791245228340398, -0.0,
+  -0.04554386660736548, -0.0, 0.019678965129990775, -0.0,
+  0.05303495252124886, -0.0, 0.24956083456526115, -0.0,
+  -0.25646957636498846, -0.0, -0.26692412907253749, -0.0,
+  0.2684805249062942, -0.0, -0.16373639836501225, -0.0,
+  0.12934037059716524, -0.0, -0.045756300603428307, -0.0,
+  0.065115004830603396, -0.0, 0.095107264877346082, -0.0,
+  -0.058815331268315944, -0.0, -0.056390435197517096, -0.0,
+  0.003616975621384922, -0.0, -0.10421336940920622, -0.0,
+  0.23745952567725406, -0.0, -0.17802433949475288, -0.0,
+  0.044104305515643254, -0.0, -0.29583542099725563, -0.0,
+  0.23633358417349928, -0.0, 0.22368418758212849, -0.0,
+  -0.22187503816380372, -0.0, 0.15843097107772716, -0.0,
+  -0.1410315824675033, -0.0, 0.017206538256207639, -0.0,
+  0.060238602598841805, -0.0, 0.081361362793213779, -0.0,
+  -0.0027901381803167318, -0.0, -0.00521245471074799, -0.0,
+  -0.068561178902534631, -0.0, -0.083218613396048788, -0.0,
+  0.11658625978854806, -0.0, -0.08238728478690413, -0.0,
+  0.072217918123265584, -0.0, -0.015839152970154546, -0.0,
+  0.025713139982220069, -0.0, 0.25986905432346263, -0.0,
+  -0.27536977773194254, -0.0, -0.05488084803348179, -0.0,
+  0.022058665483575678, -0.0, 0.036243025630078043, -0.0,
+  -0.0011120081302459775, -0.0, 0.010737453710495233, 0.0,
+  -0.01433658277122565, 0.0, -0.093476226290885797, 0.0,
+  -0.12970270353005744, 0.0, 0.056857356551363161, 0.0,
+  -0.036860484873419891, 0.0, 0.044821850428367296, 0.0,
+  -0.062960509065655201, 0.0, -0.039558517590781245, 0.0,
+  0.037968880778499893, 0.0, 0.0087352219427774946, 0.0,
+  -0.007704900373243442, 0.0, 0.0016386167987805743, 0.0,
+  0.18802160709574037, 0.0, 0.1964820062192893, 0.0,
+  0.010822825581595901, 0.0, -0.17782937064426491, 0.0,
+  -0.0011027755224522209, 0.0, 0.015408063438830956, 0.0,
+  -0.012614195491325749, 0.0, -0.0044987212910619296, 0.0,
+  0.12134844671893191, 0.0, -0.12350178230732693, 0.0,
+  0.39324246451736655, 0.0, -0.39205459628302136, 0.0,
+  -0.11276238189973384, 0.0, 0.073154132013969406, 0.0,
+  -0.02311886311336378, 0.0, 0.04803254065451884, 0.0,
+  -0.070809971491194737, 0.0, -0.14054004134457279, 0.0,
+  0.24802882071554352, 0.0, 0.0023639537979008086, 0.0,
+  -0.050451176457641078, 0.0, 0.069876217339385774, 0.0,
+  -0.032280752122691776, 0.0, 0.0066878402815647017, 0.0,
+  0.038279674513421985, 0.0, -0.033821176699512574, 0.0,
+  -0.43902266106036547, 0.0, 0.36068074674016909, 0.0,
+  0.035279937731614919, 0.0, -0.038029590584434871, 0.0,
+  -0.034358042387903479, 0.0, 0.10511489309221729, 0.0,
+  -0.23147521527830928, 0.0, 0.12445427280380066, 0.0,
+  -0.056198385530635019, 0.0, 0.15512533435966827, 0.0,
+  -0.0068531412155898707, 0.0, 0.025510574554240602, 0.0,
+  -0.0034568978178634254, 0.0, -0.01667852732987125, 0.0,
+  -0.14457418224054258, 0.0, 0.15487260507872677, 0.0,
+  0.20052393441293054, 0.0, -0.197830533887972, 0.0,
+  0.050758855829527848, 0.0, -0.0080507915139206038, 0.0,
+  -0.024407080613951235, 0.0, -0.023908349076447403, 0.0,
+  -0.011942851801608177, 0.0, 0.0035478454514512275, 0.0,
+  -0.10871586351469695, 0.0, -0.20660988078495943, 0.0,
+  0.056957700635429348, 0.0, -0.034107354069764145, 0.0,
+  0.041087374778719946, 0.0, -0.058727381934675638, 0.0,
+  0.079280777957080883, 0.0, -0.078231563572935731, 0.0,
+  0.0098260469312413754, 0.0, -0.0090862796914475477, 0.0,
+  0.0028635713920791553, 0.0, 0.30304892994463223, 0.0,
+  0.31183576847141503, 0.0, 0.014157752702334138, 0.0,
+  -0.32012248575465674, 0.0, -0.0030654053370921513, 0.0,
+  0.01873380210043836, 0.0, -0.0097967490529181321, 0.0,
+  -0.0078318960344723482, 0.0, -0.20826266432754831, 0.0,
+  0.20713742501584625, 0.0, -0.26939566079291072, 0.0,
+  0.26899259491071248, 0.0, 0.015747763649269313, 0.0,
+  -0.0090967846454070318, 0.0, 0.0012656500233264208, 0.0,
+  -0.012533650103228199, 0.0, -0.11086346218230558, 0.0,
+  -0.15393900091366197, 0.0, 0.29993497342954162, 0.0,
+  0.0064793697664748944, 0.0, -0.006667752327615805, 0.0,
+  -0.013319724666805737, 0.0, 0.014451223825550009, 0.0,
+  -0.006818227687048704, 0.0, -0.054201847187290146, 0.0,
+  0.043875575246889405, 0.0, 0.28983308406167135, 0.0,
+  -0.24092153311443262, 0.0, 0.029963855498414394, 0.0,
+  -0.030648521895784174, 0.0, 0.027892761055951603, 0.0,
+  -0.045998717870974086, 0.0, -0.31051030276872738, 0.0,
+  0.1722570209522048, 0.0, -0.07763010976568821, 0.0,
+  0.20583622445175409, 0.0, 0.033258388187749066, 0.0,
+  -0.015943935043743945, 0.0, 0.021329972927458998, 0.0,
+  -0.054253594619928174, 0.0, 0.08272353006511049, 0.0,
+  -0.088823155937040363, 0.0, -0.10370855839075253, 0.0,
+  0.10557104399647195, 0.0, 0.097763762423074566, 0.0,
+  -0.0099616108955418847, 0.0, -0.047472838828652816, 0.0,
+  -0.046444424337979059, 0.0, 0.020091772792698335, 0.0,
+  -0.016584076481466845, 0.0, -0.051943021064110854, 0.0,
+  -0.060499668016963708, 0.0, -0.061285136957378708, 0.0,
+  0.02040322150901118, 0.0, -0.031366788611283745, 0.0,
+  0.063770029371114326, 0.0, -0.092655392463360936, 0.0,
+  0.09346966804699619, 0.0, 0.0016186166552286082, 0.0,
+  -0.00037110184439110498, 0.0, 0.0013307718211651367, 0.0,
+  0.11373591614460243, 0.0, 0.084959692962138858, 0.0,
+  0.0078523681544481611, 0.0, -0.094664570189139347, 0.0,
+  -0.0090051138551652619, 0.0, -0.027908203084725771, 0.0,
+  0.01766962231509632, 0.0, 0.021112919163682846, 0.0,
+  0.32165445882663185, 0.0, -0.3257572286430746, 0.0,
+  -0.098576597106978386, 0.0, 0.099538706192899076, 0.0,
+  0.24160859608910795, 0.0, -0.16767071983153115, 0.0,
+  0.049901355513856965, 0.0, -0.095323711135374342, 0.0,
+  -0.051682859926525819, 0.0, -0.030144315861306226, 0.0,
+  0.11118590784697342, 0.0, -0.0083288286217918592, 0.0,
+  0.049497793970968464, 0.0, -0.12702362308039936, 0.0,
+  0.089586467402290815, 0.0, -0.0048186635361857693, 0.0,
+  -0.21439829991681889, 0.0, 0.18399105694428275, 0.0,
+  -0.1032862112507292, 0.0, 0.13432415745396581, 0.0,
+  -0.035386496264481225, 0.0, 0.07226005377219813, 0.0,
+  -0.021783563529212357, 0.0, -0.10220957634026158, 0.0,
+  -0.15390331624319797, 0.0, 0.038126842307602785, 0.0,
+  -0.027700107636484173, 0.0, 0.1337898483359215, 0.0,
+  0.03728160486138557, 0.0, -0.098122368685038153, 0.0,
+  0.078072203410223584, 0.0, -0.025975793027778346, 0.0,
+  0.18055558321724818, 0.0, -0.17772072547549866, 0.0,
+  -0.19958157950987387, 0.0, 0.20766026078449865, 0.0,
+  -0.51779386919683545, 0.0, 0.099762981280716506, 0.0,
+  0.24456216660563618, 0.0, 0.21409688363477061, 0.0,
+  -0.0014172815789375694, 0.0, 0.00020797288202999934, 0.0,
+  -0.0087098801112363393, 0.0, -0.038057571729536582, 0.0,
+  -0.023828131981528073, 0.0, -0.0077188765498595593, 0.0,
+  0.015008234164588373, 0.0, 0.010107544451800097, 0.0,
+  0.025839455334324676, 0.0, -0.026790482084331827, 0.0,
+  0.0044387903806743512, 0.0, -0.0028271436159117841, 0.0,
+  -0.0027580083182313624, 0.0, 0.04336307750572814, 0.0,
+  0.059612109911031587, 0.0, 0.0012908591809674117, 0.0,
+  -0.059547686175121975, 0.0, -0.023084021747001866, 0.0,
+  -0.033961828701685626, 0.0, 0.034939812444598956, 0.0,
+  0.015942590944348155, 0.0, -0.11092298920916643, 0.0,
+  0.11266886429954155, 0.0, -0.00093143280459621685, 0.0,
+  -0.023769773115919938, 0.0, -0.23376709887547698, 0.0,
+  0.16445112827998498, 0.0, -0.050368780119850923, 0.0,
+  0.11041736110623768, 0.0, -0.014595696133552534, 0.0,
+  0.019813110794505755, 0.0, -0.017220916615422119, 0.0,
+  0.0017287477570917154, 0.0, -0.05730463621750552, 0.0,
+  0.074466917156536819, 0.0, -0.052734234094586961, 0.0,
+  0.018871720018583969, 0.0, 0.42538737634355617, 0.0,
+  -0.34906921820315123, 0.0, 0.16581336474484182, 0.0,
+  -0.21276422100326001, 0.0, -0.001108005709741395, 0.0,
+  -0.0022297822779522337, 0.0, -0.00021560940236898702, 0.0,
+  0.092484093279864552, 0.0, 0.026126884795484102, 0.0,
+  -0.0021280948548466658, 0.0, 0.013031867940769885, 0.0,
+  -0.033805708009508606, 0.0, 0.018265317671203297, 0.0,
+  -0.081181936830179283, 0.0, 0.065190682161264515, 0.0,
+  -0.032560158125237035, 0.0, -0.1383029623944779, 0.0,
+  0.13052071436623244, 0.0, -0.024546463662452018, 0.0,
+  -0.012419323766217143, 0.0, -0.63049648921609591, 0.0,
+  0.13810927823273106, 0.0, 0.29068818784649025, 0.0,
+  0.23235837923993566, 0.0
+};
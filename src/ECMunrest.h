@@ -6,5 +6,8 @@
 RateModel ECMunrestModel();
 
 extern const char* ECMunrestModelText;
+extern const EigenSystemHash ECMunrestModelEigenHash;
+extern const double ECMunrestModelEigen[];
+extern const size_t ECMunrestModelEigenSize;
 
 #endif /* ECMUNREST_MODEL_INCLUDED */
@@ -151,12 +151,19 @@ map<AlignSeqMap::AlignNum,AlignColIndex> AlignSeqMap::linkedColumns (AlignNum nA
 }
 
 AlignPath alignPathMerge (const vguard<AlignPath>& alignments) {
+  vguard<vguard<AlignColIndex> > mergedCol;
+  return alignPathMerge (alignments, mergedCol);
+}
+
+AlignPath alignPathMerge (const vguard<AlignPath>& alignments, vguard<vguard<AlignColIndex> >& mergedCol) {
   LogThisAt(8,"Merging alignments:\n" << to_string_join (transform_container (alignments, alignPathString), "//\n"));
   const AlignSeqMap alignSeqMap (alignments);
   AlignPath a;
   for (auto& row_seqlen : alignSeqMap.seqLen)
     a[row_seqlen.first].clear();
   vguard<AlignColIndex> nextCol (alignments.size(), 0);
+  mergedCol = vguard<vguard<AlignColIndex> > (alignments.size());
+  AlignColIndex mergedCols = 0;
   bool allDone, noneReady;
   do {
     allDone = noneReady = true;
@@ -181,8 +188,10 @@ AlignPath alignPathMerge (const vguard<AlignPath>& alignments) {
 	      for (const auto& row_path : alignments.at(nAlign_col.first))
 		if (alignments.at(nAlign_col.first).at(row_path.first).at(nAlign_col.second))
 		  a[row_path.first].back() = true;
+	      mergedCol[nAlign_col.first].push_back (mergedCols);
 	      ++nextCol[nAlign_col.first];
 	    }
+	    ++mergedCols;
 	  } else
 	    ++nextCol[n];  // empty column
 	  break;
@@ -203,7 +212,13 @@ AlignPath alignPathMerge (const vguard<AlignPath>& alignments) {
 }
 
 AlignPath alignPathRemoveEmptyColumns (const AlignPath& a) {
+  vguard<AlignColIndex> keptCol;
+  return alignPathRemoveEmptyColumns (a, keptCol);
+}
+
+AlignPath alignPathRemoveEmptyColumns (const AlignPath& a, vguard<AlignColIndex>& keptCol) {
   AlignPath trimmed;
+  keptCol.clear();
   const AlignColIndex cols = alignPathColumns (a);
   for (const auto& row_path : a)
     trimmed[row_path.first].reserve (cols);
@@ -214,9 +229,11 @@ AlignPath alignPathRemoveEmptyColumns (const AlignPath& a) {
 	empty = false;
 	break;
       }
-    if (!empty)
+    if (!empty) {
       for (const auto& row_path : a)
 	trimmed[row_path.first].push_back (row_path.second[col]);
+      keptCol.push_back (col);
+    }
   }
   return trimmed;
 }
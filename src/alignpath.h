@@ -17,10 +17,12 @@ SeqIdx alignPathResiduesInRow (const AlignRowPath& r);
 
 AlignPath alignPathUnion (const AlignPath& a1, const AlignPath& a2);  // simple union (no AlignRowIndex shared between a1 & a2)
 AlignPath alignPathMerge (const vguard<AlignPath>& alignments);  // synchronized merge
+AlignPath alignPathMerge (const vguard<AlignPath>& alignments, vguard<vguard<AlignColIndex> >& mergedCol);  // also sets mergedCol[n][col] = merged column holding column col of alignment n
 AlignPath alignPathConcat (const AlignPath& a1, const AlignPath& a2);  // lengthwise concatenation
 AlignPath alignPathConcat (const AlignPath& a1, const AlignPath& a2, const AlignPath& a3);
 
 AlignPath alignPathRemoveEmptyColumns (const AlignPath& a);
+AlignPath alignPathRemoveEmptyColumns (const AlignPath& a, vguard<AlignColIndex>& keptCol);  // also sets keptCol[col] = column of a that column col came from
 
 void ensureAlignPathHasRow (AlignPath&, AlignRowIndex);   // adds an empty row if necessary
 
@@ -51,11 +53,15 @@ struct GuideAlignmentEnvelope {
 
   inline bool initialized() const { return maxDistance >= 0; }
 
+  // matchOffset is nondecreasing in pos1 and nonincreasing in pos2, so for fixed pos1 the positions in range form a contiguous band
+  inline int matchOffset (SeqIdx pos1, SeqIdx pos2) const {
+    return cumulativeMatches[row1PosToCol[pos1]] - cumulativeMatches[row2PosToCol[pos2]];
+  }
+
   inline bool inRange (SeqIdx pos1, SeqIdx pos2) const {
     if (!initialized())
       return true;
-    const int d = cumulativeMatches[row1PosToCol[pos1]] - cumulativeMatches[row2PosToCol[pos2]];
-    return abs(d) <= maxDistance;
+    return abs(matchOffset(pos1,pos2)) <= maxDistance;
   }
 };
 
@@ -5,6 +5,7 @@ RateModel dayhoffModel() {
   RateModel m;
   ParsedJson pj (dayhoffModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, dayhoffModelEigenHash, dayhoffModelEigen, dayhoffModelEigenSize);
   return m;
 }
 
@@ -394,3 +395,418 @@ const char* dayhoffModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash dayhoffModelEigenHash = 0x2664deb389fe1333ULL;
+const size_t dayhoffModelEigenSize = 1640;
+const double dayhoffModelEigen[] = {
+  -2.217824103079999, 0.0, -1.9386615142196488, 0.0,
+  1.2789404394634077e-15, 0.0, -1.7514051599018603, 0.0,
+  -1.6505798015934365, 0.0, -1.5455130588357404, 0.0,
+  -1.3387261800078065, 0.0, -1.2983657799361652, 0.0,
+  -0.23516303931366514, 0.0, -0.26671538452256283, 0.0,
+  -0.28811938127522851, 0.0, -1.1046378650768565, 0.0,
+  -1.0414394583488236, 0.0, -0.42805122049548405, 0.0,
+  -0.54045559851016733, 0.0, -0.8772291831017579, 0.0,
+  -0.7093542689475334, 0.0, -0.72236823263670147, 0.0,
+  -0.77435732703842597, 0.0, -0.80633379879154665, 0.0,
+  -0.039765876818434617, 0.0, 0.21882786267787896, 0.0,
+  -0.22360679774997844, 0.0, -0.02665980168885897, 0.0,
+  -0.46273856736872071, 0.0, 0.40498819405072761, 0.0,
+  0.06660577932275541, 0.0, 0.051069781275034296, 0.0,
+  -0.023897392057275951, 0.0, 0.03966406338902255, 0.0,
+  0.057168381079250374, 0.0, -0.16933073639399032, 0.0,
+  -0.16873617959796697, 0.0, 0.01101163097835196, 0.0,
+  0.18929060528659275, 0.0, 0.04471990446438652, 0.0,
+  -0.063252646640394303, 0.0, -0.083051365709161648, 0.0,
+  -0.034345032282951549, 0.0, -0.024151482972902573, 0.0,
+  -0.037488623130644494, 0.0, 0.040411002733301234, 0.0,
+  -0.22360679774997894, 0.0, 0.037143980812738668, 0.0,
+  0.021653447837349137, 0.0, 0.0064716187716557577, 0.0,
+  -0.10647396634350074, 0.0, -0.04333999373932327, 0.0,
+  0.012942434565121456, 0.0, 0.070625602856586311, 0.0,
+  0.10024272433485314, 0.0, -0.69894253053605326, 0.0,
+  0.41945598759549119, 0.0, 0.10471212401944364, 0.0,
+  -0.56600593932921017, 0.0, -0.27195277340738733, 0.0,
+  -0.29679792676248945, 0.0, 0.045526740539334351, 0.0,
+  0.062951435466486655, 0.0, 0.065822421363561673, 0.0,
+  -0.72423415259156954, 0.0, 0.22937683042837956, 0.0,
+  -0.2236067977499793, 0.0, -0.55671410338512806, 0.0,
+  0.17344776513957702, 0.0, -0.12039659296963579, 0.0,
+  -0.18008259209181621, 0.0, -0.15108492022165709, 0.0,
+  -0.019471277324596557, 0.0, 0.060669040508991579, 0.0,
+  0.068630508888421024, 0.0, 0.036959474758722716, 0.0,
+  -0.17588757690722137, 0.0, 0.10338882180345579, 0.0,
+  -0.029479520709363577, 0.0, 0.063907183665185344, 0.0,
+  0.1382951358298381, 0.0, 0.060463673817622132, 0.0,
+  -0.021178735598924622, 0.0, -0.030559070135991091, 0.0,
+  0.52882748129158419, 0.0, 0.40357328903648104, 0.0,
+  -0.22360679774997902, 0.0, -0.055420285149539984, 0.0,
+  0.10198241387595421, 0.0, -0.0035265865063221335, 0.0,
+  -0.25269979826362049, 0.0, -0.16862735798446121, 0.0,
+  -0.028049202648873558, 0.0, 0.080581921412746518, 0.0,
+  0.095557028358953355, 0.0, -0.046095857980460904, 0.0,
+  0.156456766062497, 0.0, 0.12525747115470809, 0.0,
+  0.046183088540573736, 0.0, 0.30196810299998927, 0.0,
+  0.36404854319227165, 0.0, 0.12335484303955634, 0.0,
+  -0.030071800167828833, 0.0, -0.1345034336693742, 0.0,
+  -0.01457858063224758, 0.0, 0.034912264573021094, 0.0,
+  -0.22360679774997932, 0.0, 0.025220819093801545, 0.0,
+  0.002934854072859849, 0.0, -0.00093718084904525383, 0.0,
+  0.00083287841889373698, 0.0, 0.0017232316530930111, 0.0,
+  -0.062594142841381956, 0.0, -0.94581839980809368, 0.0,
+  0.26443518150940298, 0.0, 0.028200218234512738, 0.0,
+  0.03008872576894844, 0.0, -0.079213977739627364, 0.0,
+  -0.076476143990375112, 0.0, 0.012647039903503438, 0.0,
+  0.037813230966831098, 0.0, 0.044782674740668826, 0.0,
+  0.060217640117901844, 0.0, -0.012287555912440471, 0.0,
+  0.087053872327536169, 0.0, 0.23778063171320271, 0.0,
+  -0.22360679774997924, 0.0, -0.33977139724465105, 0.0,
+  0.15152463819110884, 0.0, -0.19093692399074494, 0.0,
+  0.49721043167490941, 0.0, 0.3499971110756685, 0.0,
+  -0.019601636154823954, 0.0, 0.078971532810608217, 0.0,
+  0.07183674070456568, 0.0, -0.001887845888644457, 0.0,
+  0.20019347173175328, 0.0, 0.082252891802448033, 0.0,
+  -0.17866847493029875, 0.0, -0.063909231596501068, 0.0,
+  0.35572200576646545, 0.0, -0.062802563363335215, 0.0,
+  0.043482315433908521, 0.0, -0.043942673103521929, 0.0,
+  -0.32143974526990621, 0.0, -0.52392929694721213, 0.0,
+  -0.22360679774997866, 0.0, 0.41006691019179692, 0.0,
+  -0.10910617224012753, 0.0, 0.059781581434562032, 0.0,
+  0.020293579696379023, 0.0, 0.027864006793895623, 0.0,
+  -0.02741334015325211, 0.0, 0.080970235664501955, 0.0,
+  0.088964050113458815, 0.0, -0.063146733533158569, 0.0,
+  0.27990273711785629, 0.0, 0.10944559673780511, 0.0,
+  0.020486064872855377, 0.0, 0.29659411996264651, 0.0,
+  0.39237994546328597, 0.0, 0.074061783300284387, 0.0,
+  -0.027558149330986857, 0.0, -0.14256101120793277, 0.0,
+  -0.0079148421675689935, 0.0, 0.023383833091201029, 0.0,
+  -0.22360679774997916, 0.0, 0.071967334458308524, 0.0,
+  0.055889824036181604, 0.0, -0.084018933780406008, 0.0,
+  0.0096894601770025294, 0.0, 0.00642964175735301, 0.0,
+  -0.031728655721767016, 0.0, 0.061171339094897748, 0.0,
+  0.099629105463718962, 0.0, 0.12488298192201742, 0.0,
+  0.16532690331946565, 0.0, 0.094853933291024803, 0.0,
+  0.45835514299310931, 0.0, -0.20874638384520927, 0.0,
+  -0.13888945815798723, 0.0, 0.36350643524796128, 0.0,
+  0.13183749558910252, 0.0, 0.18627385666985666, 0.0,
+  0.088838683000336233, 0.0, -0.099866229401037787, 0.0,
+  -0.22360679774997877, 0.0, 0.21400782611479341, 0.0,
+  -0.10976182213960965, 0.0, 0.088606708411457527, 0.0,
+  -0.12962628344365454, 0.0, -0.076923322589811299, 0.0,
+  -0.0087399886524994717, 0.0, 0.052396339633482884, 0.0,
+  0.033643222539933411, 0.0, 0.22932056829982653, 0.0,
+  -0.38229694052848373, 0.0, 0.14212441299472506, 0.0,
+  -0.27570384057415065, 0.0, -0.76086886248474761, 0.0,
+  0.52959607238740525, 0.0, -0.17837433631612451, 0.0,
+  0.047310370462478921, 0.0, 0.046022837244836891, 0.0,
+  0.02938948688263706, 0.0, 0.0075741675359018937, 0.0,
+  -0.22360679774997919, 0.0, -0.05416541566843782, 0.0,
+  -0.65256725709902996, 0.0, -0.72427539651981021, 0.0,
+  -0.032372991759285985, 0.0, -0.062768985581180076, 0.0,
+  -0.0035921740780039133, 0.0, 0.0057588701288659987, 0.0,
+  -0.11300128683687578, 0.0, 0.10960454218418078, 0.0,
+  0.17263704440938274, 0.0, -0.28191009007515611, 0.0,
+  0.030112168039156034, 0.0, -0.12190301967234525, 0.0,
+  -0.090833786083745371, 0.0, -0.036800687166052094, 0.0,
+  -0.33124661431968533, 0.0, -0.29216241627760803, 0.0,
+  0.0034229051529810718, 0.0, -0.0052944265772297636, 0.0,
+  -0.22360679774997894, 0.0, 0.01223721477484065, 0.0,
+  0.01473323552619021, 0.0, 0.021084816282513925, 0.0,
+  0.056580258050591824, 0.0, -0.08619377900620287, 0.0,
+  0.01661860440498086, 0.0, 0.018777437468246387, 0.0,
+  -0.21183732457106089, 0.0, -0.062851830806346251, 0.0,
+  -0.040504538894114754, 0.0, -0.49274299565170865, 0.0,
+  -0.086629999192665702, 0.0, 0.090231602190041643, 0.0,
+  0.13237654682700437, 0.0, 0.089452953768885235, 0.0,
+  0.19402207827432072, 0.0, 0.29565973978125559, 0.0,
+  0.05222863857960499, 0.0, -0.020679492376729815, 0.0,
+  -0.2236067977499788, 0.0, 0.056955581536922567, 0.0,
+  -0.052438077323458628, 0.0, 0.067135288319114611, 0.0,
+  0.075808186012659137, 0.0, -0.03800484506527127, 0.0,
+  -0.014711661381773662, 0.0, 0.084916041544110907, 0.0,
+  0.089995571461787827, 0.0, 0.41757639761920873, 0.0,
+  -0.11071287996702708, 0.0, 0.099170313788981446, 0.0,
+  -0.46745779588317277, 0.0, 0.16552682790386544, 0.0,
+  -0.2688557615862377, 0.0, 0.20128910034757069, 0.0,
+  -0.011870003334737761, 0.0, 0.014665198388028064, 0.0,
+  -0.019018534693093385, 0.0, 0.011797861213231512, 0.0,
+  -0.22360679774997885, 0.0, -0.016868856845139391, 0.0,
+  0.045717837929981214, 0.0, 0.045191867493013183, 0.0,
+  -0.77723395676676943, 0.0, 0.89215385361379862, 0.0,
+  -0.00015721331914353683, 0.0, 0.038001701060263307, 0.0,
+  -0.10625287874743054, 0.0, 0.1977623518818046, 0.0,
+  -0.031626396949672682, 0.0, -0.3137169681910868, 0.0,
+  -0.14954347728882064, 0.0, 0.075324247421485316, 0.0,
+  -0.05996795448115988, 0.0, 0.095554600345883936, 0.0,
+  -0.010892015259151488, 0.0, 0.068478374774520373, 0.0,
+  -0.005717189088800677, 0.0, 0.0095193116527042786, 0.0,
+  -0.22360679774997885, 0.0, 0.0078347202298293794, 0.0,
+  0.041466951003765962, 0.0, 0.046601276365981277, 0.0,
+  0.0080591097225203214, 0.0, 0.0039648542994180219, 0.0,
+  0.07261700085680528, 0.0, -0.12204678253391711, 0.0,
+  -0.5481533543657775, 0.0, 0.009830387634232279, 0.0,
+  -0.018215792204537926, 0.0, 0.27026783460393422, 0.0,
+  0.043644980267209102, 0.0, -0.03121445042316745, 0.0,
+  -0.10901064652913622, 0.0, 0.075382736891082006, 0.0,
+  0.50354398170138481, 0.0, -0.54026759492561449, 0.0,
+  -0.01621053943183097, 0.0, 0.032719923635223969, 0.0,
+  -0.22360679774997905, 0.0, 0.058244458647428332, 0.0,
+  0.065812047353694197, 0.0, -0.077170364050673734, 0.0,
+  -0.057036440616335796, 0.0, -0.042248972810102328, 0.0,
+  -0.024898717540623831, 0.0, 0.051593067499506817, 0.0,
+  0.080270131057827515, 0.0, 0.23484172028770992, 0.0,
+  0.24359165577835409, 0.0, 0.040280911075331154, 0.0,
+  0.11372700010168559, 0.0, 0.086262157643443388, 0.0,
+  -0.16484694907609199, 0.0, -0.8422867957197786, 0.0,
+  0.26170528457798092, 0.0, 0.14784835900275833, 0.0,
+  0.25982466435380508, 0.0, -0.58970031685874358, 0.0,
+  -0.22360679774997916, 0.0, -0.38372774623494876, 0.0,
+  0.05036179997189557, 0.0, -0.060862359026789908, 0.0,
+  -0.015846483729618419, 0.0, -0.0022558560588235707, 0.0,
+  -0.018505106732910392, 0.0, 0.017199242786023822, 0.0,
+  0.074337822273224163, 0.0, -0.18095698040748603, 0.0,
+  -0.25833622875613782, 0.0, 0.054882514730954152, 0.0,
+  0.11247479632300328, 0.0, 0.04857287222694498, 0.0,
+  -0.084764507034808659, 0.0, -0.052627320297023911, 0.0,
+  0.008247119660483174, 0.0, 0.003691492456129054, 0.0,
+  -0.042248704666040887, 0.0, 0.19991265975132694, 0.0,
+  -0.22360679774997905, 0.0, 0.43770353711643156, 0.0,
+  0.32671497129677357, 0.0, -0.32003586535616702, 0.0,
+  0.064947659434342095, 0.0, 0.046367926940084632, 0.0,
+  -0.020470600668072193, 0.0, 0.038055639290312131, 0.0,
+  0.04519170420452169, 0.0, -0.26390225937686024, 0.0,
+  -0.4848683406590113, 0.0, -0.00030658383446775989, 0.0,
+  0.085525855961404065, 0.0, 0.092440167162811449, 0.0,
+  -0.11535218937926917, 0.0, -0.081806353444293642, 0.0,
+  -0.1150595779267458, 0.0, -0.077378788666107839, 0.0,
+  -0.0023987844419954153, 0.0, 0.015273704326029798, 0.0,
+  -0.22360679774997891, 0.0, 0.012775306836508927, 0.0,
+  -0.0047163853952854745, 0.0, 0.00068124277051640283, 0.0,
+  0.0089039449775817053, 0.0, 0.0082749622818692591, 0.0,
+  0.98984449236609651, 0.0, -0.042716265956882493, 0.0,
+  0.4393936668278951, 0.0, 0.076738361619874268, 0.0,
+  -0.018896426185733936, 0.0, -0.067555609714697609, 0.0,
+  0.14920695710235285, 0.0, 0.033947558434350003, 0.0,
+  0.042558748747272723, 0.0, -0.0085886599565901823, 0.0,
+  -0.033992946105586071, 0.0, -0.020555479890438821, 0.0,
+  0.014495921100137137, 0.0, 0.0019697794272673808, 0.0,
+  -0.2236067977499793, 0.0, 0.0030998446328582788, 0.0,
+  -0.0088591447739968243, 0.0, -0.0094434445160542346, 0.0,
+  0.0065746946755164725, 0.0, 0.012780426730657532, 0.0,
+  0.069793977799852608, 0.0, -0.19768035460156394, 0.0,
+  -0.53828077971891097, 0.0, -0.0079832112643462225, 0.0,
+  0.081581217011597512, 0.0, 0.56380587789983549, 0.0,
+  0.01687454883749788, 0.0, 0.095948407714832026, 0.0,
+  0.038494728010780077, 0.0, -0.08530684071310872, 0.0,
+  -0.56874256712536608, 0.0, 0.58687617240562839, 0.0,
+  0.00036194985735609847, 0.0, -0.049533572938305938, 0.0,
+  -0.22360679774997905, 0.0, -0.024964849816456743, 0.0,
+  0.38541455429853189, 0.0, 0.34724675625546547, 0.0,
+  0.037598925867102666, 0.0, -0.045563493238759564, 0.0,
+  -0.01162606188016759, 0.0, 0.012963088703031317, 0.0,
+  -0.066730518427799174, 0.0, 0.11537975657045631, 0.0,
+  0.18476863686580461, 0.0, -0.27870732147979937, 0.0,
+  0.099341332185396217, 0.0, -0.16825742947288233, 0.0,
+  -0.10032415969008632, 0.0, -0.076300318503065692, 0.0,
+  -0.40000499156794184, 0.0, -0.27306418400947108, 0.0,
+  -0.076522914358626418, -0.0, -0.033868303910121113, -0.0,
+  -0.64674399329134713, -0.0, 0.5474641423703922, -0.0,
+  -0.01077831900835536, -0.0, 0.073553692330396506, -0.0,
+  -0.35163822696079555, -0.0, -0.015490412255863241, -0.0,
+  0.065963267884842178, -0.0, 0.02394317523075257, -0.0,
+  0.0064530077445592755, -0.0, 0.092840109489870107, -0.0,
+  -0.0061970581860947751, -0.0, -0.0050221324846994979, -0.0,
+  -0.018145220558722433, -0.0, 0.39927696189864875, -0.0,
+  -0.054627224050181243, -0.0, -0.00055598165458886216, -0.0,
+  0.0095780592534531923, -0.0, 0.00051737051648128544, -0.0,
+  0.3346121963114716, -0.0, 0.029010271558406717, -0.0,
+  0.16276505129491178, -0.0, 0.33198792413055261, -0.0,
+  0.020510300315925267, -0.0, 0.1596434374116053, -0.0,
+  -0.45543604501253049, -0.0, 0.036365924172123698, -0.0,
+  -0.058921923126160576, -0.0, 0.0049032366739756861, -0.0,
+  -0.0079313015142049581, -0.0, -0.029209560442231278, -0.0,
+  0.0030547101847806591, -0.0, 0.0066446079841322604, -0.0,
+  0.029102833532653267, -0.0, -0.72008447511744211, -0.0,
+  0.20539706817779529, -0.0, 0.0028130135655531669, -0.0,
+  0.0010342070867471881, -0.0, -0.05626147718806418, -0.0,
+  -0.38964339970784784, -0.0, -0.18292806617523688, -0.0,
+  -0.18081722011532264, -0.0, -0.20961774686499299, -0.0,
+  -0.14970012925752718, -0.0, -0.17108138987711921, -0.0,
+  -0.22150467234645738, -0.0, -0.39628451495990685, -0.0,
+  -0.15034411619106008, -0.0, -0.16495904187707155, -0.0,
+  -0.3817277269831712, -0.0, -0.35992608600418979, -0.0,
+  -0.065977355766753162, -0.0, -0.17786561333663034, -0.0,
+  -0.22664762355175513, -0.0, -0.31115749218351368, -0.0,
+  -0.26180752127006435, -0.0, -0.046930547781219238, -0.0,
+  -0.13378828544148236, -0.0, -0.28942740530825772, -0.0,
+  -0.046809536521273877, -0.0, 0.030618146172877166, -0.0,
+  -0.45360947147413727, -0.0, -0.052348821250639839, -0.0,
+  0.017013413791774824, -0.0, -0.26193871247958689, -0.0,
+  0.40930563140326687, -0.0, 0.12851464543021773, -0.0,
+  0.14498604207637686, -0.0, -0.040263201843376499, -0.0,
+  0.021049723290020934, -0.0, 0.092376119950423233, -0.0,
+  -0.0050152277646366063, -0.0, 0.0062795075889017244, -0.0,
+  0.059486153209961222, -0.0, -0.538038766017085, -0.0,
+  0.51638340582469822, -0.0, 0.0027016996447905054, -0.0,
+  0.0018688227732058741, -0.0, -0.032559573805777203, -0.0,
+  -0.73521529731943103, -0.0, 0.016151725098450833, -0.0,
+  0.12788511827378687, -0.0, 0.087169558995821073, -0.0,
+  0.0017915139754303502, -0.0, 0.10570548872707995, -0.0,
+  -0.098547071787460888, -0.0, 0.090313226422178969, -0.0,
+  -0.067289803094852121, -0.0, -0.43894784124430813, -0.0,
+  0.022933130946160323, -0.0, -0.076961158463932047, -0.0,
+  0.012299631573736838, -0.0, 0.030074998257943963, -0.0,
+  0.060823034595899383, -0.0, 0.063898846641405424, -0.0,
+  0.34878891004612694, -0.0, -0.0009025607063356954, -0.0,
+  -0.0048330512445186073, -0.0, 0.45486160030681511, -0.0,
+  0.68424539662098094, 0.0, 0.0051332860582816459, 0.0,
+  -0.094396563158183483, 0.0, -0.0032054188546427184, 0.0,
+  -0.00060834196727707949, 0.0, -0.14164292571763593, 0.0,
+  0.057418585326146396, 0.0, -0.14437316106061937, 0.0,
+  0.057763731036241495, 0.0, -0.51806237858764859, 0.0,
+  0.034900023928048744, 0.0, 0.10477710128358304, 0.0,
+  0.012928775416590972, 0.0, 0.035941152833061929, 0.0,
+  -0.075840976462999463, 0.0, -0.082116653332863804, 0.0,
+  -0.36331469746014816, 0.0, 0.000138630799244967, 0.0,
+  -0.0054783618996283494, 0.0, 0.43579279519946973, 0.0,
+  0.22831270497519554, 0.0, -0.17134625515991089, 0.0,
+  -0.28645892821191693, 0.0, -0.4659977127775809, 0.0,
+  0.0010968686544213185, 0.0, 0.74833118339934668, 0.0,
+  0.039545074152331772, 0.0, 0.033779835150700877, 0.0,
+  -0.17144718039178691, 0.0, -0.046979652871828405, 0.0,
+  0.19000694333844773, 0.0, 0.24003814932789244, 0.0,
+  -0.45112564252695636, 0.0, 0.012610430246594102, 0.0,
+  -0.11372460221535327, 0.0, -0.043377449511259589, 0.0,
+  0.1495878998624405, 0.0, 0.0036761136739944856, 0.0,
+  0.0077382814009783665, 0.0, 0.095733939484249617, 0.0,
+  0.21723609366014091, 0.0, -0.086550553661280963, 0.0,
+  -0.29823703331393642, 0.0, -0.38588397811579628, 0.0,
+  0.0028162195017163816, 0.0, 0.65368405620728764, 0.0,
+  0.067379397267728666, 0.0, 0.027815991253003089, 0.0,
+  -0.12625399638331108, 0.0, -0.11303733199115994, 0.0,
+  -0.35919500702032575, 0.0, -0.14933202453517169, 0.0,
+  0.64259201495529916, 0.0, 0.0076987441952449344, 0.0,
+  -0.10453650765609666, 0.0, -0.0076628850408208887, 0.0,
+  0.13252580815909468, 0.0, 0.0042395748696147928, 0.0,
+  0.018666552060051689, 0.0, -0.14396513441128184, 0.0,
+  -0.18671863213978185, 0.0, 0.047475128156372393, 0.0,
+  -0.070599894985018577, 0.0, -0.11790124557275215, 0.0,
+  -0.18789953118376587, 0.0, -0.067245761812667545, 0.0,
+  -0.12176281253097684, 0.0, -0.25213236601115591, 0.0,
+  -0.026349181543483136, 0.0, -0.011882376923084741, 0.0,
+  0.12720907091531516, 0.0, -0.10618052503529694, 0.0,
+  -0.00020799556141329646, 0.0, 0.25900021647652943, 0.0,
+  -0.11316131166452138, 0.0, -0.11546269271246148, 0.0,
+  -0.1074688322337887, 0.0, 0.93152050439921419, 0.0,
+  0.18724311764769677, 0.0, -0.067474877684959175, 0.0,
+  0.10048564520533687, -0.0, 0.084000526692086214, -0.0,
+  0.071325760770467622, -0.0, 0.10982599967358751, -0.0,
+  -0.92059673803759723, -0.0, 0.087844148079977716, -0.0,
+  0.11661322139751353, -0.0, 0.15761392635856797, -0.0,
+  0.05121850323728866, -0.0, 0.0061766487954459061, -0.0,
+  0.046604679813688543, -0.0, 0.19872045024771537, -0.0,
+  0.016301870586575083, -0.0, -0.14114250693754754, -0.0,
+  0.076029479548048465, -0.0, 0.0347959812042586, -0.0,
+  0.064779954527106068, -0.0, -0.01303432072567548, -0.0,
+  -0.1719574900787027, -0.0, 0.024394259641860636, -0.0,
+  0.14630367597764507, -0.0, 0.1204384686103462, -0.0,
+  0.0815058963066949, -0.0, 0.13155964850234617, -0.0,
+  0.26000004948908434, -0.0, 0.080720047725553162, -0.0,
+  0.12942836290500584, -0.0, 0.25931363538068003, -0.0,
+  0.033221255789045931, -0.0, -0.1224310389718057, -0.0,
+  -0.53111456260386825, -0.0, 0.21274848843359756, -0.0,
+  -0.046043426059136368, -0.0, -0.64036279383061512, -0.0,
+  0.11949154106080476, -0.0, 0.15192250657966208, -0.0,
+  0.077709275224324179, -0.0, 0.13543828215974746, -0.0,
+  -0.47299764810987011, -0.0, -0.12685166456924185, -0.0,
+  -0.28658203821585237, -0.0, -0.55535112676339926, -0.0,
+  0.029027619718852128, -0.0, -0.041969693488918415, -0.0,
+  0.018336670905917028, -0.0, -0.0014028626555052494, -0.0,
+  -0.060754664619063453, -0.0, 0.21495928485626226, -0.0,
+  0.14975291740391647, -0.0, 0.078532699075858692, -0.0,
+  -0.10421194104210542, -0.0, 0.65282249831613615, -0.0,
+  0.056674065830140043, -0.0, 0.0075946625832189691, -0.0,
+  0.23119171620051501, -0.0, -0.24456902337253844, -0.0,
+  -0.30010350892770499, -0.0, 0.015642781971148517, -0.0,
+  -0.0046391835583969388, -0.0, 0.14504912578151893, -0.0,
+  -0.28863397067759439, -0.0, 0.33685162709108973, -0.0,
+  -0.13961975194260423, -0.0, 0.14397739307732341, -0.0,
+  0.019774152515526253, -0.0, 0.15035732443858882, -0.0,
+  0.27218359435721784, -0.0, 0.28762229122373545, -0.0,
+  -0.25232435213649185, -0.0, 0.12502072862160235, -0.0,
+  -0.067878042090908655, -0.0, -0.17493768695131889, -0.0,
+  -0.0091604441563646038, -0.0, -0.014223679758855072, -0.0,
+  0.24237369583769885, -0.0, -0.35288848395039291, -0.0,
+  -0.55728564311807727, -0.0, -0.0038932044111749881, -0.0,
+  0.047915958031351548, -0.0, 0.2347684939996478, -0.0,
+  0.020052065666547079, -0.0, 0.089519460792500005, -0.0,
+  0.087368226427170875, -0.0, 0.12270770490172149, -0.0,
+  -0.055419696439479874, -0.0, 0.065764888889930748, -0.0,
+  0.11329776177262851, -0.0, 0.17567201875337254, -0.0,
+  0.099860851670710432, -0.0, -0.21733360860718559, -0.0,
+  -0.87905148327030225, -0.0, 0.16681502174564083, -0.0,
+  -0.096732644440196899, -0.0, 0.22466038647045028, -0.0,
+  0.042666851855914442, -0.0, 0.079809467015236141, -0.0,
+  -0.00037512111953915523, -0.0, -0.014816894434873063, -0.0,
+  0.3525233046236243, -0.0, -0.37698856227387118, -0.0,
+  0.2726825758506371, -0.0, -0.38279154408448296, -0.0,
+  -0.019707031478896801, -0.0, 0.035790851092228675, -0.0,
+  -0.042326188471342896, -0.0, -0.11300865448753342, -0.0,
+  0.016776541637892564, -0.0, 0.67153741562619895, -0.0,
+  -0.15324639122627681, -0.0, 0.018364501949767978, -0.0,
+  -0.12225961406759697, -0.0, -0.62203773969925324, -0.0,
+  -0.03647735878008497, -0.0, 0.028700357049455356, -0.0,
+  0.095296238156501914, -0.0, 0.12938873945519011, -0.0,
+  0.082782883974310176, -0.0, 0.025888429244573644, -0.0,
+  0.0083466319267624638, -0.0, 0.10629935633194852, -0.0,
+  0.092302075908844289, -0.0, -0.26352214259866785, -0.0,
+  0.061211460888129572, -0.0, 0.33529910697158521, -0.0,
+  0.010028924033791979, -0.0, -0.057917478116589392, -0.0,
+  0.34800758188575848, -0.0, -0.43819694023805389, -0.0,
+  -0.60595381692174743, -0.0, -0.10652066441801721, -0.0,
+  0.18245495104345855, -0.0, 0.31559127916054808, -0.0,
+  0.026325279127026657, -0.0, -0.029409725076500963, -0.0,
+  0.10356541840048779, -0.0, 0.080060320647986918, -0.0,
+  0.12819943718704591, -0.0, 0.0084393198210090826, -0.0,
+  0.067998469458649846, -0.0, -0.25796285716474493, -0.0,
+  -0.11953505850322281, -0.0, -0.26332402116313885, -0.0,
+  0.12128189263819325, -0.0, 0.37011494189178235, -0.0,
+  0.027454607233505273, -0.0, 0.29516358366871132, -0.0,
+  0.42154016998413951, -0.0, -0.266947377259728, -0.0,
+  0.38617171805565326, -0.0, -0.072672954111103943, -0.0,
+  0.245083473309539, -0.0, -0.46933392100984278, -0.0,
+  -0.019189489154232336, -0.0, -0.09403947198904003, -0.0,
+  -0.18120966431851654, -0.0, -0.12792150949633663, -0.0,
+  -0.14647288410015011, -0.0, 0.009687099189938644, -0.0,
+  0.024978630047326374, -0.0, -0.14082976491347649, -0.0,
+  -0.12851661362446129, -0.0, 0.033074407481994209, -0.0,
+  0.043418967412275418, -0.0, 0.10269030047322329, -0.0,
+  0.026624249567524089, -0.0, -0.042670262174295329, -0.0,
+  0.065151171248055778, -0.0, 0.57209002720087654, -0.0,
+  -0.10650352392262039, -0.0, -0.024108890513639247, -0.0,
+  0.13561057675991872, -0.0, 0.28772576510493769, -0.0,
+  0.02503754122736088, -0.0, 0.05324870699002629, -0.0,
+  -0.75815208426744729, -0.0, -0.065033434549950753, -0.0,
+  -0.085057834977302779, -0.0, -0.0016007599238425537, -0.0,
+  -0.045325971103173802, -0.0, -0.087702338409459651, -0.0,
+  -0.068279967936302394, -0.0, 0.058755433723378207, -0.0,
+  -0.019538979274868203, -0.0, -0.032162480127380252, -0.0,
+  0.045994718241733117, -0.0, 0.037955742151531968, -0.0,
+  -0.031145477693459472, -0.0, 0.26656805454006283, -0.0,
+  0.036291493476676449, -0.0, -0.27879798402358263, -0.0,
+  0.37789131794049674, -0.0, -0.021798480441882602, -0.0,
+  -0.003666614086800816, -0.0, 0.45697396676505009, -0.0,
+  0.30263957451725565, -0.0, 0.013093164192509155, -0.0,
+  -0.15369755224203943, -0.0, -0.0081396641279562129, -0.0,
+  -0.38823606597990101, -0.0, -0.59070019961452025, -0.0,
+  -0.047560226937818632, 0.0, 0.060853699972718625, 0.0,
+  -0.02792625598755049, 0.0, -0.1424932235041948, 0.0,
+  -0.0092965214079137378, 0.0, -0.037994613710625728, 0.0,
+  -0.15959395967146395, 0.0, 0.37307126534579987, 0.0,
+  0.034969757169004641, 0.0, -0.24357531027475152, 0.0,
+  0.57039891137866738, 0.0, 0.026676819942713256, 0.0,
+  0.022833955051475643, 0.0, -0.48566153158849418, 0.0,
+  0.16935595402396861, 0.0, 0.005805171295685637, 0.0,
+  -0.10238511843617326, 0.0, -0.0048754649102934876, 0.0,
+  0.39682347566457671, 0.0, -0.39942678341533161, 0.0
+};
@@ -6,5 +6,8 @@
 RateModel dayhoffModel();
 
 extern const char* dayhoffModelText;
+extern const EigenSystemHash dayhoffModelEigenHash;
+extern const double dayhoffModelEigen[];
+extern const size_t dayhoffModelEigenSize;
 
 #endif /* DAYHOFF_MODEL_INCLUDED */
@@ -100,6 +100,10 @@ void DiagonalEnvelope::initFull() {
 }
 
 void DiagonalEnvelope::initSparse (const KmerIndex& yKmerIndex, unsigned int bandSize, int kmerThreshold, size_t cellSize, size_t maxSize) {
+  initSparse (yKmerIndex, px->unvalidatedTokens (yKmerIndex.alphabet), bandSize, kmerThreshold, cellSize, maxSize);
+}
+
+void DiagonalEnvelope::initSparse (const KmerIndex& yKmerIndex, const UnvalidatedTokSeq& xTok, unsigned int bandSize, int kmerThreshold, size_t cellSize, size_t maxSize) {
   const unsigned int kmerLen = yKmerIndex.kmerLen;
   
   if (kmerThreshold >= 0) {
@@ -116,7 +120,6 @@ void DiagonalEnvelope::initSparse (const KmerIndex& yKmerIndex, unsigned int ban
     }
   }
 
-  const UnvalidatedTokSeq xTok = px->unvalidatedTokens (yKmerIndex.alphabet);
   const AlphTok alphabetSize = (AlphTok) yKmerIndex.alphabet.size();
   
   map<int,unsigned int> diagKmerCount;
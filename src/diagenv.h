@@ -50,6 +50,12 @@ struct DiagonalEnvelope {
 		   int kmerThreshold = DEFAULT_KMER_THRESHOLD,  // negative => use memory guides
 		   size_t cellSize = sizeof(double),
 		   size_t maxSize = 0);
+  void initSparse (const KmerIndex& yKmerIndex,
+		   const UnvalidatedTokSeq& xTok,  // precomputed tokens for x
+		   unsigned int bandSize = DEFAULT_BAND_SIZE,
+		   int kmerThreshold = DEFAULT_KMER_THRESHOLD,
+		   size_t cellSize = sizeof(double),
+		   size_t maxSize = 0);
   void initStorage();
   inline int getStorageIndexSafe (SeqIdx i, SeqIdx j) const {
     const int idx = storageIndex[yLen + i - j];
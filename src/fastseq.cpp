@@ -1,5 +1,11 @@
 #include <zlib.h>
 #include <iostream>
+#include <thread>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "fastseq.h"
 #include "util.h"
 #include "alignpath.h"
@@ -216,9 +222,163 @@ void initFastSeq (FastSeq& seq, kseq_t* ks) {
     seq.qual = string(ks->qual.s);
 }
 
+// character classes for parseFastSeqs: kseq_read keeps printable characters and stops at '>', '+' or '@'
+struct FastSeqCharClass {
+  enum Type { Residue, Ignored, Delimiter };
+  Type type[256];
+  FastSeqCharClass() {
+    for (int c = 0; c < 256; ++c)
+      type[c] = (c == '>' || c == '+' || c == '@') ? Delimiter : (isgraph(c) ? Residue : Ignored);
+  }
+};
+static const FastSeqCharClass fastSeqCharClass;
+
+// parses FASTA/FASTQ in memory, following the same rules as kseq_read
+void parseFastSeqs (const char* p, const char* end, vguard<FastSeq>& seqs) {
+  int lastChar = 0;
+  while (true) {
+    if (lastChar == 0) {
+      while (p < end && *p != '>' && *p != '@')
+	++p;
+      if (p == end)
+	break;
+      lastChar = *p++;
+    }
+    if (p == end)
+      break;
+
+    FastSeq seq;
+    const char* nameEnd = p;
+    while (nameEnd < end && !isspace ((unsigned char) *nameEnd))
+      ++nameEnd;
+    seq.name.assign (p, nameEnd);
+    p = nameEnd < end ? nameEnd + 1 : end;
+    if (nameEnd == end || *nameEnd != '\n') {
+      const char* commentEnd = (const char*) memchr (p, '\n', end - p);
+      if (!commentEnd)
+	commentEnd = end;
+      seq.comment.assign (p, commentEnd);
+      p = commentEnd < end ? commentEnd + 1 : end;
+    }
+
+    // copy each run of printable characters (i.e. each line) up to the next '>', '+' or '@'
+    const char* nextHeader = (const char*) memchr (p, '>', end - p);
+    seq.seq.reserve ((nextHeader ? nextHeader : end) - p);
+    int c = -1;
+    while (p < end) {
+      const char* runEnd = p;
+      while (runEnd < end && fastSeqCharClass.type[(unsigned char) *runEnd] == FastSeqCharClass::Residue)
+	++runEnd;
+      seq.seq.append (p, runEnd);
+      p = runEnd < end ? runEnd + 1 : end;
+      if (runEnd < end && fastSeqCharClass.type[(unsigned char) *runEnd] == FastSeqCharClass::Delimiter) {
+	c = *runEnd;
+	break;
+      }
+    }
+    if (c == '>' || c == '@')
+      lastChar = c;
+
+    if (c == '+') {
+      while (p < end && *p != '\n')
+	++p;
+      if (p < end) {
+	++p;
+	seq.qual.reserve (seq.seq.size());
+	while (p < end) {
+	  const unsigned char q = *p++;
+	  if (seq.qual.size() >= seq.seq.size())
+	    break;
+	  if (q >= 33 && q <= 127)
+	    seq.qual.push_back (q);
+	}
+	lastChar = 0;
+	if (seq.qual.size() != seq.seq.size())
+	  seq.qual.clear();
+      }
+    }
+
+    seqs.push_back (FastSeq());
+    swap (seqs.back(), seq);
+  }
+}
+
+// reads an uncompressed file via mmap, parsing large FASTA files in parallel
+// returns false if the file is not a regular file, is empty, or is gzipped
+bool readMappedFastSeqs (const char* filename, vguard<FastSeq>& seqs) {
+  const int fd = open (filename, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat (fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+    close (fd);
+    return false;
+  }
+  const size_t size = st.st_size;
+  void* mapped = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (mapped == MAP_FAILED)
+    return false;
+  const char* begin = (const char*) mapped;
+  const char* end = begin + size;
+  if (size >= 2 && (unsigned char) begin[0] == 0x1f && (unsigned char) begin[1] == 0x8b) {
+    munmap (mapped, size);
+    return false;
+  }
+  madvise (mapped, size, MADV_SEQUENTIAL);
+
+  // without FASTQ '+' lines, every newline followed by '>' starts a record, so the file can be split there
+  size_t threads = max ((size_t) 1, min ((size_t) thread::hardware_concurrency(), size / MinMappedFastaBytesPerThread));
+  if (threads > 1 && memchr (begin, '+', size))
+    threads = 1;
+  vguard<const char*> chunkStart (1, begin);
+  for (size_t n = 1; n < threads; ++n) {
+    const char* p = max (chunkStart.back(), begin + n * size / threads);
+    while ((p = (const char*) memchr (p, '\n', end - p)) && p + 1 < end && p[1] != '>')
+      ++p;
+    chunkStart.push_back (p && p + 1 < end ? p + 1 : end);
+  }
+  chunkStart.push_back (end);
+
+  if (threads > 1) {
+    vguard<vguard<FastSeq> > chunkSeqs (threads);
+    vguard<thread> chunkThreads;
+    for (size_t n = 0; n < threads; ++n)
+      chunkThreads.push_back (thread (parseFastSeqs, chunkStart[n], chunkStart[n+1], ref(chunkSeqs[n])));
+    size_t total = 0;
+    for (size_t n = 0; n < threads; ++n) {
+      chunkThreads[n].join();
+      total += chunkSeqs[n].size();
+    }
+    seqs.reserve (total);
+    for (auto& cs : chunkSeqs)
+      for (auto& s : cs) {
+	seqs.push_back (FastSeq());
+	swap (seqs.back(), s);
+      }
+  } else
+    parseFastSeqs (begin, end, seqs);
+
+  munmap (mapped, size);
+  LogThisAt(4, "Mapped " << size << " bytes of " << filename << " and parsed in " << plural(threads,"thread") << endl);
+  return true;
+}
+
 vguard<FastSeq> readFastSeqs (const char* filename) {
   vguard<FastSeq> seqs;
+  if (!readMappedFastSeqs (filename, seqs))
+    readGzippedFastSeqs (filename, seqs);
 
+  LogThisAt(3, "Read " << plural(seqs.size(),"sequence") << " from " << filename << endl);
+  
+  if (seqs.empty())
+    Warn ("Couldn't read any sequences from %s", filename);
+  
+  return seqs;
+}
+
+// streams gzipped (or unseekable) input through zlib & kseq
+void readGzippedFastSeqs (const char* filename, vguard<FastSeq>& seqs) {
   gzFile fp = gzopen(filename, "r");
   Require (fp != Z_NULL, "Couldn't open %s", filename);
 
@@ -234,13 +394,6 @@ vguard<FastSeq> readFastSeqs (const char* filename) {
   }
   kseq_destroy (ks);
   gzclose (fp);
-
-  LogThisAt(3, "Read " << plural(seqs.size(),"sequence") << " from " << filename << endl);
-  
-  if (seqs.empty())
-    Warn ("Couldn't read any sequences from %s", filename);
-  
-  return seqs;
 }
 
 set<string> fastSeqDuplicateNames (const vguard<FastSeq>& seqs) {
@@ -253,11 +406,46 @@ set<string> fastSeqDuplicateNames (const vguard<FastSeq>& seqs) {
   return dups;
 }
 
+TokenizedFastSeqs::TokenizedFastSeqs (const vguard<FastSeq>& seqs, const string& alphabet)
+  : alphabet (alphabet),
+    tok (seqs.size())
+{
+  UnvalidatedAlphTok charTok[256];
+  for (int c = 0; c < 256; ++c)
+    charTok[c] = c ? tokenize ((char) c, alphabet) : InvalidAlphabetToken;
+  for (size_t n = 0; n < seqs.size(); ++n) {
+    const string& seq = seqs[n].seq;
+    UnvalidatedTokSeq& t = tok[n];
+    t.resize (seq.size());
+    for (size_t pos = 0; pos < seq.size(); ++pos)
+      t[pos] = charTok[(unsigned char) seq[pos]];
+  }
+  LogThisAt(6, "Tokenized " << plural(seqs.size(),"sequence") << endl);
+}
+
+bool TokenizedFastSeqs::matches (const vguard<FastSeq>& seqs, const string& alph) const {
+  if (alph != alphabet || seqs.size() != tok.size())
+    return false;
+  for (size_t n = 0; n < seqs.size(); ++n)
+    if (seqs[n].length() != tok[n].size())
+      return false;
+  return true;
+}
+
 KmerIndex::KmerIndex (const FastSeq& seq, const string& alphabet, SeqIdx kmerLen)
   : seq(seq), alphabet(alphabet), kmerLen(kmerLen)
 {
+  init (seq.unvalidatedTokens (alphabet));
+}
+
+KmerIndex::KmerIndex (const FastSeq& seq, const UnvalidatedTokSeq& tok, const string& alphabet, SeqIdx kmerLen)
+  : seq(seq), alphabet(alphabet), kmerLen(kmerLen)
+{
+  init (tok);
+}
+
+void KmerIndex::init (const UnvalidatedTokSeq& tok) {
   LogThisAt(5, "Building " << kmerLen << "-mer index for " << seq.name << endl);
-  const UnvalidatedTokSeq tok = seq.unvalidatedTokens (alphabet);
   const AlphTok alphabetSize = (AlphTok) alphabet.size();
   const SeqIdx seqLen = seq.length();
   for (SeqIdx j = 0; j + kmerLen <= seqLen; ++j)
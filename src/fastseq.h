@@ -12,6 +12,7 @@
 using namespace std;
 
 #define DefaultFastaCharsPerLine 50
+#define MinMappedFastaBytesPerThread (1 << 26)  /* files are parsed in chunks at least this big */
 #define InvalidAlphabetToken -1
 
 // alphabets
@@ -69,18 +70,35 @@ struct FastSeq {
   void writeFastq (ostream& out) const;
 };
 
-vguard<FastSeq> readFastSeqs (const char* filename);
+vguard<FastSeq> readFastSeqs (const char* filename);  // memory-maps uncompressed files; uses zlib for gzipped files
+bool readMappedFastSeqs (const char* filename, vguard<FastSeq>& seqs);
+void readGzippedFastSeqs (const char* filename, vguard<FastSeq>& seqs);
+void parseFastSeqs (const char* begin, const char* end, vguard<FastSeq>& seqs);
 void writeFastaSeqs (ostream& out, const vguard<FastSeq>& fastSeqs);
 void writeFastqSeqs (ostream& out, const vguard<FastSeq>& fastSeqs);
 
 set<string> fastSeqDuplicateNames (const vguard<FastSeq>& seqs);
 
+// tokens for every sequence in a dataset, computed once and shared by guide alignment & profile construction
+struct TokenizedFastSeqs {
+  string alphabet;
+  vguard<UnvalidatedTokSeq> tok;  // InvalidAlphabetToken marks characters outside the alphabet
+  TokenizedFastSeqs() { }
+  TokenizedFastSeqs (const vguard<FastSeq>& seqs, const string& alphabet);
+  size_t size() const { return tok.size(); }
+  const UnvalidatedTokSeq& operator[] (size_t n) const { return tok[n]; }
+  bool matches (const vguard<FastSeq>& seqs, const string& alph) const;
+};
+
 struct KmerIndex {
   const FastSeq& seq;
   const string& alphabet;
   const SeqIdx kmerLen;
   map <Kmer, vector<SeqIdx> > kmerLocations;
   KmerIndex (const FastSeq& seq, const string& alphabet, SeqIdx kmerLen);
+  KmerIndex (const FastSeq& seq, const UnvalidatedTokSeq& tok, const string& alphabet, SeqIdx kmerLen);
+private:
+  void init (const UnvalidatedTokSeq& tok);
 };
 
 #endif /* KSEQCONTAINER_INCLUDED */
@@ -25,6 +25,7 @@ DPMatrix::DPMatrix (const Profile& x, const Profile& y, const PairHMM& hmm, cons
     insy (y.size(), -numeric_limits<double>::infinity()),
     rootsubx (x.size(), -numeric_limits<double>::infinity()),
     rootsuby (y.size(), -numeric_limits<double>::infinity()),
+    linRoot (hmm.components() * hmm.alphabetSize()),
     startCell (0, 0, PairHMM::SSS),
     endCell (xSize - 1, ySize - 1, PairHMM::EEE),
     envelope (env),
@@ -55,6 +56,12 @@ DPMatrix::DPMatrix (const Profile& x, const Profile& y, const PairHMM& hmm, cons
 	log_accum_exp (rootsuby[j], logInnerProduct (hmm.logRoot[cpt], suby.state[j].lpAbsorb[cpt]));
       }
 
+  initLinearAbsorb (subx, linSubx, logScaleSubx);
+  initLinearAbsorb (suby, linSuby, logScaleSuby);
+  for (int cpt = 0; cpt < components(); ++cpt)
+    for (AlphTok tok = 0; tok < alphSize; ++tok)
+      linRoot[cpt*alphSize + tok] = exp (hmm.logRoot[cpt][tok]);
+
   xNearStart[0] = true;
   for (ProfileStateIndex i = 0; i < xSize; ++i)
     if (xNearStart[i])
@@ -65,6 +72,22 @@ DPMatrix::DPMatrix (const Profile& x, const Profile& y, const PairHMM& hmm, cons
     yNearEnd[y.trans[yt].src] = true;
 }
 
+void DPMatrix::initLinearAbsorb (const Profile& sub, vguard<vguard<double> >& lin, vguard<LogProb>& logScale) {
+  lin = vguard<vguard<double> > (sub.size());
+  logScale = vguard<LogProb> (sub.size(), -numeric_limits<double>::infinity());
+  for (ProfileStateIndex i = 0; i < sub.size(); ++i)
+    if (!sub.state[i].isNull()) {
+      const auto& lpAbsorb = sub.state[i].lpAbsorb;
+      for (const auto& lpa : lpAbsorb)
+	for (auto lp : lpa)
+	  logScale[i] = max (logScale[i], lp);
+      lin[i].reserve (lpAbsorb.size() * lpAbsorb.front().size());
+      for (const auto& lpa : lpAbsorb)
+	for (auto lp : lpa)
+	  lin[i].push_back (exp (lp - logScale[i]));
+    }
+}
+
 ForwardMatrix::ForwardMatrix (const Profile& x, const Profile& y, const PairHMM& hmm, AlignRowIndex parentRowIndex, const GuideAlignmentEnvelope& env, SumProduct* sumProd)
   : DPMatrix (x, y, hmm, env),
     parentRowIndex (parentRowIndex),
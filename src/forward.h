@@ -24,6 +24,9 @@ protected:
   vguard<LogProb> insx, insy;  // insert-on-branch probabilities by x & y indices
   vguard<LogProb> rootsubx, rootsuby;  // insert-at-root-then-substitute probabilities by x & y indices
   vguard<vguard<LogProb> > absorbScratch;  // scratch space for computing absorb profiles
+  vguard<vguard<double> > linSubx, linSuby;  // linSubx[xpos][cpt*alphSize + tok] = exp(subx absorb weight - logScaleSubx[xpos])
+  vguard<LogProb> logScaleSubx, logScaleSuby;
+  vguard<double> linRoot;  // linRoot[cpt*alphSize + tok] = exp(hmm.logRoot[cpt][tok])
   
 public:
   struct CellCoords {
@@ -119,10 +122,19 @@ protected:
   }
 
   inline LogProb computeLogProbAbsorb (ProfileStateIndex xpos, ProfileStateIndex ypos) {
+    const double* xlin = linSubx[xpos].data();
+    const double* ylin = linSuby[ypos].data();
+    double p = 0;
+    for (size_t n = 0; n < linRoot.size(); ++n)
+      p += linRoot[n] * xlin[n] * ylin[n];
+    if (p >= LOG_SUM_EXP_LINEAR_MIN)
+      return log(p) + logScaleSubx[xpos] + logScaleSuby[ypos];
     initAbsorbScratch (xpos, ypos);
     return logInnerProduct (hmm.logRoot, absorbScratch);
   }
 
+  static void initLinearAbsorb (const Profile& sub, vguard<vguard<double> >& lin, vguard<LogProb>& logScale);
+
   LogProb lpCellEmitOrAbsorb (const CellCoords& c);
   
   bool isAbsorbing (const CellCoords& c) const;
@@ -5,6 +5,7 @@ RateModel jcModel() {
   RateModel m;
   ParsedJson pj (jcModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, jcModelEigenHash, jcModelEigen, jcModelEigenSize);
   return m;
 }
 
@@ -24,3 +25,26 @@ const char* jcModelText =
 "    \"delextprob\" : 0.66\n"
 "}\n"
 ;
+
+const EigenSystemHash jcModelEigenHash = 0x199dcf4452cfdf26ULL;
+const size_t jcModelEigenSize = 72;
+const double jcModelEigen[] = {
+  -1.3332000000000004, 0.0, 0.0, 0.0,
+  -1.3331999999999999, 0.0, -1.3332000000000004, 0.0,
+  -0.86602540378443849, 0.0, 0.5, 0.0,
+  0.097011177180076041, 0.0, 0.50798080876817175, 0.0,
+  0.28867513459481292, 0.0, 0.50000000000000011, 0.0,
+  0.15064734971880048, 0.0, -0.80803871778003833, 0.0,
+  0.28867513459481287, 0.0, 0.5, 0.0,
+  -0.80838270714539118, 0.0, 0.0016855115916286861, 0.0,
+  0.28867513459481287, 0.0, 0.5, 0.0,
+  0.56072418024651483, 0.0, 0.29837239742023752, 0.0,
+  -0.86602540378443882, -0.0, -0.26391957437955404, -0.0,
+  0.37237015458133776, -0.0, 0.75757482358265493, -0.0,
+  0.5, 0.0, 0.49999999999999961, 0.0,
+  0.50000000000000011, 0.0, 0.5, 0.0,
+  -0.0, -0.0, 0.21296414922275275, -0.0,
+  -0.79419048530288316, -0.0, 0.58122633608013041, -0.0,
+  0.0, 0.0, -0.98275554935334841, 0.0,
+  0.29435633154256707, 0.0, 0.68839921781078139, 0.0
+};
@@ -6,5 +6,8 @@
 RateModel jcModel();
 
 extern const char* jcModelText;
+extern const EigenSystemHash jcModelEigenHash;
+extern const double jcModelEigen[];
+extern const size_t jcModelEigenSize;
 
 #endif /* JC_MODEL_INCLUDED */
@@ -6,5 +6,8 @@
 RateModel jcrnaModel();
 
 extern const char* jcrnaModelText;
+extern const EigenSystemHash jcrnaModelEigenHash;
+extern const double jcrnaModelEigen[];
+extern const size_t jcrnaModelEigenSize;
 
 #endif /* JCRNA_MODEL_INCLUDED */
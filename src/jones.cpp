@@ -5,6 +5,7 @@ RateModel jonesModel() {
   RateModel m;
   ParsedJson pj (jonesModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, jonesModelEigenHash, jonesModelEigen, jonesModelEigenSize);
   return m;
 }
 
@@ -462,3 +463,418 @@ const char* jonesModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash jonesModelEigenHash = 0xd56231729c1c58eaULL;
+const size_t jonesModelEigenSize = 1640;
+const double jonesModelEigen[] = {
+  -1.8886392025191463, 0.0, -1.8009701014097006, 0.0,
+  -4.824005359121368e-16, 0.0, -1.6107610445784919, 0.0,
+  -1.5232702353040932, 0.0, -1.3976014313762406, 0.0,
+  -1.2986391852477208, 0.0, -1.2685486416145824, 0.0,
+  -1.1695665527132302, 0.0, -0.31171884228746904, 0.0,
+  -0.34428415026623671, 0.0, -0.45436042212624705, 0.0,
+  -1.0492179651176228, 0.0, -0.99682532932757661, 0.0,
+  -0.85506481907960585, 0.0, -0.55981248768426528, 0.0,
+  -0.60941444420872048, 0.0, -0.65000383819684771, 0.0,
+  -0.76456442283696313, 0.0, -0.7168551418894038, 0.0,
+  0.30074640205222752, 0.0, -0.13501883693323929, 0.0,
+  -0.22360679774997858, 0.0, -0.31508750825870396, 0.0,
+  0.40665893503756467, 0.0, 0.11388764179012124, 0.0,
+  -0.13712953559926883, 0.0, 0.091271646495781664, 0.0,
+  -0.3137762177373572, 0.0, -0.028723282701892998, 0.0,
+  0.029530887983299815, 0.0, -0.089418941685317818, 0.0,
+  -0.034849600430793375, 0.0, 0.11982382684418956, 0.0,
+  -0.17106241410603437, 0.0, -0.075440636676136152, 0.0,
+  -0.088366159046263187, 0.0, -0.14422946709742335, 0.0,
+  0.1025068321410315, 0.0, -0.034695031568223032, 0.0,
+  -0.00047211952365844908, 0.0, -0.074958993234481963, 0.0,
+  -0.22360679774997885, 0.0, -0.070527922336350385, 0.0,
+  -0.14870307269832025, 0.0, -0.31434862353287701, 0.0,
+  -0.568825705069675, 0.0, 0.16808414573949385, 0.0,
+  0.084259333534271091, 0.0, -0.01424408499209163, 0.0,
+  0.17307356050709871, 0.0, 0.069810861063788435, 0.0,
+  0.076161373500100313, 0.0, -0.069081350217344184, 0.0,
+  -0.020604837523728999, 0.0, 0.053694986143566645, 0.0,
+  0.44267218279492893, 0.0, -0.0080659351884581863, 0.0,
+  -0.016930669488013254, 0.0, 0.28742255564784491, 0.0,
+  0.063943898770566762, 0.0, -0.5134503246840465, 0.0,
+  -0.22360679774997871, 0.0, -0.42207723623022425, 0.0,
+  -0.25719226310002596, 0.0, -0.1920262065403657, 0.0,
+  0.31815056890006355, 0.0, -0.051954981958474263, 0.0,
+  0.45008000186548575, 0.0, -0.038964696514552477, 0.0,
+  0.13013257287372942, 0.0, 0.050699998822056488, 0.0,
+  -0.06026730212641649, 0.0, 0.48609379628131694, 0.0,
+  -0.131768102264436, 0.0, 0.015675481025471939, 0.0,
+  -0.050422005781751031, 0.0, 0.0056954507679959918, 0.0,
+  0.076179210603411929, 0.0, -0.094505240854491274, 0.0,
+  -0.019320195690254817, 0.0, 0.18189900752792079, 0.0,
+  -0.22360679774997896, 0.0, 0.30669508696692216, 0.0,
+  0.54642793349884977, 0.0, -0.19360600765614222, 0.0,
+  -0.10826205004165651, 0.0, 0.040831198545487862, 0.0,
+  0.27815745471478509, 0.0, -0.058770155051150456, 0.0,
+  0.2304680772517215, 0.0, 0.076585177057051132, 0.0,
+  0.10018452527752181, 0.0, 0.08756535997959114, 0.0,
+  -0.0032840155041917989, 0.0, 0.10681691093897273, 0.0,
+  -0.33348141411129917, 0.0, 0.26979034430729587, 0.0,
+  -0.048336724209412735, 0.0, -0.29794706925307823, 0.0,
+  0.016636512545722307, 0.0, -0.067563752535746632, 0.0,
+  -0.22360679774997877, 0.0, 0.026003236204946826, 0.0,
+  0.033878100864999115, 0.0, 0.025904892893486502, 0.0,
+  0.034986813232424183, 0.0, -0.014692883417824669, 0.0,
+  0.012795212712607248, 0.0, 0.05490870053322372, 0.0,
+  -0.068097762519253882, 0.0, 0.33337823942952605, 0.0,
+  -0.00098918411659532361, 0.0, -0.083482750725982199, 0.0,
+  0.041450697003704615, 0.0, -0.92901444449495474, 0.0,
+  0.27199506080209707, 0.0, 0.57607981018620869, 0.0,
+  -0.18730551805052215, 0.0, -0.17200680166301369, 0.0,
+  0.0019892031861006932, 0.0, 0.011657216439952187, 0.0,
+  -0.22360679774997894, 0.0, 0.038774592086044349, 0.0,
+  0.15248375233200176, 0.0, -0.36650182646116342, 0.0,
+  0.34236658028390721, 0.0, -0.11974260942934563, 0.0,
+  -0.34726336524718032, 0.0, -0.035911182368088157, 0.0,
+  0.15256383710190743, 0.0, 0.077141319346562459, 0.0,
+  -0.54773050873417239, 0.0, -0.24628670155181645, 0.0,
+  0.17268270208177067, 0.0, 0.11505414179330291, 0.0,
+  0.28146684873464634, 0.0, 0.038792748912198069, 0.0,
+  -0.049551899812341912, 0.0, -0.079325947787357284, 0.0,
+  0.0025126220045612567, 0.0, -0.073488138397132058, 0.0,
+  -0.22360679774997905, 0.0, -0.16090997667353524, 0.0,
+  -0.46748408509370371, 0.0, 0.19755704925847997, 0.0,
+  -0.092074837536356313, 0.0, 0.0021348180539940845, 0.0,
+  -0.2606644271975192, 0.0, -0.059368989359238067, 0.0,
+  0.24484526518345032, 0.0, 0.066230499843721841, 0.0,
+  0.07664779403616287, 0.0, -0.22380752913146776, 0.0,
+  0.028796228214371097, 0.0, 0.13325851162758387, 0.0,
+  -0.23582101570841232, 0.0, 0.29876335007844101, 0.0,
+  -0.091607338534019242, 0.0, -0.26364771614608146, 0.0,
+  -0.0094928148036645676, 0.0, -0.051331164688320143, 0.0,
+  -0.22360679774997883, 0.0, 0.062779617195400095, 0.0,
+  -0.0081987507531936319, 0.0, 0.022646192973975805, 0.0,
+  0.074618937609391672, 0.0, -0.037798039128343702, 0.0,
+  0.053125103901767404, 0.0, -0.032375633452287958, 0.0,
+  0.1889439607830018, 0.0, -0.010204217404190422, 0.0,
+  -0.0074491829133083148, 0.0, -0.13037146995461968, 0.0,
+  0.23749237996473538, 0.0, -0.11160556096245398, 0.0,
+  -0.376036881566915, 0.0, -0.16551032606521895, 0.0,
+  -0.13539877882585366, 0.0, 0.57389524037636119, 0.0,
+  -0.0085597465911637065, 0.0, 0.10339737363550866, 0.0,
+  -0.22360679774997905, 0.0, 0.10478669054726007, 0.0,
+  0.029737235635524214, 0.0, 0.73322624363148248, 0.0,
+  -0.31252293711513052, 0.0, 0.098659521361079389, 0.0,
+  0.50053645474218256, 0.0, -0.012894785119594229, 0.0,
+  0.034727933059697555, 0.0, 0.23072650201199799, 0.0,
+  -0.67682234897379823, 0.0, 0.12394597607488926, 0.0,
+  0.30099814403006858, 0.0, 0.07735262374103348, 0.0,
+  0.19541714326374532, 0.0, -0.072885497561382989, 0.0,
+  0.18277933614033343, 0.0, -0.079629229772411117, 0.0,
+  0.68078359635705221, 0.0, 0.084210343394044596, 0.0,
+  -0.22360679774997921, 0.0, 0.24053268256952098, 0.0,
+  -0.21064154621091835, 0.0, -0.05718469828200004, 0.0,
+  0.10916992267177873, 0.0, 0.069137890697472018, 0.0,
+  0.18949496453494932, 0.0, 0.00029051125955338532, 0.0,
+  -0.21976633644828256, 0.0, -0.23126463529342456, 0.0,
+  -0.01346165381928772, 0.0, -0.31095047520992403, 0.0,
+  -0.091329315007080802, 0.0, 0.0027758957747654757, 0.0,
+  -0.01757361053687681, 0.0, 0.13190334106889806, 0.0,
+  0.28076815530218474, 0.0, 0.043984109712707685, 0.0,
+  -0.0069282653874748676, 0.0, -0.022350070434179373, 0.0,
+  -0.2236067977499793, 0.0, 0.016620304506915873, 0.0,
+  0.0036996563359276776, 0.0, 0.012906763316654087, 0.0,
+  0.031778243879071591, 0.0, 0.10829363119482818, 0.0,
+  -0.087578640903372557, 0.0, 0.024503822072004931, 0.0,
+  -0.29859303085573113, 0.0, -0.1704792956844623, 0.0,
+  0.062714771380932552, 0.0, 0.29664527123822659, 0.0,
+  0.35969966858223851, 0.0, 0.077566918640358931, 0.0,
+  0.077491714210441931, 0.0, 0.12791552191177824, 0.0,
+  -0.24381699331906315, 0.0, 0.0083347434441993894, 0.0,
+  0.00038602769787291321, 0.0, 0.095234980926876378, 0.0,
+  -0.22360679774997921, 0.0, 0.07438441641091588, 0.0,
+  0.18080977438212009, 0.0, 0.28207620096327035, 0.0,
+  0.34330489006657883, 0.0, -0.066474696842229161, 0.0,
+  0.001073065000660674, 0.0, -0.038593410518757761, 0.0,
+  0.20632956016969933, 0.0, 0.070565038590723939, 0.0,
+  0.29930243737013973, 0.0, 0.010383365115382424, 0.0,
+  -0.16464605690404324, 0.0, 0.11453316014576996, 0.0,
+  0.46681630032474625, 0.0, 0.077678382660951645, 0.0,
+  0.0040656244044589415, 0.0, 0.23116944846089824, 0.0,
+  -0.030173096694893532, 0.0, 0.042360280999179115, 0.0,
+  -0.22360679774997919, 0.0, -0.21169277973741146, 0.0,
+  0.12074427112644803, 0.0, 0.010938050254041947, 0.0,
+  -0.40754650548425392, 0.0, -0.94114774477651186, 0.0,
+  0.082312413132106271, 0.0, 0.0040992930277994697, 0.0,
+  -0.21798204354697098, 0.0, -0.22230386555232967, 0.0,
+  0.050506336422073889, 0.0, -0.0081562352368472427, 0.0,
+  0.10484376145129437, 0.0, 0.028482426840033555, 0.0,
+  0.052555441284856841, 0.0, 0.14884872176716304, 0.0,
+  0.13566342847838916, 0.0, 0.046628854895788059, 0.0,
+  -0.0026363648443191107, 0.0, -0.030199673956690105, 0.0,
+  -0.22360679774997907, 0.0, 0.0036072109723446215, 0.0,
+  0.019617498789401992, 0.0, 0.019739051909195036, 0.0,
+  -0.030188957179438432, 0.0, -0.037268262845093804, 0.0,
+  0.064403837685994017, 0.0, 0.069123129830281266, 0.0,
+  -0.46393038187695912, 0.0, 0.33093326373124166, 0.0,
+  -0.12416368504808045, 0.0, -0.15729406969864859, 0.0,
+  -0.59469871532692631, 0.0, 0.13990757375779447, 0.0,
+  -0.14736980906168384, 0.0, -0.034868988825922653, 0.0,
+  -0.51010545063156243, 0.0, 0.14626500047307753, 0.0,
+  -0.0075294650274807477, 0.0, -0.08906330516110568, 0.0,
+  -0.22360679774997874, 0.0, 0.025833909299426947, 0.0,
+  -0.0038996038272691692, 0.0, 0.014319771927994267, 0.0,
+  0.029447009400648736, 0.0, -0.032018395292745312, 0.0,
+  0.1785616685446178, 0.0, -0.029364154445670091, 0.0,
+  0.014305838658143938, 0.0, -0.084971188444551066, 0.0,
+  0.17251727880781906, 0.0, -0.35328520041440403, 0.0,
+  0.14796883177947406, 0.0, -0.079420139931008646, 0.0,
+  0.14362797424365514, 0.0, -0.54655637209245889, 0.0,
+  -0.25144832438676673, 0.0, -0.53091872438291476, 0.0,
+  -0.06473078198443788, 0.0, 0.72552618763992327, 0.0,
+  -0.22360679774997863, 0.0, -0.11190918315541161, 0.0,
+  -0.25950429596367558, 0.0, -0.077093929329561092, 0.0,
+  0.034164228718964719, 0.0, -0.0036972879016275695, 0.0,
+  -0.041809268056225868, 0.0, -0.022828338679907939, 0.0,
+  0.042593749854137095, 0.0, -0.02041279379895158, 0.0,
+  -0.034025271250915493, 0.0, 0.28376587434232997, 0.0,
+  -0.13620153897084275, 0.0, -0.088063640892764888, 0.0,
+  -0.045687233778844913, 0.0, -0.1629788502898083, 0.0,
+  0.023544993493409994, 0.0, -0.048064752048185451, 0.0,
+  -0.24489973220106523, 0.0, -0.31939521728247328, 0.0,
+  -0.22360679774997919, 0.0, 0.6431286237031284, 0.0,
+  -0.18466230146591167, 0.0, 0.021140580474105053, 0.0,
+  -0.072742978160653032, 0.0, -0.055021489022781526, 0.0,
+  -0.22087571373516801, 0.0, -0.026067102864190846, 0.0,
+  0.0090643242923014265, 0.0, -0.090024074790430786, 0.0,
+  -0.041908851104313687, 0.0, 0.27347616127047186, 0.0,
+  -0.2370724864126825, 0.0, -0.063584883367314743, 0.0,
+  -0.018556733053194444, 0.0, -0.1266040552274654, 0.0,
+  0.15681825778595831, 0.0, -0.057336676122102775, 0.0,
+  0.0053495007376151635, 0.0, -0.0020007417587074392, 0.0,
+  -0.22360679774997921, 0.0, 0.0042743652782900937, 0.0,
+  0.010258454837147542, 0.0, 0.019164431100298772, 0.0,
+  0.028203671318519918, 0.0, -0.0099340665960616116, 0.0,
+  0.0012131685676710518, 0.0, 0.98548203899507048, 0.0,
+  0.42877264328543419, 0.0, -0.14376447621314567, 0.0,
+  -0.0095351539980660319, 0.0, 0.00039673694382209347, 0.0,
+  -0.028349428009653475, 0.0, 0.057792580921961052, 0.0,
+  -0.061811460374717256, 0.0, -0.016979730579579345, 0.0,
+  0.02855430208941144, 0.0, -0.08917144573568099, 0.0,
+  -0.001635716548964663, 0.0, -0.016143594590384575, 0.0,
+  -0.2236067977499788, 0.0, -0.011768807041486497, 0.0,
+  -0.0017237663662604036, 0.0, -0.10592140956661948, 0.0,
+  0.055374388979682831, 0.0, -0.0068243400307926695, 0.0,
+  -0.16444872132504995, 0.0, 0.069441900972163351, 0.0,
+  -0.33729157472998184, 0.0, 0.68845520232190227, 0.0,
+  0.26537348201392752, 0.0, -0.0089835359555332801, 0.0,
+  0.36889418872546625, 0.0, 0.077612653609560336, 0.0,
+  -0.12806923902159212, 0.0, -0.18837270456406735, 0.0,
+  0.55439253305776859, 0.0, -0.038887730887655424, 0.0,
+  -0.6131501450634006, 0.0, -0.0063203928608539959, 0.0,
+  -0.22360679774997916, 0.0, -0.21233715126001901, 0.0,
+  0.10142405755565255, 0.0, 0.0022760588432117132, 0.0,
+  0.07455009169007, 0.0, 0.14506433753444165, 0.0,
+  0.092058834582427071, 0.0, -0.0033906300427536734, 0.0,
+  -0.17851676051447291, 0.0, -0.21687800791919337, 0.0,
+  -0.020813539662624565, 0.0, -0.31149887330284753, 0.0,
+  -0.10267743294129368, 0.0, -0.016448984846634023, 0.0,
+  -0.045587635491596112, 0.0, 0.10354451336788041, 0.0,
+  0.26447883247604942, 0.0, 0.03805146734485032, 0.0,
+  0.38018797993097997, 0.0, -0.00040197382001120669, 0.0,
+  0.044915693121177235, 0.0, -0.016402895348205972, 0.0,
+  0.0054265543125643911, 0.0, 0.0013352388146062868, 0.0,
+  0.0025589233668610999, 0.0, -0.011438052547072837, 0.0,
+  -0.0032349004209514622, 0.0, 0.60284726631403562, 0.0,
+  -0.010487930569276592, 0.0, 0.00037308676370751163, 0.0,
+  -0.011841368507900985, 0.0, -0.0017424577455650947, 0.0,
+  -0.0063127895252458391, 0.0, -0.07331775792307893, 0.0,
+  -0.23624212072325299, 0.0, 0.0012565914672813458, 0.0,
+  -0.00086491018785270983, 0.0, -0.66661417677279799, 0.0,
+  -0.17524686071645079, 0.0, -0.065528088042697372, 0.0,
+  -0.37030141284359935, 0.0, 0.15856132464189929, 0.0,
+  -0.022627343380786535, 0.0, 0.0080340143888080074, 0.0,
+  -0.076843176635526839, 0.0, -0.06350327746800731, 0.0,
+  0.04012060367308614, 0.0, 0.076563467518676723, 0.0,
+  -0.03473778536734435, 0.0, 0.094503048116805571, 0.0,
+  0.017068634837324067, 0.0, -0.020493537959965533, 0.0,
+  -0.07666796570566646, 0.0, 0.84374139681758775, 0.0,
+  -0.31634092027511845, 0.0, -0.00048253612692584255, 0.0,
+  -0.0087643790205535945, 0.0, -0.0070552064515437716, 0.0,
+  -0.34322714704716051, -0.0, -0.23116894848093483, -0.0,
+  -0.19071404708690953, -0.0, -0.23051154515295386, -0.0,
+  -0.088561619755237186, -0.0, -0.18224830218984131, -0.0,
+  -0.27651188958573419, -0.0, -0.32714536223476703, -0.0,
+  -0.10260858474292565, -0.0, -0.2404262606504706, -0.0,
+  -0.41100677180150902, -0.0, -0.26240678688876834, -0.0,
+  -0.10655300471081505, -0.0, -0.17944874788156556, -0.0,
+  -0.22763596460946894, -0.0, -0.30752612141942431, -0.0,
+  -0.26191038029416941, -0.0, -0.0637770670771826, -0.0,
+  -0.14356436486303195, -0.0, -0.29518303852670869, -0.0,
+  -0.4383570683758416, 0.0, -0.066085439926311162, 0.0,
+  -0.32627951645235415, 0.0, 0.2865594259130757, 0.0,
+  0.009334437445086205, 0.0, 0.02864348960289103, 0.0,
+  -0.18034826952350591, 0.0, 0.083248157221472885, 0.0,
+  0.043581785563851248, 0.0, 0.23440733337245012, 0.0,
+  0.027688737334463035, 0.0, 0.079117439045345073, 0.0,
+  -0.091429626214902582, 0.0, 0.0026237785259372341, 0.0,
+  0.023836704146702734, 0.0, -0.13949637892199138, 0.0,
+  0.68275634987150113, 0.0, 0.0011049722575139855, 0.0,
+  -0.0068484816097260197, 0.0, -0.25405782927565917, 0.0,
+  0.53322784779980237, 0.0, -0.13132587800604364, 0.0,
+  -0.18738786157103524, 0.0, 0.48120091810066873, 0.0,
+  0.011462133981894985, 0.0, 0.10616660621855793, 0.0,
+  -0.49383459816291891, 0.0, -0.010246825129245258, 0.0,
+  0.011656956199879848, 0.0, -0.19347587029615881, 0.0,
+  0.0058091318575521876, 0.0, 0.18125827419448226, 0.0,
+  0.049151084878025268, 0.0, 0.013448843497273589, 0.0,
+  -0.0033912689924532561, 0.0, -0.30487894685299843, 0.0,
+  -0.18477015707932959, 0.0, 0.0024994667695364052, 0.0,
+  -0.00094542249058886122, 0.0, 0.11437556508309893, 0.0,
+  0.24572924751383318, 0.0, -0.45681428949128139, 0.0,
+  -0.23021934014480475, 0.0, -0.28054990845332622, 0.0,
+  0.014422015964533168, 0.0, -0.41989263241131008, 0.0,
+  0.34340369265104481, 0.0, 0.046573040503999921, 0.0,
+  0.47295554147764801, 0.0, -0.086429172689056658, 0.0,
+  0.033347627636079034, 0.0, 0.46530758203194877, 0.0,
+  0.0073266295852953975, 0.0, 0.022267186237020096, 0.0,
+  0.020491587226587504, 0.0, -0.14903930346763769, 0.0,
+  0.034807131904242596, 0.0, 0.0076834999902798632, 0.0,
+  -0.09559364584955235, 0.0, 0.0042235097844555381, 0.0,
+  -0.24129500646796515, -0.0, -0.67413117291370672, -0.0,
+  0.31106495465935113, -0.0, -0.12793949354823037, -0.0,
+  0.015884942108167838, -0.0, 0.31988255398482457, -0.0,
+  -0.13052402867977961, -0.0, 0.1251484652750158, -0.0,
+  -0.16439980325357123, -0.0, 0.13456143295989154, -0.0,
+  0.066959865069194532, -0.0, 0.46183915701749878, -0.0,
+  -0.22262737898854795, -0.0, -0.027773092621065313, -0.0,
+  0.034365112646244492, -0.0, 0.053862850140821227, -0.0,
+  -0.097674115561166383, -0.0, 0.0092215916518615538, -0.0,
+  0.040755976184437208, -0.0, 0.11281719033672372, -0.0,
+  0.25385923917941383, -0.0, 0.31487030688839973, -0.0,
+  -0.080294415178216699, -0.0, 0.076271145457479123, -0.0,
+  -0.010544549801564079, -0.0, -0.17684291615984618, -0.0,
+  0.0047835479936725505, -0.0, -0.10020410118372171, -0.0,
+  0.082034806938716551, -0.0, 0.13470182700124783, -0.0,
+  0.36068439448556511, -0.0, -0.14135360452413895, -0.0,
+  -0.81264144089233692, -0.0, -0.054194478410283776, -0.0,
+  -0.059063053905959881, -0.0, -0.0092138415446733537, -0.0,
+  -0.11677785913236212, -0.0, -0.0051341324592665827, -0.0,
+  -0.0079393101955556392, -0.0, 0.34699843544343156, -0.0,
+  -0.53977167510751534, -0.0, 0.097623855173630925, -0.0,
+  0.43021033143371568, -0.0, 0.32136000267217651, -0.0,
+  0.0056793874569001672, -0.0, -0.31719833391483193, -0.0,
+  -0.36124680438875778, -0.0, 0.087106185770944117, -0.0,
+  0.25741144202243665, -0.0, 0.22834316300736343, -0.0,
+  -0.18040792669276207, -0.0, 0.0014112681173215241, -0.0,
+  0.043958156589678943, -0.0, 0.057924276230472922, -0.0,
+  0.20372182139076606, -0.0, -0.064441109946840769, -0.0,
+  -0.2899406537691257, -0.0, 0.0003877877891926315, -0.0,
+  -0.11832747350917887, -0.0, 0.13619629967441255, -0.0,
+  -0.14515429769169105, 0.0, -0.048481745744618228, 0.0,
+  -0.10941281101818587, 0.0, -0.19946362802301193, 0.0,
+  0.071598003557170345, 0.0, -0.096362351922444064, 0.0,
+  -0.24170612827329796, 0.0, -0.15594564037686692, 0.0,
+  -0.019481033925498218, 0.0, 0.0010283928936861027, 0.0,
+  0.14828492554780803, 0.0, -0.14910850581758611, 0.0,
+  0.0064311532791110583, 0.0, 0.18263248249560335, 0.0,
+  -0.098417555427822837, 0.0, -0.10336428710669728, 0.0,
+  -0.10052166480757117, 0.0, 0.92539564761669302, 0.0,
+  0.14678526148345322, 0.0, -0.014736216738234735, 0.0,
+  0.051468092291117928, 0.0, 0.20316091497461303, 0.0,
+  0.12602265735667487, 0.0, 0.2697636287094678, 0.0,
+  -0.030623746987282957, 0.0, 0.14118710348404795, 0.0,
+  0.34378383700442466, 0.0, 0.31387282584009379, 0.0,
+  0.018094332541768478, 0.0, -0.2683014407244857, 0.0,
+  -0.62317292878716812, 0.0, 0.27492640313483468, 0.0,
+  -0.11794142074900289, 0.0, -0.42273984251247992, 0.0,
+  0.0165361397993164, 0.0, 0.066513196739659497, 0.0,
+  0.012055024027789362, 0.0, 0.13885820482819111, 0.0,
+  -0.24588502578703622, 0.0, -0.26757795518454219, 0.0,
+  -0.19001263077503699, 0.0, 0.099913415929438296, 0.0,
+  0.059863478177563496, 0.0, 0.10929711981647709, 0.0,
+  0.18279070790717508, 0.0, 0.087040598475530723, 0.0,
+  0.11338175049172637, 0.0, -0.020667682715315244, 0.0,
+  0.14657249966737121, 0.0, -0.34424087975948608, 0.0,
+  -0.43380238452445924, 0.0, 0.11463994309961023, 0.0,
+  -0.14665066292971402, 0.0, 0.36766489906968597, 0.0,
+  -0.11975230614367682, 0.0, -0.038864740692586275, 0.0,
+  -0.1459764147074506, 0.0, -0.056765889153687389, 0.0,
+  0.61191860097983952, 0.0, -0.39634942221300418, 0.0,
+  -0.077607004970665666, -0.0, 0.11423146720457811, -0.0,
+  -0.074573739757062427, -0.0, 0.14983553276616399, -0.0,
+  -0.0005683870508419196, -0.0, -0.64766721410882178, -0.0,
+  0.13751021467539945, -0.0, -0.015811420772268586, -0.0,
+  -0.4505882664470594, -0.0, -0.020999154546232399, -0.0,
+  0.16724005848746634, -0.0, 0.5095734672870269, -0.0,
+  0.034916689274413201, -0.0, -0.1445627881441896, -0.0,
+  0.25479738541052532, -0.0, -0.06788988872733133, -0.0,
+  -0.071216390159830306, -0.0, -0.0039456062680949013, -0.0,
+  0.24718702280517174, -0.0, -0.039861976958347492, -0.0,
+  0.16396476007991079, -0.0, -0.063667239019395985, -0.0,
+  0.36959702140639178, -0.0, 0.08047309804591736, -0.0,
+  -0.029475963040378389, -0.0, -0.17894936241343951, -0.0,
+  -0.24672559468494731, -0.0, -0.17003919176794813, -0.0,
+  0.050703954395802074, -0.0, -0.2980566586970515, -0.0,
+  0.48608487631575026, -0.0, 0.010862727644778166, -0.0,
+  -0.0034648237346359407, -0.0, -0.11253263374199797, -0.0,
+  -0.32062104446609141, -0.0, 0.34791077453041952, -0.0,
+  0.28556033852871959, -0.0, 0.00010087716968979168, -0.0,
+  -0.0051418531140940398, -0.0, -0.36658406343739824, -0.0,
+  -0.26440083365958184, -0.0, -0.021449900644795277, -0.0,
+  -0.11316693836155207, -0.0, -0.0034089801603947451, -0.0,
+  0.016531184835697252, -0.0, 0.14172253759570824, -0.0,
+  0.035857169968772244, -0.0, 0.34987832654269446, -0.0,
+  0.13908301873840259, -0.0, -0.098882330908179425, -0.0,
+  0.66575679563823487, -0.0, -0.1945597460707636, -0.0,
+  0.050307749257566127, -0.0, -0.48057815495935857, -0.0,
+  0.15168328171476234, -0.0, -0.18862125003949756, -0.0,
+  -0.27961499568501241, -0.0, -0.0081420813506960718, -0.0,
+  0.23849268376245125, -0.0, -0.13648753621445781, -0.0,
+  -0.23690878092069509, -0.0, 0.11356837580137856, -0.0,
+  0.027352545022463638, -0.0, 0.22528220012002131, -0.0,
+  -0.75276982187459318, -0.0, 0.19184917283019312, -0.0,
+  0.33713430861278898, -0.0, -0.33405716045393175, -0.0,
+  0.07261944564841856, -0.0, 0.0061063155105028129, -0.0,
+  0.29168876345195421, -0.0, 0.27497960879427807, -0.0,
+  0.027767505982180973, -0.0, 0.2297078517017247, -0.0,
+  -0.16541150328842524, -0.0, -0.24778375515173026, -0.0,
+  -0.15237045792718379, -0.0, 0.033723358221838091, -0.0,
+  0.10194674616192913, -0.0, -0.04442471824311519, -0.0,
+  -0.13005751846335104, 0.0, 0.43881310006010416, 0.0,
+  -0.041235442067081483, 0.0, -0.32963412937367015, 0.0,
+  0.10329384012143947, 0.0, 0.21996753935754088, 0.0,
+  -0.27961738527948515, 0.0, -0.52752016426757076, 0.0,
+  0.08598332044048973, 0.0, -0.018118020802777093, 0.0,
+  0.13657528020134102, 0.0, 0.52527765970375184, 0.0,
+  0.024013266607594803, 0.0, -0.11340098003464451, 0.0,
+  0.14019992067130396, 0.0, -0.060248290573937803, 0.0,
+  -0.020841169518477608, 0.0, -0.016904463908964551, 0.0,
+  -0.078842309527553237, 0.0, -0.057704053346053351, 0.0,
+  -0.25849403414090549, -0.0, -0.0097364159829266619, -0.0,
+  0.0056718623110001412, -0.0, 0.3247386488005673, -0.0,
+  0.26640544735148536, -0.0, 0.036917215920171567, -0.0,
+  0.43137604630335263, -0.0, -0.28273577063638167, -0.0,
+  -0.039051679418377644, -0.0, 0.16559704897656002, -0.0,
+  0.27452829929458539, -0.0, 0.1064363892331367, -0.0,
+  0.08281818443537288, -0.0, -0.032673426418670014, -0.0,
+  -0.64966689207909378, -0.0, -0.26171472345870522, -0.0,
+  -0.17314710033889499, -0.0, -0.0056547086487128816, -0.0,
+  -0.14121457463881448, -0.0, 0.15960018313524879, -0.0,
+  0.17725186951253294, -0.0, -0.01971787054387749, -0.0,
+  0.073194008483749934, -0.0, -0.056134037240442212, -0.0,
+  -0.083570404579637561, -0.0, -0.045496729915556193, -0.0,
+  -0.12761462761623513, -0.0, -0.22315771048178659, -0.0,
+  0.094485937134034817, -0.0, 0.34008394687183979, -0.0,
+  -0.50485810231481376, -0.0, 0.0053747553389980858, -0.0,
+  0.072825734087069424, -0.0, -0.46116546614910103, -0.0,
+  -0.28836729640050679, -0.0, 0.036478499626642805, -0.0,
+  0.20692154741050059, -0.0, 0.0091747127306374184, -0.0,
+  0.40097787312913907, -0.0, 0.39331336091681202, -0.0,
+  -0.046060206619485414, 0.0, 0.25699655906344915, 0.0,
+  -0.069713283735277035, 0.0, -0.26564935400548267, 0.0,
+  -0.05892073231524815, 0.0, -0.055918527332534954, 0.0,
+  -0.28197771573446617, 0.0, 0.72619015231119455, 0.0,
+  -0.031603354075607402, 0.0, 0.040902953843933443, 0.0,
+  0.013250070162599641, 0.0, 0.23462941873055412, 0.0,
+  0.019217523271378441, 0.0, 0.10152145038351729, 0.0,
+  -0.46746153925170375, 0.0, -0.05717230231955147, 0.0,
+  -0.058084758540665957, 0.0, -0.021997195557114789, 0.0,
+  -0.021594155331157862, 0.0, 0.043444997051668627, 0.0
+};
@@ -6,5 +6,8 @@
 RateModel jonesModel();
 
 extern const char* jonesModelText;
+extern const EigenSystemHash jonesModelEigenHash;
+extern const double jonesModelEigen[];
+extern const size_t jonesModelEigenSize;
 
 #endif /* JONES_MODEL_INCLUDED */
@@ -5,6 +5,7 @@ RateModel lgModel() {
   RateModel m;
   ParsedJson pj (lgModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, lgModelEigenHash, lgModelEigen, lgModelEigenSize);
   return m;
 }
 
@@ -462,3 +463,418 @@ const char* lgModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash lgModelEigenHash = 0x25f4453c4b9cf303ULL;
+const size_t lgModelEigenSize = 1640;
+const double lgModelEigen[] = {
+  -2.1161585752491998, 0.0, -2.0879732726732927e-16, 0.0,
+  -1.7991131391748827, 0.0, -1.6534242622833992, 0.0,
+  -0.26718046750031904, 0.0, -0.40553164685962428, 0.0,
+  -0.43276501116235599, 0.0, -0.48767792703894242, 0.0,
+  -0.54617220395411459, 0.0, -0.60825341318450266, 0.0,
+  -0.75391442704973133, 0.0, -1.4587299196517427, 0.0,
+  -1.4335179353250611, 0.0, -1.3370743802202938, 0.0,
+  -1.2517432888728222, 0.0, -1.1683943738967268, 0.0,
+  -0.91682365683555589, 0.0, -1.0633771740982705, 0.0,
+  -0.98565522505531122, 0.0, -1.0048426435720312, 0.0,
+  -0.1305935509557489, 0.0, 0.22360679774997896, 0.0,
+  -0.22264709277096681, 0.0, 0.032420852390626496, 0.0,
+  0.053669238066521761, 0.0, -0.046660738580786447, 0.0,
+  0.003302710135002176, 0.0, 0.14373989645885751, 0.0,
+  0.019823022234686016, 0.0, 0.010127146698457434, 0.0,
+  -0.23013104658774128, 0.0, 0.039162383862917038, 0.0,
+  -0.035109315756012921, 0.0, -0.44207203533652323, 0.0,
+  -0.39677046016718065, 0.0, -0.075047544495145738, 0.0,
+  0.06136818108348048, 0.0, -0.094786034371763958, 0.0,
+  0.21722053284248002, 0.0, -0.093292730109659605, 0.0,
+  -0.0036763099715847163, 0.0, 0.22360679774997891, 0.0,
+  -0.029642972609475512, 0.0, 0.015338266016196178, 0.0,
+  0.15842931384220307, 0.0, 0.065789388485661446, 0.0,
+  -0.074680566809299687, 0.0, -0.26882627071074122, 0.0,
+  0.060905540545390366, 0.0, 0.54755696414491839, 0.0,
+  0.089318287318952735, 0.0, 0.17001254929596576, 0.0,
+  -0.12717973387783674, 0.0, 0.40499187668242725, 0.0,
+  -0.45694621959430881, 0.0, -0.067105308352755536, 0.0,
+  -0.048778687506422204, 0.0, 0.19553897462363154, 0.0,
+  -0.037203276691136454, 0.0, 0.0020087718128695142, 0.0,
+  -0.013515886342417821, 0.0, 0.22360679774997894, 0.0,
+  -0.23525791783472774, 0.0, 0.057680120652153229, 0.0,
+  0.1715095649010637, 0.0, 0.045784779694293259, 0.0,
+  -0.063609589998570373, 0.0, -0.013956541466489805, 0.0,
+  -0.029070695111491168, 0.0, -0.10737710243813997, 0.0,
+  -0.088358146556344774, 0.0, 0.56628078701257445, 0.0,
+  -0.36379998283418341, 0.0, -0.19737033090164843, 0.0,
+  0.35601697017794082, 0.0, 0.10316980075404852, 0.0,
+  0.13007484644010722, 0.0, 0.11885090146222682, 0.0,
+  -0.45742459128668111, 0.0, -0.11678320748036744, 0.0,
+  -0.001305121975519211, 0.0, 0.22360679774997916, 0.0,
+  0.0074269508527395316, 0.0, -0.01545393111679725, 0.0,
+  0.25479515265141939, 0.0, 0.062036241245105428, 0.0,
+  -0.087899962446542024, 0.0, -0.078859543684117794, 0.0,
+  -0.01569670653835074, 0.0, -0.57056164551748279, 0.0,
+  0.089328190210160308, 0.0, -0.38456050180182239, 0.0,
+  0.061925460027920168, 0.0, -0.042605087906978929, 0.0,
+  -0.25978771693381275, 0.0, -0.11367788075979254, 0.0,
+  -0.016812645664309282, 0.0, 0.37483794180142666, 0.0,
+  -0.2711322832258829, 0.0, -0.045920058707193345, 0.0,
+  -0.054184602521765317, 0.0, 0.22360679774997883, 0.0,
+  -0.052861700392449314, 0.0, 0.0052768573476563337, 0.0,
+  -0.064346634781876466, 0.0, -0.029791474774035053, 0.0,
+  -0.02042614329427174, 0.0, 0.15009698214212056, 0.0,
+  -0.017814092485871368, 0.0, 0.056751467270451217, 0.0,
+  -0.78756951568391675, 0.0, -0.028202664961985802, 0.0,
+  0.0083963080572740101, 0.0, 0.054098387076960033, 0.0,
+  0.16295478313986086, 0.0, 0.030775243859094203, 0.0,
+  -0.93725162267014428, 0.0, 0.0068524754116208479, 0.0,
+  -0.35683674802449578, 0.0, 0.23128603810563667, 0.0,
+  -0.010308828083180857, 0.0, 0.22360679774997888, 0.0,
+  -0.019897913562091037, 0.0, -0.08180003428779116, 0.0,
+  0.1452110675097836, 0.0, 0.040462586824773966, 0.0,
+  -0.056567767331186875, 0.0, -0.1755313751224645, 0.0,
+  0.022471228764612154, 0.0, 0.058987154621837207, 0.0,
+  0.044234504053070486, 0.0, -0.55200666972647694, 0.0,
+  -0.60942698252021321, 0.0, -0.0028066734543994104, 0.0,
+  0.14017599871390332, 0.0, 0.2171949331164662, 0.0,
+  -0.0060767429770770169, 0.0, -0.4025860067141821, 0.0,
+  0.079139770464513759, 0.0, 0.080754048343901541, 0.0,
+  0.0010190795345426296, 0.0, 0.22360679774997907, 0.0,
+  0.007800897664993557, 0.0, 0.021230625159108642, 0.0,
+  0.2289573214556942, 0.0, 0.05212284340478629, 0.0,
+  -0.083688284203912638, 0.0, -0.1624168373854126, 0.0,
+  0.021742372920176556, 0.0, -0.39030182675625585, 0.0,
+  0.12163482118427212, 0.0, 0.32693240518612499, 0.0,
+  0.093320510083061803, 0.0, 0.15123745529840255, 0.0,
+  0.068072356549738811, 0.0, 0.018413358678490001, 0.0,
+  -0.10444510539124689, 0.0, -0.20383098131267821, 0.0,
+  0.35092612589230132, 0.0, 0.10053825173440871, 0.0,
+  0.0043457098824418224, 0.0, 0.22360679774997896, 0.0,
+  -0.021795336508473612, 0.0, 0.00055489194506246607, 0.0,
+  0.21504921784954847, 0.0, 0.013871162258885983, 0.0,
+  -0.069417977010226811, 0.0, 0.76530707421291178, 0.0,
+  -0.0973351041392337, 0.0, 0.18751366475319325, 0.0,
+  0.25984423765785836, 0.0, -0.031200885700644537, 0.0,
+  0.023644287069252579, 0.0, 0.078885407654134695, 0.0,
+  0.067775715755381799, 0.0, 0.020632588972444368, 0.0,
+  -0.04505515247665353, 0.0, 0.0073292870908128445, 0.0,
+  4.2244615949255614e-05, 0.0, 0.081373202763142874, 0.0,
+  0.00063025558171719745, 0.0, 0.22360679774997905, 0.0,
+  0.036741181807025736, 0.0, 0.011343004185167782, 0.0,
+  0.051725768233926772, 0.0, 0.10889179343949457, 0.0,
+  -0.015832986454675697, 0.0, -0.14536908150794406, 0.0,
+  -0.14658917800346125, 0.0, 0.10052080670196051, 0.0,
+  -0.059388062076668045, 0.0, -0.0066356818157704235, 0.0,
+  0.5764983928481443, 0.0, -0.057465724605602668, 0.0,
+  -0.36642211061493468, 0.0, 0.58215205913131507, 0.0,
+  0.15535633856194458, 0.0, -0.59147199576615561, 0.0,
+  -0.55645432684325091, 0.0, 0.41077071242705482, 0.0,
+  -0.72340137098583102, 0.0, 0.22360679774997907, 0.0,
+  0.18397462276382934, 0.0, -0.014787934325333044, 0.0,
+  -0.26833516118057865, 0.0, -0.13541341135555796, 0.0,
+  -0.074476382955175432, 0.0, 0.0018300151311607797, 0.0,
+  0.1024412848527339, 0.0, -0.042729764851017975, 0.0,
+  0.035542138510039956, 0.0, 0.020031984394408637, 0.0,
+  -0.028276373129726497, 0.0, 0.031582632323857093, 0.0,
+  0.06536382495555694, 0.0, 0.11763101230049869, 0.0,
+  0.046445419041602549, 0.0, 0.19841011584092744, 0.0,
+  0.033683753966564339, 0.0, 0.26511283796969942, 0.0,
+  0.072003121773665191, 0.0, 0.22360679774997866, 0.0,
+  -0.064187153610818504, 0.0, -0.15343534499956307, 0.0,
+  -0.29698854375681044, 0.0, -0.10362517018844833, 0.0,
+  -0.059914008187610585, 0.0, -0.027683974627109337, 0.0,
+  0.06090238482386752, 0.0, -0.030684837420669915, 0.0,
+  0.1832837869776075, 0.0, 0.041603348730902531, 0.0,
+  0.032419889390731038, 0.0, -0.021574845771650083, 0.0,
+  -0.026277108845576498, 0.0, -0.21624045467976064, 0.0,
+  -0.053456917321836911, 0.0, -0.23452748960970415, 0.0,
+  -0.17243371639264463, 0.0, -0.17459577654469505, 0.0,
+  0.0046346814379634458, 0.0, 0.22360679774997905, 0.0,
+  0.038710579662227532, 0.0, -0.016622154949962189, 0.0,
+  0.17815421923695621, 0.0, 0.052330230729719256, 0.0,
+  -0.079090727505102099, 0.0, -0.24763177117211663, 0.0,
+  0.057642717647446787, 0.0, 0.37341619950741928, 0.0,
+  0.075863177795666911, 0.0, -0.13348693767166181, 0.0,
+  0.27408315450611204, 0.0, -0.46247880216353637, 0.0,
+  0.3914115312859448, 0.0, -0.058822162920275083, 0.0,
+  -0.029107390691216088, 0.0, 0.12838447987841914, 0.0,
+  0.071974545966790024, 0.0, -0.043149622505107232, 0.0,
+  0.14618193878270158, 0.0, 0.22360679774997894, 0.0,
+  0.21916613060634629, 0.0, 0.975590038218904, 0.0,
+  -0.21941686241930289, 0.0, -0.085267544558021491, 0.0,
+  -0.060381523278997519, 0.0, -0.022781266265210504, 0.0,
+  0.061933571962252409, 0.0, -0.005377359663788185, 0.0,
+  0.085655588157394505, 0.0, -0.1545075220798551, 0.0,
+  -0.024982104974140721, 0.0, 0.040018018965176386, 0.0,
+  0.047571815802395792, 0.0, -0.1361380603107388, 0.0,
+  -0.0098125109504253426, 0.0, -0.17046569870171491, 0.0,
+  -0.087360871227620041, 0.0, -0.098126975605622224, 0.0,
+  -0.00093092310833878158, 0.0, 0.22360679774997907, 0.0,
+  -0.0088392327138407129, 0.0, 0.0064638344126900114, 0.0,
+  -0.36353779565859901, 0.0, 0.12301184389841943, 0.0,
+  0.040442365890055419, 0.0, -0.049746755002143185, 0.0,
+  -0.30841657770205605, 0.0, -0.022777752443098889, 0.0,
+  0.082464830371938344, 0.0, -0.0076709226249331089, 0.0,
+  0.017070967607387834, 0.0, 0.0056393634645043548, 0.0,
+  -0.04248919832204387, 0.0, 0.47393154631972512, 0.0,
+  -0.088851990127016015, 0.0, 0.20705491193874856, 0.0,
+  0.19159592967173419, 0.0, -0.51474290923752231, 0.0,
+  -0.0035716855210245384, 0.0, 0.22360679774997927, 0.0,
+  -0.018534166618653192, 0.0, 0.0073762657803013165, 0.0,
+  0.17386510631064692, 0.0, -0.20908883302927483, 0.0,
+  0.79636219908200756, 0.0, -0.089833188304043202, 0.0,
+  -0.044237361000710428, 0.0, 0.0012367171628836441, 0.0,
+  0.10502612833173812, 0.0, 0.006605884571346872, 0.0,
+  -0.00019979243994353824, 0.0, 0.017700081954564486, 0.0,
+  0.030917353190963472, 0.0, 0.0094760369045913725, 0.0,
+  -0.029519868841014183, 0.0, 0.033207292028961402, 0.0,
+  -0.033739555076441614, 0.0, 0.03562689695035489, 0.0,
+  0.11824716948346801, 0.0, 0.22360679774997916, 0.0,
+  0.76687479850694551, 0.0, -0.10120724453653278, 0.0,
+  0.10552707927696618, 0.0, -0.014468554504330362, 0.0,
+  0.0034781059714423224, 0.0, 0.092685252960802725, 0.0,
+  -0.00067255649953613494, 0.0, 0.0043398441918130583, 0.0,
+  -0.24979336952754183, 0.0, 0.047677519965707557, 0.0,
+  -0.005702340369993183, 0.0, 0.11790552021930703, 0.0,
+  0.023972561796987216, 0.0, -0.067968806559979972, 0.0,
+  0.10154179869584615, 0.0, -0.060765020621561819, 0.0,
+  0.00087700974306784509, 0.0, -0.20850091113519501, 0.0,
+  -0.0924621389232302, 0.0, 0.22360679774997871, 0.0,
+  -0.45857619761051216, 0.0, -0.0011263565606554314, 0.0,
+  0.038808617975337141, 0.0, -0.039689660995255442, 0.0,
+  -0.021718055568250384, 0.0, 0.029249464512518628, 0.0,
+  0.037255361013440236, 0.0, 0.010146573611332414, 0.0,
+  -0.27603745217569842, 0.0, -0.20319408210599729, 0.0,
+  0.2170690243265109, 0.0, 0.57660629209595637, 0.0,
+  0.27693273060912565, 0.0, -0.054619502547807584, 0.0,
+  0.15650625492323661, 0.0, -0.022962127127513721, 0.0,
+  0.055848323742150548, 0.0, -0.18001413521392517, 0.0,
+  -0.0050497884589128274, 0.0, 0.22360679774997874, 0.0,
+  -0.0014274950838920242, 0.0, -0.0035966944925209902, 0.0,
+  -0.4538540072835438, 0.0, 0.88709789126228211, 0.0,
+  0.5479003125809091, 0.0, 0.34767221924398395, 0.0,
+  0.7670909946343103, 0.0, -0.11735784649684183, 0.0,
+  -0.010919783830286047, 0.0, 0.00018288651498803705, 0.0,
+  0.0066524040288097322, 0.0, -0.01498836281108841, 0.0,
+  0.014721359216358953, 0.0, 0.014185754128330634, 0.0,
+  0.015698444874985951, 0.0, -0.0038807486030609582, 0.0,
+  -0.018576581002688847, 0.0, 0.017270970237895967, 0.0,
+  -0.0014278066231435574, 0.0, 0.22360679774997894, 0.0,
+  -0.0049157192986942671, 0.0, -0.0081538069619291713, 0.0,
+  -0.29387603192543027, 0.0, 0.25998971877116889, 0.0,
+  0.087512687562700087, 0.0, -0.099628632560198119, 0.0,
+  -0.49449887066979037, 0.0, 0.026530444866335209, 0.0,
+  -0.085677438330015551, 0.0, -0.0080156046115952492, 0.0,
+  -0.086167875263191612, 0.0, 0.0042827280595109894, 0.0,
+  0.095633661060217118, 0.0, -0.48893841864110793, 0.0,
+  0.088643409196594497, 0.0, 0.0077998741337043601, 0.0,
+  0.066350018175522607, 0.0, 0.4301075701492677, 0.0,
+  0.63814373559334392, 0.0, 0.22360679774997891, 0.0,
+  -0.052308106288557435, 0.0, -0.0401983909226407, 0.0,
+  -0.20892019130916642, 0.0, -0.12650081150509085, 0.0,
+  -0.061203687731517666, 0.0, 0.026609857171557894, 0.0,
+  0.0988073587777345, 0.0, -0.036769614690908663, 0.0,
+  -0.058131998762451766, 0.0, 0.0064071581247574444, 0.0,
+  -0.028445957897860447, 0.0, -0.023141298959565411, 0.0,
+  0.0045114449803294624, 0.0, 0.15606079002002463, 0.0,
+  0.058882105246995865, 0.0, 0.23750344563861933, 0.0,
+  0.11357920432923974, 0.0, 0.30068511277010296, 0.0,
+  -0.16032384761132698, -0.0, -0.0031932209924477126, -0.0,
+  -0.0088093234528416296, -0.0, -0.0010750768031676458, -0.0,
+  -0.010884189587333741, -0.0, -0.0065253630347117354, -0.0,
+  0.0011327206137636229, -0.0, 0.0038688538449621439, -0.0,
+  0.00021876508153786142, -0.0, -0.6981616680248065, -0.0,
+  0.11077157614692286, -0.0, 0.0046487804330412035, -0.0,
+  0.052093310617224206, -0.0, -0.00061145054972794723, -0.0,
+  -0.0024423457878521449, -0.0, 0.11235890919288399, -0.0,
+  -0.076501831807286175, -0.0, -0.00094606970195470694, -0.0,
+  -0.00075719948478360785, -0.0, 0.68513867090790515, -0.0,
+  0.35359354782444935, 0.0, 0.25017550728312432, 0.0,
+  0.18772666325635445, 0.0, 0.23725551942911768, 0.0,
+  0.05785596499386423, 0.0, 0.1823153841620839, 0.0,
+  0.32014200433259504, 0.0, 0.25641860283320894, 0.0,
+  0.099974499299516045, 0.0, 0.27797427658063351, 0.0,
+  0.44310325945405438, 0.0, 0.28889969379327929, 0.0,
+  0.10263988966330521, 0.0, 0.1891801059882865, 0.0,
+  0.19695267050551127, 0.0, 0.27368103035707819, 0.0,
+  0.23830647032759217, 0.0, 0.053960738472285538, 0.0,
+  0.15274565079735902, 0.0, 0.3092344756458803, 0.0,
+  -0.30602458347446609, 0.0, -0.028827135997094404, 0.0,
+  -0.17167425246200163, 0.0, 0.0068495466787075543, 0.0,
+  -0.011888422356526086, 0.0, -0.014101516243285114, 0.0,
+  0.0097078307372534846, 0.0, -0.021724413641288493, 0.0,
+  0.014278326691741309, 0.0, 0.19879135086388358, 0.0,
+  -0.11055745100576433, 0.0, 0.043472209228545521, 0.0,
+  0.087442903932828636, 0.0, -0.0065001740790632014, 0.0,
+  -0.014189591469702136, 0.0, 0.81583835200069366, 0.0,
+  -0.42479783850316366, 0.0, -0.00029942458820896814, 0.0,
+  -0.0029187095819038769, 0.0, -0.062877006731187193, 0.0,
+  0.10048407222812845, 0.0, 0.033634852008810466, 0.0,
+  0.09491188252674676, 0.0, -0.032138363838077506, 0.0,
+  0.0026760360639568018, 0.0, -0.13072097218325859, 0.0,
+  0.059576352262442352, 0.0, 0.0012471721851309917, 0.0,
+  0.0099399865452688523, 0.0, -0.036031354480276001, 0.0,
+  -0.59593490741281008, 0.0, -0.0420923210715606, 0.0,
+  0.8777119272789442, 0.0, 0.010718503479939256, 0.0,
+  0.01273406015340707, 0.0, -0.24278662815564803, 0.0,
+  -0.0023527738993379729, 0.0, -0.0017011785609426003, 0.0,
+  -0.010916860108427595, 0.0, -0.10895948502243717, 0.0,
+  0.091858845334508582, 0.0, 0.1918543060105346, 0.0,
+  0.15584954069569434, 0.0, 0.29261642943704591, 0.0,
+  -0.018020432137375142, 0.0, 0.12814871499667393, 0.0,
+  0.35480392534906191, 0.0, 0.26691846428655325, 0.0,
+  0.025031530702617998, 0.0, -0.36105504131863708, 0.0,
+  -0.6369947635708092, 0.0, 0.24913481084973835, 0.0,
+  -0.10901277565564106, 0.0, -0.33290188525426895, 0.0,
+  0.16575457527080711, 0.0, 0.13979763842208187, 0.0,
+  0.044766715536916336, 0.0, -0.11854555644806106, 0.0,
+  -0.21728224558334827, 0.0, -0.31272279692409494, 0.0,
+  -0.19041034257605066, 0.0, 0.18994822195186217, 0.0,
+  0.099193150348327805, 0.0, 0.16986206308439059, 0.0,
+  -0.019891829968178166, 0.0, 0.085135669397817609, 0.0,
+  0.19257741501611922, 0.0, 0.041048470097753191, 0.0,
+  0.12563741214289209, 0.0, -0.43441106784950484, 0.0,
+  -0.52991327028569724, 0.0, 0.17447544915958671, 0.0,
+  -0.10100305902469375, 0.0, 0.2685696831422924, 0.0,
+  -0.47525566953929438, 0.0, -0.045698761975502274, 0.0,
+  -0.10915605148628151, 0.0, 0.55243861181719456, 0.0,
+  0.45831030392431349, 0.0, -0.45145639737734655, 0.0,
+  0.0074253621223916043, 0.0, -0.11879420133323612, 0.0,
+  -0.075926154557844711, 0.0, -0.13260132433023145, 0.0,
+  -0.0075141067988852839, 0.0, -0.065574532391636575, 0.0,
+  -0.17035315100324297, 0.0, -0.11317860332084352, 0.0,
+  -0.010064563063844742, 0.0, -0.13163337987263507, 0.0,
+  -0.16880144757054785, 0.0, -0.14528323424283293, 0.0,
+  -0.039406066783332867, 0.0, 0.048646865911956216, 0.0,
+  0.99727597910900578, 0.0, 0.0060524380616775843, 0.0,
+  -0.032907858532449812, 0.0, 0.18798460329056205, 0.0,
+  0.084992914548925699, 0.0, -0.12033953924295629, 0.0,
+  0.22535162461884395, 0.0, -0.29819168592884548, 0.0,
+  -0.011616700835863161, 0.0, -0.082956346749576443, 0.0,
+  0.038503404876279727, 0.0, -0.14189173726145765, 0.0,
+  -0.23054342626200588, 0.0, 0.87009022840209005, 0.0,
+  -0.064437742673730369, 0.0, 0.002255476587347688, 0.0,
+  -0.054389168734314979, 0.0, -0.31719948935203229, 0.0,
+  -0.010367476762206659, 0.0, -0.041727201139601204, 0.0,
+  -0.078447249585942361, 0.0, 0.11246939780654613, 0.0,
+  0.030905287483431104, 0.0, 0.083181530766700318, 0.0,
+  -0.067473316389194488, 0.0, 0.036484591133532425, 0.0,
+  0.068136838048294984, -0.0, 0.14811852110583179, -0.0,
+  -0.053050459914987073, -0.0, -0.036202006289999963, -0.0,
+  -0.01001889027977884, -0.0, 0.039825195282535787, -0.0,
+  0.067663954557460382, -0.0, -0.24262011456770124, -0.0,
+  -0.1424619627258662, -0.0, 0.27681358613815144, -0.0,
+  0.26232943262623631, -0.0, 0.16188227746629102, -0.0,
+  0.061794536756717852, -0.0, -0.56718006015148026, -0.0,
+  -0.084695212304090592, -0.0, -0.0017892921078748903, -0.0,
+  0.086304290468578071, -0.0, 0.40237644095594216, -0.0,
+  -0.73424658185508607, -0.0, 0.29701950679082606, -0.0,
+  0.013951410584261121, 0.0, 0.53370440006434983, 0.0,
+  -0.078535195384094175, 0.0, -0.52740663098522178, 0.0,
+  0.012792396838132688, 0.0, 0.041899366019071335, 0.0,
+  -0.48682170253585411, 0.0, 0.18733077873695139, 0.0,
+  0.039153617182742441, 0.0, -0.046276637879940311, 0.0,
+  -0.05297310852083581, 0.0, 0.42030729067293071, 0.0,
+  -0.0021503638425312897, 0.0, -0.016788543500221263, 0.0,
+  0.00094898412842476306, 0.0, 0.0046274903455502982, 0.0,
+  0.0094206730559457021, 0.0, -0.024672701440455375, 0.0,
+  0.015788470967605987, 0.0, -0.044299994506812088, 0.0,
+  -0.57611224645970283, -0.0, 0.15820228024477881, -0.0,
+  -0.11743569467387677, -0.0, 0.1500487641237794, -0.0,
+  -0.32260017769227006, -0.0, 0.057096835951475577, -0.0,
+  0.27569452628848595, -0.0, 0.47172640072129984, -0.0,
+  -0.042035474536160973, -0.0, 0.069948068493908999, -0.0,
+  0.57498505576664272, -0.0, 0.15516925506532683, -0.0,
+  0.0622442790410518, -0.0, 0.11045154555973641, -0.0,
+  0.14644912890583819, -0.0, -0.48400869711631106, -0.0,
+  -0.46572699027441522, -0.0, -0.0041717616609469876, -0.0,
+  -0.09265372607952807, -0.0, -0.12727137166911245, -0.0,
+  0.065284378639550791, -0.0, 0.20052179885493862, -0.0,
+  0.50117986079358579, -0.0, -0.43014692603162752, -0.0,
+  -0.0076926170505872216, -0.0, -0.47446421801351218, -0.0,
+  0.49344238649310096, -0.0, -0.037718314321764021, -0.0,
+  -0.0031275957498532146, -0.0, 0.026252121476179776, -0.0,
+  0.086909861380655054, -0.0, -0.18181163604935061, -0.0,
+  -0.074765566342631609, -0.0, -0.0068416190727572284, -0.0,
+  0.0061337868187111861, -0.0, 0.061516862341945235, -0.0,
+  -0.22828780520533234, -0.0, 4.6525965262551481e-05, -0.0,
+  -0.0057721945842030414, -0.0, 0.0093409096576887486, -0.0,
+  -0.073351275948992808, -0.0, -0.18799386492553291, -0.0,
+  -0.40352422367412327, -0.0, 0.086809357437166265, -0.0,
+  0.0028702351690143646, -0.0, -0.65648675937273315, -0.0,
+  0.17652277217570142, -0.0, 0.035822569060240658, -0.0,
+  0.34054014312364633, -0.0, -0.04644182612103203, -0.0,
+  0.084878451745205155, -0.0, 0.46785405846275829, -0.0,
+  -0.015150472623324168, -0.0, 0.019081590799725091, -0.0,
+  -0.00023249943406426711, -0.0, -0.0092210166956486605, -0.0,
+  0.30564314788831776, -0.0, 0.0021209844181882334, -0.0,
+  -0.077766976251072109, -0.0, -0.051974395233440197, -0.0,
+  -0.57253301562215908, -0.0, 0.37110282659020233, -0.0,
+  -0.13570973143679504, -0.0, -0.037023796582756868, -0.0,
+  0.011463985276430718, -0.0, -0.0018742104927356807, -0.0,
+  0.17733937843326525, -0.0, 0.074088254767083223, -0.0,
+  -0.021042691391252373, -0.0, 0.032155561233183361, -0.0,
+  -0.035015135031080426, -0.0, -0.48937533197767519, -0.0,
+  0.015044401775380531, -0.0, 0.0039075875007162225, -0.0,
+  0.012768512677441682, -0.0, 0.11819034380521046, -0.0,
+  0.50329008223985605, -0.0, -0.0029623423178818734, -0.0,
+  0.0023960314432492952, -0.0, -0.02621071088968184, -0.0,
+  -0.59630298622105049, 0.0, -0.48588467246562472, 0.0,
+  0.28406647503982868, 0.0, -0.26197404098462224, 0.0,
+  0.04007177459460564, 0.0, 0.10862262587348898, 0.0,
+  0.092626822571556508, 0.0, 0.073866405126798734, 0.0,
+  -0.15570201433674094, 0.0, 0.077226328555870222, 0.0,
+  -0.049488677266745856, 0.0, 0.48062241257066934, 0.0,
+  0.020753398559080361, 0.0, -0.034164677290718516, 0.0,
+  0.025881384364772643, 0.0, 0.027885758665211847, 0.0,
+  0.28050037327553851, 0.0, 0.0033763628726937189, 0.0,
+  0.062087326080426698, 0.0, 0.0059296204149613379, 0.0,
+  -0.15895059693652658, 0.0, -0.10055947793266365, 0.0,
+  0.11601119417383789, 0.0, -0.16155248314946219, 0.0,
+  0.010665248751510672, 0.0, 0.23718889453644881, 0.0,
+  0.035309943057386849, 0.0, 0.031690172313224192, 0.0,
+  0.34861576301359937, 0.0, 0.19586091890506949, 0.0,
+  -0.57393569411966672, 0.0, -0.10179100818050763, 0.0,
+  -0.083698385279427426, 0.0, 0.53704716291917487, 0.0,
+  0.011179180332452613, 0.0, -0.11142321493966796, 0.0,
+  -0.077965939973627857, 0.0, 0.0045851300406318345, 0.0,
+  -0.44734682710340135, 0.0, 0.28907001957161393, 0.0,
+  0.28124011741545962, 0.0, -0.15816288830624536, 0.0,
+  0.31648196791150168, 0.0, -0.051698991609802375, 0.0,
+  -0.70280368564784301, 0.0, -0.014358989314757022, 0.0,
+  -0.4333715923475176, 0.0, -0.14973512205556747, 0.0,
+  0.20130191327200964, 0.0, 0.16733129875875746, 0.0,
+  -0.30700011859212423, 0.0, -0.10898834163547777, 0.0,
+  -0.013053471298605441, 0.0, -0.21785739775531052, 0.0,
+  -0.075353943479327681, 0.0, 0.36017970336062788, 0.0,
+  0.48338950942978975, 0.0, 0.010979035883151401, 0.0,
+  0.17548701687855001, 0.0, 0.23599397913273046, 0.0,
+  -0.17052252090065401, -0.0, 0.24889213981332939, -0.0,
+  0.113517155458247, -0.0, 0.45247326975163299, -0.0,
+  0.0020171058386798863, -0.0, -0.37343502724649991, -0.0,
+  -0.33200598590779368, -0.0, 0.0095619027404045646, -0.0,
+  -0.30085448056354502, -0.0, 0.28060892388221359, -0.0,
+  -0.52872732852316018, -0.0, 0.18870902312621668, -0.0,
+  -0.089019722954697442, -0.0, 0.19929392527211484, -0.0,
+  0.033275791482833314, -0.0, -0.084611891687844359, -0.0,
+  -0.027840755104172481, -0.0, -0.0010654337582649957, -0.0,
+  0.0060616311593252809, -0.0, 0.37367227812163328, -0.0,
+  0.42434225169119139, 0.0, -0.051420589533766332, 0.0,
+  -0.47441295477410483, 0.0, -0.35539280077550617, 0.0,
+  -0.11405879648928667, 0.0, 0.079713003543844085, 0.0,
+  0.62068240148499632, 0.0, 5.9845564235181052e-05, 0.0,
+  -0.30734760389497734, 0.0, 0.051729248044895169, 0.0,
+  -0.42212221017840279, 0.0, 0.11487805810719388, 0.0,
+  -0.049538654100977894, 0.0, 0.20025013300025279, 0.0,
+  -0.036712359316773822, 0.0, 0.0013260508693202779, 0.0,
+  0.073528726964463068, 0.0, -0.0055380228123524423, 0.0,
+  0.055991353964840195, 0.0, 0.19404291864091514, 0.0,
+  -0.17090023944061847, -0.0, 0.0026035500563649297, -0.0,
+  -0.1135787009280107, -0.0, -0.05644289698595089, -0.0,
+  0.069324715441932, -0.0, 0.076274287159569451, -0.0,
+  0.16674949438750064, -0.0, 0.10809895019436463, -0.0,
+  0.21275474074079975, -0.0, 0.3817911916799126, -0.0,
+  -0.40080138701106927, -0.0, -0.064582465302684355, -0.0,
+  -0.052178924969895853, -0.0, -0.50449442847092207, -0.0,
+  0.036352175682739907, -0.0, -0.29562638346879533, -0.0,
+  -0.22224550182039149, -0.0, 0.004828198951765509, -0.0,
+  0.34035840265894546, -0.0, 0.48171522144444323, -0.0
+};
@@ -6,5 +6,8 @@
 RateModel lgModel();
 
 extern const char* lgModelText;
+extern const EigenSystemHash lgModelEigenHash;
+extern const double lgModelEigen[];
+extern const size_t lgModelEigenSize;
 
 #endif /* LG_MODEL_INCLUDED */
@@ -27,6 +27,10 @@ using namespace std;
 /* comment to disable interpolation */
 #define LOG_SUM_EXP_INTERPOLATE
 
+/* smallest rescaled linear-space sum that is trusted without falling back to log-space.
+   Terms that underflow after rescaling are < 1e-300, so the relative error is below 1e-200 per term */
+#define LOG_SUM_EXP_LINEAR_MIN 1e-100
+
 typedef double LogProb;
 
 double log_sum_exp_unary_slow (double x);  /* does not use lookup table */
@@ -9,6 +9,11 @@
 #include <gsl/gsl_complex_math.h>
 
 #include <iomanip>
+#include <fstream>
+#include <cstdio>
+#include <cfloat>
+#include <cstring>
+#include <unistd.h>
 #include <algorithm>
 #include <set>
 
@@ -24,13 +29,30 @@
 #define EIGENMODEL_NEAR_EQ_COMPLEX(X,Y) (EIGENMODEL_NEAR_EQ(GSL_REAL(X),GSL_REAL(Y)) && EIGENMODEL_NEAR_EQ(GSL_IMAG(X),GSL_IMAG(Y)))
 #define EIGENMODEL_NEAR_REAL(X) (abs(GSL_IMAG(X)) < EIGENMODEL_EPSILON)
 
+#define EIGENCACHE_VERSION 1
+#define EIGENCACHE_MAGIC "HISTEIGN"
+#define EIGENCACHE_MAGIC_LEN 8
+#define EIGENCACHE_FNV_OFFSET 0xcbf29ce484222325ULL
+#define EIGENCACHE_FNV_PRIME 0x100000001b3ULL
+
 struct DistanceMatrixParams {
   const map<pair<AlphTok,AlphTok>,int>& pairCount;
   const RateModel& model;
-  DistanceMatrixParams (const map<pair<AlphTok,AlphTok>,int>& pairCount, const RateModel& model)
+  const EigenModel& eigen;
+  const double expectedRate;  // model.expectedSubstitutionRate()
+  vguard<pair<AlphTok,AlphTok> > pairs;  // keys of pairCount
+  vguard<double> counts;  // values of pairCount
+  DistanceMatrixParams (const map<pair<AlphTok,AlphTok>,int>& pairCount, const RateModel& model, const EigenModel& eigen, double expectedRate)
     : pairCount(pairCount),
-      model(model)
-  { }
+      model(model),
+      eigen(eigen),
+      expectedRate(expectedRate)
+  {
+    for (const auto& pc : pairCount) {
+      pairs.push_back (pc.first);
+      counts.push_back (pc.second);
+    }
+  }
   double tJC() const;  // Jukes-Cantor estimate
   double tML (int maxIterations) const;
   double negLogLike (double t) const;
@@ -333,6 +355,15 @@ vguard<gsl_matrix*> RateModel::getSubProbMatrix (double t) const {
   return v;
 }
 
+SharedSubProbMatrices RateModel::getSharedSubProbMatrix (double t) const {
+  return SharedSubProbMatrices (new SubProbMatrices (getSubProbMatrix (t)));
+}
+
+SubProbMatrices::~SubProbMatrices() {
+  for (auto m: subMat)
+    gsl_matrix_free (m);
+}
+
 double RateModel::expectedSubstitutionRate() const {
   double R = 0;
   for (int c = 0; c < components(); ++c) {
@@ -372,6 +403,14 @@ double RateModel::expectedDeletionLength() const {
 }
 
 ProbModel::ProbModel (const RateModel& model, double t)
+  : ProbModel (model, t, model.getSharedSubProbMatrix (t))
+{ }
+
+ProbModel::ProbModel (const RateModel& model, double t, const EigenModel& eigen)
+  : ProbModel (model, t, SharedSubProbMatrices (new SubProbMatrices (eigen.getSubProbMatrix (t))))
+{ }
+
+ProbModel::ProbModel (const RateModel& model, double t, const SharedSubProbMatrices& subMat)
   : AlphabetOwner (model),
     t (t),
     ins (1 - exp (-model.insRate * t)),
@@ -382,7 +421,8 @@ ProbModel::ProbModel (const RateModel& model, double t)
     delWait (IndelCounts::decayWaitTime (model.delRate, t)),
     cptWeight (model.cptWeight),
     insVec (model.components()),
-    subMat (model.getSubProbMatrix (t))
+    sharedSubMat (subMat),
+    subMat (subMat->subMat)
 {
   for (int c = 0; c < model.components(); ++c) {
     insVec[c] = model.newAlphabetVector();
@@ -391,8 +431,6 @@ ProbModel::ProbModel (const RateModel& model, double t)
 }
 
 ProbModel::~ProbModel() {
-  for (auto& sr: subMat)
-    gsl_matrix_free (sr);
   for (auto& iv: insVec)
     gsl_vector_free (iv);
 }
@@ -489,6 +527,20 @@ ProbModel::State ProbModel::getState (bool parentUngapped, bool childUngapped) {
   return childUngapped ? Insert : End;
 }
 
+BranchProbModels::BranchProbModels (const RateModel& model, const Tree& tree) {
+  const EigenModel eigen (model);
+  init (model, eigen, tree);
+}
+
+BranchProbModels::BranchProbModels (const RateModel& model, const EigenModel& eigen, const Tree& tree) {
+  init (model, eigen, tree);
+}
+
+void BranchProbModels::init (const RateModel& model, const EigenModel& eigen, const Tree& tree) {
+  for (TreeNodeIndex node = 0; node < tree.root(); ++node)
+    probModel.emplace_back (model, tree.branchLength(node), eigen);
+}
+
 LogProbModel::LogProbModel (const ProbModel& pm)
   : logCptWeight (pm.components()),
     logInsProb (pm.components(), vguard<LogProb> (pm.alphabetSize())),
@@ -504,6 +556,11 @@ LogProbModel::LogProbModel (const ProbModel& pm)
 }
 
 double RateModel::mlDistance (const FastSeq& x, const FastSeq& y, int maxIterations) const {
+  const EigenModel eigen (*this);
+  return mlDistance (x, y, eigen, expectedSubstitutionRate(), maxIterations);
+}
+
+double RateModel::mlDistance (const FastSeq& x, const FastSeq& y, const EigenModel& eigen, double expectedRate, int maxIterations) const {
   LogThisAt(7,"Estimating distance from " << x.name << " to " << y.name << endl);
   map<pair<AlphTok,AlphTok>,int> pairCount;
   Assert (x.length() == y.length(), "Sequences %s and %s have different lengths (%u, %u)", x.name.c_str(), y.name.c_str(), x.length(), y.length());
@@ -522,7 +579,7 @@ double RateModel::mlDistance (const FastSeq& x, const FastSeq& y, int maxIterati
       LogThisAt(7," " << pc.second << "*" << alphabet[pc.first.first] << alphabet[pc.first.second]);
     LogThisAt(7,endl);
   }
-  const DistanceMatrixParams dmp (pairCount, *this);
+  const DistanceMatrixParams dmp (pairCount, *this, eigen, expectedRate);
   const double t = dmp.tML (maxIterations);
   LogThisAt(6,"Distance from " << x.name << " to " << y.name << " is " << t << endl);
   return t;
@@ -533,12 +590,14 @@ vguard<vguard<double> > RateModel::distanceMatrix (const vguard<FastSeq>& gapped
   ProgressLog (plog, 4);
   plog.initProgress ("Distance matrix (%d rows)", gappedSeq.size());
   const size_t pairs = (gappedSeq.size() - 1) * gappedSeq.size() / 2;
+  const EigenModel eigen (*this);
+  const double expectedRate = expectedSubstitutionRate();
   size_t n = 0;
   for (size_t i = 0; i + 1 < gappedSeq.size(); ++i)
     for (size_t j = i + 1; j < gappedSeq.size(); ++j) {
       plog.logProgress (n / (double) pairs, "computing entry %d/%d", n + 1, pairs);
       ++n;
-      dist[i][j] = dist[j][i] = mlDistance (gappedSeq[i], gappedSeq[j], maxIterations);
+      dist[i][j] = dist[j][i] = mlDistance (gappedSeq[i], gappedSeq[j], eigen, expectedRate, maxIterations);
     }
   if (LoggingThisAt(3)) {
     LogThisAt(3,"Distance matrix (" << dist.size() << " rows):" << endl);
@@ -549,17 +608,12 @@ vguard<vguard<double> > RateModel::distanceMatrix (const vguard<FastSeq>& gapped
 }
 
 double distanceMatrixNegLogLike (double t, void *params) {
+  // only the observed entries of the substitution matrix are needed, so compute them directly from the eigensystem
   const DistanceMatrixParams& dmp = *(const DistanceMatrixParams*) params;
-  vguard<gsl_matrix*> sub = dmp.model.getSubProbMatrix (t);
+  const vguard<double> p = dmp.eigen.getMixtureSubProbs (t, dmp.pairs);
   double ll = 0;
-  for (auto& pc : dmp.pairCount) {
-    double p = 0;
-    for (int c = 0; c < dmp.model.components(); ++c)
-      p += dmp.model.cptWeight[c] * gsl_matrix_get(sub[c],pc.first.first,pc.first.second);
-    ll += log(p) * (double) pc.second;
-  }
-  for (auto& sr: sub)
-    gsl_matrix_free (sr);
+  for (size_t n = 0; n < p.size(); ++n)
+    ll += log(p[n]) * dmp.counts[n];
   return -ll;
 }
 
@@ -578,7 +632,7 @@ double DistanceMatrixParams::tJC() const {
   const double A = (double) model.alphabetSize();
   if (pDiff >= (A - 1) / A)
     return numeric_limits<double>::infinity();
-  return -((A-1) / A) * log (1 - (A/(A-1)) * pDiff) / model.expectedSubstitutionRate();
+  return -((A-1) / A) * log (1 - (A/(A-1)) * pDiff) / expectedRate;
 }
 
 double DistanceMatrixParams::tML (int maxIterations) const {
@@ -898,17 +952,21 @@ void IndelCounts::accumulateIndelCounts (const RateModel& model, const Tree& tre
 }
 
 void EigenCounts::accumulateSubstitutionCounts (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, double weight) {
-  AlignColSumProduct colSumProd (model, tree, gapped);
+  const AlignColPatterns patterns (gapped);
+  AlignColSumProduct colSumProd (model, tree, patterns.gapped);
 
   EigenCounts c (model.components(), model.alphabetSize());
 
+  vguard<LogProb> patternLogLike;
   while (!colSumProd.alignmentDone()) {
     colSumProd.fillUp();
     colSumProd.fillDown();
-    colSumProd.accumulateEigenCounts (c.rootCount, c.eigenCount);
-    c.indelCounts.lp += colSumProd.columnLogLikelihood();
+    colSumProd.accumulateEigenCounts (c.rootCount, c.eigenCount, (double) patterns.patternCount[colSumProd.col]);
+    patternLogLike.push_back (colSumProd.columnLogLikelihood());
     colSumProd.nextColumn();
   }
+  for (auto p : patterns.colPattern)
+    c.indelCounts.lp += patternLogLike[p];
 
   c *= weight;
   *this += c;
@@ -1107,19 +1165,67 @@ double IndelCounts::decayWaitTime (double decayRate, double timeInterval) {
   return 1 / decayRate - timeInterval / (exp (decayRate*timeInterval) - 1);
 }
 
+// process-wide eigensystem cache, keyed by EigenModel::eigenSystemHash
+// precomputed (preset) eigensystems are never evicted; the rest are kept in least-recently-used order
+typedef shared_ptr<const vguard<double> > SharedPackedEigenSystem;
+typedef list<EigenSystemHash> EigenCacheLRUList;  // most recently used first
+static mutex eigenCacheMutex;
+static map<EigenSystemHash,SharedPackedEigenSystem> precomputedEigenCache;
+static EigenCacheLRUList eigenCacheLRU;
+static map<EigenSystemHash,pair<SharedPackedEigenSystem,EigenCacheLRUList::iterator> > eigenCache;
+static string eigenCacheDir;
+
+static SharedPackedEigenSystem storeEigenSystem (EigenSystemHash hash, const vguard<double>& packed) {
+  SharedPackedEigenSystem shared (new vguard<double> (packed));
+  lock_guard<mutex> lock (eigenCacheMutex);
+  auto iter = eigenCache.find (hash);
+  if (iter != eigenCache.end()) {
+    eigenCacheLRU.splice (eigenCacheLRU.begin(), eigenCacheLRU, iter->second.second);
+    iter->second.first = shared;
+    return shared;
+  }
+  if (eigenCache.size() >= DefaultEigenCacheCapacity) {
+    eigenCache.erase (eigenCacheLRU.back());
+    eigenCacheLRU.pop_back();
+  }
+  eigenCacheLRU.push_front (hash);
+  eigenCache[hash] = make_pair (shared, eigenCacheLRU.begin());
+  return shared;
+}
+
+// caller must hold eigenCacheMutex
+static SharedPackedEigenSystem findEigenSystem (EigenSystemHash hash, size_t size) {
+  auto preIter = precomputedEigenCache.find (hash);
+  if (preIter != precomputedEigenCache.end() && preIter->second->size() == size)
+    return preIter->second;
+  auto iter = eigenCache.find (hash);
+  if (iter != eigenCache.end() && iter->second.first->size() == size) {
+    eigenCacheLRU.splice (eigenCacheLRU.begin(), eigenCacheLRU, iter->second.second);
+    return iter->second.first;
+  }
+  return SharedPackedEigenSystem();
+}
+
+static string eigenCacheFilename (EigenSystemHash hash) {
+  lock_guard<mutex> lock (eigenCacheMutex);
+  if (eigenCacheDir.empty())
+    return string();
+  char hex[17];
+  snprintf (hex, sizeof(hex), "%016llx", hash);
+  return eigenCacheDir + '/' + hex + EigenCacheFileSuffix;
+}
+
 EigenModel::EigenModel (const EigenModel& eigen)
   : model (eigen.model),
     eval (eigen.components()),
     evec (eigen.components()),
     evecInv (eigen.components()),
     ev (eigen.ev),
-    ev_t (eigen.ev_t),
     exp_ev_t (eigen.exp_ev_t),
     isReal (eigen.isReal),
     realEval (eigen.realEval),
     realEvec (eigen.realEvec),
     realEvecInv (eigen.realEvecInv),
-    real_ev_t (eigen.real_ev_t),
     real_exp_ev_t (eigen.real_exp_ev_t)
 {
   for (int cpt = 0; cpt < eigen.components(); ++cpt) {
@@ -1138,57 +1244,48 @@ EigenModel::EigenModel (const RateModel& model)
     evec (model.components()),
     evecInv (model.components()),
     ev (model.components(), vguard<gsl_complex> (model.alphabetSize())),
-    ev_t (model.components(), vguard<gsl_complex> (model.alphabetSize())),
     exp_ev_t (model.components(), vguard<gsl_complex> (model.alphabetSize())),
     isReal (model.components(), false),
     realEval (model.components(), vguard<double> (model.alphabetSize())),
     realEvec (model.components(), vguard<vguard<double> > (model.alphabetSize(), vguard<double> (model.alphabetSize()))),
     realEvecInv (model.components(), vguard<vguard<double> > (model.alphabetSize(), vguard<double> (model.alphabetSize()))),
-    real_ev_t (model.components(), vguard<double> (model.alphabetSize())),
     real_exp_ev_t (model.components(), vguard<double> (model.alphabetSize()))
 {
   for (int cpt = 0; cpt < model.components(); ++cpt) {
     eval[cpt] = gsl_vector_complex_alloc (model.alphabetSize());
     evec[cpt] = gsl_matrix_complex_alloc (model.alphabetSize(), model.alphabetSize());
     evecInv[cpt] = gsl_matrix_complex_alloc (model.alphabetSize(), model.alphabetSize());
+  }
 
-    gsl_matrix *R = gsl_matrix_alloc (model.alphabetSize(), model.alphabetSize());
-    gsl_matrix_memcpy (R, model.subRate[cpt]);
-  
-    gsl_eigen_nonsymmv_workspace *workspace = gsl_eigen_nonsymmv_alloc (model.alphabetSize());
-    CheckGsl (gsl_eigen_nonsymmv (R, eval[cpt], evec[cpt], workspace));
-    gsl_eigen_nonsymmv_free (workspace);
-    gsl_matrix_free (R);
-
-    gsl_matrix_complex *LU = gsl_matrix_complex_alloc (model.alphabetSize(), model.alphabetSize());
-    gsl_permutation *perm = gsl_permutation_alloc (model.alphabetSize());
-    int permSig = 0;
-    gsl_matrix_complex_memcpy (LU, evec[cpt]);
-    CheckGsl (gsl_linalg_complex_LU_decomp (LU, perm, &permSig));
-    CheckGsl (gsl_linalg_complex_LU_invert (LU, perm, evecInv[cpt]));
-    gsl_matrix_complex_free (LU);
-    gsl_permutation_free (perm);
-
-    for (AlphTok i = 0; i < model.alphabetSize(); ++i)
-      ev[cpt][i] = gsl_vector_complex_get (eval[cpt], i);
-
-    isReal[cpt] = true;
-    for (AlphTok i = 0; isReal[cpt] && i < model.alphabetSize(); ++i) {
-      isReal[cpt] = isReal[cpt] && EIGENMODEL_NEAR_REAL(ev[cpt][i]);
-      for (AlphTok j = 0; isReal[cpt] && j < model.alphabetSize(); ++j)
-	isReal[cpt] = isReal[cpt] && EIGENMODEL_NEAR_REAL(gsl_matrix_complex_get(evec[cpt],i,j))
-	  && EIGENMODEL_NEAR_REAL(gsl_matrix_complex_get(evecInv[cpt],i,j));
+  const EigenSystemHash hash = eigenSystemHash (model);
+  const size_t size = packedEigenSystemSize (model);
+  const string cacheFilename = eigenCacheFilename (hash);
+  SharedPackedEigenSystem packed;
+  {
+    lock_guard<mutex> lock (eigenCacheMutex);
+    packed = findEigenSystem (hash, size);
+  }
+  if (!packed && cacheFilename.size()) {
+    vguard<double> fromFile;
+    if (readEigenCacheFile (cacheFilename, hash, size, fromFile)) {
+      LogThisAt(5,"Read eigensystem from " << cacheFilename << endl);
+      packed = storeEigenSystem (hash, fromFile);
     }
+  }
 
-    if (isReal[cpt])
-      for (AlphTok i = 0; isReal[cpt] && i < model.alphabetSize(); ++i) {
-	realEval[cpt][i] = GSL_REAL (ev[cpt][i]);
-	for (AlphTok j = 0; isReal[cpt] && j < model.alphabetSize(); ++j) {
-	  realEvec[cpt][i][j] = GSL_REAL (gsl_matrix_complex_get (evec[cpt], i, j));
-	  realEvecInv[cpt][i][j] = GSL_REAL (gsl_matrix_complex_get (evecInv[cpt], i, j));
-	}
-      }
-  
+  if (packed)
+    unpackEigenSystem (*packed);
+  else {
+    for (int cpt = 0; cpt < model.components(); ++cpt)
+      computeEigenSystem (cpt);
+    const vguard<double> computed = packEigenSystem();
+    storeEigenSystem (hash, computed);
+    if (cacheFilename.size())
+      writeEigenCacheFile (cacheFilename, hash, computed);
+  }
+
+  for (int cpt = 0; cpt < model.components(); ++cpt) {
+    initRealEigenSystem (cpt);
     LogThisAt(8,"Component #" << cpt << endl
 	      << "Eigenvalues:" << complexVectorToString(ev[cpt]) << endl
 	      << "Right eigenvector matrix, V:" << endl << complexMatrixToString(evec[cpt])
@@ -1198,6 +1295,176 @@ EigenModel::EigenModel (const RateModel& model)
   }
 }
 
+void EigenModel::computeEigenSystem (int cpt) {
+  gsl_matrix *R = gsl_matrix_alloc (model.alphabetSize(), model.alphabetSize());
+  gsl_matrix_memcpy (R, model.subRate[cpt]);
+  
+  gsl_eigen_nonsymmv_workspace *workspace = gsl_eigen_nonsymmv_alloc (model.alphabetSize());
+  CheckGsl (gsl_eigen_nonsymmv (R, eval[cpt], evec[cpt], workspace));
+  gsl_eigen_nonsymmv_free (workspace);
+  gsl_matrix_free (R);
+
+  gsl_matrix_complex *LU = gsl_matrix_complex_alloc (model.alphabetSize(), model.alphabetSize());
+  gsl_permutation *perm = gsl_permutation_alloc (model.alphabetSize());
+  int permSig = 0;
+  gsl_matrix_complex_memcpy (LU, evec[cpt]);
+  CheckGsl (gsl_linalg_complex_LU_decomp (LU, perm, &permSig));
+  CheckGsl (gsl_linalg_complex_LU_invert (LU, perm, evecInv[cpt]));
+  gsl_matrix_complex_free (LU);
+  gsl_permutation_free (perm);
+}
+
+void EigenModel::initRealEigenSystem (int cpt) {
+  for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+    ev[cpt][i] = gsl_vector_complex_get (eval[cpt], i);
+
+  isReal[cpt] = true;
+  for (AlphTok i = 0; isReal[cpt] && i < model.alphabetSize(); ++i) {
+    isReal[cpt] = isReal[cpt] && EIGENMODEL_NEAR_REAL(ev[cpt][i]);
+    for (AlphTok j = 0; isReal[cpt] && j < model.alphabetSize(); ++j)
+      isReal[cpt] = isReal[cpt] && EIGENMODEL_NEAR_REAL(gsl_matrix_complex_get(evec[cpt],i,j))
+	&& EIGENMODEL_NEAR_REAL(gsl_matrix_complex_get(evecInv[cpt],i,j));
+  }
+
+  if (isReal[cpt])
+    for (AlphTok i = 0; isReal[cpt] && i < model.alphabetSize(); ++i) {
+      realEval[cpt][i] = GSL_REAL (ev[cpt][i]);
+      for (AlphTok j = 0; isReal[cpt] && j < model.alphabetSize(); ++j) {
+	realEvec[cpt][i][j] = GSL_REAL (gsl_matrix_complex_get (evec[cpt], i, j));
+	realEvecInv[cpt][i][j] = GSL_REAL (gsl_matrix_complex_get (evecInv[cpt], i, j));
+      }
+    }
+}
+
+size_t EigenModel::packedEigenSystemSize (const RateModel& model) {
+  const size_t A = model.alphabetSize();
+  return model.components() * 2 * (A + 2*A*A);
+}
+
+vguard<double> EigenModel::packEigenSystem() const {
+  vguard<double> packed;
+  packed.reserve (packedEigenSystemSize (model));
+  auto pushComplex = [&] (gsl_complex z) {
+    packed.push_back (GSL_REAL(z));
+    packed.push_back (GSL_IMAG(z));
+  };
+  for (int cpt = 0; cpt < components(); ++cpt) {
+    for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+      pushComplex (gsl_vector_complex_get (eval[cpt], i));
+    for (auto mx: { evec[cpt], evecInv[cpt] })
+      for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+	for (AlphTok j = 0; j < model.alphabetSize(); ++j)
+	  pushComplex (gsl_matrix_complex_get (mx, i, j));
+  }
+  return packed;
+}
+
+void EigenModel::unpackEigenSystem (const vguard<double>& packed) {
+  Assert (packed.size() == packedEigenSystemSize (model), "Packed eigensystem has wrong size");
+  auto p = packed.begin();
+  auto popComplex = [&] () {
+    const gsl_complex z = gsl_complex_rect (p[0], p[1]);
+    p += 2;
+    return z;
+  };
+  for (int cpt = 0; cpt < components(); ++cpt) {
+    for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+      gsl_vector_complex_set (eval[cpt], i, popComplex());
+    for (auto mx: { evec[cpt], evecInv[cpt] })
+      for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+	for (AlphTok j = 0; j < model.alphabetSize(); ++j)
+	  gsl_matrix_complex_set (mx, i, j, popComplex());
+  }
+}
+
+EigenSystemHash EigenModel::eigenSystemHash (const RateModel& model) {
+  // 64-bit FNV-1a over the packing format version, alphabet, and rate matrices
+  EigenSystemHash hash = EIGENCACHE_FNV_OFFSET;
+  auto addBytes = [&] (const void* data, size_t n) {
+    const unsigned char* c = (const unsigned char*) data;
+    for (size_t k = 0; k < n; ++k) {
+      hash ^= c[k];
+      hash *= EIGENCACHE_FNV_PRIME;
+    }
+  };
+  const unsigned long long version = EIGENCACHE_VERSION, cpts = model.components();
+  addBytes (&version, sizeof(version));
+  addBytes (model.alphabet.c_str(), model.alphabet.size());
+  addBytes (&cpts, sizeof(cpts));
+  for (int cpt = 0; cpt < model.components(); ++cpt)
+    for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+      for (AlphTok j = 0; j < model.alphabetSize(); ++j) {
+	const double r = gsl_matrix_get (model.subRate[cpt], i, j);
+	addBytes (&r, sizeof(r));
+      }
+  return hash;
+}
+
+void EigenModel::addPrecomputedEigenSystem (const RateModel& model, EigenSystemHash hash, const double* packed, size_t size) {
+  if (hash != eigenSystemHash (model) || size != packedEigenSystemSize (model)) {
+    LogThisAt(3,"Ignoring stale precomputed eigensystem" << endl);
+    return;
+  }
+  lock_guard<mutex> lock (eigenCacheMutex);
+  if (!precomputedEigenCache.count (hash))
+    precomputedEigenCache[hash] = SharedPackedEigenSystem (new vguard<double> (packed, packed + size));
+}
+
+void EigenModel::setEigenCacheDir (const string& dir) {
+  lock_guard<mutex> lock (eigenCacheMutex);
+  eigenCacheDir = dir;
+  while (eigenCacheDir.size() > 1 && eigenCacheDir.back() == '/')
+    eigenCacheDir.pop_back();
+}
+
+bool EigenModel::readEigenCacheFile (const string& filename, EigenSystemHash hash, size_t size, vguard<double>& packed) {
+  ifstream in (filename, ios::binary);
+  if (!in)
+    return false;
+  char magic[EIGENCACHE_MAGIC_LEN];
+  EigenSystemHash fileHash = 0;
+  unsigned long long fileSize = 0;
+  in.read (magic, EIGENCACHE_MAGIC_LEN);
+  in.read ((char*) &fileHash, sizeof(fileHash));
+  in.read ((char*) &fileSize, sizeof(fileSize));
+  if (!in || memcmp (magic, EIGENCACHE_MAGIC, EIGENCACHE_MAGIC_LEN) != 0 || fileHash != hash || fileSize != size) {
+    LogThisAt(3,"Ignoring mismatched eigensystem cache file " << filename << endl);
+    return false;
+  }
+  packed.resize (size);
+  in.read ((char*) packed.data(), size * sizeof(double));
+  if (!in) {
+    LogThisAt(3,"Ignoring truncated eigensystem cache file " << filename << endl);
+    return false;
+  }
+  return true;
+}
+
+void EigenModel::writeEigenCacheFile (const string& filename, EigenSystemHash hash, const vguard<double>& packed) {
+  // write to a temporary file & rename, so concurrent processes never see a partial file
+  const string tmpFilename = filename + ".tmp" + to_string (getpid());
+  {
+    ofstream out (tmpFilename, ios::binary);
+    const unsigned long long size = packed.size();
+    out.write (EIGENCACHE_MAGIC, EIGENCACHE_MAGIC_LEN);
+    out.write ((const char*) &hash, sizeof(hash));
+    out.write ((const char*) &size, sizeof(size));
+    out.write ((const char*) packed.data(), size * sizeof(double));
+    if (!out) {
+      Warn ("Couldn't write eigensystem cache file %s", tmpFilename.c_str());
+      out.close();
+      remove (tmpFilename.c_str());
+      return;
+    }
+  }
+  if (rename (tmpFilename.c_str(), filename.c_str()) != 0) {
+    Warn ("Couldn't rename %s to %s", tmpFilename.c_str(), filename.c_str());
+    remove (tmpFilename.c_str());
+    return;
+  }
+  LogThisAt(5,"Wrote eigensystem to " << filename << endl);
+}
+
 EigenModel::~EigenModel() {
   for (auto& e: eval)
     if (e)
@@ -1211,18 +1478,18 @@ EigenModel::~EigenModel() {
 }
 
 void EigenModel::compute_exp_ev_t (double t, bool forceComplex) {
+  compute_exp_ev_t (t, exp_ev_t, real_exp_ev_t, forceComplex);
+}
+
+void EigenModel::compute_exp_ev_t (double t, vguard<vguard<gsl_complex> >& exp_ev_t, vguard<vguard<double> >& real_exp_ev_t, bool forceComplex) const {
   for (int cpt = 0; cpt < model.components(); ++cpt) {
     if (isReal[cpt] && !forceComplex) {
-      for (AlphTok i = 0; i < model.alphabetSize(); ++i) {
-	real_ev_t[cpt][i] = realEval[cpt][i] * t;
-	real_exp_ev_t[cpt][i] = exp (real_ev_t[cpt][i]);
-      }
+      for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+	real_exp_ev_t[cpt][i] = exp (realEval[cpt][i] * t);
       LogThisAt(9,"Component #" << cpt << " exp(eigenvalue*" << t << "):" << join(real_exp_ev_t[cpt]," ") << endl);
     } else {
-      for (AlphTok i = 0; i < model.alphabetSize(); ++i) {
-	ev_t[cpt][i] = gsl_complex_mul_real (ev[cpt][i], t);
-	exp_ev_t[cpt][i] = gsl_complex_exp (ev_t[cpt][i]);
-      }
+      for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+	exp_ev_t[cpt][i] = gsl_complex_exp (gsl_complex_mul_real (ev[cpt][i], t));
       LogThisAt(9,"Component #" << cpt << " exp(eigenvalue*" << t << "):" << complexVectorToString(exp_ev_t[cpt]));
     }
   }
@@ -1265,6 +1532,10 @@ double EigenModel::getSubProb (int cpt, double t, AlphTok i, AlphTok j) const {
 }
 
 double EigenModel::getSubProbInner (int cpt, double t, AlphTok i, AlphTok j) const {
+  return getSubProbInner (cpt, i, j, exp_ev_t, real_exp_ev_t);
+}
+
+double EigenModel::getSubProbInner (int cpt, AlphTok i, AlphTok j, const vguard<vguard<gsl_complex> >& exp_ev_t, const vguard<vguard<double> >& real_exp_ev_t) const {
   if (isReal[cpt]) {
     double p = 0;
     for (AlphTok k = 0; k < model.alphabetSize(); ++k)
@@ -1282,14 +1553,42 @@ double EigenModel::getSubProbInner (int cpt, double t, AlphTok i, AlphTok j) con
   return min (1., max (0., GSL_REAL(p)));
 }
 
+vguard<double> EigenModel::getMixtureSubProbs (double t, const vguard<pair<AlphTok,AlphTok> >& ij) const {
+  ((EigenModel&) *this).compute_exp_ev_t (t);
+  vguard<double> p (ij.size(), 0.);
+  for (int cpt = 0; cpt < model.components(); ++cpt)
+    for (size_t n = 0; n < ij.size(); ++n)
+      p[n] += model.cptWeight[cpt] * getSubProbInner (cpt, t, ij[n].first, ij[n].second);
+  return p;
+}
+
 vguard<gsl_matrix*> EigenModel::getSubProbMatrix (double t) const {
+  const AlphTok A = model.alphabetSize();
+  // exponentiated eigenvalues go in locals rather than members, so concurrent calls are safe
+  vguard<vguard<gsl_complex> > exp_ev_t (model.components(), vguard<gsl_complex> (A));
+  vguard<vguard<double> > real_exp_ev_t (model.components(), vguard<double> (A));
+  compute_exp_ev_t (t, exp_ev_t, real_exp_ev_t);
+  vguard<double> row (A);
   vguard<gsl_matrix*> v;
   for (int cpt = 0; cpt < model.components(); ++cpt) {
-    gsl_matrix* sub = gsl_matrix_alloc (model.alphabetSize(), model.alphabetSize());
-    ((EigenModel&) *this).compute_exp_ev_t (t);
-    for (AlphTok i = 0; i < model.alphabetSize(); ++i)
-      for (AlphTok j = 0; j < model.alphabetSize(); ++j)
-	gsl_matrix_set (sub, i, j, getSubProbInner (cpt, t, i, j));
+    gsl_matrix* sub = gsl_matrix_alloc (A, A);
+    if (isReal[cpt])
+      // sub = evec * diag(exp(eval*t)) * evecInv, one row at a time
+      for (AlphTok i = 0; i < A; ++i) {
+	fill (row.begin(), row.end(), 0.);
+	for (AlphTok k = 0; k < A; ++k) {
+	  const double s = realEvec[cpt][i][k] * real_exp_ev_t[cpt][k];
+	  const vguard<double>& evecInv_k = realEvecInv[cpt][k];
+	  for (AlphTok j = 0; j < A; ++j)
+	    row[j] += s * evecInv_k[j];
+	}
+	for (AlphTok j = 0; j < A; ++j)
+	  gsl_matrix_set (sub, i, j, min (1., max (0., row[j])));
+      }
+    else
+      for (AlphTok i = 0; i < A; ++i)
+	for (AlphTok j = 0; j < A; ++j)
+	  gsl_matrix_set (sub, i, j, getSubProbInner (cpt, i, j, exp_ev_t, real_exp_ev_t));
     v.push_back (sub);
   }
   return v;
@@ -1426,41 +1725,69 @@ string complexVectorToString (const vector<gsl_complex>& v) {
   return s.str();
 }
 
-CachingRateModel::CachingRateModel (const RateModel& model, size_t precision, size_t flushSize)
+CachingRateModel::CachingRateModel (const RateModel& model, size_t precision, size_t capacity)
   : RateModel (model),
+    keyShift (max (0, DBL_MANT_DIG - 1 - (int) ceil (precision * log2 (10.)))),
+    capacity (max ((size_t) 1, capacity)),
     eigen (model),
-    precision (precision),
-    flushSize (flushSize)
+    hits (0),
+    misses (0)
 { }
 
-string CachingRateModel::timeKey (double t) const {
-  ostringstream o;
-  o << scientific << setprecision(precision) << t;
-  return o.str();
+CachingRateModel::TimeKey CachingRateModel::timeKey (double t) const {
+  // round the IEEE bit pattern to the nearest multiple of 2^keyShift; for t >= 0 this rounds the mantissa, carrying into the exponent
+  TimeKey bits;
+  static_assert (sizeof(bits) == sizeof(t), "TimeKey must be the same size as double");
+  memcpy (&bits, &t, sizeof(t));
+  return keyShift ? ((bits >> (keyShift - 1)) + 1) >> 1 : bits;
+}
+
+SharedSubProbMatrices CachingRateModel::getSharedSubProbMatrix (double t) const {
+  const TimeKey k = timeKey (t);
+  unique_lock<mutex> lock (cacheMutex);
+  auto iter = cache.find (k);
+  if (iter != cache.end()) {
+    ++hits;
+    lru.splice (lru.begin(), lru, iter->second.second);
+    return iter->second.first;
+  }
+  ++misses;
+  // compute without holding the lock, so other threads' hits and misses are not blocked behind this one
+  lock.unlock();
+  const SharedSubProbMatrices m (new SubProbMatrices (eigen.getSubProbMatrix (t)));
+  lock.lock();
+  // another thread may have inserted the same key meanwhile; if so, keep its matrices and discard ours
+  iter = cache.find (k);
+  if (iter != cache.end()) {
+    lru.splice (lru.begin(), lru, iter->second.second);
+    return iter->second.first;
+  }
+  if (cache.size() >= capacity) {
+    cache.erase (lru.back());
+    lru.pop_back();
+  }
+  lru.push_front (k);
+  cache[k] = make_pair (m, lru.begin());
+  return m;
 }
 
 vguard<gsl_matrix*> CachingRateModel::getSubProbMatrix (double t) const {
-  CachingRateModel* mutableThis = (CachingRateModel*) this;  // cast away const
-  auto& mutableCache = mutableThis->cache;
-  auto& mutableCount = mutableThis->count;
-  const string k = timeKey (t);
+  const SharedSubProbMatrices shared = getSharedSubProbMatrix (t);
   vguard<gsl_matrix*> m;
-  if (cache.count (k)) {
-    const auto& c = cache.at(k);
-    for (int cpt = 0; cpt < components(); ++cpt)
-      m.push_back (stl_to_gsl_matrix (c[cpt]));
-  } else {
-    m = eigen.getSubProbMatrix (t);
-    if (mutableCount[k]++) {  // wait until the 2nd evaluation to start caching
-      if (mutableCache.size() >= flushSize) {
-	mutableCache.clear();
-	mutableCount.clear();
-      }
-      vguard<vguard<vguard<double> > > c;
-      for (int cpt = 0; cpt < components(); ++cpt)
-	c.push_back (gsl_matrix_to_stl (m[cpt]));
-      mutableCache[k] = c;
-    }
+  for (auto sm: shared->subMat) {
+    gsl_matrix* c = newAlphabetMatrix();
+    CheckGsl (gsl_matrix_memcpy (c, sm));
+    m.push_back (c);
   }
   return m;
 }
+
+size_t CachingRateModel::cacheHits() const {
+  lock_guard<mutex> lock (cacheMutex);
+  return hits;
+}
+
+size_t CachingRateModel::cacheMisses() const {
+  lock_guard<mutex> lock (cacheMutex);
+  return misses;
+}
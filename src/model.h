@@ -4,6 +4,10 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
 #include <string>
+#include <list>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 #include "jsonutil.h"
 #include "fastseq.h"
@@ -16,7 +20,10 @@ using namespace std;
 #define DefaultDistanceMatrixIterations 100
 
 #define DefaultCachingRateModelPrecision 5
-#define DefaultCachingRateModelFlushSize 1000
+#define DefaultCachingRateModelCapacity 1000
+
+#define EigenCacheFileSuffix ".eigen"
+#define DefaultEigenCacheCapacity 16
 
 struct AlphabetOwner {
   string alphabet;
@@ -40,6 +47,20 @@ struct AlphabetOwner {
   vguard<FastSeq> convertWildcards (const vguard<FastSeq>&) const;
 };
 
+
+// Substitution probability matrices for all components at one branch length.
+// Immutable once constructed, so they can be shared between ProbModels and threads
+struct SubProbMatrices {
+  const vguard<gsl_matrix*> subMat;  // owned
+  SubProbMatrices (const vguard<gsl_matrix*>& subMat) : subMat (subMat) { }
+  ~SubProbMatrices();
+  SubProbMatrices (const SubProbMatrices&) = delete;
+  SubProbMatrices& operator= (const SubProbMatrices&) = delete;
+};
+typedef shared_ptr<const SubProbMatrices> SharedSubProbMatrices;
+
+class EigenModel;
+
 struct RateModel : AlphabetOwner {
   double insRate, delRate, insExtProb, delExtProb;
   vguard<double> cptWeight;
@@ -64,7 +85,8 @@ struct RateModel : AlphabetOwner {
   void writeComponent (int cpt, ostream& out) const;
 
   static gsl_vector* getEqmProbVector (gsl_matrix* subRateMatrix);
-  virtual vguard<gsl_matrix*> getSubProbMatrix (double t) const;
+  virtual vguard<gsl_matrix*> getSubProbMatrix (double t) const;  // caller must free
+  virtual SharedSubProbMatrices getSharedSubProbMatrix (double t) const;  // read-only, no need to free
 
   double expectedSubstitutionRate() const;
   double expectedInsertionLength() const;
@@ -75,9 +97,15 @@ struct RateModel : AlphabetOwner {
   RateModel scaleRates (double substMultiplier, double indelMultiplier) const;
   
   double mlDistance (const FastSeq& xGapped, const FastSeq& yGapped, int maxIterations = DefaultDistanceMatrixIterations) const;
+  double mlDistance (const FastSeq& xGapped, const FastSeq& yGapped, const EigenModel& eigen, double expectedRate, int maxIterations) const;
   vguard<vguard<double> > distanceMatrix (const vguard<FastSeq>& gappedSeq, int maxIterations = DefaultDistanceMatrixIterations) const;
 };
 
+// Eigensystems are cached by a hash of the rate matrices, so identical models are only diagonalized once per process.
+// The in-process cache keeps the DefaultEigenCacheCapacity most recently used eigensystems, plus any precomputed ones.
+// Preset models carry precomputed eigensystems (see perl/model2cpp.pl); others can be cached in a directory between runs
+typedef unsigned long long EigenSystemHash;
+
 class EigenModel {
 public:
   const RateModel& model;
@@ -98,36 +126,61 @@ public:
   void accumSubCounts (int component, vguard<vguard<double> >& count, AlphTok a, AlphTok b, double weight, const gsl_matrix* sub, const gsl_matrix_complex* eSubCount) const;
 
   double getSubProb (int component, double t, AlphTok i, AlphTok j) const;
-  vguard<gsl_matrix*> getSubProbMatrix (double t) const;
+  vguard<double> getMixtureSubProbs (double t, const vguard<pair<AlphTok,AlphTok> >& ij) const;  // weighted by component, for selected (i,j) only
+  vguard<gsl_matrix*> getSubProbMatrix (double t) const;  // reentrant; caller must free
   gsl_matrix_complex* getRateMatrix (int component) const;
   gsl_matrix_complex* evecInv_evec (int component) const;
 
   vguard<vguard<vguard<double> > > getSubCounts (const vguard<vguard<vguard<gsl_complex> > >& eigenCounts) const;
+
+  static EigenSystemHash eigenSystemHash (const RateModel& model);
+  static size_t packedEigenSystemSize (const RateModel& model);
+  static void addPrecomputedEigenSystem (const RateModel& model, EigenSystemHash hash, const double* packed, size_t size);  // ignored if hash or size do not match model
+  static void setEigenCacheDir (const string& dir);
   
 private:
-  vguard<vguard<gsl_complex> > ev, ev_t, exp_ev_t;
+  vguard<vguard<gsl_complex> > ev, exp_ev_t;
 
   vguard<bool> isReal;
   vguard<vguard<double> > realEval;
   vguard<vguard<vguard<double> > > realEvec, realEvecInv;
-  vguard<vguard<double> > real_ev_t, real_exp_ev_t;
+  vguard<vguard<double> > real_exp_ev_t;
+
+  void computeEigenSystem (int component);
+  void initRealEigenSystem (int component);
+  vguard<double> packEigenSystem() const;  // per component: eigenvalues, then V, then V^{-1}, as (real,imag) pairs
+  void unpackEigenSystem (const vguard<double>& packed);
+  static bool readEigenCacheFile (const string& filename, EigenSystemHash hash, size_t size, vguard<double>& packed);
+  static void writeEigenCacheFile (const string& filename, EigenSystemHash hash, const vguard<double>& packed);
 
   void compute_exp_ev_t (double t, bool forceComplex = false);
+  void compute_exp_ev_t (double t, vguard<vguard<gsl_complex> >& exp_ev_t, vguard<vguard<double> >& real_exp_ev_t, bool forceComplex = false) const;
   double getSubProbInner (int component, double t, AlphTok i, AlphTok j) const;
+  double getSubProbInner (int component, AlphTok i, AlphTok j, const vguard<vguard<gsl_complex> >& exp_ev_t, const vguard<vguard<double> >& real_exp_ev_t) const;
   
   EigenModel& operator= (const EigenModel&) = delete;
 };
 
+// Least-recently-used cache of substitution matrices, keyed on branch length rounded to a given number of significant digits.
+// One CachingRateModel can be shared between threads: the cache is guarded by a mutex, which is released while a missing matrix is computed
 class CachingRateModel : public RateModel {
 private:
-  const size_t precision, flushSize;
-  map<string,int> count;
-  map<string,vguard<vguard<vguard<double> > > > cache;
-  string timeKey (double t) const;
+  typedef unsigned long long TimeKey;
+  typedef list<TimeKey> LRUList;  // most recently used first
+  const int keyShift;  // number of low-order mantissa bits dropped from the branch length
+  const size_t capacity;
   EigenModel eigen;
+  mutable mutex cacheMutex;
+  mutable LRUList lru;
+  mutable map<TimeKey,pair<SharedSubProbMatrices,LRUList::iterator> > cache;
+  mutable size_t hits, misses;
+  TimeKey timeKey (double t) const;
 public:
-  CachingRateModel (const RateModel& model, size_t precision = DefaultCachingRateModelPrecision, size_t flushSize = DefaultCachingRateModelFlushSize);
+  CachingRateModel (const RateModel& model, size_t precision = DefaultCachingRateModelPrecision, size_t capacity = DefaultCachingRateModelCapacity);
   vguard<gsl_matrix*> getSubProbMatrix (double t) const;
+  SharedSubProbMatrices getSharedSubProbMatrix (double t) const;
+  size_t cacheHits() const;
+  size_t cacheMisses() const;
 };
 
 class ProbModel : public AlphabetOwner {
@@ -139,8 +192,11 @@ public:
   double insWait, delWait;
   vguard<double> cptWeight;
   vguard<gsl_vector*> insVec;
-  vguard<gsl_matrix*> subMat;
+  SharedSubProbMatrices sharedSubMat;
+  vguard<gsl_matrix*> subMat;  // owned by sharedSubMat
   ProbModel (const RateModel& model, double t);
+  ProbModel (const RateModel& model, double t, const EigenModel& eigen);  // substitution matrices from a precomputed eigensystem
+  ProbModel (const RateModel& model, double t, const SharedSubProbMatrices& subMat);
   ~ProbModel();
   int components() const { return cptWeight.size(); }
   double transProb (State src, State dest) const;
@@ -152,6 +208,16 @@ private:
   ProbModel& operator= (const ProbModel&) = delete;
 };
 
+// ProbModels for every branch of a tree, with substitution matrices computed from one eigendecomposition of the rate matrix
+struct BranchProbModels {
+  deque<ProbModel> probModel;  // probModel[node] is for the branch from node to its parent; the root has no entry
+  BranchProbModels (const RateModel& model, const Tree& tree);
+  BranchProbModels (const RateModel& model, const EigenModel& eigen, const Tree& tree);
+  inline const ProbModel& operator[] (TreeNodeIndex node) const { return probModel[node]; }
+private:
+  void init (const RateModel& model, const EigenModel& eigen, const Tree& tree);
+};
+
 struct LogProbModel {
   typedef vguard<LogProb> LogProbVector;
   typedef vguard<vguard<LogProb> > LogProbMatrix;
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <math.h>
+#include <algorithm>
 #include "profile.h"
 #include "jsonutil.h"
 #include "forward.h"
@@ -21,12 +22,17 @@ ProfileState::ProfileState (size_t components, AlphTok alphSize)
 { }
 
 Profile::Profile (size_t components, const string& alphabet, const FastSeq& seq, AlignRowIndex rowIndex)
+  : Profile (components, (AlphTok) alphabet.size(), seq, seq.unvalidatedTokens (alphabet), rowIndex)
+{ }
+
+Profile::Profile (size_t components, AlphTok alphSize, const FastSeq& seq, const UnvalidatedTokSeq& tok, AlignRowIndex rowIndex)
   : components (components),
-    alphSize ((AlphTok) alphabet.size()),
-    state (seq.length() + 2, ProfileState (components, (AlphTok) alphabet.size())),
+    alphSize (alphSize),
+    state (seq.length() + 2, ProfileState (components, alphSize)),
     trans (seq.length() + 1),
     rootRowIndex (rowIndex)
 {
+  Assert (tok.size() == seq.seq.size(), "Token sequence length does not match sequence %s", seq.name.c_str());
   name = seq.name;
   state.front() = state.back() = ProfileState();  // start and end are null states
   state.front().name = "START";
@@ -54,13 +60,12 @@ Profile::Profile (size_t components, const string& alphabet, const FastSeq& seq,
 	if (Alignment::isWildcard (seq.seq[pos]))
 	  fill (lpa.begin(), lpa.end(), 0);
 	else {
-	  const UnvalidatedAlphTok tok = tokenize (seq.seq[pos], alphabet);
-	  if (tok < 0) {
+	  if (tok[pos] < 0) {
 	    invalidChars.insert (seq.seq[pos]);
 	    ++nInvalidToks;
 	    fill (lpa.begin(), lpa.end(), 0);
 	  } else
-	    lpa[tok] = 0;
+	    lpa[tok[pos]] = 0;
 	}
     }
   }
@@ -76,14 +81,35 @@ Profile::Profile (size_t components, const string& alphabet, const FastSeq& seq,
 }
 
 Profile Profile::leftMultiply (const vguard<gsl_matrix*>& sub) const {
+  // multiply in linear space, rescaling each absorb vector by its maximum;
+  // rows whose rescaled sum is too small to trust are redone in log-space
   Profile prof (*this);
+  vguard<vguard<double> > subMx (components, vguard<double> (alphSize * alphSize));
+  for (int cpt = 0; cpt < components; ++cpt)
+    for (AlphTok c = 0; c < alphSize; ++c)
+      for (AlphTok d = 0; d < alphSize; ++d)
+	subMx[cpt][c*alphSize + d] = gsl_matrix_get (sub[cpt], c, d);
+  vguard<double> linAbsorb (alphSize);
   for (ProfileStateIndex i = 0; i < size(); ++i)
     if (!state[i].isNull())
       for (int cpt = 0; cpt < components; ++cpt) {
+	const vguard<LogProb>& lpAbsorb = state[i].lpAbsorb[cpt];
+	const LogProb lpMax = *max_element (lpAbsorb.begin(), lpAbsorb.end());
+	for (AlphTok d = 0; d < alphSize; ++d)
+	  linAbsorb[d] = exp (lpAbsorb[d] - lpMax);
 	for (AlphTok c = 0; c < alphSize; ++c) {
-	  LogProb lp = -numeric_limits<double>::infinity();
+	  const double* subRow = subMx[cpt].data() + c*alphSize;
+	  double p = 0;
 	  for (AlphTok d = 0; d < alphSize; ++d)
-	    lp = log_sum_exp (lp, log (gsl_matrix_get(sub[cpt],c,d)) + state[i].lpAbsorb[cpt][d]);
+	    p += subRow[d] * linAbsorb[d];
+	  LogProb lp;
+	  if (p >= LOG_SUM_EXP_LINEAR_MIN)
+	    lp = log(p) + lpMax;
+	  else {
+	    lp = -numeric_limits<double>::infinity();
+	    for (AlphTok d = 0; d < alphSize; ++d)
+	      lp = log_sum_exp (lp, log (subRow[d]) + lpAbsorb[d]);
+	  }
 	  prof.state[i].lpAbsorb[cpt][c] = lp;
 	}
       }
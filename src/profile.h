@@ -54,6 +54,7 @@ struct Profile {
   Profile (size_t components, AlphTok alphSize, AlignRowIndex rowIndex)
     : components(components), alphSize(alphSize), rootRowIndex(rowIndex) { }
   Profile (size_t components, const string& alphabet, const FastSeq& seq, AlignRowIndex rowIndex);
+  Profile (size_t components, AlphTok alphSize, const FastSeq& seq, const UnvalidatedTokSeq& tok, AlignRowIndex rowIndex);
   ProfileStateIndex size() const { return state.size(); }
   Profile leftMultiply (const vguard<gsl_matrix*>& sub) const;
   const ProfileState& start() const { return state.front(); }
@@ -8,10 +8,12 @@ QuickAlignMatrix::QuickAlignMatrix (const DiagonalEnvelope& env, const RateModel
   : penv (&env),
     px (env.px),
     py (env.py),
+    xTokOwned (env.px->unvalidatedTokens (model.alphabet)),
+    yTokOwned (env.py->unvalidatedTokens (model.alphabet)),
+    xTok (xTokOwned),
+    yTok (yTokOwned),
     xLen (px->length()),
     yLen (py->length()),
-    xTok (env.px->unvalidatedTokens (model.alphabet)),
-    yTok (env.py->unvalidatedTokens (model.alphabet)),
     cell (env.totalStorageSize * 3, -numeric_limits<double>::infinity()),
     start (-numeric_limits<double>::infinity()),
     end (-numeric_limits<double>::infinity()),
@@ -19,6 +21,29 @@ QuickAlignMatrix::QuickAlignMatrix (const DiagonalEnvelope& env, const RateModel
     model (model),
     time (time)
 {
+  fill (env);
+}
+
+QuickAlignMatrix::QuickAlignMatrix (const DiagonalEnvelope& env, const RateModel& model, double time, const UnvalidatedTokSeq& xTok, const UnvalidatedTokSeq& yTok)
+  : penv (&env),
+    px (env.px),
+    py (env.py),
+    xTok (xTok),
+    yTok (yTok),
+    xLen (px->length()),
+    yLen (py->length()),
+    cell (env.totalStorageSize * 3, -numeric_limits<double>::infinity()),
+    start (-numeric_limits<double>::infinity()),
+    end (-numeric_limits<double>::infinity()),
+    result (-numeric_limits<double>::infinity()),
+    model (model),
+    time (time)
+{
+  Assert (xTok.size() == xLen && yTok.size() == yLen, "Token sequence lengths do not match sequences");
+  fill (env);
+}
+
+void QuickAlignMatrix::fill (const DiagonalEnvelope& env) {
   // compute scores
   ProbModel pm (model, time);
   LogProbModel lpm (pm);
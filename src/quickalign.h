@@ -10,7 +10,8 @@ public:
   enum State { Start, Match, Insert, Delete };
   const DiagonalEnvelope* penv;
   const FastSeq *px, *py;
-  UnvalidatedTokSeq xTok, yTok;
+  UnvalidatedTokSeq xTokOwned, yTokOwned;  // only used if tokens were not supplied by caller
+  const UnvalidatedTokSeq &xTok, &yTok;
   SeqIdx xLen, yLen, xEnd, yEnd;
   vguard<LogProb> cell;
   LogProb start, end, result;
@@ -23,6 +24,7 @@ public:
   LogProb gapOpen, gapExtend, noGap;
   
   QuickAlignMatrix (const DiagonalEnvelope& env, const RateModel& model, double time);
+  QuickAlignMatrix (const DiagonalEnvelope& env, const RateModel& model, double time, const UnvalidatedTokSeq& xTok, const UnvalidatedTokSeq& yTok);
   inline LogProb& getCell (SeqIdx i, SeqIdx j, unsigned int offset) {
     const int storageIndex = penv->getStorageIndexUnsafe (i, j);
     return cell[storageIndex*3 + offset];
@@ -55,6 +57,7 @@ public:
   vguard<FastSeq> gappedSeq() const;
 
 protected:
+  void fill (const DiagonalEnvelope& env);
   static void updateMax (LogProb& currentMax, State& currentMaxIdx, double candidateMax, State candidateMaxIdx);
 
   inline LogProb startGapScore (SeqIdx i, SeqIdx j) const {
@@ -66,6 +69,11 @@ protected:
     return (i == xLen ? noGap : (gapOpen + (xLen-i-2)*gapExtend))
       + (j == yLen ? noGap : (gapOpen + (yLen-j-2)*gapExtend));
   }
+
+private:
+  // xTok & yTok may refer to this object's own xTokOwned & yTokOwned, which a copy would leave dangling
+  QuickAlignMatrix (const QuickAlignMatrix&) = delete;
+  QuickAlignMatrix& operator= (const QuickAlignMatrix&) = delete;
 };
 
 
@@ -1,5 +1,6 @@
 #include <fstream>
 #include <random>
+#include <thread>
 #include "recon.h"
 #include "util.h"
 #include "forward.h"
@@ -41,6 +42,7 @@ Reconstructor::Reconstructor()
     guideAlignTryAllPairs (false),
     useUPGMA (true),
     jukesCantorDistanceMatrix (false),
+    collapseDuplicates (false),
     includeBestTraceInProfile (true),
     keepGapsOpen (false),
     usePosteriorsForProfile (false),
@@ -60,10 +62,20 @@ Reconstructor::Reconstructor()
     minEMImprovement (DefaultMinEMImprovement),
     runMCMC (false),
     outputTraceMCMC (false),
+    deltaTraceMCMC (false),
     fixGuideMCMC (false),
     fixTreeMCMC (false),
     fixAlignMCMC (false),
     mcmcSamplesPerSeq (DefaultMCMCSamplesPerSeq),
+    mcmcAdaptSamplesPerSeq (DefaultMCMCAdaptSamplesPerSeq),
+    mcmcTries (DefaultMCMCTries),
+    mcmcChains (DefaultMCMCChains),
+    mcmcSwapInterval (DefaultMCMCSwapInterval),
+    mcmcTraceThinning (DefaultMCMCTraceThinning),
+    mcmcTraceQueueSize (DefaultMCMCTraceQueueSize),
+    ancestralThreads (DefaultAncestralThreads),
+    refinerThreads (DefaultRefinerThreads),
+    mcmcHeatStep (DefaultMCMCHeatStep),
     mcmcTraceFiles (0),
     outputFormat (StockholmFormat),
     outputLeavesOnly (false),
@@ -91,6 +103,15 @@ bool Reconstructor::parseAncSeqArgs (deque<string>& argvec) {
       predictAncestralSequence = true;
       argvec.pop_front();
       return true;
+
+    } else if (arg == "-ancthreads") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      ancestralThreads = n;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
     }
   }
 
@@ -244,6 +265,13 @@ bool Reconstructor::parseModelArgs (deque<string>& argvec) {
       argvec.pop_front();
       return true;
 
+    } else if (arg == "-eigencache") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      eigenCacheDir = argvec[1];
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
     } else if (arg == "-preset") {
       Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
       setPresetModelName (argvec[1]);
@@ -449,6 +477,11 @@ bool Reconstructor::parseProfileArgs (deque<string>& argvec, bool allowReconstru
       argvec.pop_front();
       return true;
 
+    } else if (arg == "-dedup") {
+      collapseDuplicates = true;
+      argvec.pop_front();
+      return true;
+
     } else if (arg == "-jc") {
       jukesCantorDistanceMatrix = true;
       argvec.pop_front();
@@ -516,6 +549,80 @@ bool Reconstructor::parseSamplerArgs (deque<string>& argvec) {
       argvec.pop_front();
       return true;
 
+    } else if (arg == "-adapt") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n >= 0, "%s must be nonnegative", arg.c_str());
+      mcmcAdaptSamplesPerSeq = n;
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-tries") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      mcmcTries = n;
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-chains") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      mcmcChains = n;
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-ess") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      mcmcStoppingRule.minESS = atof (argvec[1].c_str());
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-rhat") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      mcmcStoppingRule.maxRHat = atof (argvec[1].c_str());
+      Require (mcmcStoppingRule.maxRHat >= 1, "%s must be at least 1", arg.c_str());
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-plateau") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      mcmcStoppingRule.plateauSamplesPerNode = atof (argvec[1].c_str());
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-heat") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      mcmcHeatStep = atof (argvec[1].c_str());
+      Require (mcmcHeatStep >= 0, "%s must be nonnegative", arg.c_str());
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-swapevery") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      mcmcSwapInterval = n;
+      runMCMC = true;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
     } else if (arg == "-fixguide") {
       fixGuideMCMC = true;
       runMCMC = true;
@@ -543,6 +650,29 @@ bool Reconstructor::parseSamplerArgs (deque<string>& argvec) {
       argvec.pop_front();
       return true;
 
+    } else if (arg == "-tracedelta") {
+      deltaTraceMCMC = true;
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-thin") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      mcmcTraceThinning = n;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
+    } else if (arg == "-tracequeue") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n >= 0, "%s must be nonnegative", arg.c_str());
+      mcmcTraceQueueSize = n;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+
     } else if (arg == "-norefine") {
       refineReconstruction = false;
       argvec.pop_front();
@@ -552,6 +682,15 @@ bool Reconstructor::parseSamplerArgs (deque<string>& argvec) {
       refineReconstruction = true;
       argvec.pop_front();
       return true;
+
+    } else if (arg == "-refinethreads") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      const int n = atoi (argvec[1].c_str());
+      Require (n > 0, "%s must be at least 1", arg.c_str());
+      refinerThreads = n;
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
     }
   }
 
@@ -597,6 +736,11 @@ bool Reconstructor::parseCountArgs (deque<string>& argvec) {
     } else if (arg == "-refine" || arg == "-norefine") {
       argvec.pop_front();
       return true;
+    } else if (arg == "-refinethreads") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
     }
   }
 
@@ -633,6 +777,21 @@ bool Reconstructor::parseSumArgs (deque<string>& argvec) {
   return false;
 }
 
+bool Reconstructor::parseExpandArgs (deque<string>& argvec) {
+  if (argvec.size()) {
+    const string& arg = argvec[0];
+    if (arg == "-trace") {
+      Require (argvec.size() > 1, "%s must have an argument", arg.c_str());
+      traceFilenames.push_back (argvec[1]);
+      argvec.pop_front();
+      argvec.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void Reconstructor::setModelParam (double& p, const char* paramName) const {
   const string param (paramName);
   if (modelParam.count(param))
@@ -657,6 +816,8 @@ void Reconstructor::scaleModel (RateModel& model, const char* subScaleParamName,
 }
 
 void Reconstructor::loadModel() {
+  if (eigenCacheDir.size())
+    EigenModel::setEigenCacheDir (eigenCacheDir);
   if (presetModelName.size()) {
     LogThisAt(1,"Loading preset model " << presetModelName << endl);
     model = namedModel (presetModelName);
@@ -708,6 +869,9 @@ void Reconstructor::loadModel() {
   if (tokenizeCodons)
     codonTokenizer.assertAlphabetTokenized (model.alphabet);
 
+  if (eigenCacheDir.size())
+    EigenModel eigen (model);  // diagonalize now, so the eigensystem is cached even if this command never uses it
+
   dataCounts = EventCounts (model, model.components());
 
   if (modelSaveFilename.size()) {
@@ -801,16 +965,19 @@ void Reconstructor::loadSeqs (const string& seqFilename, const string& guideFile
 	dataset.seqs = readFastSeqs (seqFilename.c_str());
 	if (tokenizeCodons)
 	  dataset.seqs = codonTokenizer.tokenize (dataset.seqs);
+	if (collapseDuplicates)
+	  dataset.collapseDuplicateSeqs();
 	if (maxDistanceFromGuide < 0 && treeFilename.size())
 	  LogThisAt(1,"Don't need guide alignment: banding is turned off and tree is supplied" << endl);
 	else {
 	  LogThisAt(1,"Building guide alignment (" << dataset.name << ")" << endl);
+	  dataset.initTokens (model.alphabet);
 	  AlignGraph* ag = NULL;
 	  if (guideAlignTryAllPairs)
-	    ag = new AlignGraph (dataset.seqs, model, 1, diagEnvParams);
+	    ag = new AlignGraph (dataset.seqs, model, 1, diagEnvParams, &dataset.seqTokens);
 	  else {
 	    seedGenerator();
-	    ag = new AlignGraph (dataset.seqs, model, 1, diagEnvParams, generator);
+	    ag = new AlignGraph (dataset.seqs, model, 1, diagEnvParams, generator, &dataset.seqTokens);
 	  }
 	  Alignment align = ag->mstAlign();
 	  delete ag;
@@ -830,6 +997,7 @@ void Reconstructor::loadSeqs (const string& seqFilename, const string& guideFile
       else
 	buildTree (dataset);
 
+      dataset.expandDuplicateSeqs();
       dataset.prepareRecon (*this);
     }
   }
@@ -840,6 +1008,67 @@ void Reconstructor::Dataset::initGuide (const vguard<FastSeq>& gapped) {
   const Alignment align (gappedGuide);
   guide = align.path;
   seqs = align.ungapped;
+  seqTokens = TokenizedFastSeqs();
+}
+
+void Reconstructor::Dataset::initTokens (const string& alphabet) {
+  if (!seqTokens.matches (seqs, alphabet))
+    seqTokens = TokenizedFastSeqs (seqs, alphabet);
+}
+
+void Reconstructor::Dataset::collapseDuplicateSeqs() {
+  map<string,size_t> repIndex;
+  vguard<FastSeq> reps;
+  uncollapsedSeqRep.clear();
+  for (const auto& fs : seqs) {
+    const auto iter = repIndex.find (fs.seq);
+    if (iter == repIndex.end()) {
+      uncollapsedSeqRep.push_back (repIndex[fs.seq] = reps.size());
+      reps.push_back (fs);
+    } else
+      uncollapsedSeqRep.push_back (iter->second);
+  }
+  if (reps.size() < seqs.size()) {
+    LogThisAt(1,"Collapsed " << plural(seqs.size(),"sequence") << " to " << plural(reps.size(),"distinct sequence") << " (" << name << ")" << endl);
+    uncollapsedSeqs.swap (seqs);
+    seqs.swap (reps);
+    seqTokens = TokenizedFastSeqs();
+  } else
+    uncollapsedSeqRep.clear();
+}
+
+void Reconstructor::Dataset::expandDuplicateSeqs() {
+  if (uncollapsedSeqs.empty())
+    return;
+  map<string,vguard<string> > copies;
+  vguard<bool> seenRep (seqs.size(), false);
+  for (size_t n = 0; n < uncollapsedSeqs.size(); ++n) {
+    const size_t rep = uncollapsedSeqRep[n];
+    if (seenRep[rep]) {
+      if (!tree.hasNode (uncollapsedSeqs[n].name))
+	copies[seqs[rep].name].push_back (uncollapsedSeqs[n].name);
+    } else
+      seenRep[rep] = true;
+  }
+  if (tree.nodes() && !copies.empty())
+    tree = tree.addLeafCopies (copies);
+  if (!gappedGuide.empty()) {
+    vguard<FastSeq> expandedGuide;
+    AlignPath expandedPath;
+    for (size_t n = 0; n < uncollapsedSeqs.size(); ++n) {
+      const size_t rep = uncollapsedSeqRep[n];
+      expandedGuide.push_back (gappedGuide[rep]);
+      expandedGuide.back().name = uncollapsedSeqs[n].name;
+      expandedGuide.back().comment = uncollapsedSeqs[n].comment;
+      expandedPath[n] = guide.at (rep);
+    }
+    gappedGuide.swap (expandedGuide);
+    guide.swap (expandedPath);
+  }
+  seqs.swap (uncollapsedSeqs);
+  uncollapsedSeqs.clear();
+  uncollapsedSeqRep.clear();
+  seqTokens = TokenizedFastSeqs();
 }
 
 Reconstructor::Dataset& Reconstructor::newDataset() {
@@ -913,6 +1142,8 @@ void Reconstructor::reconstruct (Dataset& dataset) {
   if (!usePosteriorsForProfile)
     seedGenerator();  // re-seed generator, in case it was used during prealignment
 
+  dataset.initTokens (model.alphabet);
+
   vguard<gsl_vector*> rootProb = model.insProb;
   LogProb lpFinalFwd = -numeric_limits<double>::infinity(), lpFinalTrace = -numeric_limits<double>::infinity();
   const ForwardMatrix::ProfilingStrategy strategy =
@@ -926,18 +1157,20 @@ void Reconstructor::reconstruct (Dataset& dataset) {
   if (accumulateSubstCounts)
     sumProd = new SumProduct (model, dataset.tree);
 
+  const BranchProbModels branchProbModels (model, dataset.tree);
+
   AlignPath path;
   map<int,Profile> prof;
   for (TreeNodeIndex node = 0; node < dataset.tree.nodes(); ++node) {
     if (dataset.tree.isLeaf(node))
-      prof[node] = Profile (model.components(), model.alphabet, dataset.seqs[dataset.nodeToSeqIndex[node]], node);
+      prof[node] = Profile (model.components(), model.alphabetSize(), dataset.seqs[dataset.nodeToSeqIndex[node]], dataset.seqTokens[dataset.nodeToSeqIndex[node]], node);
     else {
       const int lChildNode = dataset.tree.getChild(node,0);
       const int rChildNode = dataset.tree.getChild(node,1);
       const Profile& lProf = prof[lChildNode];
       const Profile& rProf = prof[rChildNode];
-      ProbModel lProbs (model, dataset.tree.branchLength(lChildNode));
-      ProbModel rProbs (model, dataset.tree.branchLength(rChildNode));
+      const ProbModel& lProbs = branchProbModels[lChildNode];
+      const ProbModel& rProbs = branchProbModels[rChildNode];
       PairHMM hmm (lProbs, rProbs, rootProb);
 
       LogThisAt(2,"Aligning node #" << lProf.rootRowIndex << " " << lProf.name << " (" << plural(lProf.state.size(),"state") << ", " << plural(lProf.trans.size(),"transition") << ") and node #" << rProf.rootRowIndex << " " << rProf.name << " (" << plural(rProf.state.size(),"state") << ", " << plural(rProf.trans.size(),"transition") << ") to build profile for node #" << node << endl);
@@ -1047,13 +1280,12 @@ void Reconstructor::reconstruct (Dataset& dataset) {
 void Reconstructor::refine (Dataset& dataset) {
   LogThisAt(1,"Refining parent-child alignments (" << dataset.name << ")" << endl);
   vguard<FastSeq>& gappedRecon = dataset.hasAncestralReconstruction() ? dataset.gappedAncestralRecon : dataset.gappedRecon;
-  Refiner::History history;
-  history.tree = dataset.tree;
-  history.gapped = gappedRecon;
+  const Refiner::History history (gappedRecon, dataset.tree);
   Refiner refiner (model);
+  refiner.threads = refinerThreads;
   const Refiner::History refinedHistory = refiner.refine (history);
-  dataset.tree = refinedHistory.tree;
-  gappedRecon = refinedHistory.gapped;
+  dataset.tree = refinedHistory.tree();
+  gappedRecon = refinedHistory.gapped();
 }
 
 void Reconstructor::refineAll() {
@@ -1062,17 +1294,61 @@ void Reconstructor::refineAll() {
     refine (ds);
 }
 
+void Reconstructor::predictAncestorColumns (const Tree& tree, const vguard<FastSeq>& gapped, AlignColIndex startCol, AlignColIndex endCol, vguard<FastSeq>& recon, ReconPostProbMap& postProb) const {
+  vguard<FastSeq> slice (gapped);
+  for (auto& fs : slice)
+    fs.seq = fs.seq.substr (startCol, endCol - startCol);
+  AlignColSumProduct colSumProd (model, tree, slice);
+  while (!colSumProd.alignmentDone()) {
+    colSumProd.fillUp();
+    colSumProd.fillDown();
+    colSumProd.appendAncestralReconstructedColumn (recon);
+    if (reportAncestralSequenceProbability)
+      colSumProd.appendAncestralPostProbColumn (postProb);
+    colSumProd.nextColumn();
+  }
+}
+
 void Reconstructor::predictAncestors (Dataset& dataset) {
   if (predictAncestralSequence) {
     LogThisAt(1,"Predicting ancestral sequences (" << dataset.name << ")" << endl);
-    AlignColSumProduct colSumProd (model, dataset.tree, dataset.gappedRecon);
-    while (!colSumProd.alignmentDone()) {
-      colSumProd.fillUp();
-      colSumProd.fillDown();
-      colSumProd.appendAncestralReconstructedColumn (dataset.gappedAncestralRecon);
-      if (reportAncestralSequenceProbability)
-	colSumProd.appendAncestralPostProbColumn (dataset.gappedAncestralReconPostProb);
-      colSumProd.nextColumn();
+    const AlignColPatterns patterns (dataset.gappedRecon);
+    if (patterns.patterns()) {
+      // columns are independent, so split them into contiguous ranges, one per thread
+      const size_t nThreads = min (ancestralThreads, patterns.patterns());
+      vguard<AlignColIndex> threadStartCol (nThreads + 1);
+      for (size_t t = 0; t <= nThreads; ++t)
+	threadStartCol[t] = t * patterns.patterns() / nThreads;
+      vguard<vguard<FastSeq> > threadRecon (nThreads);
+      vguard<ReconPostProbMap> threadPostProb (nThreads);
+      auto predictRange = [&] (size_t t) {
+	predictAncestorColumns (dataset.tree, patterns.gapped, threadStartCol[t], threadStartCol[t+1], threadRecon[t], threadPostProb[t]);
+      };
+      if (nThreads == 1)
+	predictRange (0);
+      else {
+	LogThisAt(2,"Predicting ancestral sequences using " << nThreads << " threads" << endl);
+	vguard<thread> threads;
+	for (size_t t = 0; t < nThreads; ++t)
+	  threads.push_back (thread (predictRange, t));
+	for (auto& th : threads)
+	  th.join();
+      }
+
+      // stitch the ranges back together in column order
+      vguard<FastSeq> patternRecon (threadRecon[0]);
+      ReconPostProbMap patternPostProb;
+      for (size_t t = 0; t < nThreads; ++t) {
+	if (t > 0)
+	  for (AlignRowIndex row = 0; row < patternRecon.size(); ++row)
+	    patternRecon[row].seq += threadRecon[t][row].seq;
+	for (const auto& row_colProb : threadPostProb[t])
+	  for (const auto& col_prob : row_colProb.second)
+	    patternPostProb[row_colProb.first][threadStartCol[t] + col_prob.first] = col_prob.second;
+      }
+
+      dataset.gappedAncestralRecon = patterns.expandColumns (patternRecon);
+      dataset.gappedAncestralReconPostProb = patterns.expandColumns (patternPostProb);
     }
   }
 }
@@ -1082,9 +1358,9 @@ void Reconstructor::predictAllAncestors() {
     predictAncestors (ds);
 }
 
-void Reconstructor::writeTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, ostream& out, bool isReconstruction, const ReconPostProbMap* postProb) const {
-  Tree t (tree);
-  vguard<FastSeq> g (gapped);
+void Reconstructor::formatTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, bool isReconstruction, Tree& t, vguard<FastSeq>& g) const {
+  t = tree;
+  g = gapped;
   if (outputLeavesOnly) {
     vguard<FastSeq> gl;
     for (TreeNodeIndex n = 0; n < tree.nodes(); ++n)
@@ -1101,6 +1377,38 @@ void Reconstructor::writeTreeAlignment (const Tree& tree, const vguard<FastSeq>&
     else
       t.assignInternalNodeNames(g);
   }
+}
+
+Stockholm Reconstructor::makeStockholm (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, bool isReconstruction, const ReconPostProbMap* postProb, const map<string,string>* gfAnnotation) const {
+  Tree t;
+  vguard<FastSeq> g;
+  formatTreeAlignment (tree, gapped, isReconstruction, t, g);
+  Stockholm stock (g, t);
+  if (postProb) {
+    if (outputLeavesOnly)
+      Warn ("Not showing ancestors, so not showing posterior probabilities of ancestors either");
+    else
+      for (auto& row_colcharprob: *postProb)
+	for (auto& col_charprob: row_colcharprob.second)
+	  for (auto& char_prob: col_charprob.second)
+	    stock.gs[AncestralSequencePostProbTag][stock.gapped[row_colcharprob.first].name].push_back (string() + to_string(col_charprob.first + 1) + " " + char_prob.first + " " + to_string(char_prob.second));
+  }
+  stock.gf[StockholmIDTag].push_back (name);
+  stock.gf[StockholmLogProbTag].push_back (to_string (TreeAlignFuncs::logLikelihood (model, t, gapped)));
+  if (gfAnnotation)
+    for (const auto& tag_value: *gfAnnotation)
+      stock.gf[tag_value.first].push_back (tag_value.second);
+  return stock;
+}
+
+void Reconstructor::writeTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, ostream& out, bool isReconstruction, const ReconPostProbMap* postProb, const map<string,string>* gfAnnotation) const {
+  if (outputFormat == StockholmFormat) {
+    makeStockholm (tree, gapped, name, isReconstruction, postProb, gfAnnotation).write (out, 0);
+    return;
+  }
+  Tree t;
+  vguard<FastSeq> g;
+  formatTreeAlignment (tree, gapped, isReconstruction, t, g);
   switch (outputFormat) {
   case FastaFormat:
     writeFastaSeqs (out, g);
@@ -1115,23 +1423,6 @@ void Reconstructor::writeTreeAlignment (const Tree& tree, const vguard<FastSeq>&
   case JsonFormat:
     writeJson (t, g, out, postProb);
     break;
-  case StockholmFormat:
-    {
-      Stockholm stock (g, t);
-      if (postProb) {
-	if (outputLeavesOnly)
-	  Warn ("Not showing ancestors, so not showing posterior probabilities of ancestors either");
-	else
-	  for (auto& row_colcharprob: *postProb)
-	    for (auto& col_charprob: row_colcharprob.second)
-	      for (auto& char_prob: col_charprob.second)
-		stock.gs[AncestralSequencePostProbTag][stock.gapped[row_colcharprob.first].name].push_back (string() + to_string(col_charprob.first + 1) + " " + char_prob.first + " " + to_string(char_prob.second));
-      }
-      stock.gf[StockholmIDTag].push_back (name);
-      stock.gf[StockholmLogProbTag].push_back (to_string (TreeAlignFuncs::logLikelihood (model, t, gapped)));
-      stock.write (out, 0);
-    }
-    break;
   default:
     Fail ("Unknown output format");
     break;
@@ -1283,31 +1574,131 @@ void Reconstructor::count (Dataset& dataset) {
     dataCounts.indelCounts += dataset.eigenCounts.indelCounts;
 }
 
-Reconstructor::HistoryLogger::HistoryLogger (Reconstructor& recon, const string& name)
+Reconstructor::TraceWriter::TraceWriter (size_t maxQueueSize)
+  : maxQueueSize (maxQueueSize),
+    finished (maxQueueSize == 0)
+{
+  if (!finished)
+    writerThread = thread (&TraceWriter::run, this);
+}
+
+Reconstructor::TraceWriter::~TraceWriter() {
+  finish();
+}
+
+void Reconstructor::TraceWriter::push (const function<void()>& job) {
+  unique_lock<mutex> lock (queueMutex);
+  if (finished) {
+    lock.unlock();
+    job();
+  } else {
+    queueChanged.wait (lock, [&] { return queue.size() < maxQueueSize; });
+    queue.push_back (job);
+    queueChanged.notify_all();
+  }
+}
+
+void Reconstructor::TraceWriter::finish() {
+  {
+    lock_guard<mutex> lock (queueMutex);
+    finished = true;
+    queueChanged.notify_all();
+  }
+  if (writerThread.joinable())
+    writerThread.join();
+}
+
+void Reconstructor::TraceWriter::run() {
+  while (true) {
+    function<void()> job;
+    {
+      unique_lock<mutex> lock (queueMutex);
+      queueChanged.wait (lock, [&] { return finished || !queue.empty(); });
+      if (queue.empty())
+	break;
+      job = queue.front();
+      queue.pop_front();
+      queueChanged.notify_all();
+    }
+    job();
+  }
+}
+
+Reconstructor::HistoryLogger::HistoryLogger (Reconstructor& recon, TraceWriter& writer, const string& name)
   : recon (&recon),
+    writer (writer),
     out (NULL),
-    name (name)
+    name (name),
+    hasLastHistory (false),
+    historiesSeen (0)
 {
   if (recon.outputTraceMCMC && recon.mcmcTraceFilename.size())
     out = new ofstream (recon.mcmcTraceFilename + "." + to_string(++recon.mcmcTraceFiles));
 }
 
 Reconstructor::HistoryLogger::~HistoryLogger() {
+  flush();
   if (out)
     delete out;
 }
 
 void Reconstructor::HistoryLogger::logHistory (const Sampler::History& history) {
-  if (recon->outputTraceMCMC)
-    recon->writeTreeAlignment (history.tree, history.gapped, name, out ? *out : cout, true);
+  if (recon->outputTraceMCMC && historiesSeen++ % recon->mcmcTraceThinning == 0) {
+    flush();
+    lastHistory = history;
+    hasLastHistory = true;
+  }
+}
+
+void Reconstructor::HistoryLogger::logDiagnostics (const Sampler::Diagnostics& diagnostics) {
+  if (hasLastHistory) {
+    lastDiagnostics[MCMCEffectiveSampleSizeTag] = to_string (diagnostics.ess);
+    lastDiagnostics[MCMCSplitRHatTag] = to_string (diagnostics.rHat);
+    lastDiagnostics[MCMCPlateauTag] = to_string (diagnostics.plateauSamplesPerNode);
+  }
+}
+
+void Reconstructor::HistoryLogger::flush() {
+  if (hasLastHistory) {
+    const Sampler::History history = lastHistory;
+    const map<string,string> diagnostics = lastDiagnostics;
+    writer.push ([this,history,diagnostics] { write (history, diagnostics); });
+    lastDiagnostics.clear();
+    hasLastHistory = false;
+  }
+}
+
+void Reconstructor::HistoryLogger::write (const Sampler::History& history, const map<string,string>& diagnostics) {
+  ostream& traceOut = out ? *out : cout;
+  if (recon->outputFormat != StockholmFormat) {
+    recon->writeTreeAlignment (history.tree(), history.gapped(), name, traceOut, true, NULL, diagnostics.empty() ? NULL : &diagnostics);
+    return;
+  }
+  // rejected moves leave the sampler's history pointers unchanged, so the log-likelihood need not be recomputed
+  const bool unchanged = lastWritten.rows() && history.sharedTree == lastWrittenHistory.sharedTree && history.sharedGapped == lastWrittenHistory.sharedGapped;
+  Stockholm stock = unchanged ? lastWritten : recon->makeStockholm (history.tree(), history.gapped(), name, true);
+  Stockholm annotated (stock);
+  for (const auto& tag_value: diagnostics)
+    annotated.gf[tag_value.first].push_back (tag_value.second);
+  if (recon->deltaTraceMCMC && lastWritten.rows())
+    annotated.delta(lastWritten).write (traceOut, 0);
+  else
+    annotated.write (traceOut, 0);
+  if (!unchanged) {
+    swap (lastWritten, stock);
+    lastWrittenHistory = history;
+  }
 }
 
 void Reconstructor::sampleAll() {
   Require (datasets.size() > 0, "Please supply some data");
   Require (!fixAlignMCMC || !fixTreeMCMC, "You can't fix both tree and alignment when doing MCMC - you must sample one of them!");
+  Require (!deltaTraceMCMC || outputFormat == StockholmFormat, "Delta-encoded MCMC traces must be in Stockholm format");
+  Require (mcmcChains > 1 || mcmcHeatStep == 0, "-heat only affects the chains after the first; please also specify -chains 2 or more");
   if (runMCMC) {
     SimpleTreePrior treePrior;
     vguard<Sampler> samplers;
+    TraceWriter traceWriter (outputTraceMCMC ? mcmcTraceQueueSize : 0);
     vguard<HistoryLogger*> loggers;
     size_t totalNodes = 0;
     CachingRateModel cachedModel (model);
@@ -1319,33 +1710,52 @@ void Reconstructor::sampleAll() {
       vguard<FastSeq>& gappedRecon = dataset.hasAncestralReconstruction() ? dataset.gappedAncestralRecon : dataset.gappedRecon;
       dataset.tree.assignInternalNodeNames (gappedRecon);
       samplers.push_back (Sampler (cachedModel, treePrior, dataset.gappedGuide));
-      loggers.push_back (new HistoryLogger (*this, dataset.name));
+      loggers.push_back (new HistoryLogger (*this, traceWriter, dataset.name));
       Sampler& sampler = samplers.back();
       sampler.addLogger (*loggers.back());
       sampler.useFixedGuide = fixGuideMCMC;
       sampler.sampleAncestralSeqs = dataset.hasAncestralReconstruction();
-      Sampler::History history;
-      history.tree = dataset.tree;
-      history.gapped = gappedRecon;
+      const Sampler::History history (gappedRecon, dataset.tree);
       sampler.initialize (history, dataset.name);
       if (fixTreeMCMC)
 	sampler.fixTree();
       if (fixAlignMCMC)
 	sampler.fixAlignment();
-      totalNodes += history.tree.nodes();
+      sampler.adaptiveSamples = mcmcAdaptSamplesPerSeq * history.tree().nodes();
+      sampler.tries = mcmcTries;
+      totalNodes += history.tree().nodes();
     }
 
     const unsigned int nSamples = mcmcSamplesPerSeq * totalNodes;
     LogThisAt(1,"Starting MCMC sampler ("
 	      << plural(mcmcSamplesPerSeq,"sample") << " per node, "
-	      << plural(nSamples,"sample") << " in total)" << endl);
-    Sampler::run (samplers, generator, nSamples);
+	      << plural(nSamples,"sample") << " in total"
+	      << (mcmcChains > 1 ? string(" per chain, ") + plural(mcmcChains,"chain") : string()) << ")" << endl);
+    if (mcmcChains > 1) {
+      // chain #n runs at temperature 1 + n*mcmcHeatStep; only the cold chain is logged
+      vguard<vguard<Sampler> > chains (1, samplers);
+      for (size_t c = 1; c < mcmcChains; ++c) {
+	chains.push_back (samplers);
+	for (auto& sampler: chains.back()) {
+	  sampler.loggers.clear();
+	  sampler.heat = 1. / (1. + c * mcmcHeatStep);
+	}
+      }
+      Sampler::runChains (chains, generator, nSamples, mcmcSwapInterval, mcmcStoppingRule);
+      samplers.swap (chains[0]);
+    } else
+      Sampler::run (samplers, generator, nSamples, mcmcStoppingRule);
+    LogThisAt(2,"Substitution matrix cache: " << plural(cachedModel.cacheHits(),"hit") << ", " << plural(cachedModel.cacheMisses(),"miss","misses") << endl);
+
+    for (HistoryLogger* logger: loggers)
+      logger->flush();
+    traceWriter.finish();
 
     for (size_t n = 0; n < datasets.size(); ++n) {
       Dataset& dataset = datasets[n];
       Sampler& sampler = samplers[n];
-      dataset.tree = sampler.bestHistory.tree;
-      dataset.gappedRecon = sampler.bestHistory.gapped;
+      dataset.tree = sampler.bestHistory.tree();
+      dataset.gappedRecon = sampler.bestHistory.gapped();
       dataset.reconstruction = Alignment (dataset.gappedRecon);
       dataset.clearPrep();
 
@@ -1358,6 +1768,23 @@ void Reconstructor::sampleAll() {
   }
 }
 
+void Reconstructor::expandTraces (ostream& out) const {
+  Require (traceFilenames.size() > 0, "Please specify a trace file");
+  for (const auto& filename: traceFilenames) {
+    ifstream in (filename);
+    Require (in, "Trace file not found: %s", filename.c_str());
+    Stockholm last;
+    while (in && !in.eof()) {
+      Stockholm stock (in);
+      if (stock.gf.empty() && stock.rows() == 0)
+	continue;
+      stock.applyDelta (last);
+      stock.write (out, 0);
+      swap (last, stock);
+    }
+  }
+}
+
 void Reconstructor::reconstructAll() {
   Require (datasets.size() > 0, "Please supply some data");
   for (auto& ds : datasets)
@@ -3,12 +3,17 @@
 
 #include <deque>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <functional>
 #include "tree.h"
 #include "alignpath.h"
 #include "model.h"
 #include "forward.h"
 #include "diagenv.h"
 #include "sampler.h"
+#include "stockholm.h"
 
 #define DefaultProfileSamples 10
 #define DefaultMaxDPMemoryFraction .05
@@ -18,8 +23,21 @@
 #define DefaultMinEMImprovement .001
 
 #define DefaultMCMCSamplesPerSeq 100
+#define DefaultMCMCChains 1
+#define DefaultMCMCHeatStep 0
+#define DefaultMCMCSwapInterval 100
+#define DefaultMCMCAdaptSamplesPerSeq 0
+#define DefaultMCMCTries 1
+#define DefaultMCMCTraceThinning 1
+#define DefaultMCMCTraceQueueSize 100
+
+#define DefaultAncestralThreads 1
+#define DefaultRefinerThreads 1
 
 #define AncestralSequencePostProbTag "PP"
+#define MCMCEffectiveSampleSizeTag "ESS"
+#define MCMCSplitRHatTag "RHAT"
+#define MCMCPlateauTag "PLATEAU"
 
 #define ReconCarefulAliasArgs {"-allspan","-kmatchoff","-band","40","-profminpost",".001","-profmaxmem",to_string(100*DefaultMaxDPMemoryFraction),"-refine"}
 #define ReconFastAliasArgs {"-rndspan","-kmatchn","3","-band","10","-profmaxstates","1","-jc","-norefine"}
@@ -34,14 +52,15 @@ public:
   static const vguard<string> carefulAliasArgs;
   
   string fastaReconFilename, treeFilename, modelFilename, presetModelName;
-  list<string> seqFilenames, fastaGuideFilenames, nexusGuideFilenames, stockholmGuideFilenames, nexusReconFilenames, stockholmReconFilenames, countFilenames, simulatorTreeFilenames;
+  list<string> seqFilenames, fastaGuideFilenames, nexusGuideFilenames, stockholmGuideFilenames, nexusReconFilenames, stockholmReconFilenames, countFilenames, simulatorTreeFilenames, traceFilenames;
   string treeRoot;
-  string modelSaveFilename, guideSaveFilename, dotSaveFilename, mcmcTraceFilename;
-  size_t profileSamples, profileNodeLimit, maxEMIterations, mcmcSamplesPerSeq;
+  string modelSaveFilename, eigenCacheDir, guideSaveFilename, dotSaveFilename, mcmcTraceFilename;
+  size_t profileSamples, profileNodeLimit, maxEMIterations, mcmcSamplesPerSeq, mcmcAdaptSamplesPerSeq, mcmcTries, mcmcChains, mcmcSwapInterval, mcmcTraceThinning, mcmcTraceQueueSize, ancestralThreads, refinerThreads;
   size_t profileMinLen, profileMaxLen;
   int maxDistanceFromGuide, simulatorRootSeqLen, gammaCategories;
-  bool tokenizeCodons, guideAlignTryAllPairs, jukesCantorDistanceMatrix, useUPGMA, includeBestTraceInProfile, keepGapsOpen, usePosteriorsForProfile, reconstructRoot, refineReconstruction, predictAncestralSequence, reportAncestralSequenceProbability, accumulateSubstCounts, accumulateIndelCounts, gotPrior, useLaplacePseudocounts, usePosteriorsForDot, useSeparateSubPosteriorsForDot, keepDotGapsOpen, runMCMC, outputTraceMCMC, fixGuideMCMC, fixTreeMCMC, fixAlignMCMC, outputLeavesOnly, normalizeModel;
-  double minPostProb, maxDPMemoryFraction, minEMImprovement, minDotPostProb, minDotSubPostProb, gammaShape;
+  bool tokenizeCodons, guideAlignTryAllPairs, jukesCantorDistanceMatrix, useUPGMA, collapseDuplicates, includeBestTraceInProfile, keepGapsOpen, usePosteriorsForProfile, reconstructRoot, refineReconstruction, predictAncestralSequence, reportAncestralSequenceProbability, accumulateSubstCounts, accumulateIndelCounts, gotPrior, useLaplacePseudocounts, usePosteriorsForDot, useSeparateSubPosteriorsForDot, keepDotGapsOpen, runMCMC, outputTraceMCMC, deltaTraceMCMC, fixGuideMCMC, fixTreeMCMC, fixAlignMCMC, outputLeavesOnly, normalizeModel;
+  double minPostProb, maxDPMemoryFraction, minEMImprovement, minDotPostProb, minDotSubPostProb, gammaShape, mcmcHeatStep;
+  Sampler::StoppingRule mcmcStoppingRule;
   typedef enum { FastaFormat, GappedFastaFormat, NexusFormat, StockholmFormat, NewickFormat, JsonFormat, UnknownFormat } FileFormat;
   FileFormat outputFormat;
   ofstream* guideFile;
@@ -60,6 +79,9 @@ public:
     
     Tree tree;
     vguard<FastSeq> seqs, gappedGuide, gappedRecon, gappedAncestralRecon;
+    TokenizedFastSeqs seqTokens;
+    vguard<FastSeq> uncollapsedSeqs;  // full input, if identical sequences were collapsed
+    vguard<size_t> uncollapsedSeqRep;  // uncollapsedSeqRep[n] = index in seqs of the n'th input sequence's representative
     ReconPostProbMap gappedAncestralReconPostProb;
 
     map<string,size_t> seqIndex;
@@ -74,6 +96,9 @@ public:
     EigenCounts eigenCounts;
 
     void initGuide (const vguard<FastSeq>& gapped);
+    void initTokens (const string& alphabet);
+    void collapseDuplicateSeqs();
+    void expandDuplicateSeqs();
     void prepareRecon (Reconstructor& recon);
     void clearPrep();
     bool hasReconstruction() const { return !gappedRecon.empty(); }
@@ -94,6 +119,7 @@ public:
   bool parseCountArgs (deque<string>& argvec);
   bool parseSumArgs (deque<string>& argvec);
   bool parseFitArgs (deque<string>& argvec);
+  bool parseExpandArgs (deque<string>& argvec);
 
   void checkUniqueSeqFile();
   void checkUniqueTreeFile();
@@ -122,21 +148,51 @@ public:
   void reconstruct (Dataset& dataset);
   void refine (Dataset& dataset);
   void predictAncestors (Dataset& dataset);
+  void predictAncestorColumns (const Tree& tree, const vguard<FastSeq>& gapped, AlignColIndex startCol, AlignColIndex endCol, vguard<FastSeq>& recon, ReconPostProbMap& postProb) const;
   void count (Dataset& dataset);
   void fit();
 
   void simulate();
-  
+  void expandTraces (ostream& out) const;
+
+  // background thread that runs trace-writing jobs in order, so that formatting & I/O don't hold up the sampler
+  struct TraceWriter {
+    size_t maxQueueSize;  // push() blocks while this many jobs are waiting; if zero, jobs run synchronously
+    deque<function<void()> > queue;
+    mutex queueMutex;
+    condition_variable queueChanged;
+    bool finished;
+    thread writerThread;
+    TraceWriter (size_t maxQueueSize);
+    ~TraceWriter();
+    void push (const function<void()>& job);
+    void finish();  // runs all queued jobs, then stops the thread; later jobs run synchronously
+    void run();
+  };
+
+  // the latest history is held back until the next one arrives, so that convergence diagnostics can be attached to the sample they were computed at
+  // only every mcmcTraceThinning'th history is logged
   struct HistoryLogger : Sampler::Logger {
     Reconstructor* recon;
+    TraceWriter& writer;
     ofstream* out;
     const string& name;
-    HistoryLogger (Reconstructor& recon, const string& name);
+    Sampler::History lastHistory;
+    map<string,string> lastDiagnostics;
+    bool hasLastHistory;
+    size_t historiesSeen;
+    Sampler::History lastWrittenHistory;  // writer thread only: lastWritten is reused while the sampler's history is unchanged,
+    Stockholm lastWritten;                // and is the reference for delta encoding
+    HistoryLogger (Reconstructor& recon, TraceWriter& writer, const string& name);
     ~HistoryLogger();
     void logHistory (const Sampler::History& history);
+    void logDiagnostics (const Sampler::Diagnostics& diagnostics);
+    void flush();
+    void write (const Sampler::History& history, const map<string,string>& diagnostics);
   };
 
-  void writeTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, ostream& out, bool isReconstruction = false, const ReconPostProbMap* postProb = NULL) const;
+  void writeTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, ostream& out, bool isReconstruction = false, const ReconPostProbMap* postProb = NULL, const map<string,string>* gfAnnotation = NULL) const;
+  Stockholm makeStockholm (const Tree& tree, const vguard<FastSeq>& gapped, const string& name, bool isReconstruction = false, const ReconPostProbMap* postProb = NULL, const map<string,string>* gfAnnotation = NULL) const;
   void writeRecon (const Dataset& dataset, ostream& out) const;
   void writeRecon (ostream& out) const;
   void writeCounts (ostream& out) const;
@@ -155,6 +211,7 @@ private:
 
   Alignment makeAlignment (const Dataset& dataset, const AlignPath& path, TreeNodeIndex root) const;
   string makeAlignmentString (const Dataset& dataset, const AlignPath& path, TreeNodeIndex root, bool assignInternalNodeNames) const;
+  void formatTreeAlignment (const Tree& tree, const vguard<FastSeq>& gapped, bool isReconstruction, Tree& formattedTree, vguard<FastSeq>& formattedGapped) const;  // applies output options
   
   void seedGenerator();
 };
@@ -1,3 +1,4 @@
+#include <thread>
 #include <gsl/gsl_math.h>
 #include "refiner.h"
 #include "recon.h"
@@ -104,7 +105,8 @@ AlignPath Refiner::BranchMatrix::best() const {
 
 Refiner::Refiner (const RateModel& model)
   : model (model),
-    maxDistanceFromGuide (DefaultMaxDistanceFromGuide)
+    maxDistanceFromGuide (DefaultMaxDistanceFromGuide),
+    threads (DefaultRefinerThreads)
 { }
 
 GuideAlignmentEnvelope Refiner::makeGuide (const Tree& tree, const AlignPath& path, TreeNodeIndex node1, TreeNodeIndex node2) const {
@@ -115,39 +117,32 @@ vguard<SeqIdx> Refiner::guideSeqPos (const AlignPath& path, AlignRowIndex row) c
   return TreeAlignFuncs::getGuideSeqPos (path, row, row);
 }
 
-Refiner::History Refiner::refine (const History& oldHistory, TreeNodeIndex node) const {
-  const TreeNodeIndex parent = oldHistory.tree.parentNode (node);
+AlignPath Refiner::refineBranch (const History& oldHistory, const AlignPath& oldPath, TreeNodeIndex node, ConditionalPWMCache& cache) const {
+  const TreeNodeIndex parent = oldHistory.tree().parentNode (node);
 
-  LogThisAt(4,"Attempting branch refinement move between...\n   node #" << node << ": " << oldHistory.tree.seqName(node) << "\n parent #" << parent << ": " << oldHistory.tree.seqName(parent) << endl);
+  LogThisAt(4,"Attempting branch refinement move between...\n   node #" << node << ": " << oldHistory.tree().seqName(node) << "\n parent #" << parent << ": " << oldHistory.tree().seqName(parent) << endl);
 
-  const TreeBranchLength dist = oldHistory.tree.branchLength(parent,node);
+  const TreeBranchLength dist = oldHistory.tree().branchLength(parent,node);
   
-  const Alignment oldAlign (oldHistory.gapped);
-  const AlignPath oldBranchPath = branchPath (oldAlign.path, oldHistory.tree, node);
-  const GuideAlignmentEnvelope newBranchEnv = makeGuide (oldHistory.tree, oldBranchPath, parent, node);
+  const AlignPath oldBranchPath = branchPath (oldPath, oldHistory.tree(), node);
+  const GuideAlignmentEnvelope newBranchEnv = makeGuide (oldHistory.tree(), oldBranchPath, parent, node);
 
-  const AlignPath pCladePath = cladePath (oldAlign.path, oldHistory.tree, parent, node);
-  const AlignPath nCladePath = cladePath (oldAlign.path, oldHistory.tree, node, parent);
-  
-  const vguard<SeqIdx> parentEnvPos = guideSeqPos (oldAlign.path, parent);
-  const vguard<SeqIdx> nodeEnvPos = guideSeqPos (oldAlign.path, node);
+  const vguard<SeqIdx> parentEnvPos = guideSeqPos (oldPath, parent);
+  const vguard<SeqIdx> nodeEnvPos = guideSeqPos (oldPath, node);
   
   map<TreeNodeIndex,TreeNodeIndex> exclude;
   exclude[node] = parent;
   exclude[parent] = node;
 
-  const auto pwms = getConditionalPWMs (model, oldHistory.tree, oldHistory.gapped, exclude, allExceptNodeAndAncestors(oldHistory.tree,parent), nodeAndAncestors(oldHistory.tree,parent));
+  const auto pwms = cache.getConditionalPWMs (model, oldHistory.tree(), oldHistory.gapped(), exclude, allExceptNodeAndAncestors(oldHistory.tree(),parent), nodeAndAncestors(oldHistory.tree(),parent));
   const PosWeightMatrix& pSeq = pwms.at (parent);
   const PosWeightMatrix& nSeq = pwms.at (node);
 
   const BranchMatrix branchMatrix (model, pSeq, nSeq, dist, newBranchEnv, parentEnvPos, nodeEnvPos, parent, node);
   const AlignPath newBranchPath = branchMatrix.best();
 
-  const vguard<AlignPath> mergeComponents = { pCladePath, newBranchPath, nCladePath };
-  const AlignPath newPath = alignPathMerge (mergeComponents);
-
 #ifdef DEBUG
-  LogThisAt(12,"Test of conditional probability weight matrix calculation:" << endl << branchConditionalDump(model, oldHistory.tree, oldHistory.gapped, parent, node));
+  LogThisAt(12,"Test of conditional probability weight matrix calculation:" << endl << branchConditionalDump(model, oldHistory.tree(), oldHistory.gapped(), parent, node));
 #endif /* DEBUG */
 
   LogThisAt(7,"Old (parent:node) alignment:" << endl << alignPathString(oldBranchPath)
@@ -156,30 +151,61 @@ Refiner::History Refiner::refine (const History& oldHistory, TreeNodeIndex node)
   LogThisAt(6,"New (parent:node) alignment:" << endl << alignPathString(newBranchPath)
 	    << "Log-likelihood: " << branchMatrix.logPathProb(newBranchPath) << endl);
 
+  return newBranchPath;
+}
+
+AlignPath Refiner::mergeBranchPath (const AlignPath& path, const Tree& tree, TreeNodeIndex node, const AlignPath& newBranchPath) {
+  const TreeNodeIndex parent = tree.parentNode (node);
+  const AlignPath pCladePath = cladePath (path, tree, parent, node);
+  const AlignPath nCladePath = cladePath (path, tree, node, parent);
+  const vguard<AlignPath> mergeComponents = { pCladePath, newBranchPath, nCladePath };
+  return alignPathMerge (mergeComponents);
+}
+
+Refiner::History Refiner::refine (const History& oldHistory, TreeNodeIndex node) const {
+  const Alignment oldAlign (oldHistory.gapped());
+  const AlignPath newBranchPath = refineBranch (oldHistory, oldAlign.path, node, conditionalPWMCache);
+  const AlignPath newPath = mergeBranchPath (oldAlign.path, oldHistory.tree(), node, newBranchPath);
+
   LogThisAt(7,"New full alignment:" << endl << alignPathString(newPath));
 
   const Alignment newAlign (oldAlign.ungapped, newPath);
 
-  History newHistory;
-  newHistory.tree = oldHistory.tree;
-  newHistory.gapped = newAlign.gapped();
-  
-  return newHistory;
+  return History (make_shared<const vguard<FastSeq> > (newAlign.gapped()), oldHistory.sharedTree);
 }
 
 Refiner::History Refiner::refine (const History& oldHistory) const {
-  const Tree& tree = oldHistory.tree;
+  const Tree& tree = oldHistory.tree();
   tree.assertPostorderSorted();
+  // unchanged columns are only revisited on the next sweep, so keep cached PWM columns for a whole sweep if memory allows
+  // (parallel refinement keeps one cache per thread, so each gets a share of the budget)
+  const size_t cols = oldHistory.gapped().empty() ? 0 : oldHistory.gapped().front().seq.size();
+  const size_t bytesPerStep = 2 * cols * (model.components() * model.alphabetSize() * sizeof(LogProb) + tree.nodes()) * threads;
+  conditionalPWMCache.treeId.maxAge = conditionalPWMCache.pwmCol.maxAge
+    = max ((size_t) DefaultConditionalPWMCacheAge, min ((size_t) tree.nodes(), DefaultRefinerPWMCacheBytes / max ((size_t) 1, bytesPerStep)));
+  if (threads > 1 && tree.nodes() > 3)
+    return refineInParallel (oldHistory);
+  // the working state is the alignment path; gapped rows are rebuilt only when a refinement is accepted
+  const Alignment align (oldHistory.gapped());
+  const LogProb lpRoot = rootLogLikelihood (model, oldHistory);
   History bestHistory = oldHistory;
-  LogProb bestLogProb = logLikelihood (bestHistory);
+  AlignPath bestPath = align.path;
+  vguard<LogProb> bestBranchLogLike = branchLogLikelihoods (tree, bestPath);
+  LogProb bestLogProb = pathLogLikelihood (tree, align.ungapped, bestPath, lpRoot, bestBranchLogLike, logLikelihoodCache);
   TreeNodeIndex node = 0;
   int stepsSinceImprovement = 0;
   while (stepsSinceImprovement < tree.nodes() - 1) {
-    const History newBestHistory = refine (bestHistory, node);
-    const LogProb newBestLogProb = logLikelihood (newBestHistory);
+    const AlignPath newBranchPath = refineBranch (bestHistory, bestPath, node, conditionalPWMCache);
+    const AlignPath newPath = mergeBranchPath (bestPath, tree, node, newBranchPath);
+    LogThisAt(7,"New full alignment:" << endl << alignPathString(newPath));
+    vguard<LogProb> newBranchLogLike = bestBranchLogLike;
+    newBranchLogLike[node] = branchLogLikelihood (tree, newPath, node);
+    const LogProb newBestLogProb = pathLogLikelihood (tree, align.ungapped, newPath, lpRoot, newBranchLogLike, logLikelihoodCache);
     if (newBestLogProb > bestLogProb) {
       LogThisAt(3,"Branch refinement improved alignment log-likelihood from " << bestLogProb << " to " << newBestLogProb << endl);
-      bestHistory = newBestHistory;
+      bestHistory = History (make_shared<const vguard<FastSeq> > (Alignment (align.ungapped, newPath).gapped()), oldHistory.sharedTree);
+      bestPath = newPath;
+      bestBranchLogLike.swap (newBranchLogLike);
       bestLogProb = newBestLogProb;
       stepsSinceImprovement = 0;
     } else {
@@ -190,5 +216,140 @@ Refiner::History Refiner::refine (const History& oldHistory) const {
     }
     node = (node + 1) % (tree.nodes() - 1);  // skip root
   }
+  LogThisAt(3,conditionalPWMCache.stats());
+  LogThisAt(3,logLikelihoodCache.stats());
+  return bestHistory;
+}
+
+LogProb Refiner::branchLogLikelihood (const Tree& tree, const AlignPath& path, TreeNodeIndex node) const {
+  const TreeNodeIndex parent = tree.parentNode (node);
+  const ProbModel probModel (model, tree.branchLength (node));
+  return logBranchPathLikelihood (probModel, pairPath (path, parent, node), parent, node);
+}
+
+vguard<LogProb> Refiner::branchLogLikelihoods (const Tree& tree, const AlignPath& path) const {
+  vguard<LogProb> branchLogLike (tree.nodes(), 0);
+  for (TreeNodeIndex node = 0; node < tree.root(); ++node)
+    branchLogLike[node] = branchLogLikelihood (tree, path, node);
+  return branchLogLike;
+}
+
+LogProb Refiner::pathLogLikelihood (const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path, LogProb lpRoot, const vguard<LogProb>& branchLogLike, LogLikelihoodCache& cache) const {
+  LogProb lpGaps = 0;
+  for (TreeNodeIndex node = 0; node < tree.root(); ++node)
+    lpGaps += branchLogLike[node];
+  const LogProb lpSub = cache.substLogLikelihood (model, tree, ungapped, path);
+  const LogProb lp = lpRoot + lpGaps + lpSub;
+  LogThisAt(6,"log(L) = " << setw(10) << lpRoot << " (root) + " << setw(10) << lpGaps << " (indels) + " << setw(10) << lpSub << " (substitutions) = " << lp << endl);
+  cache.nextAge();
+  return lp;
+}
+
+vguard<vguard<TreeNodeIndex> > Refiner::independentBranchBatches (const Tree& tree) const {
+  // greedily color branches (identified by child node) so that branches sharing a node get different colors
+  vguard<set<size_t> > nodeColors (tree.nodes());
+  vguard<vguard<TreeNodeIndex> > colorBranches;
+  for (TreeNodeIndex node = 0; node < tree.nodes() - 1; ++node) {  // skip root
+    const TreeNodeIndex parent = tree.parentNode (node);
+    size_t color = 0;
+    while (nodeColors[node].count(color) || nodeColors[parent].count(color))
+      ++color;
+    nodeColors[node].insert (color);
+    nodeColors[parent].insert (color);
+    if (color >= colorBranches.size())
+      colorBranches.resize (color + 1);
+    colorBranches[color].push_back (node);
+  }
+  // split each color into batches of at most (threads) branches
+  vguard<vguard<TreeNodeIndex> > batches;
+  for (const auto& branches : colorBranches)
+    for (size_t n = 0; n < branches.size(); n += threads)
+      batches.push_back (vguard<TreeNodeIndex> (branches.begin() + n, branches.begin() + min (n + threads, branches.size())));
+  return batches;
+}
+
+Refiner::History Refiner::refineInParallel (const History& oldHistory) const {
+  const Tree& tree = oldHistory.tree();
+  const vguard<vguard<TreeNodeIndex> > batches = independentBranchBatches (tree);
+  LogThisAt(3,"Refining " << plural(tree.nodes() - 1,"branch","branches") << " in " << plural(batches.size(),"batch","batches") << " of up to " << threads << " using parallel threads" << endl);
+
+  vguard<ConditionalPWMCache> threadPWMCache (threads, conditionalPWMCache);
+  vguard<LogLikelihoodCache> threadLogLikeCache (threads, logLikelihoodCache);
+  const Alignment align (oldHistory.gapped());
+  const LogProb lpRoot = rootLogLikelihood (model, oldHistory);
+  History bestHistory = oldHistory;
+  AlignPath bestPath = align.path;
+  vguard<LogProb> bestBranchLogLike = branchLogLikelihoods (tree, bestPath);
+  LogProb bestLogProb = pathLogLikelihood (tree, align.ungapped, bestPath, lpRoot, bestBranchLogLike, logLikelihoodCache);
+  size_t batch = 0, batchesSinceImprovement = 0;
+  while (batchesSinceImprovement < batches.size()) {
+    const vguard<TreeNodeIndex>& nodes = batches[batch];
+
+    // realign each branch of the batch independently, against the current best history
+    vguard<AlignPath> newBranchPath (nodes.size()), newPath (nodes.size());
+    vguard<LogProb> newBranchLogProb (nodes.size()), newLogProb (nodes.size());
+    auto refineNode = [&] (size_t n) {
+      newBranchPath[n] = refineBranch (bestHistory, bestPath, nodes[n], threadPWMCache[n]);
+      newPath[n] = mergeBranchPath (bestPath, tree, nodes[n], newBranchPath[n]);
+      vguard<LogProb> branchLogLike = bestBranchLogLike;
+      newBranchLogProb[n] = branchLogLike[nodes[n]] = branchLogLikelihood (tree, newPath[n], nodes[n]);
+      newLogProb[n] = pathLogLikelihood (tree, align.ungapped, newPath[n], lpRoot, branchLogLike, threadLogLikeCache[n]);
+    };
+    if (nodes.size() == 1)
+      refineNode (0);
+    else {
+      vguard<thread> nodeThreads;
+      for (size_t n = 0; n < nodes.size(); ++n)
+	nodeThreads.push_back (thread (refineNode, n));
+      for (auto& th : nodeThreads)
+	th.join();
+    }
+
+    // combine all the branches that improved on their own; keep the combination only if it beats the best single branch
+    AlignPath combinedPath = bestPath;
+    vguard<LogProb> combinedBranchLogLike = bestBranchLogLike;
+    size_t improved = 0, best = 0;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+      if (newLogProb[n] > bestLogProb) {
+	combinedPath = mergeBranchPath (combinedPath, tree, nodes[n], newBranchPath[n]);
+	combinedBranchLogLike[nodes[n]] = newBranchLogProb[n];
+	if (improved == 0 || newLogProb[n] > newLogProb[best])
+	  best = n;
+	++improved;
+      } else if (newLogProb[n] < bestLogProb && !REFINER_NEAR_EQ(newLogProb[n],bestLogProb))
+	Warn ("During branch refinement, alignment log-likelihood dropped from %g to %g", bestLogProb, newLogProb[n]);
+    }
+
+    if (improved) {
+      LogProb newBestLogProb = newLogProb[best];
+      bool useCombined = false;
+      if (improved > 1) {
+	const LogProb combinedLogProb = pathLogLikelihood (tree, align.ungapped, combinedPath, lpRoot, combinedBranchLogLike, logLikelihoodCache);
+	LogThisAt(4,"Combining " << improved << " refined branches gives log-likelihood " << combinedLogProb << " (best single branch " << newBestLogProb << ")" << endl);
+	if (combinedLogProb > newBestLogProb) {
+	  newBestLogProb = combinedLogProb;
+	  useCombined = true;
+	}
+      }
+      if (useCombined) {
+	bestPath.swap (combinedPath);
+	bestBranchLogLike.swap (combinedBranchLogLike);
+      } else {
+	bestPath.swap (newPath[best]);
+	bestBranchLogLike[nodes[best]] = newBranchLogProb[best];
+      }
+      LogThisAt(3,"Branch refinement improved alignment log-likelihood from " << bestLogProb << " to " << newBestLogProb << endl);
+      bestHistory = History (make_shared<const vguard<FastSeq> > (Alignment (align.ungapped, bestPath).gapped()), oldHistory.sharedTree);
+      bestLogProb = newBestLogProb;
+      batchesSinceImprovement = 0;
+    } else {
+      ++batchesSinceImprovement;
+      LogThisAt(4,"Branch refinement failed to improve alignment log-likelihood for " << plural(batchesSinceImprovement,"batch","batches") << endl);
+    }
+    batch = (batch + 1) % batches.size();
+  }
+  for (const auto& cache : threadPWMCache)
+    LogThisAt(3,cache.stats());
+  LogThisAt(3,logLikelihoodCache.stats());
   return bestHistory;
 }
@@ -3,6 +3,8 @@
 
 #include "sampler.h"
 
+#define DefaultRefinerPWMCacheBytes (1 << 28)
+
 struct Refiner : TreeAlignFuncs {
   typedef DPMatrix::random_engine random_engine;
   
@@ -17,6 +19,9 @@ struct Refiner : TreeAlignFuncs {
   // Refiner member variables
   const RateModel& model;
   int maxDistanceFromGuide;
+  size_t threads;
+  mutable ConditionalPWMCache conditionalPWMCache;
+  mutable LogLikelihoodCache logLikelihoodCache;
   
   // Refiner constructor
   Refiner (const RateModel& model);
@@ -29,6 +34,21 @@ struct Refiner : TreeAlignFuncs {
   History refine (const History& oldHistory, TreeNodeIndex node) const;
   History refine (const History& oldHistory) const;
 
+  // parallel refinement: branches are grouped into batches of up to (threads) branches that share no nodes,
+  // each batch is realigned concurrently, and the merged result is kept only if it beats every single-branch result
+  History refineInParallel (const History& oldHistory) const;
+  vguard<vguard<TreeNodeIndex> > independentBranchBatches (const Tree& tree) const;
+
+  // realign a single branch, returning the new (parent:node) pairwise path
+  AlignPath refineBranch (const History& oldHistory, const AlignPath& oldPath, TreeNodeIndex node, ConditionalPWMCache& cache) const;
+  static AlignPath mergeBranchPath (const AlignPath& path, const Tree& tree, TreeNodeIndex node, const AlignPath& newBranchPath);
+
+  // incremental scoring of an alignment path: indel terms are kept per branch, so realigning a branch rescores only that branch,
+  // and substitution terms are looked up column by column in a log-likelihood cache
+  LogProb branchLogLikelihood (const Tree& tree, const AlignPath& path, TreeNodeIndex node) const;
+  vguard<LogProb> branchLogLikelihoods (const Tree& tree, const AlignPath& path) const;
+  LogProb pathLogLikelihood (const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path, LogProb lpRoot, const vguard<LogProb>& branchLogLike, LogLikelihoodCache& cache) const;
+
   GuideAlignmentEnvelope makeGuide (const Tree& tree, const AlignPath& path, TreeNodeIndex node1, TreeNodeIndex node2) const;
   vguard<SeqIdx> guideSeqPos (const AlignPath& path, AlignRowIndex row) const;
 };
@@ -1,4 +1,6 @@
+#include <thread>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_fft_complex.h>
 #include "sampler.h"
 #include "recon.h"
 #include "util.h"
@@ -32,17 +34,29 @@ LogProb SimpleTreePrior::treeLogLikelihood (const Tree& tree) const {
 
 Sampler::History Sampler::History::reorder (const vguard<TreeNodeIndex>& newOrder) const {
   LogThisAt(6,"Reordering nodes to maintain preorder sort (" << to_string_join(newOrder) << ")" << endl);
-  History newHistory;
-  newHistory.tree = tree.reorderNodes (newOrder);
-  newHistory.gapped.reserve (gapped.size());
+  vguard<FastSeq> newGapped;
+  newGapped.reserve (gapped().size());
   for (auto n : newOrder)
-    newHistory.gapped.push_back (gapped[n]);
-  return newHistory;
+    newGapped.push_back (gapped()[n]);
+  return History (newGapped, tree().reorderNodes (newOrder));
 }
 
 void Sampler::History::assertNamesMatch() const {
-  tree.assertAllNodesNamed();
-  tree.assertNodesMatchSeqs (gapped);
+  tree().assertAllNodesNamed();
+  tree().assertNodesMatchSeqs (gapped());
+}
+
+bool Sampler::History::sameAs (const History& history) const {
+  if (sharedTree != history.sharedTree && treeKey (tree()) != treeKey (history.tree()))
+    return false;
+  if (sharedGapped == history.sharedGapped)
+    return true;
+  if (gapped().size() != history.gapped().size())
+    return false;
+  for (size_t n = 0; n < gapped().size(); ++n)
+    if (gapped()[n].name != history.gapped()[n].name || gapped()[n].seq != history.gapped()[n].seq)
+      return false;
+  return true;
 }
 
 TreeNodeIndex Sampler::randomInternalNode (const Tree& tree, random_engine& generator) {
@@ -134,6 +148,11 @@ vguard<SeqIdx> TreeAlignFuncs::getGuideSeqPos (const AlignPath& path, AlignRowIn
 }
 
 AlignPath TreeAlignFuncs::cladePath (const AlignPath& path, const Tree& tree, TreeNodeIndex cladeRoot, TreeNodeIndex cladeRootParent, TreeNodeIndex exclude) {
+  vguard<AlignColIndex> pathCol;
+  return cladePath (path, tree, cladeRoot, cladeRootParent, pathCol, exclude);
+}
+
+AlignPath TreeAlignFuncs::cladePath (const AlignPath& path, const Tree& tree, TreeNodeIndex cladeRoot, TreeNodeIndex cladeRootParent, vguard<AlignColIndex>& pathCol, TreeNodeIndex exclude) {
   AlignPath p;
   const vguard<TreeNodeIndex> rerootedParent = tree.rerootedParent (cladeRootParent);
   vguard<bool> childrenIncluded (tree.nodes(), false);
@@ -144,7 +163,7 @@ AlignPath TreeAlignFuncs::cladePath (const AlignPath& path, const Tree& tree, Tr
       childrenIncluded[n] = true;
     }
   }
-  return alignPathRemoveEmptyColumns (p);
+  return alignPathRemoveEmptyColumns (p, pathCol);
 }
 
 AlignPath TreeAlignFuncs::pairPath (const AlignPath& path, TreeNodeIndex node1, TreeNodeIndex node2) {
@@ -369,9 +388,103 @@ map<TreeNodeIndex,TreeAlignFuncs::PosWeightMatrix> TreeAlignFuncs::getConditiona
   return pwms;
 }
 
+TreeAlignFuncs::ConditionalPWMCache::ConditionalPWMCache (size_t maxAge)
+  : treeId (maxAge),
+    pwmCol (maxAge),
+    nextTreeId (0)
+{ }
+
+map<TreeNodeIndex,TreeAlignFuncs::PosWeightMatrix> TreeAlignFuncs::ConditionalPWMCache::getConditionalPWMs (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, const map<TreeNodeIndex,TreeNodeIndex>& exclude, const set<TreeNodeIndex>& fillUpNodes, const set<TreeNodeIndex>& fillDownNodes, bool normalize) {
+  const TreeKey tKey = treeKey (tree);
+  const size_t* tid = treeId.find (tKey);
+  if (!tid)
+    tid = &treeId.insert (tKey, nextTreeId++);
+  const size_t id = *tid;
+  const AlignColIndex cols = gapped.empty() ? 0 : gapped.front().seq.size();
+
+  // the posterior of a node, excluding one neighbor, depends only on the rows reachable from the node without crossing that neighbor
+  map<TreeNodeIndex,vguard<ColumnKey> > colKey;
+  for (const auto& node_exclude : exclude) {
+    const TreeNodeIndex node = node_exclude.first, excluded = node_exclude.second;
+    vguard<AlignRowIndex> rows;
+    list<TreeNodeIndex> toVisit (1, node);
+    set<TreeNodeIndex> visited;
+    while (!toVisit.empty()) {
+      const TreeNodeIndex n = toVisit.front();
+      toVisit.pop_front();
+      if (n < 0 || n == excluded || visited.count (n))
+	continue;
+      visited.insert (n);
+      toVisit.push_back (tree.parentNode (n));
+      for (size_t nc = 0; nc < tree.nChildren (n); ++nc)
+	toVisit.push_back (tree.getChild (n, nc));
+    }
+    vguard<ColumnKey>& keys = colKey[node];
+    keys.reserve (cols);
+    for (AlignColIndex col = 0; col < cols; ++col) {
+      string colStr;
+      colStr.reserve (visited.size());
+      for (auto row : visited)
+	colStr.push_back (gapped[row].seq[col]);
+      keys.push_back (ColumnKey (id, node, excluded, normalize, colStr));
+    }
+  }
+
+  // look up every node's ungapped columns; gather the columns that are missing for any node, & compute them together
+  map<TreeNodeIndex,vguard<const PWMColumn*> > found;
+  vguard<FastSeq> missing (gapped);
+  for (auto& fs : missing)
+    fs.seq.clear();
+  vguard<AlignColIndex> missingCol;
+  for (const auto& node_exclude : exclude)
+    found[node_exclude.first].resize (cols, NULL);
+  for (AlignColIndex col = 0; col < cols; ++col) {
+    bool colMissing = false;
+    for (const auto& node_exclude : exclude)
+      if (!Alignment::isGap (gapped[node_exclude.first].seq[col]))
+	if (!(found[node_exclude.first][col] = pwmCol.find (colKey[node_exclude.first][col])))
+	  colMissing = true;
+    if (colMissing) {
+      missingCol.push_back (col);
+      for (AlignRowIndex row = 0; row < gapped.size(); ++row)
+	missing[row].seq.push_back (gapped[row].seq[col]);
+    }
+  }
+  if (missingCol.size()) {
+    AlignColSumProduct colSumProd (model, tree, missing);
+    colSumProd.preorder = vguard<TreeNodeIndex> (fillDownNodes.rbegin(), fillDownNodes.rend());
+    colSumProd.postorder = vguard<TreeNodeIndex> (fillUpNodes.begin(), fillUpNodes.end());
+    for (auto col : missingCol) {
+      colSumProd.fillUp();
+      colSumProd.fillDown();
+      for (const auto& node_exclude : exclude) {
+	const PWMColumn*& f = found[node_exclude.first][col];
+	if (!colSumProd.isGap (node_exclude.first) && !f)
+	  f = &pwmCol.insert (colKey[node_exclude.first][col], colSumProd.logNodeExcludedPostProb (node_exclude.first, node_exclude.second, normalize));
+      }
+      colSumProd.nextColumn();
+    }
+  }
+
+  map<TreeNodeIndex,PosWeightMatrix> pwms;
+  for (AlignColIndex col = 0; col < cols; ++col)
+    for (const auto& node_exclude : exclude)
+      if (!Alignment::isGap (gapped[node_exclude.first].seq[col]))
+	pwms[node_exclude.first].push_back (*found[node_exclude.first][col]);
+  treeId.nextAge();
+  pwmCol.nextAge();
+  return pwms;
+}
+
+string TreeAlignFuncs::ConditionalPWMCache::stats() const {
+  ostringstream out;
+  out << "Conditional PWM cache: " << plural(pwmCol.hits,"column hit") << ", " << plural(pwmCol.misses,"column miss","column misses") << endl;
+  return out.str();
+}
+
 LogProb TreeAlignFuncs::rootLogLikelihood (const RateModel& model, const History& history) {
   size_t rootLen = 0;
-  for (auto c: history.gapped[history.tree.root()].seq)
+  for (auto c: history.gapped()[history.tree().root()].seq)
     if (!Alignment::isGap(c))
       ++rootLen;
   const LogProb rootExt = rootExtProb(model);
@@ -380,11 +493,11 @@ LogProb TreeAlignFuncs::rootLogLikelihood (const RateModel& model, const History
 }
 
 LogProb TreeAlignFuncs::indelLogLikelihood (const RateModel& model, const History& history) {
-  const Alignment align (history.gapped);
+  const Alignment align (history.gapped());
   LogProb lpGaps = 0;
-  for (TreeNodeIndex node = 0; node < history.tree.root(); ++node) {
-    const TreeNodeIndex parent = history.tree.parentNode (node);
-    const ProbModel probModel (model, history.tree.branchLength (node));
+  for (TreeNodeIndex node = 0; node < history.tree().root(); ++node) {
+    const TreeNodeIndex parent = history.tree().parentNode (node);
+    const ProbModel probModel (model, history.tree().branchLength (node));
     const AlignPath path = pairPath (align.path, parent, node);
     lpGaps += logBranchPathLikelihood (probModel, path, parent, node);
   }
@@ -392,22 +505,24 @@ LogProb TreeAlignFuncs::indelLogLikelihood (const RateModel& model, const Histor
 }
 
 LogProb TreeAlignFuncs::substLogLikelihood (const RateModel& model, const History& history) {
-  AlignColSumProduct colSumProd (model, history.tree, history.gapped);
-  LogProb lpSub = 0;
-  vguard<LogProb> colSub;
+  const AlignColPatterns patterns (history.gapped());
+  AlignColSumProduct colSumProd (model, history.tree(), patterns.gapped);
+  vguard<LogProb> patternSub;
   while (!colSumProd.alignmentDone()) {
     colSumProd.fillUp();
-    const LogProb cll = colSumProd.columnLogLikelihood();
-    lpSub += cll;
-    colSub.push_back (cll);
+    patternSub.push_back (colSumProd.columnLogLikelihood());
     colSumProd.nextColumn();
   }
+  const vguard<LogProb> colSub = patterns.expandColumns (patternSub);
+  LogProb lpSub = 0;
+  for (auto cll : colSub)
+    lpSub += cll;
   LogThisAt(9,"Column substitution log-likelihoods: (" << to_string_join(colSub) << ")" << endl);
   return lpSub;
 }
 
 LogProb TreeAlignFuncs::logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, const History& history, const char* suffix) {
-  const LogProb lpTree = treePrior.treeLogLikelihood (history.tree);
+  const LogProb lpTree = treePrior.treeLogLikelihood (history.tree());
   const LogProb lpRoot = rootLogLikelihood (model, history);
   const LogProb lpGaps = indelLogLikelihood (model, history);
   const LogProb lpSub = substLogLikelihood (model, history);
@@ -417,7 +532,7 @@ LogProb TreeAlignFuncs::logLikelihood (const SimpleTreePrior& treePrior, const R
 }
 
 LogProb TreeAlignFuncs::logLikelihood (const RateModel& model, const History& history, const char* suffix) {
-  const Alignment align (history.gapped);
+  const Alignment align (history.gapped());
   const LogProb lpRoot = rootLogLikelihood (model, history);
   const LogProb lpGaps = indelLogLikelihood (model, history);
   const LogProb lpSub = substLogLikelihood (model, history);
@@ -436,6 +551,281 @@ LogProb TreeAlignFuncs::logLikelihood (const RateModel& model, const Tree& tree,
   return logLikelihood (model, history, suffix);
 }
 
+TreeAlignFuncs::TreeKey TreeAlignFuncs::treeKey (const Tree& tree) {
+  TreeKey key;
+  key.first.resize (tree.nodes());
+  key.second.reserve (tree.nodes());
+  for (TreeNodeIndex node = 0; node < tree.nodes(); ++node) {
+    for (size_t nc = 0; nc < tree.nChildren (node); ++nc)
+      key.first[node].push_back (tree.getChild (node, nc));
+    key.second.push_back (tree.branchLength (node));
+  }
+  return key;
+}
+
+void TreeAlignFuncs::HistoryChange::keepColumns (AlignColIndex cols) {
+  oldCol = vguard<long> (cols);
+  for (AlignColIndex col = 0; col < cols; ++col)
+    oldCol[col] = col;
+}
+
+void TreeAlignFuncs::HistoryChange::matchColumns (const Alignment& oldAlign, const vguard<FastSeq>& newUngapped, const AlignPath& newPath, const vguard<vguard<AlignColIndex> >& oldCladeCol, const vguard<vguard<AlignColIndex> >& newCladeCol, const vguard<AlignRowIndex>& rebuiltRows) {
+  // list the (clade, clade column) pairs held by each old & new column, in clade order
+  typedef vguard<pair<size_t,AlignColIndex> > CladeCols;
+  const AlignPath& oldPath = oldAlign.path;
+  const AlignColIndex oldCols = alignPathColumns (oldPath), newCols = alignPathColumns (newPath);
+  vguard<CladeCols> oldHeld (oldCols), newHeld (newCols);
+  for (size_t clade = 0; clade < oldCladeCol.size(); ++clade) {
+    Assert (oldCladeCol[clade].size() == newCladeCol[clade].size(), "Clade #%u has %u old columns but %u new columns", clade, oldCladeCol[clade].size(), newCladeCol[clade].size());
+    for (AlignColIndex col = 0; col < oldCladeCol[clade].size(); ++col) {
+      oldHeld[oldCladeCol[clade][col]].push_back (make_pair (clade, col));
+      newHeld[newCladeCol[clade][col]].push_back (make_pair (clade, col));
+    }
+  }
+  oldCol = vguard<long> (newCols, -1);
+  for (AlignColIndex col = 0; col < newCols; ++col)
+    if (!newHeld[col].empty()) {
+      const AlignColIndex match = oldCladeCol[newHeld[col].front().first][newHeld[col].front().second];
+      if (oldHeld[match] == newHeld[col])
+	oldCol[col] = match;
+    }
+  // a rebuilt row is not in any clade, so compare its residues directly
+  for (auto row : rebuiltRows) {
+    const AlignRowPath& oldRow = oldPath.at (row);
+    const AlignRowPath& newRow = newPath.at (row);
+    const string& oldSeq = oldAlign.ungapped[row].seq;
+    const string& newSeq = newUngapped[row].seq;
+    vguard<SeqIdx> oldPos (oldCols);
+    SeqIdx pos = 0;
+    for (AlignColIndex col = 0; col < oldCols; ++col) {
+      oldPos[col] = pos;
+      if (oldRow[col])
+	++pos;
+    }
+    pos = 0;
+    for (AlignColIndex col = 0; col < newCols; ++col) {
+      const long match = oldCol[col];
+      if (match >= 0 && (newRow[col] != oldRow[match] || (newRow[col] && newSeq[pos] != oldSeq[oldPos[match]])))
+	oldCol[col] = -1;
+      if (newRow[col])
+	++pos;
+    }
+  }
+}
+
+void TreeAlignFuncs::HistoryChange::markBranchColumns (const History& oldHistory, const History& newHistory) {
+  // a column's substitution log-likelihood also depends on the branch of every ungapped node
+  if (oldHistory.sharedTree == newHistory.sharedTree)
+    return;
+  for (auto node : branches) {
+    const string& seq = newHistory.gapped()[node].seq;
+    for (AlignColIndex col = 0; col < oldCol.size(); ++col)
+      if (!Alignment::isGap (seq[col]))
+	oldCol[col] = -1;
+  }
+}
+
+TreeAlignFuncs::LogLikelihoodCache::LogLikelihoodCache (size_t maxAge)
+  : treeId (maxAge),
+    branchLogLike (maxAge),
+    colLogLike (maxAge),
+    nextTreeId (0),
+    branchesReused (0),
+    colsReused (0)
+{ }
+
+LogProb TreeAlignFuncs::LogLikelihoodCache::branchLogLikelihood (const RateModel& model, const History& history, TreeNodeIndex node) {
+  const AlignColIndex cols = history.gapped().empty() ? 0 : history.gapped().front().seq.size();
+  const TreeNodeIndex parent = history.tree().parentNode (node);
+  const string& parentSeq = history.gapped()[parent].seq;
+  const string& nodeSeq = history.gapped()[node].seq;
+  BranchKey key (history.tree().branchLength (node), string());
+  for (AlignColIndex col = 0; col < cols; ++col) {
+    const bool p = !Alignment::isGap (parentSeq[col]), n = !Alignment::isGap (nodeSeq[col]);
+    if (p || n)
+      key.second.push_back (p ? (n ? 'M' : 'D') : 'I');
+  }
+  const LogProb* lp = branchLogLike.find (key);
+  if (!lp) {
+    AlignPath path;
+    for (auto c : key.second) {
+      path[0].push_back (c != 'I');
+      path[1].push_back (c != 'D');
+    }
+    const ProbModel probModel (model, key.first);
+    lp = &branchLogLike.insert (key, logBranchPathLikelihood (probModel, pairPath (path, 0, 1), 0, 1));
+  }
+  return *lp;
+}
+
+size_t TreeAlignFuncs::LogLikelihoodCache::getTreeId (const Tree& tree) {
+  const TreeKey tKey = treeKey (tree);
+  const size_t* tid = treeId.find (tKey);
+  if (!tid)
+    tid = &treeId.insert (tKey, nextTreeId++);
+  return *tid;
+}
+
+void TreeAlignFuncs::LogLikelihoodCache::columnLogLikelihoods (const RateModel& model, const History& history, const vguard<AlignColIndex>& cols, vguard<LogProb>& colSub) {
+  if (cols.empty())
+    return;
+  const size_t id = getTreeId (history.tree());
+  const vguard<FastSeq>& gapped = history.gapped();
+  const AlignRowIndex rows = gapped.size();
+
+  // look up each column; gather the distinct columns that are not in the cache & compute them together
+  ColumnKey key (id, string (rows, Alignment::gapChar));
+  map<string,size_t> missingIndex;
+  vguard<FastSeq> missing (gapped);
+  for (auto& fs : missing)
+    fs.seq.clear();
+  vguard<vguard<AlignColIndex> > missingCols;
+  for (auto col : cols) {
+    for (AlignRowIndex row = 0; row < rows; ++row)
+      key.second[row] = gapped[row].seq[col];
+    const LogProb* lp = colLogLike.find (key);
+    if (lp)
+      colSub[col] = *lp;
+    else {
+      auto iter = missingIndex.find (key.second);
+      if (iter == missingIndex.end()) {
+	iter = missingIndex.insert (iter, make_pair (key.second, missingCols.size()));
+	missingCols.push_back (vguard<AlignColIndex>());
+	for (AlignRowIndex row = 0; row < rows; ++row)
+	  missing[row].seq.push_back (key.second[row]);
+      }
+      missingCols[iter->second].push_back (col);
+    }
+  }
+  if (missingCols.size()) {
+    AlignColSumProduct colSumProd (model, history.tree(), missing);
+    for (const auto& sameCols : missingCols) {
+      colSumProd.fillUp();
+      for (AlignRowIndex row = 0; row < rows; ++row)
+	key.second[row] = missing[row].seq[colSumProd.col];
+      const LogProb lp = colLogLike.insert (key, colSumProd.columnLogLikelihood());
+      for (auto col : sameCols)
+	colSub[col] = lp;
+      colSumProd.nextColumn();
+    }
+  }
+}
+
+LogProb TreeAlignFuncs::LogLikelihoodCache::substLogLikelihood (const RateModel& model, const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path) {
+  const size_t id = getTreeId (tree);
+  const AlignRowIndex rows = ungapped.size();
+  const AlignColIndex cols = alignPathColumns (path);
+  vguard<const AlignRowPath*> rowPath (rows);
+  for (AlignRowIndex row = 0; row < rows; ++row)
+    rowPath[row] = &path.at (row);
+
+  // walk the path, building each column & looking it up; gather distinct missing columns & compute them together
+  vguard<LogProb> colSub (cols);
+  vguard<SeqIdx> pos (rows, 0);
+  ColumnKey key (id, string (rows, Alignment::gapChar));
+  map<string,size_t> missingIndex;
+  vguard<FastSeq> missing (ungapped);
+  for (auto& fs : missing)
+    fs.seq.clear();
+  vguard<vguard<AlignColIndex> > missingCols;
+  for (AlignColIndex col = 0; col < cols; ++col) {
+    for (AlignRowIndex row = 0; row < rows; ++row)
+      key.second[row] = (*rowPath[row])[col] ? ungapped[row].seq[pos[row]++] : Alignment::gapChar;
+    const LogProb* lp = colLogLike.find (key);
+    if (lp)
+      colSub[col] = *lp;
+    else {
+      auto iter = missingIndex.find (key.second);
+      if (iter == missingIndex.end()) {
+	iter = missingIndex.insert (iter, make_pair (key.second, missingCols.size()));
+	missingCols.push_back (vguard<AlignColIndex>());
+	for (AlignRowIndex row = 0; row < rows; ++row)
+	  missing[row].seq.push_back (key.second[row]);
+      }
+      missingCols[iter->second].push_back (col);
+    }
+  }
+  if (missingCols.size()) {
+    AlignColSumProduct colSumProd (model, tree, missing);
+    for (const auto& cols : missingCols) {
+      colSumProd.fillUp();
+      for (AlignRowIndex row = 0; row < rows; ++row)
+	key.second[row] = missing[row].seq[colSumProd.col];
+      const LogProb lp = colLogLike.insert (key, colSumProd.columnLogLikelihood());
+      for (auto col : cols)
+	colSub[col] = lp;
+      colSumProd.nextColumn();
+    }
+  }
+
+  LogProb lpSub = 0;
+  for (auto cll : colSub)
+    lpSub += cll;
+  LogThisAt(9,"Column substitution log-likelihoods: (" << to_string_join(colSub) << ")" << endl);
+  return lpSub;
+}
+
+LogProb TreeAlignFuncs::LogLikelihoodCache::logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, History& history, const char* suffix) {
+  return logLikelihood (treePrior, model, history, History(), HistoryChange(), suffix);
+}
+
+LogProb TreeAlignFuncs::LogLikelihoodCache::logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, History& history, const History& oldHistory, const HistoryChange& change, const char* suffix) {
+  const LogLikelihoodTerms* oldTerms = oldHistory.sharedTerms.get();
+  auto terms = make_shared<LogLikelihoodTerms>();
+
+  // indel log-likelihood of each branch, copying the ones the change didn't touch
+  const TreeNodeIndex root = history.tree().root();
+  terms->branchLogLike.reserve (root);
+  for (TreeNodeIndex node = 0; node < root; ++node)
+    if (oldTerms && !change.branches.count (node)) {
+      terms->branchLogLike.push_back (oldTerms->branchLogLike[change.oldNodeIndex (node)]);
+      ++branchesReused;
+    } else
+      terms->branchLogLike.push_back (branchLogLikelihood (model, history, node));
+
+  // substitution log-likelihood of each column, likewise
+  const AlignColIndex cols = history.gapped().empty() ? 0 : history.gapped().front().seq.size();
+  terms->colLogLike.resize (cols);
+  vguard<AlignColIndex> changedCols;
+  for (AlignColIndex col = 0; col < cols; ++col)
+    if (oldTerms && col < change.oldCol.size() && change.oldCol[col] >= 0) {
+      terms->colLogLike[col] = oldTerms->colLogLike[change.oldCol[col]];
+      ++colsReused;
+    } else
+      changedCols.push_back (col);
+  columnLogLikelihoods (model, history, changedCols, terms->colLogLike);
+  LogThisAt(9,"Column substitution log-likelihoods: (" << to_string_join(terms->colLogLike) << ")" << endl);
+
+  const LogProb lpTree = treePrior.treeLogLikelihood (history.tree());
+  const LogProb lpRoot = rootLogLikelihood (model, history);
+  LogProb lpGaps = 0, lpSub = 0;
+  for (auto lp : terms->branchLogLike)
+    lpGaps += lp;
+  for (auto lp : terms->colLogLike)
+    lpSub += lp;
+  const LogProb lp = lpTree + lpRoot + lpGaps + lpSub;
+  LogThisAt(6,"log(L" << suffix << ") = " << setw(10) << lpTree << " (tree) + " << setw(10) << lpRoot << " (root) + " << setw(10) << lpGaps << " (indels) + " << setw(10) << lpSub << " (substitutions) = " << lp << endl);
+  history.sharedTerms = terms;
+  nextAge();
+  return lp;
+}
+
+void TreeAlignFuncs::LogLikelihoodCache::nextAge() {
+  treeId.nextAge();
+  branchLogLike.nextAge();
+  colLogLike.nextAge();
+}
+
+string TreeAlignFuncs::LogLikelihoodCache::stats() const {
+  ostringstream out;
+  out << "Log-likelihood cache: "
+      << plural(branchLogLike.hits,"branch hit") << ", " << plural(branchLogLike.misses,"branch miss","branch misses") << ", "
+      << plural(colLogLike.hits,"column hit") << ", " << plural(colLogLike.misses,"column miss","column misses") << "; "
+      << plural(branchesReused,"branch","branches") << " & " << plural(colsReused,"column") << " unchanged by moves"
+      << endl;
+  return out.str();
+}
+
 LogProb TreeAlignFuncs::logBranchPathLikelihood (const ProbModel& probModel, const AlignPath& path, TreeNodeIndex parent, TreeNodeIndex child) {
   const AlignColIndex cols = alignPathColumns (path);
   ProbModel::State state = ProbModel::Start;
@@ -450,14 +840,36 @@ LogProb TreeAlignFuncs::logBranchPathLikelihood (const ProbModel& probModel, con
 }
 
 TreeAlignFuncs::PosWeightMatrix TreeAlignFuncs::preMultiply (const PosWeightMatrix& child, const vguard<LogProbModel::LogProbMatrix>& submat) {
+  // multiply in linear space, rescaling each position by its maximum; fall back to log-space if the rescaled sum is too small to trust
   PosWeightMatrix pwm (child.size(), vguard<vguard<LogProb> > (submat.size(), vguard<LogProb> (submat.front().size(), -numeric_limits<double>::infinity())));
+  vguard<vguard<vguard<double> > > linSub (submat.size());
+  for (int cpt = 0; cpt < (int) submat.size(); ++cpt) {
+    linSub[cpt].resize (submat[cpt].size());
+    for (AlphTok i = 0; i < submat[cpt].size(); ++i)
+      for (auto lp : submat[cpt][i])
+	linSub[cpt][i].push_back (exp (lp));
+  }
+  vguard<double> linChild;
   size_t n = 0;
   for (const auto& lpp : child) {
     auto& pre = pwm[n++];
-    for (int cpt = 0; cpt < (int) submat.size(); ++cpt)
-      for (AlphTok i = 0; i < pre[cpt].size(); ++i)
+    for (int cpt = 0; cpt < (int) submat.size(); ++cpt) {
+      const LogProb lpMax = *max_element (lpp[cpt].begin(), lpp[cpt].end());
+      linChild.resize (lpp[cpt].size());
+      for (AlphTok j = 0; j < lpp[cpt].size(); ++j)
+	linChild[j] = exp (lpp[cpt][j] - lpMax);
+      for (AlphTok i = 0; i < pre[cpt].size(); ++i) {
+	const vguard<double>& linRow = linSub[cpt][i];
+	double p = 0;
 	for (AlphTok j = 0; j < lpp[cpt].size(); ++j)
-	  log_accum_exp (pre[cpt][i], submat[cpt][i][j] + lpp[cpt][j]);
+	  p += linRow[j] * linChild[j];
+	if (p >= LOG_SUM_EXP_LINEAR_MIN)
+	  pre[cpt][i] = log(p) + lpMax;
+	else
+	  for (AlphTok j = 0; j < lpp[cpt].size(); ++j)
+	    log_accum_exp (pre[cpt][i], submat[cpt][i][j] + lpp[cpt][j]);
+      }
+    }
   }
   return pwm;
 }
@@ -488,22 +900,23 @@ Sampler::Move::Move (Type type, const History& history, LogProb oldLogLikelihood
     samplerName (samplerName)
 { }
 
-void Sampler::Move::initNewHistory (const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path) {
+void Sampler::Move::initNewHistory (const History::SharedTree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path) {
   const Alignment newAlign (ungapped, path);
-  initNewHistory (tree, newAlign.gapped());
+  newHistory = History (make_shared<const vguard<FastSeq> > (newAlign.gapped()), tree);
 }
 
-void Sampler::Move::initNewHistory (const Tree& tree, const vguard<FastSeq>& gapped) {
-  newHistory.tree = tree;
-  newHistory.gapped = gapped;
+void Sampler::Move::initNewHistory (const Tree& tree, const History::SharedAlignment& gapped) {
+  newHistory = History (gapped, make_shared<const Tree> (tree));
+  change.keepColumns (gapped->empty() ? 0 : gapped->front().seq.size());
 }
 
 void Sampler::Move::initRatio (const Sampler& sampler) {
-  newLogLikelihood = sampler.logLikelihood (newHistory, "_new");
+  change.markBranchColumns (oldHistory, newHistory);
+  newLogLikelihood = sampler.logLikelihood (newHistory, oldHistory, change, "_new");
 
   const LogProb logOddsRatio = newLogLikelihood - oldLogLikelihood;
   const LogProb logHastingsRatio = logReverseProposal - logForwardProposal + logJacobian;
-  logAcceptProb = logOddsRatio + logHastingsRatio;
+  logAcceptProb = sampler.heat * logOddsRatio + logHastingsRatio;
 
   LogThisAt(5,"log(L_new/L_old) = " << logOddsRatio << ", log(Q_rev/Q_fwd) = " << logHastingsRatio << ", log(P_accept) = " << logAcceptProb << endl);
 }
@@ -559,22 +972,23 @@ bool Sampler::Move::accept (random_engine& generator) const {
 Sampler::BranchAlignMove::BranchAlignMove (const History& history, LogProb oldLogLikelihood, const Sampler& sampler, random_engine& generator)
   : Move (BranchAlign, history, oldLogLikelihood, sampler.name)
 {
-  node = Sampler::randomChildNode (history.tree, generator);
-  parent = history.tree.parentNode (node);
+  node = Sampler::randomChildNode (history.tree(), generator);
+  parent = history.tree().parentNode (node);
 
-  LogThisAt(4,"Proposing branch realignment move between...\n   node #" << node << ": " << history.tree.seqName(node) << "\n parent #" << parent << ": " << history.tree.seqName(parent) << endl);
+  LogThisAt(4,"Proposing branch realignment move between...\n   node #" << node << ": " << history.tree().seqName(node) << "\n parent #" << parent << ": " << history.tree().seqName(parent) << endl);
 
-  const TreeBranchLength dist = history.tree.branchLength(parent,node);
+  const TreeBranchLength dist = history.tree().branchLength(parent,node);
   
-  const TreeNodeIndex parentClosestLeaf = history.tree.closestLeaf (parent, node);
-  const TreeNodeIndex nodeClosestLeaf = history.tree.closestLeaf (node, parent);
+  const TreeNodeIndex parentClosestLeaf = history.tree().closestLeaf (parent, node);
+  const TreeNodeIndex nodeClosestLeaf = history.tree().closestLeaf (node, parent);
 
-  const Alignment oldAlign (history.gapped);
-  const AlignPath oldBranchPath = Sampler::branchPath (oldAlign.path, history.tree, node);
-  const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree, parentClosestLeaf, nodeClosestLeaf, oldBranchPath, parent, node);
+  const Alignment oldAlign (history.gapped());
+  const AlignPath oldBranchPath = Sampler::branchPath (oldAlign.path, history.tree(), node);
+  const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree(), parentClosestLeaf, nodeClosestLeaf, oldBranchPath, parent, node);
 
-  const AlignPath pCladePath = Sampler::cladePath (oldAlign.path, history.tree, parent, node);
-  const AlignPath nCladePath = Sampler::cladePath (oldAlign.path, history.tree, node, parent);
+  vguard<AlignColIndex> pCladeCol, nCladeCol;
+  const AlignPath pCladePath = Sampler::cladePath (oldAlign.path, history.tree(), parent, node, pCladeCol);
+  const AlignPath nCladePath = Sampler::cladePath (oldAlign.path, history.tree(), node, parent, nCladeCol);
   
   const vguard<SeqIdx> parentEnvPos = sampler.guideSeqPos (oldAlign.path, parent, parentClosestLeaf);
   const vguard<SeqIdx> nodeEnvPos = sampler.guideSeqPos (oldAlign.path, node, nodeClosestLeaf);
@@ -583,7 +997,7 @@ Sampler::BranchAlignMove::BranchAlignMove (const History& history, LogProb oldLo
   exclude[node] = parent;
   exclude[parent] = node;
 
-  const auto pwms = sampler.getConditionalPWMs (history.tree, history.gapped, exclude, sampler.allExceptNodeAndAncestors(history.tree,parent), sampler.nodeAndAncestors(history.tree,parent));
+  const auto pwms = sampler.getConditionalPWMs (history.tree(), history.gapped(), exclude, sampler.allExceptNodeAndAncestors(history.tree(),parent), sampler.nodeAndAncestors(history.tree(),parent));
   const PosWeightMatrix& pSeq = pwms.at (parent);
   const PosWeightMatrix& nSeq = pwms.at (node);
 
@@ -594,7 +1008,7 @@ Sampler::BranchAlignMove::BranchAlignMove (const History& history, LogProb oldLo
   const LogProb logPostNewBranchPath = newBranchMatrix.logPostProb (newBranchPath);
 
   LogThisAt(6,"Previous (parent:node) alignment:" << endl << alignPathString(oldBranchPath));
-  const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree, parentClosestLeaf, nodeClosestLeaf, newBranchPath, parent, node);
+  const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree(), parentClosestLeaf, nodeClosestLeaf, newBranchPath, parent, node);
   const BranchMatrix* oldBranchMatrix =
     sampler.useFixedGuide
     ? &newBranchMatrix
@@ -610,44 +1024,48 @@ Sampler::BranchAlignMove::BranchAlignMove (const History& history, LogProb oldLo
   }
 
   const vguard<AlignPath> mergeComponents = { pCladePath, newBranchPath, nCladePath };
-  const AlignPath newPath = alignPathMerge (mergeComponents);
+  vguard<vguard<AlignColIndex> > mergedCol;
+  const AlignPath newPath = alignPathMerge (mergeComponents, mergedCol);
 
   logForwardProposal = logPostNewBranchPath;
   logReverseProposal = logPostOldBranchPath;
 
-  initNewHistory (oldHistory.tree, oldAlign.ungapped, newPath);
+  change.matchColumns (oldAlign, oldAlign.ungapped, newPath, { pCladeCol, nCladeCol }, { mergedCol[0], mergedCol[2] }, vguard<AlignRowIndex>());
+  initNewHistory (oldHistory.sharedTree, oldAlign.ungapped, newPath);
+  change.branches.insert (node);
   initRatio (sampler);
 }
 
 Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLikelihood, const Sampler& sampler, random_engine& generator)
   : Move (NodeAlign, history, oldLogLikelihood, sampler.name)
 {
-  node = Sampler::randomInternalNode (history.tree, generator);
+  node = Sampler::randomInternalNode (history.tree(), generator);
 
-  Assert (history.tree.nChildren(node) == 2, "Non-binary tree");
-  leftChild = history.tree.getChild (node, 0);
-  rightChild = history.tree.getChild (node, 1);
+  Assert (history.tree().nChildren(node) == 2, "Non-binary tree");
+  leftChild = history.tree().getChild (node, 0);
+  rightChild = history.tree().getChild (node, 1);
 
-  parent = history.tree.parentNode (node);
+  parent = history.tree().parentNode (node);
 
-  LogThisAt(4,"Proposing node realignment move between...\n        node #" << node << ": " << history.tree.seqName(node) << "\n  left-child #" << leftChild << ": " << history.tree.seqName(leftChild) << "\n right-child #" << rightChild << ": " << history.tree.seqName(rightChild) << (parent >= 0 ? (string("\n      parent #") + to_string(parent) + ": " + history.tree.seqName(parent)) : string()) << endl);
+  LogThisAt(4,"Proposing node realignment move between...\n        node #" << node << ": " << history.tree().seqName(node) << "\n  left-child #" << leftChild << ": " << history.tree().seqName(leftChild) << "\n right-child #" << rightChild << ": " << history.tree().seqName(rightChild) << (parent >= 0 ? (string("\n      parent #") + to_string(parent) + ": " + history.tree().seqName(parent)) : string()) << endl);
 
-  const TreeBranchLength lDist = history.tree.branchLength(node,leftChild);
-  const TreeBranchLength rDist = history.tree.branchLength(node,rightChild);
+  const TreeBranchLength lDist = history.tree().branchLength(node,leftChild);
+  const TreeBranchLength rDist = history.tree().branchLength(node,rightChild);
   
-  const TreeNodeIndex leftChildClosestLeaf = history.tree.closestLeaf (leftChild, node);
-  const TreeNodeIndex rightChildClosestLeaf = history.tree.closestLeaf (rightChild, node);
+  const TreeNodeIndex leftChildClosestLeaf = history.tree().closestLeaf (leftChild, node);
+  const TreeNodeIndex rightChildClosestLeaf = history.tree().closestLeaf (rightChild, node);
 
-  const Alignment oldAlign (history.gapped);
+  const Alignment oldAlign (history.gapped());
   const AlignPath oldSiblingPath = Sampler::triplePath (oldAlign.path, leftChild, rightChild, node);
 
-  const AlignPath lCladePath = Sampler::cladePath (oldAlign.path, history.tree, leftChild, node);
-  const AlignPath rCladePath = Sampler::cladePath (oldAlign.path, history.tree, rightChild, node);
+  vguard<AlignColIndex> lCladeCol, rCladeCol, pCladeCol;
+  const AlignPath lCladePath = Sampler::cladePath (oldAlign.path, history.tree(), leftChild, node, lCladeCol);
+  const AlignPath rCladePath = Sampler::cladePath (oldAlign.path, history.tree(), rightChild, node, rCladeCol);
 
   const vguard<SeqIdx> leftChildEnvPos = sampler.guideSeqPos (oldAlign.path, leftChild, leftChildClosestLeaf);
   const vguard<SeqIdx> rightChildEnvPos = sampler.guideSeqPos (oldAlign.path, rightChild, rightChildClosestLeaf);
 
-  const GuideAlignmentEnvelope newSiblingEnv = sampler.makeGuide (history.tree, leftChildClosestLeaf, rightChildClosestLeaf, oldSiblingPath, leftChild, rightChild);
+  const GuideAlignmentEnvelope newSiblingEnv = sampler.makeGuide (history.tree(), leftChildClosestLeaf, rightChildClosestLeaf, oldSiblingPath, leftChild, rightChild);
 
   map<TreeNodeIndex,TreeNodeIndex> exclude;
   exclude[leftChild] = node;
@@ -656,7 +1074,7 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
     exclude[node] = parent;
     exclude[parent] = node;
   }
-  const auto pwms = sampler.getConditionalPWMs (history.tree, history.gapped, exclude, sampler.allExceptNodeAndAncestors(history.tree,parent>=0?parent:node), parent >= 0 ? sampler.nodeAndAncestors(history.tree,parent) : set<TreeNodeIndex>());
+  const auto pwms = sampler.getConditionalPWMs (history.tree(), history.gapped(), exclude, sampler.allExceptNodeAndAncestors(history.tree(),parent>=0?parent:node), parent >= 0 ? sampler.nodeAndAncestors(history.tree(),parent) : set<TreeNodeIndex>());
   const PosWeightMatrix& lSeq = pwms.at (leftChild);
   const PosWeightMatrix& rSeq = pwms.at (rightChild);
 
@@ -666,7 +1084,7 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
   const LogProb logPostNewSiblingPath = newSibMatrix.logPostProb (newSiblingPath);
 
   LogThisAt(6,"Previous (node:left:right) alignment:" << endl << alignPathString(oldSiblingPath));
-  const GuideAlignmentEnvelope oldSiblingEnv = sampler.makeGuide (history.tree, leftChildClosestLeaf, rightChildClosestLeaf, newSiblingPath, leftChild, rightChild);
+  const GuideAlignmentEnvelope oldSiblingEnv = sampler.makeGuide (history.tree(), leftChildClosestLeaf, rightChildClosestLeaf, newSiblingPath, leftChild, rightChild);
   const SiblingMatrix* oldSibMatrix =
     sampler.useFixedGuide
     ? &newSibMatrix
@@ -677,7 +1095,8 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
   logReverseProposal = logPostOldSiblingPath;
 
   vguard<AlignPath> mergeComponents = { lCladePath, rCladePath, newSiblingPath };
-  AlignPath newPath = alignPathMerge (mergeComponents);
+  vguard<vguard<AlignColIndex> > mergedCol;
+  AlignPath newPath = alignPathMerge (mergeComponents, mergedCol);
 
   const PosWeightMatrix newNodeSeq = newSibMatrix.parentSeq (newSiblingPath);
   const PosWeightMatrix& oldNodeSeq = oldSibMatrix->parentSeq (oldSiblingPath);
@@ -693,18 +1112,18 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
 
   if (parent >= 0) {  // don't attempt to align to parent if node is root
     const PosWeightMatrix& pSeq = pwms.at (parent);
-    const TreeBranchLength pDist = history.tree.branchLength(parent,node);
+    const TreeBranchLength pDist = history.tree().branchLength(parent,node);
 
-    const TreeNodeIndex nodeClosestLeaf = history.tree.closestLeaf (node, parent);
-    const TreeNodeIndex parentClosestLeaf = history.tree.closestLeaf (parent, node);
+    const TreeNodeIndex nodeClosestLeaf = history.tree().closestLeaf (node, parent);
+    const TreeNodeIndex parentClosestLeaf = history.tree().closestLeaf (parent, node);
     const TreeNodeIndex nodeClosestChild = lDist < rDist ? leftChild : rightChild;
     
-    const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree, parentClosestLeaf, nodeClosestLeaf, oldAlign.path, parent, nodeClosestChild);
+    const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree(), parentClosestLeaf, nodeClosestLeaf, oldAlign.path, parent, nodeClosestChild);
     const AlignPath& nodeSubtreePath = newPath;
     const vguard<SeqIdx> newNodeEnvPos = sampler.guideSeqPos (nodeSubtreePath, node, nodeClosestChild, nodeClosestLeaf);
     const vguard<SeqIdx> oldNodeEnvPos = sampler.guideSeqPos (oldAlign.path, node, nodeClosestChild, nodeClosestLeaf);
 
-    const AlignPath pCladePath = Sampler::cladePath (oldAlign.path, history.tree, parent, node);
+    const AlignPath pCladePath = Sampler::cladePath (oldAlign.path, history.tree(), parent, node, pCladeCol);
     const vguard<SeqIdx> parentEnvPos = sampler.guideSeqPos (oldAlign.path, parent, parentClosestLeaf);
 
     const BranchMatrix newBranchMatrix (sampler.model, pSeq, newNodeSeq, pDist, newBranchEnv, parentEnvPos, newNodeEnvPos, parent, node);
@@ -715,11 +1134,11 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
 
     mergeComponents.push_back (pCladePath);
     mergeComponents.push_back (newBranchPath);
-    newPath = alignPathMerge (mergeComponents);
+    newPath = alignPathMerge (mergeComponents, mergedCol);
 
-    const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree, parentClosestLeaf, nodeClosestLeaf, newPath, parent, nodeClosestChild);
+    const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree(), parentClosestLeaf, nodeClosestLeaf, newPath, parent, nodeClosestChild);
     const BranchMatrix oldBranchMatrix (sampler.model, pSeq, oldNodeSeq, pDist, oldBranchEnv, parentEnvPos, oldNodeEnvPos, parent, node);
-    const AlignPath oldBranchPath = Sampler::branchPath (oldAlign.path, history.tree, node);
+    const AlignPath oldBranchPath = Sampler::branchPath (oldAlign.path, history.tree(), node);
     LogThisAt(6,"Previous (parent:node) alignment:" << endl << alignPathString(oldBranchPath));
     const LogProb logPostOldBranchPath = oldBranchMatrix.logPostProb (oldBranchPath);
 
@@ -739,18 +1158,28 @@ Sampler::NodeAlignMove::NodeAlignMove (const History& history, LogProb oldLogLik
     return;
   }
   
-  initNewHistory (oldHistory.tree, newUngapped, newPath);
+  vguard<vguard<AlignColIndex> > oldCladeCol = { lCladeCol, rCladeCol }, newCladeCol = { mergedCol[0], mergedCol[1] };
+  if (parent >= 0) {
+    oldCladeCol.push_back (pCladeCol);
+    newCladeCol.push_back (mergedCol[3]);
+  }
+  change.matchColumns (oldAlign, newUngapped, newPath, oldCladeCol, newCladeCol, vguard<AlignRowIndex> (1, node));
+  initNewHistory (oldHistory.sharedTree, newUngapped, newPath);
+  change.branches.insert (leftChild);
+  change.branches.insert (rightChild);
+  if (parent >= 0)
+    change.branches.insert (node);
   initRatio (sampler);
 }
 
 Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogProb oldLogLikelihood, const Sampler& sampler, random_engine& generator)
   : Move (PruneAndRegraft, history, oldLogLikelihood, sampler.name)
 {
-  const vguard<TreeBranchLength>& distanceFromRoot = history.tree.distanceFromRoot();
+  const vguard<TreeBranchLength>& distanceFromRoot = history.tree().distanceFromRoot();
 
-  node = Sampler::randomGrandchildNode (history.tree, generator);
+  node = Sampler::randomGrandchildNode (history.tree(), generator);
 
-  const vector<TreeNodeIndex> contemps = contemporaneousNodes (history.tree, distanceFromRoot, node);
+  const vector<TreeNodeIndex> contemps = contemporaneousNodes (history.tree(), distanceFromRoot, node);
   if (contemps.empty()) {
     nullify("nowhere to regraft");
     return;
@@ -759,21 +1188,21 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
   const size_t contempIndex = random_index (contempWeights, generator);
   const TreeNodeIndex newSibling = contemps[contempIndex];
 
-  parent = history.tree.parentNode (node);
+  parent = history.tree().parentNode (node);
   Assert (parent >= 0, "Parent node not found");
 
-  oldGrandparent = history.tree.parentNode (parent);
+  oldGrandparent = history.tree().parentNode (parent);
   Assert (oldGrandparent >= 0, "Grandparent node not found");
 
-  newGrandparent = history.tree.parentNode (newSibling);
+  newGrandparent = history.tree().parentNode (newSibling);
   Assert (newGrandparent >= 0, "Grandparent node not found");
 
-  oldSibling = history.tree.getSibling (node);
+  oldSibling = history.tree().getSibling (node);
   
-  LogThisAt(4,"Proposing prune-and-regraft move at...\n            node #" << node << ": " << history.tree.seqName(node) << "\n          parent #" << parent << ": " << history.tree.seqName(parent) << "\n     old sibling #" << oldSibling << ": " << history.tree.seqName(oldSibling) << "\n old grandparent #" << oldGrandparent << ": " << history.tree.seqName(oldGrandparent) << "\n     new sibling #" << newSibling << ": " << history.tree.seqName(newSibling) << "\n new grandparent #" << newGrandparent << ": " << history.tree.seqName(newGrandparent) << endl);
+  LogThisAt(4,"Proposing prune-and-regraft move at...\n            node #" << node << ": " << history.tree().seqName(node) << "\n          parent #" << parent << ": " << history.tree().seqName(parent) << "\n     old sibling #" << oldSibling << ": " << history.tree().seqName(oldSibling) << "\n old grandparent #" << oldGrandparent << ": " << history.tree().seqName(oldGrandparent) << "\n     new sibling #" << newSibling << ": " << history.tree().seqName(newSibling) << "\n new grandparent #" << newGrandparent << ": " << history.tree().seqName(newGrandparent) << endl);
 
-  const Tree& oldTree = history.tree;
-  const Alignment oldAlign (history.gapped);
+  const Tree& oldTree = history.tree();
+  const Alignment oldAlign (history.gapped());
   
   const TreeBranchLength oldGranParentDist = oldTree.branchLength(oldGrandparent,parent);
   const TreeBranchLength parentNodeDist = oldTree.branchLength(parent,node);
@@ -782,7 +1211,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
   const TreeBranchLength parentNewSibDist = distanceFromRoot[newSibling] - distanceFromRoot[parent];
   const TreeBranchLength newGranParentDist = distanceFromRoot[parent] - distanceFromRoot[newGrandparent];
 
-  Tree newTree = history.tree;
+  Tree newTree = history.tree();
   newTree.setParent (oldSibling, oldGrandparent, oldGranParentDist + parentOldSibDist);
   newTree.setParent (newSibling, parent, parentNewSibDist);
   newTree.setParent (parent, newGrandparent, newGranParentDist);
@@ -802,7 +1231,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
   // optimize special case that (oldSibling,parent,oldGrandparent,newGrandparent,newSibling) form a sub-alignment with no gaps
   const vguard<TreeNodeIndex> subpathNodes = { oldSibling, parent, oldGrandparent, newGrandparent, newSibling };
   if (Sampler::subpathUngapped (oldAlign.path, subpathNodes)) {
-    initNewHistory (newTree, history.gapped);
+    initNewHistory (newTree, history.sharedGapped);
 
     logForwardProposal = logFwdSibSelect;
     logReverseProposal = logRevSibSelect;
@@ -811,10 +1240,11 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
     
   } else {
     // general case: we need to realign
-    const AlignPath oldSibCladePath = Sampler::cladePath (oldAlign.path, oldTree, oldSibling, parent);
-    const AlignPath nodeCladePath = Sampler::cladePath (oldAlign.path, oldTree, node, parent);
-    const AlignPath newSibCladePath = Sampler::cladePath (oldAlign.path, oldTree, newSibling, newGrandparent);
-    const AlignPath oldGranCladePath = Sampler::cladePath (oldAlign.path, oldTree, oldGrandparent, parent, newSibling);
+    vguard<AlignColIndex> oldSibCladeCol, nodeCladeCol, newSibCladeCol, oldGranCladeCol;
+    const AlignPath oldSibCladePath = Sampler::cladePath (oldAlign.path, oldTree, oldSibling, parent, oldSibCladeCol);
+    const AlignPath nodeCladePath = Sampler::cladePath (oldAlign.path, oldTree, node, parent, nodeCladeCol);
+    const AlignPath newSibCladePath = Sampler::cladePath (oldAlign.path, oldTree, newSibling, newGrandparent, newSibCladeCol);
+    const AlignPath oldGranCladePath = Sampler::cladePath (oldAlign.path, oldTree, oldGrandparent, parent, oldGranCladeCol, newSibling);
 
     const AlignPath oldSiblingPath = Sampler::triplePath (oldAlign.path, node, oldSibling, parent);
     const AlignPath oldBranchPath = Sampler::branchPath (oldAlign.path, oldTree, parent);
@@ -838,7 +1268,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
     const vguard<SeqIdx> newSibEnvPos = sampler.guideSeqPos (oldAlign.path, newSibling, newSibClosestLeaf);
     const vguard<SeqIdx> newGranEnvPos = sampler.guideSeqPos (oldAlign.path, newGrandparent, newGranClosestLeaf);
 
-    const GuideAlignmentEnvelope newSibEnv = sampler.makeGuide (history.tree, nodeClosestLeaf, newSibClosestLeaf, oldAlign.path, node, newSibling);
+    const GuideAlignmentEnvelope newSibEnv = sampler.makeGuide (history.tree(), nodeClosestLeaf, newSibClosestLeaf, oldAlign.path, node, newSibling);
 
     map<TreeNodeIndex,TreeNodeIndex> exclude;
     exclude[node] = -1;
@@ -849,7 +1279,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
 
     Tree detachedTree = oldTree;
     detachedTree.detach (node);
-    const auto pwms = sampler.getConditionalPWMs (detachedTree, history.gapped, exclude, sampler.allNodes(history.tree), sampler.nodesAndAncestors(history.tree,oldGrandparent,newGrandparent));
+    const auto pwms = sampler.getConditionalPWMs (detachedTree, history.gapped(), exclude, sampler.allNodes(history.tree()), sampler.nodesAndAncestors(history.tree(),oldGrandparent,newGrandparent));
 
     const PosWeightMatrix& nodeSeq = pwms.at (node);
     const PosWeightMatrix& oldSibSeq = pwms.at (oldSibling);
@@ -867,7 +1297,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
     vguard<AlignPath> mergeComponents = { nodeCladePath, newSibCladePath, newSiblingPath };
     const AlignPath newParentSubtreePath = alignPathMerge (mergeComponents);
 
-    const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree, newGranClosestLeaf, newParentClosestLeaf, oldAlign.path, newGrandparent, newParentClosestChild);
+    const GuideAlignmentEnvelope newBranchEnv = sampler.makeGuide (history.tree(), newGranClosestLeaf, newParentClosestLeaf, oldAlign.path, newGrandparent, newParentClosestChild);
 
     const vguard<SeqIdx> newParentEnvPos = sampler.guideSeqPos (newParentSubtreePath, parent, newParentClosestChild, newParentClosestLeaf);
     const vguard<SeqIdx> oldParentEnvPos = sampler.guideSeqPos (oldAlign.path, parent, oldParentClosestChild, oldParentClosestLeaf);
@@ -885,13 +1315,14 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
     mergeComponents.push_back (oldGranSibPath);
     mergeComponents.push_back (oldGranCladePath);
     mergeComponents.push_back (newBranchPath);
-    const AlignPath newPath = alignPathMerge (mergeComponents);
+    vguard<vguard<AlignColIndex> > mergedCol;
+    const AlignPath newPath = alignPathMerge (mergeComponents, mergedCol);
 
-    const GuideAlignmentEnvelope oldSibEnv = sampler.makeGuide (history.tree, nodeClosestLeaf, oldSibClosestLeaf, newPath, node, oldSibling);
+    const GuideAlignmentEnvelope oldSibEnv = sampler.makeGuide (history.tree(), nodeClosestLeaf, oldSibClosestLeaf, newPath, node, oldSibling);
     const SiblingMatrix oldSibMatrix (sampler.model, nodeSeq, oldSibSeq, parentNodeDist, parentOldSibDist, oldSibEnv, nodeEnvPos, oldSibEnvPos, node, oldSibling, parent);
     const LogProb logPostOldSiblingPath = oldSibMatrix.logPostProb (oldSiblingPath);
 
-    const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree, oldGranClosestLeaf, oldParentClosestLeaf, newPath, oldGrandparent, oldParentClosestChild);
+    const GuideAlignmentEnvelope oldBranchEnv = sampler.makeGuide (history.tree(), oldGranClosestLeaf, oldParentClosestLeaf, newPath, oldGrandparent, oldParentClosestChild);
     const PosWeightMatrix oldParentSeq = oldSibMatrix.parentSeq (oldSiblingPath);
     const BranchMatrix oldBranchMatrix (sampler.model, oldGranSeq, oldParentSeq, oldGranParentDist, oldBranchEnv, oldGranEnvPos, oldParentEnvPos, oldGrandparent, parent);
     const LogProb logPostOldBranchPath = oldBranchMatrix.logPostProb (oldBranchPath);
@@ -911,15 +1342,27 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
     } else
       newUngapped[parent].seq = string (alignPathResiduesInRow (newSiblingPath.at (parent)), Alignment::wildcardChar);
   
-    initNewHistory (newTree, newUngapped, newPath);
+    change.matchColumns (oldAlign, newUngapped, newPath, { nodeCladeCol, newSibCladeCol, oldSibCladeCol, oldGranCladeCol }, { mergedCol[0], mergedCol[1], mergedCol[3], mergedCol[5] }, vguard<AlignRowIndex> (1, parent));
+    initNewHistory (make_shared<const Tree> (newTree), newUngapped, newPath);
   }
 
   // we need...
   //  newGrandparent > parent
   //  parent > newSibling
   //  parent > node
-  if (parent < newSibling || parent > newGrandparent)
-    newHistory = newHistory.reorder (newHistory.tree.postorderSort());
+  change.branches.insert (node);
+  change.branches.insert (parent);
+  change.branches.insert (oldSibling);
+  change.branches.insert (newSibling);
+  if (parent < newSibling || parent > newGrandparent) {
+    change.oldNode = newHistory.tree().postorderSort();
+    newHistory = newHistory.reorder (change.oldNode);
+    set<TreeNodeIndex> oldBranches;
+    oldBranches.swap (change.branches);
+    for (TreeNodeIndex n = 0; n < (TreeNodeIndex) change.oldNode.size(); ++n)
+      if (oldBranches.count (change.oldNode[n]))
+	change.branches.insert (n);
+  }
 
   initRatio (sampler);
 }
@@ -927,7 +1370,7 @@ Sampler::PruneAndRegraftMove::PruneAndRegraftMove (const History& history, LogPr
 Sampler::NodeHeightMove::NodeHeightMove (const History& history, LogProb oldLogLikelihood, const Sampler& sampler, random_engine& generator)
   : Move (NodeHeight, history, oldLogLikelihood, sampler.name)
 {
-  Tree newTree = history.tree;
+  Tree newTree = history.tree();
   logForwardProposal = logReverseProposal = logJacobian = 0;
 
   node = Sampler::randomInternalNode (newTree, generator);
@@ -969,9 +1412,12 @@ Sampler::NodeHeightMove::NodeHeightMove (const History& history, LogProb oldLogL
     newTree.node[rightChild].d = (rChildDist - minChildDist) + cDistNew;
 
     LogThisAt(6,"Sampled coalescence time of #" << leftChild << " and #" << rightChild << ": " << cDistNew << " (previously " << minChildDist << ", maximum " << pDist << ")" << endl);
+    change.branches.insert (node);
   }
+  change.branches.insert (leftChild);
+  change.branches.insert (rightChild);
 
-  initNewHistory (newTree, oldHistory.gapped);
+  initNewHistory (newTree, oldHistory.sharedGapped);
   initRatio (sampler);
 }
 
@@ -980,7 +1426,7 @@ Sampler::RescaleMove::RescaleMove (const History& history, LogProb oldLogLikelih
 {
   LogThisAt(4,"Proposing rescale move" << endl);
 
-  const auto dist = history.tree.distanceFromRoot();
+  const auto dist = history.tree().distanceFromRoot();
   const TreeBranchLength oldTreeHeight = *max_element (dist.begin(), dist.end());
 
   const double maxLogMultiplier = log(2);
@@ -991,14 +1437,16 @@ Sampler::RescaleMove::RescaleMove (const History& history, LogProb oldLogLikelih
 
   LogThisAt(6,"Sampled tree height: " << newTreeHeight << " (previously " << oldTreeHeight << ", multiplier " << multiplier << ")" << endl);
 
-  Tree newTree = history.tree;
+  Tree newTree = history.tree();
   for (auto& node : newTree.node)
     node.d *= multiplier;
 
   logForwardProposal = logReverseProposal = 0;
   logJacobian = logMultiplier;
 
-  initNewHistory (newTree, oldHistory.gapped);
+  for (TreeNodeIndex n = 0; n < newTree.root(); ++n)
+    change.branches.insert (n);
+  initNewHistory (newTree, oldHistory.sharedGapped);
   initRatio (sampler);
 }
 
@@ -1612,6 +2060,14 @@ Sampler::Sampler (const RateModel& model, const SimpleTreePrior& treePrior, cons
     movesProposed (Move::TotalMoveTypes, 0),
     movesAccepted (Move::TotalMoveTypes, 0),
     moveNanosecs (Move::TotalMoveTypes, 0.),
+    moveLogLikeChange (Move::TotalMoveTypes, 0.),
+    samplesTaken (0),
+    adaptiveSamples (0),
+    adaptInterval (DefaultMCMCAdaptInterval),
+    heat (1.),
+    tries (1),
+    swapsProposed (0),
+    swapsAccepted (0),
     useFixedGuide (false),
     sampleAncestralSeqs (false),
     guide (gappedGuide),
@@ -1626,6 +2082,12 @@ Sampler::Sampler (const RateModel& model, const SimpleTreePrior& treePrior, cons
 
 Sampler::Move Sampler::proposeMove (const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const {
   const Move::Type type = (Move::Type) random_index (moveRate, generator);
+  if (tries > 1 && allowsMultipleTries (type))
+    return proposeMultipleTryMove (type, oldHistory, oldLogLikelihood, generator);
+  return proposeMove (type, oldHistory, oldLogLikelihood, generator);
+}
+
+Sampler::Move Sampler::proposeMove (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const {
   switch (type) {
   case Move::BranchAlign: return BranchAlignMove (oldHistory, oldLogLikelihood, *this, generator);
   case Move::NodeAlign: return NodeAlignMove (oldHistory, oldLogLikelihood, *this, generator);
@@ -1638,6 +2100,74 @@ Sampler::Move Sampler::proposeMove (const History& oldHistory, LogProb oldLogLik
   return Move();
 }
 
+bool Sampler::allowsMultipleTries (Move::Type type) {
+  return type == Move::BranchAlign || type == Move::NodeAlign || type == Move::PruneAndRegraft;
+}
+
+LogProb Sampler::multipleTryLogWeight (const Move& move) const {
+  if (move.nullified || move.newHistory.sameAs (move.oldHistory))
+    return -numeric_limits<double>::infinity();
+  return heat * move.newLogLikelihood - move.logForwardProposal;
+}
+
+vguard<Sampler::Move> Sampler::proposeMoves (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, size_t nMoves, random_engine& generator) const {
+  // the caches are not thread-safe, so each extra thread proposes using its own copy of this sampler
+  if (tryWorkers.size() + 1 < nMoves) {
+    Sampler worker (*this);
+    worker.tryWorkers.clear();
+    worker.loggers.clear();
+    worker.logLikelihoodTrace.clear();
+    while (tryWorkers.size() + 1 < nMoves)
+      tryWorkers.push_back (worker);
+  }
+  vguard<random_engine> tryGenerator;
+  for (size_t n = 0; n < nMoves; ++n)
+    tryGenerator.push_back (random_engine (generator()));
+  vguard<Move> moves (nMoves);
+  auto propose = [&] (const Sampler* sampler, size_t n) {
+    moves[n] = sampler->proposeMove (type, oldHistory, oldLogLikelihood, tryGenerator[n]);
+  };
+  vguard<thread> threads;
+  auto worker = tryWorkers.begin();
+  for (size_t n = 1; n < nMoves; ++n)
+    threads.push_back (thread (propose, &*worker++, n));
+  if (nMoves)
+    propose (this, 0);
+  for (auto& th : threads)
+    th.join();
+  return moves;
+}
+
+Sampler::Move Sampler::proposeMultipleTryMove (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const {
+  // draw the candidates y_1..y_k from x, and select y_j with probability proportional to w(y_j|x)
+  vguard<Move> moves = proposeMoves (type, oldHistory, oldLogLikelihood, tries, generator);
+  vguard<LogProb> logWeight;
+  for (const auto& move: moves)
+    logWeight.push_back (multipleTryLogWeight (move));
+  const LogProb logWeightSum = log_sum_exp (logWeight);
+  if (logWeightSum == -numeric_limits<double>::infinity()) {
+    Move move = moves.front();
+    move.nullify ("no candidate changed the history");
+    return move;
+  }
+  vguard<double> weight;
+  for (auto lw: logWeight)
+    weight.push_back (exp (lw - logWeightSum));
+  Move move = moves[random_index (weight, generator)];
+
+  // draw the reference points x_1..x_{k-1} from y_j, setting x_k = x
+  const vguard<Move> refMoves = proposeMoves (type, move.newHistory, move.newLogLikelihood, tries - 1, generator);
+  vguard<LogProb> refLogWeight;
+  for (const auto& refMove: refMoves)
+    refLogWeight.push_back (multipleTryLogWeight (refMove));
+  refLogWeight.push_back (heat * oldLogLikelihood - move.logReverseProposal);
+
+  move.logAcceptProb = logWeightSum - log_sum_exp (refLogWeight);
+  move.comment += (move.comment.empty() ? "" : " ") + string("(best of ") + to_string(tries) + " tries)";
+  LogThisAt(5,"Multiple-try log(P_accept) = log(" << to_string_join(logWeight) << ") - log(" << to_string_join(refLogWeight) << ")" << endl);
+  return move;
+}
+
 void Sampler::addLogger (Logger& logger) {
   loggers.push_back (&logger);
 }
@@ -1647,7 +2177,7 @@ void Sampler::initialize (const History& initialHistory, const string& samplerNa
   currentHistory = initialHistory;
   currentHistory.assertNamesMatch();
 
-  isUltrametric = currentHistory.tree.isUltrametric();
+  isUltrametric = currentHistory.tree().isUltrametric();
   if (isUltrametric)
     LogThisAt(3,"Initial tree is ultrametric" << endl);
   else
@@ -1655,11 +2185,13 @@ void Sampler::initialize (const History& initialHistory, const string& samplerNa
   
   bestHistory = currentHistory;
   currentLogLikelihood = bestLogLikelihood = logLikelihood (currentHistory, "initial");
+  logLikelihoodTrace.clear();
+  samplesSinceBest = 0;
 
   // set move rates more-or-less arbitrarily
-  moveRate[Move::BranchAlign] = initialHistory.tree.hasChildren() ? 1 : 0;
+  moveRate[Move::BranchAlign] = initialHistory.tree().hasChildren() ? 1 : 0;
   moveRate[Move::NodeAlign] = 1;
-  moveRate[Move::PruneAndRegraft] = initialHistory.tree.hasGrandchildren() ? 1 : 0;
+  moveRate[Move::PruneAndRegraft] = initialHistory.tree().hasGrandchildren() ? 1 : 0;
   moveRate[Move::NodeHeight] = 2;
   moveRate[Move::Rescale] = 2;
 }
@@ -1685,8 +2217,8 @@ void Sampler::sample (random_engine& generator) {
 
     // do some consistency checks
     move.newHistory.assertNamesMatch();
-    move.newHistory.tree.assertPostorderSorted();
-    if (isUltrametric && !move.newHistory.tree.isUltrametric())
+    move.newHistory.tree().assertPostorderSorted();
+    if (isUltrametric && !move.newHistory.tree().isUltrametric())
       Warn ("Move generated a non-ultrametric tree");
     
     // accept/reject
@@ -1694,6 +2226,7 @@ void Sampler::sample (random_engine& generator) {
       currentHistory = move.newHistory;
       currentLogLikelihood = move.newLogLikelihood;
       ++movesAccepted[move.type];
+      moveLogLikeChange[move.type] += abs (move.newLogLikelihood - move.oldLogLikelihood);
     }
 
     // log
@@ -1704,17 +2237,56 @@ void Sampler::sample (random_engine& generator) {
     if (move.newLogLikelihood > bestLogLikelihood) {
       bestHistory = move.newHistory;
       bestLogLikelihood = move.newLogLikelihood;
+      samplesSinceBest = 0;
       LogThisAt(2,"New best log-likelihood: " << bestLogLikelihood << " (" << name << ")" << endl);
+    } else
+      ++samplesSinceBest;
+    logLikelihoodTrace.push_back (currentLogLikelihood);
+
+    // tune move rates during burn-in
+    if (++samplesTaken <= adaptiveSamples && (samplesTaken % adaptInterval == 0 || samplesTaken == adaptiveSamples)) {
+      adaptMoveRates();
+      if (samplesTaken == adaptiveSamples)
+	LogThisAt(2,"Freezing move rates for " << name << " after " << plural(samplesTaken,"sample") << endl);
+    }
+}
+
+void Sampler::adaptMoveRates() {
+  // efficiency of each enabled move type is its accepted log-likelihood change per CPU-second,
+  // with one unit of change added so that types never yet accepted are not starved;
+  // types not yet proposed keep the mean rate
+  vguard<double> efficiency (Move::TotalMoveTypes, 0.);
+  double totalEfficiency = 0, totalRate = 0;
+  int enabled = 0, measured = 0;
+  for (int t = 0; t < (int) Move::TotalMoveTypes; ++t)
+    if (moveRate[t] > 0) {
+      ++enabled;
+      totalRate += moveRate[t];
+      if (movesProposed[t] > 0 && moveNanosecs[t] > 0) {
+	efficiency[t] = (moveLogLikeChange[t] + 1) / (moveNanosecs[t] / 1e9);
+	totalEfficiency += efficiency[t];
+	++measured;
+      }
     }
+  if (measured == 0)
+    return;
+  ostringstream out;
+  for (int t = 0; t < (int) Move::TotalMoveTypes; ++t)
+    if (moveRate[t] > 0) {
+      const double fraction = movesProposed[t] > 0 && moveNanosecs[t] > 0 ? efficiency[t] / totalEfficiency * measured / enabled : 1. / enabled;
+      moveRate[t] = totalRate * max (fraction, (double) MCMCMinMoveRateFraction);
+      out << ' ' << Move::typeName ((Move::Type) t) << '=' << setprecision(3) << moveRate[t];
+    }
+  LogThisAt(3,"Move rates for " << name << " after " << plural(samplesTaken,"sample") << ":" << out.str() << endl);
 }
 
-void Sampler::run (vguard<Sampler>& samplers, random_engine& generator, unsigned int nSamples) {
+void Sampler::run (vguard<Sampler>& samplers, random_engine& generator, unsigned int nSamples, const StoppingRule& stoppingRule) {
   ProgressLog (plog, 2);
   plog.initProgress ("MCMC sampling run");
 
   vguard<double> nodes;
   for (const auto& sampler: samplers)
-    nodes.push_back (sampler.currentHistory.tree.nodes());
+    nodes.push_back (sampler.currentHistory.tree().nodes());
   
   for (unsigned int n = 0; n < nSamples; ++n) {
     // print progress
@@ -1726,11 +2298,222 @@ void Sampler::run (vguard<Sampler>& samplers, random_engine& generator, unsigned
     
     // sample
     samplers[nSampler].sample (generator);
+
+    // check for convergence
+    if (stoppingRule.active() && (n + 1) % stoppingRule.checkInterval == 0 && converged ({&samplers}, stoppingRule, n + 1))
+      break;
   }
 
   // log stats
-  for (size_t nSampler = 0; nSampler < samplers.size(); ++nSampler)
+  for (size_t nSampler = 0; nSampler < samplers.size(); ++nSampler) {
     LogThisAt(1,"Dataset #" << nSampler+1 << " (" << samplers[nSampler].name << "):\n" << samplers[nSampler].moveStats());
+    LogThisAt(2,samplers[nSampler].logLikelihoodCache.stats() << samplers[nSampler].conditionalPWMCache.stats());
+  }
+}
+
+void Sampler::runChains (vguard<vguard<Sampler> >& chains, random_engine& generator, unsigned int nSamples, unsigned int swapInterval, const StoppingRule& stoppingRule) {
+  Assert (chains.size() > 0, "No chains");
+  const size_t nChains = chains.size(), nDatasets = chains[0].size();
+  for (const auto& chain: chains)
+    Assert (chain.size() == nDatasets, "All chains must sample the same datasets");
+
+  ProgressLog (plog, 2);
+  plog.initProgress ("MCMC sampling run (%u chains)", (unsigned int) nChains);
+
+  vguard<double> nodes;
+  for (const auto& sampler: chains[0])
+    nodes.push_back (sampler.currentHistory.tree().nodes());
+
+  // each chain gets its own random number stream, seeded from the main generator
+  vguard<random_engine> chainGenerator;
+  for (size_t c = 0; c < nChains; ++c)
+    chainGenerator.push_back (random_engine (generator()));
+
+  auto runChain = [&] (size_t c, unsigned int steps) {
+    for (unsigned int n = 0; n < steps; ++n)
+      chains[c][random_index (nodes, chainGenerator[c])].sample (chainGenerator[c]);
+  };
+
+  for (unsigned int n = 0; n < nSamples; n += swapInterval) {
+    plog.logProgress (n / (double) nSamples, "step %u/%u", n + 1, nSamples);
+
+    const unsigned int steps = min (swapInterval, nSamples - n);
+    vguard<thread> threads;
+    for (size_t c = 0; c < nChains; ++c)
+      threads.push_back (thread (runChain, c, steps));
+    for (auto& th : threads)
+      th.join();
+
+    // propose swapping the states of a random pair of adjacent chains, separately for each dataset
+    if (nChains > 1)
+      for (size_t d = 0; d < nDatasets; ++d) {
+	uniform_int_distribution<size_t> distribution (0, nChains - 2);
+	const size_t c = distribution (generator);
+	Sampler& cold = chains[c][d];
+	Sampler& hot = chains[c+1][d];
+	if (cold.heat == hot.heat)
+	  continue;  // independent replicas; nothing to gain by swapping
+	const LogProb logAcceptProb = (cold.heat - hot.heat) * (hot.currentLogLikelihood - cold.currentLogLikelihood);
+	const bool accept = logAcceptProb >= 0 || bernoulli_distribution (exp (logAcceptProb)) (generator);
+	++cold.swapsProposed;
+	if (accept) {
+	  ++cold.swapsAccepted;
+	  swap (cold.currentHistory, hot.currentHistory);
+	  swap (cold.currentLogLikelihood, hot.currentLogLikelihood);
+	}
+	LogThisAt(3,"Swap between chains #" << c+1 << " and #" << c+2 << " for " << cold.name << (accept ? " ACCEPTED" : " rejected") << " with log(P_accept) = " << logAcceptProb << endl);
+      }
+
+    // check for convergence, at most once per checkInterval samples
+    if (stoppingRule.active() && (n + steps) / stoppingRule.checkInterval > n / stoppingRule.checkInterval) {
+      vguard<const vguard<Sampler>*> chainPtrs;
+      for (const auto& chain: chains)
+	chainPtrs.push_back (&chain);
+      if (converged (chainPtrs, stoppingRule, n + steps))
+	break;
+    }
+  }
+
+  // log stats, and gather the best history from all chains into the cold chain
+  for (size_t d = 0; d < nDatasets; ++d) {
+    Sampler& best = chains[0][d];
+    for (size_t c = 0; c < nChains; ++c) {
+      const Sampler& sampler = chains[c][d];
+      LogThisAt(1,"Dataset #" << d+1 << " (" << sampler.name << "), chain #" << c+1 << " (heat " << sampler.heat << "):\n" << sampler.moveStats() << (c + 1 < nChains ? sampler.swapStats() : string()));
+      LogThisAt(2,sampler.logLikelihoodCache.stats() << sampler.conditionalPWMCache.stats());
+      if (sampler.bestLogLikelihood > best.bestLogLikelihood) {
+	best.bestHistory = sampler.bestHistory;
+	best.bestLogLikelihood = sampler.bestLogLikelihood;
+      }
+    }
+    LogThisAt(2,"Best log-likelihood for dataset #" << d+1 << " over all chains: " << best.bestLogLikelihood << endl);
+  }
+}
+
+bool Sampler::Diagnostics::converged (const StoppingRule& rule) const {
+  return samples >= MCMCMinConvergenceSamples
+    && (rule.minESS <= 0 || ess >= rule.minESS)
+    && (rule.maxRHat <= 0 || rHat <= rule.maxRHat)
+    && (rule.plateauSamplesPerNode <= 0 || plateauSamplesPerNode >= rule.plateauSamplesPerNode);
+}
+
+string Sampler::Diagnostics::toString() const {
+  ostringstream out;
+  out << "ESS " << ess << ", split-R-hat " << rHat << ", " << plateauSamplesPerNode << " samples per node since best (over last " << plural(samples,"sample") << " per chain)";
+  return out.str();
+}
+
+double Sampler::effectiveSampleSize (const vguard<double>& x) {
+  // Geyer's initial positive sequence estimator
+  const size_t n = x.size();
+  if (n < 2)
+    return n;
+  double mean = 0;
+  for (auto xi : x)
+    mean += xi;
+  mean /= n;
+  // all autocovariances at once, as the inverse FFT of the power spectrum, zero-padded to avoid wraparound
+  size_t fftSize = 1;
+  while (fftSize < 2*n)
+    fftSize *= 2;
+  vguard<double> packed (2*fftSize, 0.);  // (real,imag) pairs
+  for (size_t i = 0; i < n; ++i)
+    packed[2*i] = x[i] - mean;
+  CheckGsl (gsl_fft_complex_radix2_forward (packed.data(), 1, fftSize));
+  for (size_t k = 0; k < fftSize; ++k) {
+    packed[2*k] = packed[2*k] * packed[2*k] + packed[2*k+1] * packed[2*k+1];
+    packed[2*k+1] = 0;
+  }
+  CheckGsl (gsl_fft_complex_radix2_inverse (packed.data(), 1, fftSize));
+  auto autocov = [&] (size_t lag) {
+    return packed[2*lag] / n;
+  };
+  const double var = autocov (0);
+  if (var <= 0)
+    return 0;  // a chain that never moved has told us nothing
+  double tau = -1;
+  for (size_t lag = 0; lag + 1 < n; lag += 2) {
+    const double pairSum = (autocov (lag) + autocov (lag + 1)) / var;
+    if (pairSum <= 0)
+      break;
+    tau += 2 * pairSum;
+  }
+  return n / max (tau, 1. / n);
+}
+
+double Sampler::splitRHat (const vguard<vguard<double> >& x) {
+  // split each chain in two, then compare between- & within-half variances
+  size_t n = numeric_limits<size_t>::max();
+  for (const auto& chain: x)
+    n = min (n, chain.size() / 2);
+  if (x.empty() || n < 2)
+    return numeric_limits<double>::infinity();
+  vguard<double> means, vars;
+  for (const auto& chain: x)
+    for (size_t half = 0; half < 2; ++half) {
+      const auto begin = chain.end() - (2 - half) * n;
+      double mean = 0, var = 0;
+      for (auto iter = begin; iter != begin + n; ++iter)
+	mean += *iter;
+      mean /= n;
+      for (auto iter = begin; iter != begin + n; ++iter)
+	var += (*iter - mean) * (*iter - mean);
+      means.push_back (mean);
+      vars.push_back (var / (n - 1));
+    }
+  const size_t m = means.size();
+  double meanOfMeans = 0, w = 0, b = 0;
+  for (size_t j = 0; j < m; ++j) {
+    meanOfMeans += means[j] / m;
+    w += vars[j] / m;
+  }
+  for (size_t j = 0; j < m; ++j)
+    b += (means[j] - meanOfMeans) * (means[j] - meanOfMeans) * n / (m - 1);
+  if (w <= 0)
+    return numeric_limits<double>::infinity();  // a chain that stopped moving has not converged, whatever its mean
+  return sqrt (((n - 1) * w / n + b / n) / w);
+}
+
+Sampler::Diagnostics Sampler::diagnose (const vguard<const Sampler*>& chains) {
+  Diagnostics diag;
+  diag.samples = numeric_limits<unsigned int>::max();
+  diag.ess = 0;
+  unsigned int samplesSinceBest = numeric_limits<unsigned int>::max();
+  vguard<vguard<double> > traces;
+  for (const Sampler* sampler: chains)
+    if (sampler->heat == 1) {
+      // discard the first half, & any adaptive burn-in
+      const size_t burn = max ((size_t) min (sampler->adaptiveSamples, sampler->samplesTaken), sampler->logLikelihoodTrace.size() / 2);
+      traces.push_back (vguard<double> (sampler->logLikelihoodTrace.begin() + min (burn, sampler->logLikelihoodTrace.size()), sampler->logLikelihoodTrace.end()));
+      diag.samples = min (diag.samples, (unsigned int) traces.back().size());
+      diag.ess += effectiveSampleSize (traces.back());
+      samplesSinceBest = min (samplesSinceBest, sampler->samplesSinceBest);
+    }
+  if (traces.empty())
+    diag.samples = 0;
+  diag.rHat = splitRHat (traces);
+  diag.plateauSamplesPerNode = traces.empty() ? 0 : samplesSinceBest / (double) chains[0]->currentHistory.tree().nodes();
+  return diag;
+}
+
+bool Sampler::converged (const vguard<const vguard<Sampler>*>& chains, const StoppingRule& stoppingRule, unsigned int samplesSoFar) {
+  bool allConverged = true;
+  const size_t nDatasets = chains[0]->size();
+  for (size_t d = 0; d < nDatasets; ++d) {
+    vguard<const Sampler*> datasetChains;
+    for (const auto* chain: chains)
+      datasetChains.push_back (&chain->at(d));
+    const Diagnostics diag = diagnose (datasetChains);
+    const bool datasetConverged = diag.converged (stoppingRule);
+    LogThisAt(2,"Convergence diagnostics for " << datasetChains[0]->name << " after " << plural(samplesSoFar,"sample") << ": " << diag.toString() << (datasetConverged ? " (converged)" : "") << endl);
+    for (auto& logger : datasetChains[0]->loggers)
+      logger->logDiagnostics (diag);
+    if (!datasetConverged)
+      allConverged = false;
+  }
+  if (allConverged)
+    LogThisAt(1,"MCMC converged after " << plural(samplesSoFar,"sample") << "; stopping" << endl);
+  return allConverged;
 }
 
 string Sampler::moveStats() const {
@@ -1745,6 +2528,15 @@ string Sampler::moveStats() const {
   return out.str();
 }
 
+string Sampler::swapStats() const {
+  ostringstream out;
+  out << setw(Move::typeNameWidth()) << "Chain swap" << ": "
+      << setw(5) << swapsProposed << " moves, "
+      << setw(5) << swapsAccepted << " accepted"
+      << endl;
+  return out.str();
+}
+
 string Sampler::sampleSeq (const PosWeightMatrix& profile, random_engine& generator) const {
   string seq (profile.size(), Alignment::wildcardChar);
   for (SeqIdx pos = 0; pos < profile.size(); ++pos) {
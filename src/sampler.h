@@ -2,12 +2,22 @@
 #define SAMPLER_INCLUDED
 
 #include <iomanip>
+#include <tuple>
 #include "model.h"
 #include "tree.h"
 #include "fastseq.h"
 #include "forward.h"
 #include "logger.h"
 
+#define DefaultLogLikelihoodCacheAge 16
+#define DefaultConditionalPWMCacheAge 16
+
+#define DefaultMCMCAdaptInterval 20  /* samples between move rate updates during adaptive burn-in */
+#define MCMCMinMoveRateFraction .05  /* adaptation never drops a move type below this fraction of proposals */
+
+#define DefaultMCMCConvergenceCheckInterval 100  /* samples between convergence checks */
+#define MCMCMinConvergenceSamples 20  /* convergence is not assessed on fewer samples per chain than this */
+
 struct SimpleTreePrior {
   double populationSize;
   SimpleTreePrior() : populationSize(1) { }
@@ -18,14 +28,30 @@ struct SimpleTreePrior {
 struct TreeAlignFuncs {
   typedef vguard<vguard<vguard<LogProb> > > PosWeightMatrix;  // pwm[pos][cpt][tok]
 
+  // TreeAlignFuncs::LogLikelihoodTerms
+  // per-branch indel & per-column substitution log-likelihoods of a history
+  struct LogLikelihoodTerms {
+    vguard<LogProb> branchLogLike;  // branchLogLike[node], for nodes below the root
+    vguard<LogProb> colLogLike;  // colLogLike[col]
+  };
+
   // TreeAlignFuncs::History
+  // tree & alignment are immutable & shared between copies, so copying a History is cheap, and a move that changes only one of them shares the other
   struct History {
-    vguard<FastSeq> gapped;
-    Tree tree;
-    History() { }
-    History (const vguard<FastSeq>& g, const Tree& t) : gapped(g), tree(t) { }
+    typedef shared_ptr<const vguard<FastSeq> > SharedAlignment;
+    typedef shared_ptr<const Tree> SharedTree;
+    typedef shared_ptr<const LogLikelihoodTerms> SharedTerms;
+    SharedAlignment sharedGapped;
+    SharedTree sharedTree;
+    SharedTerms sharedTerms;  // set when the history is scored by a LogLikelihoodCache, so that its changed copies can be rescored incrementally
+    History() : sharedGapped (make_shared<const vguard<FastSeq> >()), sharedTree (make_shared<const Tree>()) { }
+    History (const vguard<FastSeq>& g, const Tree& t) : sharedGapped (make_shared<const vguard<FastSeq> > (g)), sharedTree (make_shared<const Tree> (t)) { }
+    History (const SharedAlignment& g, const SharedTree& t) : sharedGapped (g), sharedTree (t) { }
+    inline const vguard<FastSeq>& gapped() const { return *sharedGapped; }
+    inline const Tree& tree() const { return *sharedTree; }
     History reorder (const vguard<TreeNodeIndex>& newOrder) const;
     void assertNamesMatch() const;
+    bool sameAs (const History& history) const;  // true if tree & gapped alignment are identical
   };
 
   static map<TreeNodeIndex,PosWeightMatrix> getConditionalPWMs (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, const map<TreeNodeIndex,TreeNodeIndex>& exclude, const set<TreeNodeIndex>& fillUpNodes, const set<TreeNodeIndex>& fillDownNodes, bool normalize = true);
@@ -35,6 +61,7 @@ struct TreeAlignFuncs {
   static PosWeightMatrix preMultiply (const PosWeightMatrix& child, const vguard<LogProbModel::LogProbMatrix>& submat);
 
   static AlignPath cladePath (const AlignPath& path, const Tree& tree, TreeNodeIndex cladeRoot, TreeNodeIndex cladeRootParent, TreeNodeIndex exclude = -1);
+  static AlignPath cladePath (const AlignPath& path, const Tree& tree, TreeNodeIndex cladeRoot, TreeNodeIndex cladeRootParent, vguard<AlignColIndex>& pathCol, TreeNodeIndex exclude = -1);  // also sets pathCol[col] = column of path that column col came from
   static AlignPath pairPath (const AlignPath& path, TreeNodeIndex node1, TreeNodeIndex node2);
   static AlignPath triplePath (const AlignPath& path, TreeNodeIndex lChild, TreeNodeIndex rChild, TreeNodeIndex parent);
   static AlignPath branchPath (const AlignPath& path, const Tree& tree, TreeNodeIndex node);
@@ -61,6 +88,128 @@ struct TreeAlignFuncs {
   static LogProb logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, const char* suffix = "");
   static LogProb logLikelihood (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, const char* suffix = "");
 
+  // TreeAlignFuncs::AgedCache
+  // map whose entries are dropped once they have gone unused for maxAge calls to nextAge().
+  // Entries are kept in order of last use, so nextAge() only visits the entries it drops
+  template<class Key,class Value>
+  class AgedCache {
+  private:
+    typedef list<pair<Key,size_t> > LRUList;  // key & age when last used, most recently used first
+    LRUList lru;
+    map<Key,pair<Value,typename LRUList::iterator> > cache;
+    void touch (typename LRUList::iterator iter) {
+      iter->second = age;
+      lru.splice (lru.begin(), lru, iter);
+    }
+    void copyEntries (const AgedCache& c) {
+      for (auto iter = c.lru.rbegin(); iter != c.lru.rend(); ++iter) {
+	lru.push_front (*iter);
+	cache[iter->first] = make_pair (c.cache.at(iter->first).first, lru.begin());
+      }
+    }
+  public:
+    size_t maxAge, age, hits, misses;
+    AgedCache (size_t maxAge) : maxAge(maxAge), age(0), hits(0), misses(0) { }
+    AgedCache (const AgedCache& c) : maxAge(c.maxAge), age(c.age), hits(c.hits), misses(c.misses) { copyEntries (c); }
+    AgedCache& operator= (const AgedCache& c) {
+      if (this != &c) {
+	maxAge = c.maxAge;
+	age = c.age;
+	hits = c.hits;
+	misses = c.misses;
+	lru.clear();
+	cache.clear();
+	copyEntries (c);
+      }
+      return *this;
+    }
+    Value* find (const Key& key) {
+      auto iter = cache.find (key);
+      if (iter == cache.end()) {
+	++misses;
+	return NULL;
+      }
+      ++hits;
+      touch (iter->second.second);
+      return &iter->second.first;
+    }
+    Value& insert (const Key& key, const Value& value) {
+      auto iter = cache.find (key);
+      if (iter == cache.end()) {
+	lru.push_front (make_pair (key, age));
+	iter = cache.insert (make_pair (key, make_pair (value, lru.begin()))).first;
+      } else {
+	iter->second.first = value;
+	touch (iter->second.second);
+      }
+      return iter->second.first;
+    }
+    void nextAge() {
+      ++age;
+      while (!lru.empty() && lru.back().second + maxAge < age) {
+	cache.erase (lru.back().first);
+	lru.pop_back();
+      }
+    }
+    size_t size() const { return cache.size(); }
+  };
+
+  typedef pair<vguard<vguard<TreeNodeIndex> >,vguard<TreeBranchLength> > TreeKey;  // children & branch length of each node
+  static TreeKey treeKey (const Tree& tree);
+
+  // TreeAlignFuncs::HistoryChange
+  // the branches & columns of a new history that a move changed, relative to the old history it was proposed from.
+  // Log-likelihood terms of everything else are copied from the old history
+  struct HistoryChange {
+    vguard<TreeNodeIndex> oldNode;  // oldNode[node] = index of node in the old history; empty if nodes were not renumbered
+    set<TreeNodeIndex> branches;  // nodes whose branch to their parent changed length, parent or pairwise alignment
+    vguard<long> oldCol;  // oldCol[col] = old column with the same contents & no changed branch, or -1 if col must be rescored
+    void keepColumns (AlignColIndex cols);  // for moves that leave the alignment unchanged
+    // for moves that merge unchanged clade alignments with new ones; cladeCol[clade][col] is the old or new column holding column col of the clade's path,
+    // and rebuiltRows are rows in no clade, whose residues may have been resampled.
+    // A new column keeps an old one if it holds exactly the same clade columns, and the same residues of each rebuilt row
+    void matchColumns (const Alignment& oldAlign, const vguard<FastSeq>& newUngapped, const AlignPath& newPath, const vguard<vguard<AlignColIndex> >& oldCladeCol, const vguard<vguard<AlignColIndex> >& newCladeCol, const vguard<AlignRowIndex>& rebuiltRows);
+    void markBranchColumns (const History& oldHistory, const History& newHistory);  // if the tree changed, rescores columns where a changed branch's node is ungapped
+    TreeNodeIndex oldNodeIndex (TreeNodeIndex node) const { return oldNode.empty() ? node : oldNode[node]; }
+  };
+
+  // TreeAlignFuncs::LogLikelihoodCache
+  // per-branch indel & per-column substitution log-likelihoods of recently scored histories,
+  // so that branches & columns changed by a move are rescored without repeating recent work
+  class LogLikelihoodCache {
+  public:
+    typedef pair<TreeBranchLength,string> BranchKey;  // branch length, pairwise alignment states
+    typedef pair<size_t,string> ColumnKey;  // tree ID, column
+    AgedCache<TreeKey,size_t> treeId;
+    AgedCache<BranchKey,LogProb> branchLogLike;
+    AgedCache<ColumnKey,LogProb> colLogLike;
+    size_t nextTreeId, branchesReused, colsReused;  // reused = copied from the old history of a move
+    LogLikelihoodCache (size_t maxAge = DefaultLogLikelihoodCacheAge);
+    size_t getTreeId (const Tree& tree);
+    LogProb branchLogLikelihood (const RateModel& model, const History& history, TreeNodeIndex node);  // indel log-likelihood of the branch from node's parent
+    void columnLogLikelihoods (const RateModel& model, const History& history, const vguard<AlignColIndex>& cols, vguard<LogProb>& colSub);  // sets colSub[col] for each col in cols
+    LogProb substLogLikelihood (const RateModel& model, const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path);  // substitution log-likelihood, without building gapped rows
+    LogProb logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, History& history, const char* suffix = "");  // scores every branch & column, and sets history.sharedTerms
+    LogProb logLikelihood (const SimpleTreePrior& treePrior, const RateModel& model, History& history, const History& oldHistory, const HistoryChange& change, const char* suffix = "");  // rescores only what change reports
+    void nextAge();
+    string stats() const;
+  };
+
+  // TreeAlignFuncs::ConditionalPWMCache
+  // per-column results of getConditionalPWMs, keyed by tree, excluded edge & the contents of the rows on the node's side of that edge,
+  // so that columns of subtrees untouched since a recent call are not recomputed
+  class ConditionalPWMCache {
+  public:
+    typedef vguard<vguard<LogProb> > PWMColumn;  // pwmCol[cpt][tok]
+    typedef tuple<size_t,TreeNodeIndex,TreeNodeIndex,bool,string> ColumnKey;  // tree ID, node, excluded neighbor, normalize, column restricted to node's side
+    AgedCache<TreeKey,size_t> treeId;
+    AgedCache<ColumnKey,PWMColumn> pwmCol;
+    size_t nextTreeId;
+    ConditionalPWMCache (size_t maxAge = DefaultConditionalPWMCacheAge);
+    map<TreeNodeIndex,PosWeightMatrix> getConditionalPWMs (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped, const map<TreeNodeIndex,TreeNodeIndex>& exclude, const set<TreeNodeIndex>& fillUpNodes, const set<TreeNodeIndex>& fillDownNodes, bool normalize = true);
+    string stats() const;
+  };
+
   // TreeAlignFuncs::SparseDPMatrix
   template <size_t CellStates>
   class SparseDPMatrix {
@@ -103,33 +252,72 @@ struct TreeAlignFuncs {
     const SeqIdx xSize, ySize;
 
   private:
-    vguard<map<SeqIdx,XYCell> > cellStorage;  // partial Forward sums by cell
+    // partial Forward sums by cell, stored contiguously row by row.
+    // Row xpos holds the cell at ypos=0, then the envelope band [bandStart[xpos],bandEnd[xpos]), then the cell at ypos=ySize-1
+    vguard<SeqIdx> bandStart, bandEnd;
+    vguard<size_t> rowOffset;
+    vguard<XYCell> cellStorage;
     XYCell emptyCell;  // always -inf
-    
+
+    inline bool inBand (SeqIdx xpos, SeqIdx ypos) const {
+      return ypos == 0 || ypos == ySize-1 || (ypos >= bandStart[xpos] && ypos < bandEnd[xpos]);
+    }
+
+    inline size_t cellIndex (SeqIdx xpos, SeqIdx ypos) const {
+      return rowOffset[xpos]
+	+ (ypos == 0
+	   ? 0
+	   : (ypos == ySize-1
+	      ? 1 + bandEnd[xpos] - bandStart[xpos]
+	      : 1 + ypos - bandStart[xpos]));
+    }
+
+    void initBands() {
+      const SeqIdx yBandMax = ySize > 1 ? ySize - 1 : 1;
+      bandStart.reserve (xSize);
+      bandEnd.reserve (xSize);
+      rowOffset.reserve (xSize);
+      // band limits are nondecreasing in xpos, so a single sweep finds them all
+      SeqIdx lo = 1, hi = 1;
+      size_t cells = 0;
+      for (SeqIdx xpos = 0; xpos < xSize; ++xpos) {
+	if (xpos == 0 || xpos == xSize - 1 || !env.initialized()) {
+	  bandStart.push_back (1);
+	  bandEnd.push_back (yBandMax);
+	} else {
+	  while (lo < yBandMax && env.matchOffset (xEnvPos[xpos], yEnvPos[lo]) > env.maxDistance)
+	    ++lo;
+	  hi = max (hi, lo);
+	  while (hi < yBandMax && env.matchOffset (xEnvPos[xpos], yEnvPos[hi]) >= -env.maxDistance)
+	    ++hi;
+	  bandStart.push_back (lo);
+	  bandEnd.push_back (hi);
+	}
+	rowOffset.push_back (cells);
+	cells += (ySize > 1 ? 2 : 1) + bandEnd.back() - bandStart.back();
+      }
+      cellStorage.resize (cells);
+    }
+
   public:
     LogProb lpEnd;
 
     // cell accessors
-    inline XYCell& xyCell (SeqIdx xpos, SeqIdx ypos) { return cellStorage[xpos][ypos]; }
+    inline XYCell& xyCell (SeqIdx xpos, SeqIdx ypos) {
+      Assert (inBand (xpos, ypos), "Cell (%u,%u) is outside envelope", xpos, ypos);
+      return cellStorage[cellIndex (xpos, ypos)];
+    }
     inline const XYCell& xyCell (SeqIdx xpos, SeqIdx ypos) const {
-      const auto& column = cellStorage[xpos];
-      auto iter = column.find(ypos);
-      return iter == column.end() ? emptyCell : iter->second;
+      return inBand (xpos, ypos) ? cellStorage[cellIndex (xpos, ypos)] : emptyCell;
     }
 
     template<class State>
     inline LogProb& cell (SeqIdx xpos, SeqIdx ypos, State state)
-    { return cellStorage[xpos][ypos].lp[(unsigned int) state]; }
+    { return xyCell(xpos,ypos).lp[(unsigned int) state]; }
 
     template<class State>
     inline LogProb cell (SeqIdx xpos, SeqIdx ypos, State state) const
-    {
-      const auto& column = cellStorage[xpos];
-      auto iter = column.find(ypos);
-      return iter == column.end()
-	? -numeric_limits<double>::infinity()
-	: iter->second.lp[(unsigned int) state];
-    }
+    { return xyCell(xpos,ypos).lp[(unsigned int) state]; }
 
     inline LogProb cell (const CellCoords& coords) const {
       if (coords.state == CellStates)
@@ -144,8 +332,7 @@ struct TreeAlignFuncs {
     inline const LogProb lpStart() const { return cell(0,0,0); }
 
     inline bool inEnvelope (SeqIdx xpos, SeqIdx ypos) const {
-      return xpos == 0 || ypos == 0 || xpos == xSize-1 || ypos == ySize-1
-	|| env.inRange (xEnvPos[xpos], yEnvPos[ypos]);
+      return xpos == 0 || xpos == xSize-1 || inBand (xpos, ypos);
     }
     
     // constructor
@@ -155,9 +342,10 @@ struct TreeAlignFuncs {
 	yEnvPos(yEnvPos),
 	xSize(xEnvPos.size()),
 	ySize(yEnvPos.size()),
-	cellStorage(xSize),
 	lpEnd(-numeric_limits<double>::infinity())
-    { }
+    {
+      initBands();
+    }
 
     // output
     void writeToLog (int logLevel) const {
@@ -324,9 +512,28 @@ struct Sampler : TreeAlignFuncs {
     LogProb lpEmit (const CellCoords& coords) const;
   };
 
+  // Sampler::StoppingRule
+  // sampling stops early once every dataset meets all the active (nonzero) criteria
+  struct StoppingRule {
+    double minESS, maxRHat, plateauSamplesPerNode;
+    unsigned int checkInterval;
+    StoppingRule() : minESS(0), maxRHat(0), plateauSamplesPerNode(0), checkInterval(DefaultMCMCConvergenceCheckInterval) { }
+    bool active() const { return minESS > 0 || maxRHat > 0 || plateauSamplesPerNode > 0; }
+  };
+
+  // Sampler::Diagnostics
+  // convergence diagnostics for one dataset over its cold chains, computed on the log-likelihood trace after burn-in (the second half of each chain)
+  struct Diagnostics {
+    unsigned int samples;  // samples per chain after burn-in
+    double ess, rHat, plateauSamplesPerNode;
+    bool converged (const StoppingRule& rule) const;
+    string toString() const;
+  };
+
   // Sampler::Logger
   struct Logger {
     virtual void logHistory (const History& history) = 0;
+    virtual void logDiagnostics (const Diagnostics&) { }
   };
   
   // Sampler::Move
@@ -335,6 +542,7 @@ struct Sampler : TreeAlignFuncs {
     Type type;
     TreeNodeIndex node, parent, leftChild, rightChild, oldGrandparent, newGrandparent, oldSibling, newSibling;  // no single type of move uses all of these
     History oldHistory, newHistory;
+    HistoryChange change;  // filled in by each type of move before initRatio, which rescores only the changed branches & columns
     LogProb logForwardProposal, logReverseProposal, logJacobian, oldLogLikelihood, newLogLikelihood, logAcceptProb;
     bool nullified;
     string samplerName, comment;
@@ -342,8 +550,8 @@ struct Sampler : TreeAlignFuncs {
     Move() { }
     Move (Type type, const History& history, LogProb logLikelihood, const string& samplerName);
     
-    void initNewHistory (const Tree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path);
-    void initNewHistory (const Tree& tree, const vguard<FastSeq>& gapped);
+    void initNewHistory (const History::SharedTree& tree, const vguard<FastSeq>& ungapped, const AlignPath& path);
+    void initNewHistory (const Tree& tree, const History::SharedAlignment& gapped);
     void initRatio (const Sampler& sampler);
     void nullify (const char* reason);
     bool accept (random_engine& generator) const;
@@ -377,15 +585,25 @@ struct Sampler : TreeAlignFuncs {
   const SimpleTreePrior& treePrior;
   list<Logger*> loggers;
   vguard<double> moveRate, moveNanosecs;
+  vguard<double> moveLogLikeChange;  // total |change in log-likelihood| of accepted moves
   vguard<int> movesProposed, movesAccepted;
+  unsigned int samplesTaken, adaptiveSamples, adaptInterval;  // for the first adaptiveSamples samples, moveRate is retuned every adaptInterval samples; it is then frozen
+  double heat;  // inverse temperature; log-likelihood ratios are scaled by this when accepting moves
+  unsigned int tries;  // number of proposals per alignment or regraft move (multiple-try Metropolis)
+  int swapsProposed, swapsAccepted;  // state swaps with the next-hottest chain
   bool useFixedGuide, sampleAncestralSeqs;
   const Alignment guide;
   map<string,AlignRowIndex> guideRowByName;
   int maxDistanceFromGuide;
 
   string name;
+  mutable LogLikelihoodCache logLikelihoodCache;
+  mutable ConditionalPWMCache conditionalPWMCache;
+  mutable list<Sampler> tryWorkers;  // copies of this sampler, with their own caches, for proposing the extra tries in parallel threads
   History currentHistory, bestHistory;
   LogProb currentLogLikelihood, bestLogLikelihood;
+  vguard<LogProb> logLikelihoodTrace;  // current log-likelihood after each sample
+  unsigned int samplesSinceBest;
   bool isUltrametric;
   
   // Sampler constructor
@@ -398,18 +616,39 @@ struct Sampler : TreeAlignFuncs {
   void fixAlignment();  // do tree-sampling moves only
   
   // Sampler sampling methods
-  inline LogProb logLikelihood (const History& history, const char* prefix = "") const {
-    return TreeAlignFuncs::logLikelihood (treePrior, model, history, prefix);
+  inline LogProb logLikelihood (History& history, const char* prefix = "") const {
+    return logLikelihoodCache.logLikelihood (treePrior, model, history, prefix);
+  }
+  inline LogProb logLikelihood (History& history, const History& oldHistory, const HistoryChange& change, const char* prefix = "") const {
+    return logLikelihoodCache.logLikelihood (treePrior, model, history, oldHistory, change, prefix);
   }
   
   Move proposeMove (const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const;
+  Move proposeMove (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const;
+
+  // multiple-try Metropolis (Liu, Liang & Wong, 2000), with weights w(y|x) = P(y)^heat / Q(y|x)
+  Move proposeMultipleTryMove (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, random_engine& generator) const;
+  vguard<Move> proposeMoves (Move::Type type, const History& oldHistory, LogProb oldLogLikelihood, size_t nMoves, random_engine& generator) const;  // one thread per move
+  LogProb multipleTryLogWeight (const Move& move) const;  // -infinity if the move leaves the history unchanged
+  static bool allowsMultipleTries (Move::Type type);  // only moves without a Jacobian term
 
   void sample (random_engine& generator);
+  void adaptMoveRates();  // set move rates proportional to accepted log-likelihood change per CPU-second
   
-  static void run (vguard<Sampler>& samplers, random_engine& generator, unsigned int nSamples = 1);
+  static void run (vguard<Sampler>& samplers, random_engine& generator, unsigned int nSamples = 1, const StoppingRule& stoppingRule = StoppingRule());
+  // chains[chain][dataset], one thread per chain, chain #0 cold; swaps states of adjacent chains every swapInterval samples
+  // on return, the best history found by any chain is in chains[0]
+  static void runChains (vguard<vguard<Sampler> >& chains, random_engine& generator, unsigned int nSamples, unsigned int swapInterval, const StoppingRule& stoppingRule = StoppingRule());
+
+  // convergence
+  static Diagnostics diagnose (const vguard<const Sampler*>& chains);  // chains with heat < 1 are ignored
+  static bool converged (const vguard<const vguard<Sampler>*>& chains, const StoppingRule& stoppingRule, unsigned int samplesSoFar);  // also logs the diagnostics
+  static double effectiveSampleSize (const vguard<double>& x);
+  static double splitRHat (const vguard<vguard<double> >& x);
 
   // Sampler summary methods
   string moveStats() const;
+  string swapStats() const;
   
   // Sampler helpers
   static TreeNodeIndex randomInternalNode (const Tree& tree, random_engine& generator);
@@ -426,7 +665,7 @@ struct Sampler : TreeAlignFuncs {
   vguard<SeqIdx> guideSeqPos (const AlignPath& path, AlignRowIndex row, AlignRowIndex variableGuideRow, AlignRowIndex fixedGuideRow) const;
 
   inline map<TreeNodeIndex,PosWeightMatrix> getConditionalPWMs (const Tree& tree, const vguard<FastSeq>& gapped, const map<TreeNodeIndex,TreeNodeIndex>& exclude, const set<TreeNodeIndex>& fillUpNodes, const set<TreeNodeIndex>& fillDownNodes) const {
-    return TreeAlignFuncs::getConditionalPWMs (model, tree, gapped, exclude, fillUpNodes, fillDownNodes);
+    return conditionalPWMCache.getConditionalPWMs (model, tree, gapped, exclude, fillUpNodes, fillDownNodes);
   }
 
   string sampleSeq (const PosWeightMatrix& profile, random_engine& generator) const;
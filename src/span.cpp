@@ -32,25 +32,31 @@ void AlignGraph::Partition::merge (const AlignGraph::TrialEdge& e) {
   }
 }
 
-AlignGraph::AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, ForwardMatrix::random_engine& generator)
+AlignGraph::AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, ForwardMatrix::random_engine& generator, const TokenizedFastSeqs* seqTokens)
   : seqs (seqs),
     model (model),
     time (time),
     diagEnvParams (diagEnvParams),
+    ownTokens (seqTokens ? TokenizedFastSeqs() : TokenizedFastSeqs (seqs, model.alphabet)),
+    seqTokens (seqTokens ? *seqTokens : ownTokens),
     edges (seqs.size()),
     edgePath (seqs.size())
 {
+  Assert (this->seqTokens.matches (seqs, model.alphabet), "Token sequences do not match sequences");
   buildSparseRandomGraph (generator);
 }
 
-AlignGraph::AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams)
+AlignGraph::AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, const TokenizedFastSeqs* seqTokens)
   : seqs (seqs),
     model (model),
     time (time),
     diagEnvParams (diagEnvParams),
+    ownTokens (seqTokens ? TokenizedFastSeqs() : TokenizedFastSeqs (seqs, model.alphabet)),
+    seqTokens (seqTokens ? *seqTokens : ownTokens),
     edges (seqs.size()),
     edgePath (seqs.size())
 {
+  Assert (this->seqTokens.matches (seqs, model.alphabet), "Token sequences do not match sequences");
   buildDenseGraph();
 }
 
@@ -91,6 +97,8 @@ void AlignGraph::buildGraph (const list<TrialEdge>& trialEdges, const string& gr
   ProgressLog (plog, 4);
   plog.initProgress ("Guide alignment (%d sequences, %s)", seqs.size(), graphDescription.c_str());
 
+  const CachingRateModel cachedModel (model);  // every pair is aligned at the same time, so the substitution matrices are computed once
+
   size_t n = 0;
   for (auto& trialEdge : trialEdges) {
     plog.logProgress (n / (double) trialEdges.size(), "pairwise alignment %d/%d", n + 1, trialEdges.size());
@@ -99,12 +107,12 @@ void AlignGraph::buildGraph (const list<TrialEdge>& trialEdges, const string& gr
     const size_t src = trialEdge.row1, dest = trialEdge.row2;
     DiagonalEnvelope env (seqs[src], seqs[dest]);
     if (diagEnvParams.sparse) {
-      KmerIndex yKmerIndex (seqs[dest], model.alphabet, diagEnvParams.kmerLen);
-      env.initSparse (yKmerIndex, diagEnvParams.bandSize, diagEnvParams.kmerThreshold, ForwardMatrix::cellSize(), diagEnvParams.effectiveMaxSize());
+      KmerIndex yKmerIndex (seqs[dest], seqTokens[dest], model.alphabet, diagEnvParams.kmerLen);
+      env.initSparse (yKmerIndex, seqTokens[src], diagEnvParams.bandSize, diagEnvParams.kmerThreshold, ForwardMatrix::cellSize(), diagEnvParams.effectiveMaxSize());
     } else
       env.initFull();
 
-    QuickAlignMatrix mx (env, model, time);
+    QuickAlignMatrix mx (env, cachedModel, time, seqTokens[src], seqTokens[dest]);
     edgePath[src][dest] = mx.alignPath (src, dest);
     
     Edge e;
@@ -34,12 +34,14 @@ struct AlignGraph {
   const RateModel& model;
   const double time;
   const DiagEnvParams& diagEnvParams;
+  TokenizedFastSeqs ownTokens;  // only used if tokens were not supplied by caller
+  const TokenizedFastSeqs& seqTokens;
 
   vguard<priority_queue<Edge> > edges;
   vguard<map<AlignRowIndex,AlignPath> > edgePath;
   
-  AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, ForwardMatrix::random_engine& generator);
-  AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams);
+  AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, ForwardMatrix::random_engine& generator, const TokenizedFastSeqs* seqTokens = NULL);
+  AlignGraph (const vguard<FastSeq>& seqs, const RateModel& model, const double time, const DiagEnvParams& diagEnvParams, const TokenizedFastSeqs* seqTokens = NULL);
 
   void buildSparseRandomGraph (ForwardMatrix::random_engine& generator);
   void buildDenseGraph();
@@ -49,6 +51,11 @@ struct AlignGraph {
   AlignPath mstPath();
   Alignment mstAlign();
   vguard<FastSeq> mstGapped();
+
+private:
+  // seqTokens may refer to this object's own ownTokens, which a copy would leave dangling
+  AlignGraph (const AlignGraph&) = delete;
+  AlignGraph& operator= (const AlignGraph&) = delete;
 };
 
 #endif /* SPAN_INCLUDED */
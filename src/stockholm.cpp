@@ -1,18 +1,51 @@
 #include <algorithm>
 #include <iomanip>
+#include <cstring>
 #include "stockholm.h"
-#include "regexmacros.h"
 #include "util.h"
 
-// POSIX basic regular expressions
-const regex nonwhite_re (RE_DOT_STAR RE_NONWHITE_CHAR_CLASS RE_DOT_STAR, regex_constants::basic);
-const regex seq_re (RE_WHITE_OR_EMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_OR_EMPTY, regex_constants::basic);
-const regex gf_re (RE_WHITE_OR_EMPTY "#=GF" RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_NONWHITE_CHAR_CLASS RE_DOT_STAR), regex_constants::basic);
-const regex gc_re (RE_WHITE_OR_EMPTY "#=GC" RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)), regex_constants::basic);
-const regex gr_re (RE_WHITE_OR_EMPTY "#=GR" RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)), regex_constants::basic);
-const regex gs_re (RE_WHITE_OR_EMPTY "#=GS" RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_PLUS(RE_NONWHITE_CHAR_CLASS)) RE_WHITE_NONEMPTY RE_GROUP(RE_NONWHITE_CHAR_CLASS RE_DOT_STAR), regex_constants::basic);
-const regex hash_re (RE_WHITE_OR_EMPTY "#" RE_DOT_STAR, regex_constants::basic);
-const regex divider_re (RE_WHITE_OR_EMPTY "//" RE_WHITE_OR_EMPTY, regex_constants::basic);
+// matches Stockholm lines one pattern at a time, using the character classes of regexmacros.h:
+// white space is [ \t\n], a token is a run of [!-~], and free text is [ -~]*
+struct StockholmLine {
+  const char *p, *end;
+  StockholmLine (const string& line) : p (line.data()), end (line.data() + line.size()) { }
+  static inline bool isWhite (char c) { return c == ' ' || c == '\t' || c == '\n'; }
+  static inline bool isNonWhite (char c) { return c >= '!' && c <= '~'; }
+  static inline bool isText (char c) { return c >= ' ' && c <= '~'; }
+  bool white() {  // one or more white space characters
+    const char* start = p;
+    while (p < end && isWhite(*p))
+      ++p;
+    return p > start;
+  }
+  bool optionalWhiteToEnd() {
+    white();
+    return p == end;
+  }
+  bool token (const char*& tokStart, size_t& tokLen) {
+    tokStart = p;
+    while (p < end && isNonWhite(*p))
+      ++p;
+    tokLen = p - tokStart;
+    return tokLen > 0;
+  }
+  bool literal (const char* s) {
+    const size_t len = strlen (s);
+    if ((size_t) (end - p) < len || strncmp (p, s, len) != 0)
+      return false;
+    p += len;
+    return true;
+  }
+  bool textToEnd (const char*& textStart, size_t& textLen) {  // a token character, then free text
+    if (p == end || !isNonWhite(*p))
+      return false;
+    for (textStart = p; p < end; ++p)
+      if (!isText(*p))
+	return false;
+    textLen = p - textStart;
+    return true;
+  }
+};
 
 Stockholm::Stockholm()
 { }
@@ -38,37 +71,59 @@ void Stockholm::read (istream& in) {
   gr.clear();
   gapped.clear();
 
-  smatch sm;
-  map<string,string> seq;
-  vguard<string> rowName;
+  map<string,size_t> rowIndex;
+  size_t nextRow = 0;  // rows usually repeat in the same order in each block
+  const char *s1, *s2, *s3;
+  size_t n1, n2, n3;
+  string line;
   while (in && !in.eof()) {
-    string line;
     getline(in,line);
-    if (regex_match (line, sm, seq_re)) {
-      if (!seq.count (sm.str(1)))
-	rowName.push_back (sm.str(1));
-      seq[sm.str(1)] += sm.str(2);
-    } else if (regex_match (line, sm, gf_re))
-      gf[sm.str(1)].push_back (sm.str(2));
-    else if (regex_match (line, sm, gc_re))
-      gc[sm.str(1)] += sm.str(2);
-    else if (regex_match (line, sm, gr_re))
-      gr[sm.str(2)][sm.str(1)] += sm.str(3);
-    else if (regex_match (line, sm, gs_re))
-      gs[sm.str(2)][sm.str(1)].push_back (sm.str(3));
-    else if (regex_match (line, hash_re))
+    StockholmLine sl (line);
+    sl.white();
+    const char* lineStart = sl.p;
+    if (sl.token(s1,n1) && sl.white() && sl.token(s2,n2) && sl.optionalWhiteToEnd()) {
+      if (nextRow >= gapped.size() || gapped[nextRow].name.compare (0, string::npos, s1, n1) != 0) {
+	const string name (s1, n1);
+	auto iter = rowIndex.find (name);
+	if (iter == rowIndex.end()) {
+	  nextRow = rowIndex[name] = gapped.size();
+	  gapped.push_back (FastSeq());
+	  gapped.back().name = name;
+	} else
+	  nextRow = iter->second;
+      }
+      gapped[nextRow++].seq.append (s2, n2);
+      continue;
+    }
+    sl.p = lineStart;
+    if (sl.literal("#=GF") && sl.white() && sl.token(s1,n1) && sl.white() && sl.textToEnd(s2,n2)) {
+      gf[string(s1,n1)].push_back (string(s2,n2));
+      continue;
+    }
+    sl.p = lineStart;
+    if (sl.literal("#=GC") && sl.white() && sl.token(s1,n1) && sl.white() && sl.token(s2,n2) && sl.optionalWhiteToEnd()) {
+      gc[string(s1,n1)].append (s2, n2);
+      continue;
+    }
+    sl.p = lineStart;
+    if (sl.literal("#=GR") && sl.white() && sl.token(s1,n1) && sl.white() && sl.token(s2,n2) && sl.white() && sl.token(s3,n3) && sl.optionalWhiteToEnd()) {
+      gr[string(s2,n2)][string(s1,n1)].append (s3, n3);
+      continue;
+    }
+    sl.p = lineStart;
+    if (sl.literal("#=GS") && sl.white() && sl.token(s1,n1) && sl.white() && sl.token(s2,n2) && sl.white() && sl.textToEnd(s3,n3)) {
+      gs[string(s2,n2)][string(s1,n1)].push_back (string(s3,n3));
+      continue;
+    }
+    sl.p = lineStart;
+    if (sl.literal("#") && all_of (sl.p, sl.end, StockholmLine::isText))
       continue;
-    else if (regex_match (line, divider_re))
+    sl.p = lineStart;
+    if (sl.literal("//") && sl.optionalWhiteToEnd())
       break;
-    else if (regex_match (line, nonwhite_re))
+    if (all_of (line.begin(), line.end(), StockholmLine::isText) && any_of (line.begin(), line.end(), StockholmLine::isNonWhite))
       Warn ("Unrecognized line in Stockholm file: %s", line.c_str());
   }
-  for (const auto& name : rowName) {
-    FastSeq fs;
-    fs.name = name;
-    fs.seq = seq[name];
-    gapped.push_back (fs);
-  }
 }
 
 void Stockholm::write (ostream& out, size_t charsPerRow) const {
@@ -99,53 +154,157 @@ void Stockholm::write (ostream& out, size_t charsPerRow) const {
   if (tw > 0)
     w = max (w, nw + tw + 6);
   
-  out << "# STOCKHOLM 1.0" << endl;
+  // lines are formatted into a buffer that is written in large chunks
+  string buf;
+  buf.reserve (StockholmWriteBufferSize + 2 * (w + cols + nw + tw + 16));
+  auto pad = [&] (const string& s, int width) {
+    buf += s;
+    if ((int) s.size() < width)
+      buf.append (width - s.size(), ' ');
+  };
+  auto endLine = [&]() {
+    buf += '\n';
+    if (buf.size() >= StockholmWriteBufferSize) {
+      out.write (buf.data(), buf.size());
+      buf.clear();
+    }
+  };
+
+  buf += "# STOCKHOLM 1.0";
+  endLine();
   for (auto& tag_gf : gf)
-    for (auto& line : tag_gf.second)
-      out << "#=GF " << left << setw(w-5) << tag_gf.first << " " << line << endl;
+    for (auto& line : tag_gf.second) {
+      buf += "#=GF ";
+      pad (tag_gf.first, w-5);
+      buf += ' ';
+      buf += line;
+      endLine();
+    }
 
   for (auto& tag_gs : gs) {
     for (auto& fs : gapped)
       if (tag_gs.second.count (fs.name))
-	for (auto& line : tag_gs.second.at(fs.name))
-	  out << "#=GS " << left << setw(nw+1) << fs.name << left << setw(tw+1) << tag_gs.first << line << endl;
+	for (auto& line : tag_gs.second.at(fs.name)) {
+	  buf += "#=GS ";
+	  pad (fs.name, nw+1);
+	  pad (tag_gs.first, tw+1);
+	  buf += line;
+	  endLine();
+	}
     for (auto& name_gs : tag_gs.second)
       if (!names.count (name_gs.first))
-	for (auto& line : name_gs.second)
-	  out << "#=GS " << left << setw(nw+1) << name_gs.first << left << setw(tw+1) << tag_gs.first << line << endl;
+	for (auto& line : name_gs.second) {
+	  buf += "#=GS ";
+	  pad (name_gs.first, nw+1);
+	  pad (tag_gs.first, tw+1);
+	  buf += line;
+	  endLine();
+	}
   }
 
   const int colStep = charsPerRow > 0 ? max (MinStockholmCharsPerRow, ((int) charsPerRow) - w - 1) : cols;
   for (int col = 0, block = 0; block == 0 || col < cols; ++block, col += colStep) {
     for (auto& tag_gc : gc)
-      if (block == 0 || col < tag_gc.second.size())
-	out << "#=GC " << left << setw(w-5) << tag_gc.first << " " << tag_gc.second.substr(col,colStep) << endl;
+      if (block == 0 || col < tag_gc.second.size()) {
+	buf += "#=GC ";
+	pad (tag_gc.first, w-5);
+	buf += ' ';
+	buf.append (tag_gc.second, col, colStep);
+	endLine();
+      }
 
     for (auto& fs : gapped) {
-      if (block == 0 || col < fs.seq.size())
-	out << left << setw(w+1) << fs.name << fs.seq.substr(col,colStep) << endl;
+      if (block == 0 || col < fs.seq.size()) {
+	pad (fs.name, w+1);
+	buf.append (fs.seq, col, colStep);
+	endLine();
+      }
       for (auto& tag_gr : gr)
 	if (tag_gr.second.count (fs.name))
-	  if (block == 0 || col < tag_gr.second.at(fs.name).size())
-	    out << "#=GR " << left << setw(nw+1) << fs.name << left << setw(tw+1) << tag_gr.first << tag_gr.second.at(fs.name).substr(col,colStep) << endl;
+	  if (block == 0 || col < tag_gr.second.at(fs.name).size()) {
+	    buf += "#=GR ";
+	    pad (fs.name, nw+1);
+	    pad (tag_gr.first, tw+1);
+	    buf.append (tag_gr.second.at(fs.name), col, colStep);
+	    endLine();
+	  }
     }
 
     for (auto& tag_gr : gr)
       for (auto& name_gr : tag_gr.second)
 	if (!names.count (name_gr.first))
-	  if (block == 0 || col < name_gr.second.size())
-	    out << "#=GR " << left << setw(nw+1) << name_gr.first << left << setw(tw+1) << tag_gr.first << name_gr.second.substr(col,colStep) << endl;
+	  if (block == 0 || col < name_gr.second.size()) {
+	    buf += "#=GR ";
+	    pad (name_gr.first, nw+1);
+	    pad (tag_gr.first, tw+1);
+	    buf.append (name_gr.second, col, colStep);
+	    endLine();
+	  }
 
     if (col + colStep < cols)
-      out << endl;
+      endLine();
   }
-  out << "//" << endl;
+  buf += "//";
+  endLine();
+  out.write (buf.data(), buf.size());
+  out.flush();
 }
 
 void Stockholm::setTree (const Tree& tree, const char* tag) {
   gf[string(tag)].push_back (tree.toString());
 }
 
+Stockholm Stockholm::delta (const Stockholm& previous) const {
+  Assert (!isDelta() && !gf.count (StockholmRowOrderTag), "Alignment is already delta-encoded");
+  map<string,const string*> prevSeq;
+  vguard<string> prevOrder;
+  for (const auto& fs : previous.gapped) {
+    prevSeq[fs.name] = &fs.seq;
+    prevOrder.push_back (fs.name);
+  }
+  Stockholm d (*this);
+  d.gapped.clear();
+  vguard<string> order;
+  for (const auto& fs : gapped) {
+    order.push_back (fs.name);
+    auto iter = prevSeq.find (fs.name);
+    if (iter == prevSeq.end() || *iter->second != fs.seq)
+      d.gapped.push_back (fs);
+  }
+  if (order != prevOrder)
+    d.gf[StockholmRowOrderTag].push_back (join (order));
+  d.gf[StockholmDeltaTag].push_back (to_string (gapped.size() - d.gapped.size()));
+  return d;
+}
+
+void Stockholm::applyDelta (const Stockholm& previous) {
+  if (!isDelta())
+    return;
+  map<string,const FastSeq*> seqByName;
+  vguard<string> order;
+  for (const auto& fs : previous.gapped) {
+    seqByName[fs.name] = &fs;
+    order.push_back (fs.name);
+  }
+  for (const auto& fs : gapped)
+    seqByName[fs.name] = &fs;
+  if (gf.count (StockholmRowOrderTag))
+    order = split (gf.at(StockholmRowOrderTag).front());
+  vguard<FastSeq> full;
+  for (const auto& name : order) {
+    Assert (seqByName.count (name), "Delta-encoded alignment has no sequence for %s", name.c_str());
+    full.push_back (*seqByName.at (name));
+  }
+  Assert (full.size() == gapped.size() + atoi (gf.at(StockholmDeltaTag).front().c_str()), "Delta-encoded alignment does not match previous alignment");
+  gapped.swap (full);
+  gf.erase (StockholmDeltaTag);
+  gf.erase (StockholmRowOrderTag);
+}
+
+bool Stockholm::isDelta() const {
+  return gf.count (StockholmDeltaTag);
+}
+
 size_t Stockholm::rows() const {
   return gapped.size();
 }
@@ -9,9 +9,12 @@
 #define StockholmNewHampshireTag "NH"
 #define StockholmIDTag "ID"
 #define StockholmLogProbTag "LP"
+#define StockholmDeltaTag "DELTA"
+#define StockholmRowOrderTag "RO"
 
 #define MinStockholmCharsPerRow 10
 #define DefaultStockholmRowLength 80
+#define StockholmWriteBufferSize (1 << 20)  /* bytes formatted before each write to the output stream */
 
 struct Stockholm {
   vguard<FastSeq> gapped;
@@ -32,6 +35,12 @@ struct Stockholm {
   Tree getTree() const;
   bool hasTree() const;
   
+  // delta encoding, for compact MCMC traces: rows identical to those of the previous alignment are omitted,
+  // the number omitted is recorded under StockholmDeltaTag, and the row order under StockholmRowOrderTag if it changed
+  Stockholm delta (const Stockholm& previous) const;
+  void applyDelta (const Stockholm& previous);  // restores omitted rows; does nothing if this is not a delta
+  bool isDelta() const;
+
   size_t rows() const;
   size_t columns() const;
   AlignPath path() const;
@@ -7,6 +7,16 @@
 
 #define SUMPROD_RESCALE_THRESHOLD 1e-30
 
+// maximum number of (component,column) pairs, and of message entries (E, F & G combined), in a column-batched block.
+// Blocks hold at least SUMPROD_BLOCK_CHUNK columns where possible, so that blockMatMul works on whole chunks
+#define SUMPROD_BLOCK_COLUMNS 32
+#define SUMPROD_BLOCK_MAX_CELLS 4194304
+#define SUMPROD_BLOCK_CHUNK 8
+
+// SumProductBlock::nodeTok codes for non-token characters
+#define SUMPROD_GAP_TOK -2
+#define SUMPROD_WILD_TOK -1
+
 SumProductStorage::SumProductStorage (size_t components, size_t nodes, size_t alphabetSize)
   : gappedCol (nodes),
     E (components, vguard<vguard<double> > (nodes, vguard<double> (alphabetSize))),
@@ -27,21 +37,33 @@ SumProduct::SumProduct (const RateModel& model, const Tree& tree)
     eigen (model),
     insProb (model.components(), vguard<double> (model.alphabetSize())),
     branchSubProb (model.components(), vguard<vguard<vguard<double> > > (tree.nodes(), vguard<vguard<double> > (model.alphabetSize(), vguard<double> (model.alphabetSize())))),
-    branchEigenSubCount (model.components(), vguard<gsl_matrix_complex*> (tree.nodes())),
+    branchSubMat (model.components(), vguard<vguard<double> > (tree.nodes(), vguard<double> (model.alphabetSize() * model.alphabetSize()))),
     logCptWeight (log_vector (model.cptWeight))
 {
   for (int cpt = 0; cpt < components(); ++cpt)
     for (AlphTok i = 0; i < model.alphabetSize(); ++i)
       insProb[cpt][i] = gsl_vector_get (model.insProb[cpt], i);
 
+  const BranchProbModels branchProbModels (model, eigen, tree);
   for (AlignRowIndex r = 0; r < tree.nodes() - 1; ++r) {
-      ProbModel pm (model, tree.branchLength(r));
+      const ProbModel& pm = branchProbModels[r];
       for (int cpt = 0; cpt < components(); ++cpt)
 	for (AlphTok i = 0; i < model.alphabetSize(); ++i)
 	  for (AlphTok j = 0; j < model.alphabetSize(); ++j)
-	    branchSubProb[cpt][r][i][j] = gsl_matrix_get (pm.subMat[cpt], i, j);
+	    branchSubMat[cpt][r][i*model.alphabetSize() + j] = branchSubProb[cpt][r][i][j] = gsl_matrix_get (pm.subMat[cpt], i, j);
   }
+}
 
+SumProduct::~SumProduct() {
+  for (auto& cptEigenSubCount : branchEigenSubCount)
+    for (auto m : cptEigenSubCount)
+      gsl_matrix_complex_free (m);
+}
+
+void SumProduct::initEigenSubCounts() const {
+  if (!branchEigenSubCount.empty())
+    return;
+  branchEigenSubCount = vguard<vguard<gsl_matrix_complex*> > (model.components(), vguard<gsl_matrix_complex*> (tree.nodes(), NULL));
   for (AlignRowIndex r = 0; r < tree.nodes() - 1; ++r) {
     vguard<gsl_matrix_complex*> esc = eigen.eigenSubCount (tree.branchLength(r));
     for (int cpt = 0; cpt < components(); ++cpt)
@@ -49,12 +71,6 @@ SumProduct::SumProduct (const RateModel& model, const Tree& tree)
   }
 }
 
-SumProduct::~SumProduct() {
-  for (int cpt = 0; cpt < components(); ++cpt)
-    for (auto m : branchEigenSubCount[cpt])
-      gsl_matrix_complex_free (m);
-}
-
 void SumProduct::initColumn (const map<AlignRowIndex,char>& seq) {
   ungappedRows.clear();
   gappedCol = vguard<char> (tree.nodes(), Alignment::gapChar);
@@ -161,6 +177,7 @@ void SumProduct::fillUp() {
 }
 
 void SumProduct::fillDown() {
+  vguard<double> GE (model.alphabetSize());
   for (int cpt = 0; cpt < components(); ++cpt) {
     LogThisAt(8,"Sending root-to-tip messages, component #" << cpt << " column " << join(gappedCol,"") << endl);
     if (!columnEmpty()) {
@@ -175,15 +192,17 @@ void SumProduct::fillDown() {
 	    logG[cpt][r] = logG[cpt][rp];
 	    for (auto rs: rsibs)
 	      logG[cpt][r] += logE[cpt][rs];
+	    for (AlphTok i = 0; i < model.alphabetSize(); ++i) {
+	      double p = G[cpt][rp][i];
+	      for (auto rs: rsibs)
+		if (!isGap(rs))
+		  p *= E[cpt][rs][i];
+	      GE[i] = p;
+	    }
 	    for (AlphTok j = 0; j < model.alphabetSize(); ++j) {
 	      double Gj = 0;
-	      for (AlphTok i = 0; i < model.alphabetSize(); ++i) {
-		double p = G[cpt][rp][i] * branchSubProb[cpt][r][i][j];
-		for (auto rs: rsibs)
-		  if (!isGap(rs))
-		    p *= E[cpt][rs][i];
-		Gj += p;
-	      }
+	      for (AlphTok i = 0; i < model.alphabetSize(); ++i)
+		Gj += GE[i] * branchSubProb[cpt][r][i][j];
 	      G[cpt][r][j] = Gj;
 	    }
 	  }
@@ -197,6 +216,202 @@ void SumProduct::fillDown() {
   }
 }
 
+// Y[i][b] = sum_j M[i*rowStride + j*colStride] * X[j][b], for i,j < A and b < B, summing over j in ascending order.
+// Row i of X and Y starts at offset i*ld. Columns are processed in chunks held in local accumulators, so that each row of X is loaded once per chunk
+static void blockMatMul (size_t A, size_t B, size_t ld, const double* M, size_t rowStride, size_t colStride, const double* X, double* Y) {
+  double acc[SUMPROD_BLOCK_CHUNK];
+  for (size_t b0 = 0; b0 < B; b0 += SUMPROD_BLOCK_CHUNK) {
+    const size_t nb = min ((size_t) SUMPROD_BLOCK_CHUNK, B - b0);
+    for (size_t i = 0; i < A; ++i) {
+      fill (acc, acc + SUMPROD_BLOCK_CHUNK, 0.);
+      const double* Mi = M + i*rowStride;
+      if (nb == SUMPROD_BLOCK_CHUNK)
+	for (size_t j = 0; j < A; ++j) {
+	  const double Mij = Mi[j*colStride];
+	  const double* Xj = X + j*ld + b0;
+	  for (size_t b = 0; b < SUMPROD_BLOCK_CHUNK; ++b)
+	    acc[b] += Mij * Xj[b];
+	}
+      else
+	for (size_t j = 0; j < A; ++j) {
+	  const double Mij = Mi[j*colStride];
+	  const double* Xj = X + j*ld + b0;
+	  for (size_t b = 0; b < nb; ++b)
+	    acc[b] += Mij * Xj[b];
+	}
+      copy (acc, acc + nb, Y + i*ld + b0);
+    }
+  }
+}
+
+void SumProduct::initBlock (SumProductBlock& block, const vguard<FastSeq>& gapped, AlignColIndex startCol, size_t columns) const {
+  const size_t A = model.alphabetSize(), N = tree.nodes(), C = components();
+  if (block.columns != columns || block.components != C || block.nodeTok.size() != N) {
+    block.columns = columns;
+    block.components = C;
+    block.E = block.F = block.G = vguard<vguard<double> > (N, vguard<double> (A * block.width()));
+    block.logE = block.logF = block.logG = vguard<vguard<LogProb> > (N, vguard<LogProb> (block.width()));
+    block.nodeTok = vguard<vguard<int> > (N, vguard<int> (columns));
+    block.cptLogLike = vguard<vguard<LogProb> > (columns, vguard<LogProb> (C));
+    block.colLogLike = vguard<LogProb> (columns);
+  }
+  for (AlignRowIndex r = 0; r < N; ++r)
+    for (size_t b = 0; b < columns; ++b) {
+      const char c = gapped[r].seq[startCol + b];
+      if (Alignment::isGap(c))
+	block.nodeTok[r][b] = SUMPROD_GAP_TOK;
+      else {
+	const char g = model.isValidSymbol(c) ? c : Alignment::wildcardChar;
+	block.nodeTok[r][b] = Alignment::isWildcard(g) ? SUMPROD_WILD_TOK : (int) model.tokenize(g);
+      }
+    }
+}
+
+void SumProduct::fillUp (SumProductBlock& block) const {
+  const size_t A = model.alphabetSize(), B = block.columns, C = components(), W = block.width();
+  LogThisAt(8,"Sending tip-to-root messages, " << plural(C,"component") << ", block of " << plural(B,"column") << endl);
+  for (auto& cll: block.cptLogLike)
+    fill (cll.begin(), cll.end(), 0.);
+  for (auto r : postorder) {
+    const vguard<int>& tok = block.nodeTok[r];
+    vguard<LogProb>& logF = block.logF[r];
+    vguard<LogProb>& logE = block.logE[r];
+    double* F = block.F[r].data();
+    double* E = block.E[r].data();
+    fill (logF.begin(), logF.end(), 0.);
+    fill (F, F + A*W, 1.);
+    for (size_t nc = 0; nc < tree.nChildren(r); ++nc) {
+      const TreeNodeIndex child = tree.getChild(r,nc);
+      const vguard<LogProb>& childLogE = block.logE[child];
+      const double* childE = block.E[child].data();
+      for (size_t w = 0; w < W; ++w)
+	logF[w] += childLogE[w];
+      for (size_t k = 0; k < A*W; ++k)
+	F[k] *= childE[k];
+    }
+
+    for (size_t cpt = 0; cpt < C; ++cpt)
+      for (size_t b = 0; b < B; ++b) {
+	const size_t w = cpt*B + b;
+	if (tok[b] == SUMPROD_WILD_TOK) {
+	  double Fmax = 0;
+	  for (AlphTok i = 0; i < A; ++i)
+	    if (F[i*W+w] > Fmax)
+	      Fmax = F[i*W+w];
+	  if (Fmax < SUMPROD_RESCALE_THRESHOLD) {
+	    for (AlphTok i = 0; i < A; ++i)
+	      F[i*W+w] /= Fmax;
+	    logF[w] += log (Fmax);
+	  }
+	} else if (tok[b] != SUMPROD_GAP_TOK) {
+	  double Ftok = F[tok[b]*W+w];
+	  if (Ftok < SUMPROD_RESCALE_THRESHOLD) {
+	    logF[w] += log (Ftok);
+	    Ftok = 1;
+	  }
+	  for (AlphTok i = 0; i < A; ++i)
+	    F[i*W+w] = 0;
+	  F[tok[b]*W+w] = Ftok;
+	}
+      }
+
+    // E[i][w] = sum_j branchSubMat[cpt][i][j] * F[j][w], for the columns w of each component
+    const TreeNodeIndex rp = tree.parentNode(r);
+    if (rp >= 0)
+      for (size_t cpt = 0; cpt < C; ++cpt)
+	blockMatMul (A, B, W, branchSubMat[cpt][r].data(), A, 1, F + cpt*B, E + cpt*B);
+
+    // gapped nodes, and roots of ungapped subtrees, pass no message to their parents
+    for (size_t b = 0; b < B; ++b)
+      if (tok[b] == SUMPROD_GAP_TOK || rp < 0 || block.nodeTok[rp][b] == SUMPROD_GAP_TOK)
+	for (size_t cpt = 0; cpt < C; ++cpt) {
+	  const size_t w = cpt*B + b;
+	  if (tok[b] != SUMPROD_GAP_TOK) {
+	    double Fins = 0;
+	    for (AlphTok i = 0; i < A; ++i)
+	      Fins += F[i*W+w] * insProb[cpt][i];
+	    block.cptLogLike[b][cpt] += logF[w] + log (Fins);
+	  }
+	  for (AlphTok i = 0; i < A; ++i)
+	    E[i*W+w] = 1;
+	  logE[w] = 0;
+	}
+      else
+	for (size_t cpt = 0; cpt < C; ++cpt)
+	  logE[cpt*B+b] = logF[cpt*B+b];
+  }
+  for (size_t b = 0; b < B; ++b) {
+    block.colLogLike[b] = -numeric_limits<double>::infinity();
+    for (size_t cpt = 0; cpt < C; ++cpt)
+      log_accum_exp (block.colLogLike[b], logCptWeight[cpt] + block.cptLogLike[b][cpt]);
+  }
+}
+
+void SumProduct::fillDown (SumProductBlock& block) const {
+  const size_t A = model.alphabetSize(), B = block.columns, C = components(), W = block.width();
+  vguard<double> GE (A * W);
+  LogThisAt(8,"Sending root-to-tip messages, " << plural(C,"component") << ", block of " << plural(B,"column") << endl);
+  for (auto r: preorder) {
+    const vguard<int>& tok = block.nodeTok[r];
+    vguard<LogProb>& logG = block.logG[r];
+    double* G = block.G[r].data();
+    const TreeNodeIndex rp = tree.parentNode(r);
+    if (rp >= 0) {
+      // G[j][w] = sum_i GE[i][w] * branchSubMat[cpt][i][j], where GE[i][w] = G_parent[i][w] * prod_sibling E_sibling[i][w]
+      const vguard<TreeNodeIndex> rsibs = tree.getSiblings(r);
+      const double* Gp = block.G[rp].data();
+      const vguard<LogProb>& logGp = block.logG[rp];
+      for (size_t w = 0; w < W; ++w) {
+	logG[w] = logGp[w];
+	for (auto rs: rsibs)
+	  logG[w] += block.logE[rs][w];
+      }
+      copy (Gp, Gp + A*W, GE.begin());
+      for (auto rs: rsibs) {
+	const double* Es = block.E[rs].data();
+	for (size_t k = 0; k < A*W; ++k)
+	  GE[k] *= Es[k];
+      }
+      for (size_t cpt = 0; cpt < C; ++cpt)
+	blockMatMul (A, B, W, branchSubMat[cpt][r].data(), 1, A, GE.data() + cpt*B, G + cpt*B);
+    }
+    for (size_t b = 0; b < B; ++b)
+      if (tok[b] != SUMPROD_GAP_TOK && (rp < 0 || block.nodeTok[rp][b] == SUMPROD_GAP_TOK))
+	for (size_t cpt = 0; cpt < C; ++cpt) {
+	  const size_t w = cpt*B + b;
+	  for (AlphTok i = 0; i < A; ++i)
+	    G[i*W+w] = insProb[cpt][i];
+	  logG[w] = 0;
+	}
+  }
+}
+
+void SumProduct::loadBlockColumn (const SumProductBlock& block, size_t b, bool up, bool down) {
+  const size_t A = model.alphabetSize(), B = block.columns, W = block.width();
+  for (int cpt = 0; cpt < components(); ++cpt) {
+    const size_t w = cpt*B + b;
+    for (TreeNodeIndex r = 0; r < tree.nodes(); ++r) {
+      if (up) {
+	logE[cpt][r] = block.logE[r][w];
+	logF[cpt][r] = block.logF[r][w];
+	for (AlphTok i = 0; i < A; ++i) {
+	  E[cpt][r][i] = block.E[r][i*W+w];
+	  F[cpt][r][i] = block.F[r][i*W+w];
+	}
+      }
+      if (down) {
+	logG[cpt][r] = block.logG[r][w];
+	for (AlphTok i = 0; i < A; ++i)
+	  G[cpt][r][i] = block.G[r][i*W+w];
+      }
+    }
+  }
+  if (up) {
+    cptLogLike = block.cptLogLike[b];
+    colLogLike = block.colLogLike[b];
+  }
+}
+
 LogProb SumProduct::computeColumnLogLikelihoodAt (AlignRowIndex node) const {
   LogProb lp = -numeric_limits<double>::infinity();
   for (int cpt = 0; cpt < components(); ++cpt)
@@ -273,6 +488,7 @@ void SumProduct::accumulateRootCounts (vguard<vguard<double> >& rootCounts, doub
 void SumProduct::accumulateSubCounts (vguard<vguard<double> >& rootCounts, vguard<vguard<vguard<double> > >& subCounts, double weight) const {
   LogThisAt(8,"Accumulating substitution counts, column " << join(gappedCol,"") << ", weight " << weight << endl);
   accumulateRootCounts (rootCounts, weight);
+  initEigenSubCounts();
 
   const auto rootNode = columnRoot();
   for (auto node : ungappedRows)
@@ -294,6 +510,7 @@ void SumProduct::accumulateSubCounts (vguard<vguard<double> >& rootCounts, vguar
 void SumProduct::accumulateEigenCounts (vguard<vguard<double> >& rootCounts, vguard<vguard<vguard<gsl_complex> > >& eigenCounts, double weight) const {
   LogThisAt(8,"Accumulating eigencounts, column " << join(gappedCol,"") << ", weight " << weight << endl);
   accumulateRootCounts (rootCounts, weight);
+  initEigenSubCounts();
 
   const auto rootNode = columnRoot();
   const int A = model.alphabetSize();
@@ -374,12 +591,55 @@ void SumProduct::accumulateEigenCounts (vguard<vguard<double> >& rootCounts, vgu
 AlignColSumProduct::AlignColSumProduct (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped)
   : SumProduct (model, tree),
     gapped (gapped),
-    col (0)
+    col (0),
+    blockSize (max ((size_t) 1,
+		    min (max ((size_t) SUMPROD_BLOCK_CHUNK, (size_t) SUMPROD_BLOCK_COLUMNS / model.components()),
+			 (size_t) SUMPROD_BLOCK_MAX_CELLS / (3 * model.components() * tree.nodes() * model.alphabetSize())))),
+    blockStart (0),
+    blockFilledUp (false),
+    blockFilledDown (false)
 {
   Assert (tree.nodes() == gapped.size(), "Number of nodes in tree (%d) does not match number of sequences (%d)", tree.nodes(), gapped.size());
   initAlignColumn();
 }
 
+bool AlignColSumProduct::useBlocks() const {
+  return (blockSize > 1 || components() > 1) && postorder.size() == tree.nodes() && preorder.size() == tree.nodes();
+}
+
+void AlignColSumProduct::initAlignBlock() {
+  if (block.columns == 0 || col < blockStart || col >= blockStart + block.columns) {
+    blockStart = col;
+    initBlock (block, gapped, blockStart, min (blockSize, (size_t) (gapped.front().length() - blockStart)));
+    blockFilledUp = blockFilledDown = false;
+  }
+}
+
+void AlignColSumProduct::fillUp() {
+  if (useBlocks()) {
+    initAlignBlock();
+    if (!blockFilledUp) {
+      SumProduct::fillUp (block);
+      blockFilledUp = true;
+    }
+    loadBlockColumn (block, col - blockStart, true, false);
+  } else
+    SumProduct::fillUp();
+}
+
+void AlignColSumProduct::fillDown() {
+  if (useBlocks()) {
+    initAlignBlock();
+    Assert (blockFilledUp, "Column-batched fillDown called before fillUp");
+    if (!blockFilledDown) {
+      SumProduct::fillDown (block);
+      blockFilledDown = true;
+    }
+    loadBlockColumn (block, col - blockStart, false, true);
+  } else
+    SumProduct::fillDown();
+}
+
 void AlignColSumProduct::initAlignColumn() {
   map<AlignRowIndex,char> seq;
   for (TreeNodeIndex r = 0; r < tree.nodes(); ++r)
@@ -424,3 +684,59 @@ void AlignColSumProduct::appendAncestralPostProbColumn (ReconPostProbMap& rpp, d
     }
   }
 }
+
+AlignColPatterns::AlignColPatterns (const vguard<FastSeq>& g)
+  : gapped (g)
+{
+  const AlignColIndex cols = g.empty() ? 0 : g.front().length();
+  for (auto& fs : gapped) {
+    fs.seq.clear();
+    fs.qual.clear();
+  }
+  map<string,size_t> patternIndex;
+  string colStr (g.size(), Alignment::gapChar);
+  colPattern.reserve (cols);
+  for (AlignColIndex col = 0; col < cols; ++col) {
+    for (AlignRowIndex row = 0; row < g.size(); ++row)
+      colStr[row] = g[row].seq[col];
+    const auto iter = patternIndex.find (colStr);
+    if (iter == patternIndex.end()) {
+      const size_t pattern = patternCount.size();
+      patternIndex[colStr] = pattern;
+      colPattern.push_back (pattern);
+      patternCount.push_back (1);
+      for (AlignRowIndex row = 0; row < g.size(); ++row)
+	gapped[row].seq.push_back (colStr[row]);
+    } else {
+      colPattern.push_back (iter->second);
+      ++patternCount[iter->second];
+    }
+  }
+  LogThisAt(6,"Alignment has " << plural(cols,"column") << " and " << plural(patterns(),"distinct column pattern") << endl);
+}
+
+vguard<FastSeq> AlignColPatterns::expandColumns (const vguard<FastSeq>& patternGapped) const {
+  vguard<FastSeq> out (patternGapped);
+  for (auto& fs : out) {
+    const string patternSeq = fs.seq;
+    fs.seq.clear();
+    fs.seq.reserve (columns());
+    for (auto p : colPattern)
+      fs.seq.push_back (patternSeq[p]);
+  }
+  return out;
+}
+
+AlignColSumProduct::ReconPostProbMap AlignColPatterns::expandColumns (const AlignColSumProduct::ReconPostProbMap& patternPostProb) const {
+  AlignColSumProduct::ReconPostProbMap rpp;
+  for (const auto& row_colProb : patternPostProb) {
+    const auto& patternColProb = row_colProb.second;
+    auto& colProb = rpp[row_colProb.first];
+    for (AlignColIndex col = 0; col < columns(); ++col) {
+      const auto iter = patternColProb.find (colPattern[col]);
+      if (iter != patternColProb.end())
+	colProb[col] = iter->second;
+    }
+  }
+  return rpp;
+}
@@ -29,6 +29,20 @@ struct SumProductStorage {
   SumProductStorage() { }
 };
 
+// Storage for a block of columns filled together, laid out so that each node's messages for all components and columns are contiguous.
+// One pass over the tree then fills every component
+struct SumProductBlock {
+  size_t columns, components;
+  vguard<vguard<double> > E, F, G;  // E[node][state*width() + cpt*columns + col]
+  vguard<vguard<LogProb> > logE, logF, logG;  // logE[node][cpt*columns + col]
+  vguard<vguard<int> > nodeTok;  // nodeTok[node][col] = token, or a negative code for gaps & wildcards
+  vguard<vguard<LogProb> > cptLogLike;  // cptLogLike[col][cpt]
+  vguard<LogProb> colLogLike;  // colLogLike[col]
+
+  SumProductBlock() : columns(0), components(0) { }
+  inline size_t width() const { return components * columns; }
+};
+
 class SumProduct : private SumProductStorage {
 private:
   void assertSingleRoot() const;
@@ -42,12 +56,13 @@ public:
   vguard<LogProb> logCptWeight;  // logCptWeight[cpt]
   vguard<vguard<double> > insProb;  // insProb[cpt][state]
   vguard<vguard<vguard<vguard<double> > > > branchSubProb;  // branchSubProb[cpt][node][parentState][nodeState]
+  vguard<vguard<vguard<double> > > branchSubMat;  // branchSubMat[cpt][node][parentState*alphabetSize + nodeState], contiguous copy of branchSubProb
 
   EigenModel eigen;
-  vguard<vguard<gsl_matrix_complex*> > branchEigenSubCount;
+  mutable vguard<vguard<gsl_matrix_complex*> > branchEigenSubCount;  // empty until needed for counting
   
   SumProduct (const RateModel& model, const Tree& tree);
-  ~SumProduct();
+  virtual ~SumProduct();
 
   void initColumn (const map<AlignRowIndex,char>& seq);
   AlignRowIndex columnRoot() const;
@@ -63,8 +78,14 @@ public:
 
   LogProb computeColumnLogLikelihoodAt (AlignRowIndex row) const;
 
-  void fillUp();  // E, F
-  void fillDown();  // G
+  virtual void fillUp();  // E, F
+  virtual void fillDown();  // G
+
+  // column-batched fill, visiting all nodes; results are identical to initColumn(), fillUp() & fillDown() for each column
+  void initBlock (SumProductBlock& block, const vguard<FastSeq>& gapped, AlignColIndex startCol, size_t columns) const;
+  void fillUp (SumProductBlock& block) const;
+  void fillDown (SumProductBlock& block) const;
+  void loadBlockColumn (const SumProductBlock& block, size_t col, bool up, bool down);  // copy one column's messages into per-column storage
   
   vguard<LogProb> logNodePostProb (AlignRowIndex node) const;  // marginalizes out component
   vguard<vguard<LogProb> > logNodeExcludedPostProb (TreeNodeIndex node, TreeNodeIndex exclude, bool normalize = true) const;
@@ -77,6 +98,7 @@ public:
 private:
   void initColumn();  // populates ungappedRows
   void accumulateRootCounts (vguard<vguard<double> >& rootCounts, double weight = 1) const;
+  void initEigenSubCounts() const;
   
   SumProduct (const SumProduct&) = delete;
   SumProduct& operator= (const SumProduct&) = delete;
@@ -88,17 +110,51 @@ public:
 
   const vguard<FastSeq>& gapped;  // tree node index must match alignment row index
   AlignColIndex col;
-  
+  size_t blockSize;  // number of columns to fill together; 1 to fill column by column
+
   AlignColSumProduct (const RateModel& model, const Tree& tree, const vguard<FastSeq>& gapped);
 
   bool alignmentDone() const;
   void nextColumn();
 
+  void fillUp();
+  void fillDown();
+
   void appendAncestralReconstructedColumn (vguard<FastSeq>& out) const;
   void appendAncestralPostProbColumn (ReconPostProbMap& out, double minProb = .01, double maxProb = 1.) const;
   
 private:
+  SumProductBlock block;
+  AlignColIndex blockStart;
+  bool blockFilledUp, blockFilledDown;
+
   void initAlignColumn();  // populates ungappedRows
+  bool useBlocks() const;  // true if a block holds more than one (component,column) pair and preorder & postorder visit every node
+  void initAlignBlock();
+};
+
+// Distinct columns of a gapped alignment, so that the sum-product algorithm visits each column pattern once
+struct AlignColPatterns {
+  vguard<FastSeq> gapped;  // one column per distinct pattern, in order of first occurrence
+  vguard<size_t> colPattern;  // colPattern[col] = index of the pattern of alignment column #col
+  vguard<size_t> patternCount;  // patternCount[pattern] = number of alignment columns with that pattern
+
+  AlignColPatterns (const vguard<FastSeq>& gapped);
+
+  inline size_t patterns() const { return patternCount.size(); }
+  inline size_t columns() const { return colPattern.size(); }
+
+  // map per-pattern results back to alignment columns
+  vguard<FastSeq> expandColumns (const vguard<FastSeq>& patternGapped) const;
+  AlignColSumProduct::ReconPostProbMap expandColumns (const AlignColSumProduct::ReconPostProbMap& patternPostProb) const;
+  template<class T>
+  vguard<T> expandColumns (const vguard<T>& patternValue) const {
+    vguard<T> v;
+    v.reserve (columns());
+    for (auto p : colPattern)
+      v.push_back (patternValue[p]);
+    return v;
+  }
 };
 
 #endif /* SUMPROD_INCLUDED */
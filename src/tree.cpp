@@ -6,6 +6,11 @@
 #include "knhx.h"
 #include "logger.h"
 
+// relative tolerance within which neighbor-joining treats compensated distances as tied
+#define NJ_TIE_EPSILON 1e-12
+// number of active nodes below which neighbor-joining reverts to exhaustive search
+#define NJ_EXHAUSTIVE_NODES 8
+
 double Tree::minBranchLength = TREE_MIN_BRANCH_LEN;
 
 Tree::Tree (const string& nhx) {
@@ -237,73 +242,154 @@ bool Tree::hasNode (const string& name) const {
   return false;
 }
 
+// compact symmetric distance matrix with triangular storage, indexed by slot
+struct TreeDistanceMatrix {
+  vguard<TreeBranchLength> tri;
+  TreeDistanceMatrix (const vguard<vguard<TreeBranchLength> >& dist)
+    : tri (dist.size() * (dist.size() - 1) / 2)
+  {
+    for (size_t i = 1; i < dist.size(); ++i)
+      for (size_t j = 0; j < i; ++j)
+	tri[i*(i-1)/2 + j] = dist[j][i];
+  }
+  inline TreeBranchLength& operator() (size_t i, size_t j) {
+    return i > j ? tri[i*(i-1)/2 + j] : tri[j*(j-1)/2 + i];
+  }
+};
+
 void Tree::buildByNeighborJoining (const vguard<string>& nodeName, const vguard<vguard<TreeBranchLength> >& distanceMatrix) {
   // check that there are more than 2 nodes
   Assert (nodeName.size() >= 2, "Fewer than 2 nodes; can't make a binary tree");
   // clear the existing tree
   node.clear();
-  // copy distance matrix
-  vguard<vguard<TreeBranchLength> > dist = distanceMatrix;
   // estimate tree by neighbor-joining
-  // algorithm follows description in Durbin et al, pp170-171
-  // first, initialise the list of active nodes
-  set<TreeNodeIndex> activeNodes;
-  for (TreeNodeIndex n = 0; n < (int) nodeName.size(); ++n) {
-    activeNodes.insert (n);
+  // algorithm follows description in Durbin et al, pp170-171,
+  // with the search for the closest pair bounded as in RapidNJ (Simonsen, Mailund & Pedersen, 2008)
+  const TreeNodeIndex nLeaves = nodeName.size(), nNodes = 2*nLeaves - 1;
+  // copy distance matrix into triangular storage.
+  // Each active node occupies a slot; a joined node takes over the slot of its first child
+  TreeDistanceMatrix dist (distanceMatrix);
+  vguard<TreeNodeIndex> nodeSlot (nNodes, -1), slotNode (nLeaves);
+  vguard<TreeNodeIndex> activeSlots;
+  vguard<TreeBranchLength> rowSum (nLeaves, 0), avgDist (nLeaves);
+  for (TreeNodeIndex n = 0; n < nLeaves; ++n) {
     node.push_back (TreeNode());
     node.back().name = nodeName[n];
     node.back().parent = -1;
+    nodeSlot[n] = slotNode[n] = n;
+    activeSlots.push_back (n);
+    for (TreeNodeIndex m = 0; m < nLeaves; ++m)
+      if (m != n)
+	rowSum[n] += dist(n,m);
   }
+  // for each node, list the older nodes that were active when it was created, sorted by increasing distance.
+  // Every active pair then appears exactly once, in the sorted row of its younger member
+  vguard<vguard<TreeNodeIndex> > sortedRow (nNodes);
+  vguard<size_t> sortedRowStart (nNodes, 0);
+  auto sortRow = [&] (TreeNodeIndex n) {
+    vguard<TreeNodeIndex>& row = sortedRow[n];
+    const TreeNodeIndex s = nodeSlot[n];
+    for (auto m : activeSlots)
+      if (slotNode[m] < n)
+	row.push_back (slotNode[m]);
+    sort (row.begin(), row.end(), [&] (TreeNodeIndex a, TreeNodeIndex b) {
+	const TreeBranchLength da = dist(s,nodeSlot[a]), db = dist(s,nodeSlot[b]);
+	return da < db || (da == db && a < b);
+      });
+  };
+  for (TreeNodeIndex n = 1; n < nLeaves; ++n)
+    sortRow (n);
   // main loop
-  vguard<TreeBranchLength> avgDist;
   while (true)
     {
       // get number of active nodes
-      const int nActiveNodes = activeNodes.size();
+      const int nActiveNodes = activeSlots.size();
       // loop exit test
       if (nActiveNodes == 2) break;
       Assert (nActiveNodes > 2, "Fewer than 2 nodes left -- should never get here");
-      // calculate average distances from each node
-      avgDist = vguard<TreeBranchLength> (nodes(), (double) 0);
-      for (auto ni : activeNodes)
-	{
+      TreeBranchLength minDist = numeric_limits<double>::infinity();
+      TreeNodeIndex min_i = -1, min_j = -1;
+      if (nActiveNodes <= NJ_EXHAUSTIVE_NODES) {
+	// for the last few joins, which are near-ties that rounding error can decide,
+	// recompute the average distances & search all pairs exactly as in Durbin et al
+	vguard<TreeNodeIndex> activeNodes;
+	for (auto s : activeSlots)
+	  activeNodes.push_back (slotNode[s]);
+	sort (activeNodes.begin(), activeNodes.end());
+	for (auto ni : activeNodes) {
 	  double a_i = 0;
 	  for (auto nj : activeNodes)
 	    if (nj != ni)
-	      a_i += dist[ni][nj];
-	  avgDist[ni] = a_i / (double) (nActiveNodes - 2);
-	  LogThisAt(7,"Distance correction for node " << ni << " is " << avgDist[ni] << endl);
+	      a_i += dist(nodeSlot[ni],nodeSlot[nj]);
+	  rowSum[nodeSlot[ni]] = a_i;
+	  avgDist[nodeSlot[ni]] = a_i / (double) (nActiveNodes - 2);
 	}
-      // find minimal compensated distance (with avg distances subtracted off)
-      bool isFirstPair = true;
-      TreeBranchLength minDist = 0;
-      TreeNodeIndex min_i = -1, min_j = -1;
-      set<TreeNodeIndex>::const_iterator node_i_p, node_j_p, activeNodes_end_p;
-      activeNodes_end_p = activeNodes.end();
-      for (node_i_p = activeNodes.begin(); node_i_p != activeNodes_end_p; ++node_i_p)
-	for (node_j_p = node_i_p, ++node_j_p; node_j_p != activeNodes_end_p; ++node_j_p)
-	  {
-	    const double compensatedDist = dist [*node_i_p] [*node_j_p] - avgDist [*node_i_p] - avgDist [*node_j_p];
-	    LogThisAt(7,"Compensated distance from node " << *node_i_p << " to node " << *node_j_p << " is " << compensatedDist << endl);
-	    if (isFirstPair || compensatedDist < minDist)
+	for (size_t a = 0; a < activeNodes.size(); ++a)
+	  for (size_t b = a + 1; b < activeNodes.size(); ++b) {
+	    const TreeNodeIndex i = activeNodes[a], j = activeNodes[b];
+	    const double compensatedDist = dist(nodeSlot[i],nodeSlot[j]) - avgDist[nodeSlot[i]] - avgDist[nodeSlot[j]];
+	    if (min_i < 0 || compensatedDist < minDist)
+	      {
+		min_i = i;
+		min_j = j;
+		minDist = compensatedDist;
+	      }
+	  }
+      } else {
+	// calculate average distances from each node
+	TreeBranchLength maxAvgDist = -numeric_limits<double>::infinity();
+	for (auto s : activeSlots) {
+	  avgDist[s] = rowSum[s] / (double) (nActiveNodes - 2);
+	  maxAvgDist = max (maxAvgDist, avgDist[s]);
+	}
+	// find minimal compensated distance (with avg distances subtracted off).
+	// Each sorted row is scanned only until the compensated distance is bounded below by the best so far.
+	// Ties (to within rounding error) are resolved in favor of the lexicographically earliest pair, as in the exhaustive search
+	for (auto s_j : activeSlots) {
+	  const TreeNodeIndex j = slotNode[s_j];
+	  const vguard<TreeNodeIndex>& row = sortedRow[j];
+	  size_t& start = sortedRowStart[j];
+	  while (start < row.size() && nodeSlot[row[start]] < 0)
+	    ++start;
+	  for (size_t r = start; r < row.size(); ++r) {
+	    const TreeNodeIndex i = row[r], s_i = nodeSlot[i];
+	    if (s_i < 0)
+	      continue;
+	    const TreeBranchLength d = dist(s_i,s_j);
+	    const TreeBranchLength bound = d - avgDist[s_j] - maxAvgDist;
+	    if (bound - minDist > NJ_TIE_EPSILON * (abs(d) + abs(avgDist[s_j]) + abs(maxAvgDist)))
+	      break;
+	    const TreeBranchLength compensatedDist = d - avgDist[s_i] - avgDist[s_j];
+	    const TreeBranchLength tieTolerance = NJ_TIE_EPSILON * (abs(d) + abs(avgDist[s_i]) + abs(avgDist[s_j]));
+	    if (compensatedDist < minDist - tieTolerance
+		|| (compensatedDist <= minDist + tieTolerance && (i < min_i || (i == min_i && j < min_j))))
 	      {
-		min_i = *node_i_p;
-		min_j = *node_j_p;
+		min_i = i;
+		min_j = j;
 		minDist = compensatedDist;
-		isFirstPair = false;
 	      }
 	  }
+	}
+      }
+      Assert (min_i >= 0, "Neighbor-joining failed to find a pair of nodes to join");
       // nodes min_i and min_j are neighbors -- join them with new index k
       // first, calculate new distances as per NJ algorithm
       const TreeNodeIndex k = nodes();
-      dist.push_back (vguard<TreeBranchLength> (k + 1));
-      dist[k][k] = 0;
-      const TreeBranchLength d_ij = dist[min_i][min_j];
-      for (TreeNodeIndex m = 0; m < k; ++m)
-	dist[m].push_back (dist[k][m] = 0.5 * (dist[min_i][m] + dist[min_j][m] - d_ij));
-      TreeBranchLength d_ik = 0.5 * (d_ij + avgDist[min_i] - avgDist[min_j]);
+      const TreeNodeIndex s_i = nodeSlot[min_i], s_j = nodeSlot[min_j], s_k = s_i;
+      const TreeBranchLength d_ij = dist(s_i,s_j);
+      TreeBranchLength d_ik = 0.5 * (d_ij + avgDist[s_i] - avgDist[s_j]);
       TreeBranchLength d_jk = d_ij - d_ik;
-      LogThisAt(8,"Before Kuhner-Felsenstein:\ni=" << min_i << ", j=" << min_j << ", k=" << k << ", d_ij=" << d_ij << ", d_ik=" << d_ik << ", d_jk=" << d_jk << "\nDistances from k to other nodes: " << to_string_join(dist[k]) << endl);
+      TreeBranchLength rowSum_k = 0;
+      for (auto s_m : activeSlots)
+	if (s_m != s_i && s_m != s_j) {
+	  const TreeBranchLength d_im = dist(s_i,s_m), d_jm = dist(s_j,s_m);
+	  const TreeBranchLength d_km = 0.5 * (d_im + d_jm - d_ij);
+	  rowSum[s_m] += d_km - d_im - d_jm;
+	  rowSum_k += d_km;
+	  dist(s_k,s_m) = d_km;
+	}
+      rowSum[s_k] = rowSum_k;
+      LogThisAt(8,"Before Kuhner-Felsenstein:\ni=" << min_i << ", j=" << min_j << ", k=" << k << ", d_ij=" << d_ij << ", d_ik=" << d_ik << ", d_jk=" << d_jk << endl);
       // apply Kuhner-Felsenstein correction to prevent negative branch lengths
       // also enforce minimum branch lengths here
       if (d_ik < minBranchLength)
@@ -316,8 +402,6 @@ void Tree::buildByNeighborJoining (const vguard<string>& nodeName, const vguard<
 	  d_ik -= d_jk - minBranchLength;
 	  d_jk = minBranchLength;
 	}
-      dist[min_i][k] = dist[k][min_i] = d_ik;
-      dist[min_j][k] = dist[k][min_j] = d_jk;
       // now update the Tree
       node.push_back (TreeNode());
       node[k].child.push_back (min_i);
@@ -327,15 +411,19 @@ void Tree::buildByNeighborJoining (const vguard<string>& nodeName, const vguard<
       node[min_j].parent = k;
       node[min_j].d = max (0., d_jk);
       LogThisAt(7,"Joining nodes " << min_i << " and " << min_j << " to common ancestor " << k << " (branch lengths: " << k << "->" << min_i << " = " << d_ik << ", " << k << "->" << min_j << " = " << d_jk << ")" << endl);
-      activeNodes.erase (min_i);
-      activeNodes.erase (min_j);
-      activeNodes.insert (k);
+      // update the active slots
+      nodeSlot[min_i] = nodeSlot[min_j] = -1;
+      nodeSlot[k] = s_k;
+      slotNode[s_k] = k;
+      activeSlots.erase (find (activeSlots.begin(), activeSlots.end(), s_j));
+      vguard<TreeNodeIndex>().swap (sortedRow[min_i]);
+      vguard<TreeNodeIndex>().swap (sortedRow[min_j]);
+      sortRow (k);
     }
   // make the root node
-  set<TreeNodeIndex>::iterator iter = activeNodes.begin();
-  const TreeNodeIndex i = *iter;
-  const TreeNodeIndex j = *++iter;
-  const double d = max (dist[i][j], 0.);  // don't correct the last node, just keep branch length non-negative
+  const TreeNodeIndex i = min (slotNode[activeSlots[0]], slotNode[activeSlots[1]]);
+  const TreeNodeIndex j = max (slotNode[activeSlots[0]], slotNode[activeSlots[1]]);
+  const double d = max (dist(nodeSlot[i],nodeSlot[j]), 0.);  // don't correct the last node, just keep branch length non-negative
   const TreeNodeIndex k = node.size();
   node.push_back (TreeNode());
   node[k].parent = -1;
@@ -364,58 +452,79 @@ void Tree::buildByUPGMA (const vguard<string>& nodeName, const vguard<vguard<Tre
   Assert (nodeName.size() >= 2, "Fewer than 2 nodes; can't make a binary tree");
   // clear the existing tree
   node.clear();
-  // copy distance matrix
-  vguard<vguard<TreeBranchLength> > dist = distanceMatrix;
   // estimate tree by UPGMA
-  // first, initialise the list of active nodes
-  set<TreeNodeIndex> activeNodes;
-  for (TreeNodeIndex n = 0; n < (int) nodeName.size(); ++n) {
-    activeNodes.insert (n);
+  const TreeNodeIndex nLeaves = nodeName.size(), nNodes = 2*nLeaves - 1;
+  // copy distance matrix into triangular storage.
+  // Each active node occupies a slot; a joined node takes over the slot of its first child
+  TreeDistanceMatrix dist (distanceMatrix);
+  vguard<TreeNodeIndex> nodeSlot (nNodes, -1), slotNode (nLeaves);
+  vguard<TreeNodeIndex> activeSlots;
+  for (TreeNodeIndex n = 0; n < nLeaves; ++n) {
     node.push_back (TreeNode());
     node.back().name = nodeName[n];
     node.back().parent = -1;
+    nodeSlot[n] = slotNode[n] = n;
+    activeSlots.push_back (n);
   }
+  // for each active node, cache the closest of the older active nodes.
+  // Ties are resolved in favor of the lexicographically earliest pair, as in an exhaustive search
+  vguard<TreeNodeIndex> rowMinNode (nNodes, -1);
+  vguard<TreeBranchLength> rowMinDist (nNodes);
+  auto scanRow = [&] (TreeNodeIndex j) {
+    const TreeNodeIndex s_j = nodeSlot[j];
+    rowMinNode[j] = -1;
+    for (auto s_i : activeSlots) {
+      const TreeNodeIndex i = slotNode[s_i];
+      if (i < j) {
+	const TreeBranchLength d = dist(s_i,s_j);
+	if (rowMinNode[j] < 0 || d < rowMinDist[j] || (d == rowMinDist[j] && i < rowMinNode[j])) {
+	  rowMinNode[j] = i;
+	  rowMinDist[j] = d;
+	}
+      }
+    }
+  };
+  for (TreeNodeIndex n = 1; n < nLeaves; ++n)
+    scanRow (n);
   // main loop
   vguard<TreeBranchLength> nodeHeight (nodeName.size(), 0);
   while (true)
     {
       // get number of active nodes
-      const int nActiveNodes = activeNodes.size();
+      const int nActiveNodes = activeSlots.size();
       // loop exit test
       if (nActiveNodes == 2) break;
       Assert (nActiveNodes > 2, "Fewer than 2 nodes left -- should never get here");
-      // find closest two nodes
+      // find closest two nodes, using the cached row minima
       bool isFirstPair = true;
       TreeBranchLength minDist = 0;
       TreeNodeIndex min_i = -1, min_j = -1;
-      set<TreeNodeIndex>::const_iterator node_i_p, node_j_p, activeNodes_end_p;
-      activeNodes_end_p = activeNodes.end();
-      for (node_i_p = activeNodes.begin(); node_i_p != activeNodes_end_p; ++node_i_p)
-	for (node_j_p = node_i_p, ++node_j_p; node_j_p != activeNodes_end_p; ++node_j_p) {
-	  const TreeBranchLength d = dist [*node_i_p] [*node_j_p];
-	  if (isFirstPair || d < minDist)
+      for (auto s : activeSlots) {
+	const TreeNodeIndex j = slotNode[s], i = rowMinNode[j];
+	if (i >= 0) {
+	  const TreeBranchLength d = rowMinDist[j];
+	  if (isFirstPair || d < minDist || (d == minDist && (i < min_i || (i == min_i && j < min_j))))
 	    {
-	      min_i = *node_i_p;
-	      min_j = *node_j_p;
+	      min_i = i;
+	      min_j = j;
 	      minDist = d;
 	      isFirstPair = false;
 	    }
 	}
+      }
       // nodes min_i and min_j are neighbors -- join them with new index k
       // first, calculate new distances
       const TreeNodeIndex k = nodes();
-      dist.push_back (vguard<TreeBranchLength> (k + 1));
-      dist[k][k] = 0;
-      const TreeBranchLength d_ij = dist[min_i][min_j];
+      const TreeNodeIndex s_i = nodeSlot[min_i], s_j = nodeSlot[min_j], s_k = s_i;
+      const TreeBranchLength d_ij = dist(s_i,s_j);
       nodeHeight.push_back (max (nodeHeight[min_i] + minBranchLength,
 				 max (nodeHeight[min_j] + minBranchLength,
 				      (nodeHeight[min_i] + nodeHeight[min_j] + d_ij) / 2)));
       const TreeBranchLength d_ik = nodeHeight[k] - nodeHeight[min_i];
       const TreeBranchLength d_jk = nodeHeight[k] - nodeHeight[min_j];
-      for (TreeNodeIndex m = 0; m < k; ++m)
-	dist[m].push_back (dist[k][m] = (dist[min_i][m] + dist[min_j][m]) / 2);
-      dist[min_i][k] = dist[k][min_i] = d_ik;
-      dist[min_j][k] = dist[k][min_j] = d_jk;
+      for (auto s_m : activeSlots)
+	if (s_m != s_i && s_m != s_j)
+	  dist(s_k,s_m) = (dist(s_i,s_m) + dist(s_j,s_m)) / 2;
       // now update the Tree
       node.push_back (TreeNode());
       node[k].child.push_back (min_i);
@@ -425,18 +534,25 @@ void Tree::buildByUPGMA (const vguard<string>& nodeName, const vguard<vguard<Tre
       node[min_j].parent = k;
       node[min_j].d = max (0., d_jk);
       LogThisAt(7,"Joining nodes " << min_i << " and " << min_j << " to common ancestor " << k << " (branch lengths: " << k << "->" << min_i << " = " << d_ik << ", " << k << "->" << min_j << " = " << d_jk << ")" << endl);
-      activeNodes.erase (min_i);
-      activeNodes.erase (min_j);
-      activeNodes.insert (k);
+      // update the active slots, and rescan any rows whose closest node was just joined
+      nodeSlot[min_i] = nodeSlot[min_j] = -1;
+      nodeSlot[k] = s_k;
+      slotNode[s_k] = k;
+      activeSlots.erase (find (activeSlots.begin(), activeSlots.end(), s_j));
+      for (auto s : activeSlots) {
+	const TreeNodeIndex n = slotNode[s];
+	if (n != k && (rowMinNode[n] == min_i || rowMinNode[n] == min_j))
+	  scanRow (n);
+      }
+      scanRow (k);
     }
   // make the root node
-  set<TreeNodeIndex>::iterator iter = activeNodes.begin();
-  const TreeNodeIndex i = *iter;
-  const TreeNodeIndex j = *++iter;
+  const TreeNodeIndex i = min (slotNode[activeSlots[0]], slotNode[activeSlots[1]]);
+  const TreeNodeIndex j = max (slotNode[activeSlots[0]], slotNode[activeSlots[1]]);
   const TreeNodeIndex k = node.size();
   nodeHeight.push_back (max (nodeHeight[i] + minBranchLength,
 			     max (nodeHeight[j] + minBranchLength,
-				  (nodeHeight[i] + nodeHeight[j] + dist[i][j]) / 2)));
+				  (nodeHeight[i] + nodeHeight[j] + dist(nodeSlot[i],nodeSlot[j])) / 2)));
   node.push_back (TreeNode());
   node[k].parent = -1;
   node[k].child.push_back (i);
@@ -723,6 +839,51 @@ void Tree::setParent (TreeNodeIndex n, TreeNodeIndex p, TreeBranchLength d) {
     node[p].child.push_back (n);
 }
 
+Tree Tree::addLeafCopies (const map<string,vguard<string> >& copies) const {
+  Tree t (*this);
+  // K copies need a subtree of height (K+1)*minBranchLength; if a leaf's branch is shorter than that,
+  // lengthen every leaf's branch by the shortfall, so the tree stays ultrametric
+  TreeBranchLength shortfall = 0;
+  for (TreeNodeIndex n = 0; n + 1 < nodes(); ++n)
+    if (isLeaf(n) && copies.count (nodeName(n)))
+      shortfall = max (shortfall, (copies.at(nodeName(n)).size() + 1) * minBranchLength - branchLength(n));
+  if (shortfall > 0)
+    for (TreeNodeIndex n = 0; n + 1 < nodes(); ++n)
+      if (isLeaf(n))
+	t.node[n].d += shortfall;
+  vguard<TreeNodeIndex> newOrder;
+  for (TreeNodeIndex n = 0; n < nodes(); ++n) {
+    newOrder.push_back (n);
+    if (isLeaf(n) && copies.count (nodeName(n))) {
+      const vguard<string>& names = copies.at (nodeName(n));
+      const TreeNodeIndex parent = parentNode(n);
+      const TreeBranchLength d = t.node[n].d;
+      TreeNodeIndex top = n;
+      for (size_t k = 1; k <= names.size(); ++k) {
+	const TreeNodeIndex c = t.node.size(), j = c + 1;
+	TreeNode copy, join;
+	copy.name = names[k-1];
+	copy.parent = j;
+	copy.d = k * minBranchLength;
+	join.child.push_back (top);
+	join.child.push_back (c);
+	t.node.push_back (copy);
+	t.node.push_back (join);
+	t.node[top].parent = j;
+	t.node[top].d = minBranchLength;
+	newOrder.push_back (c);
+	newOrder.push_back (j);
+	top = j;
+      }
+      t.node[top].parent = parent;
+      t.node[top].d = max (d - names.size() * minBranchLength, minBranchLength);  // clamp only guards against rounding
+      if (parent >= 0)
+	replace (t.node[parent].child.begin(), t.node[parent].child.end(), n, top);
+    }
+  }
+  return t.reorderNodes (newOrder);
+}
+
 bool Tree::hasChildren() const {
   return nodes() > 1;
 }
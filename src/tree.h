@@ -72,6 +72,7 @@ struct Tree {
   Tree reorderNodes (const vguard<TreeNodeIndex>& newOrder) const;
   void detach (TreeNodeIndex node);
   void setParent (TreeNodeIndex node, TreeNodeIndex parent, TreeBranchLength branchLength);  // WARNING! does not check for cycles, may leave tree in a non-preorder-sorted state
+  Tree addLeafCopies (const map<string,vguard<string> >& copies) const;  // joins each named leaf to its copies by an ultrametric subtree of minimal-length branches; leaf branches are lengthened if needed to fit it
 
   vguard<TreeBranchLength> distanceFrom (TreeNodeIndex node) const;
   vguard<TreeBranchLength> distanceFromRoot() const;
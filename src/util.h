@@ -138,7 +138,7 @@ std::string quoted_escaped (std::string const& s);
 /* random_double */
 template<class Generator>
 double random_double (Generator& generator) {
-  return generator() / (((double) std::numeric_limits<typename Generator::result_type>::max()) + 1);
+  return (generator() - generator.min()) / (((double) generator.max() - generator.min()) + 1);
 }
 
 /* extract_keys */
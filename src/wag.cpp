@@ -5,6 +5,7 @@ RateModel wagModel() {
   RateModel m;
   ParsedJson pj (wagModelText);
   m.read (pj.value);
+  EigenModel::addPrecomputedEigenSystem (m, wagModelEigenHash, wagModelEigen, wagModelEigenSize);
   return m;
 }
 
@@ -462,3 +463,418 @@ const char* wagModelText =
 "  }\n"
 "}\n"
 ;
+
+const EigenSystemHash wagModelEigenHash = 0x4ba29b3cc4a7fc41ULL;
+const size_t wagModelEigenSize = 1640;
+const double wagModelEigen[] = {
+  -1.1102230246251565e-15, 0.0, -1.7791695407992085, 0.0,
+  -1.7075342548435486, 0.0, -1.6655486317312089, 0.0,
+  -1.5483111871701611, 0.0, -1.4070264931532874, 0.0,
+  -1.3890446164301025, 0.0, -1.2762113612487413, 0.0,
+  -1.2188397247689566, 0.0, -0.35122707074250725, 0.0,
+  -1.0712190618081467, 0.0, -1.0050214079557278, 0.0,
+  -0.93428366563267606, 0.0, -0.85502559203244666, 0.0,
+  -0.79074063942384598, 0.0, -0.6296728988981326, 0.0,
+  -0.45515856739463006, 0.0, -0.48893257594445422, 0.0,
+  -0.55037844703306871, 0.0, -0.5549978746737374, 0.0,
+  0.22360679774997916, 0.0, 0.14051444444144848, 0.0,
+  -0.20102671976398506, 0.0, 0.034992915708924058, 0.0,
+  0.079098260139367937, 0.0, -0.1459859199988357, 0.0,
+  0.058596002853855682, 0.0, 0.41486543706361656, 0.0,
+  0.37766715812366569, 0.0, 0.083938633343605698, 0.0,
+  -0.02653336651864158, 0.0, 0.18012749083533308, 0.0,
+  0.10879029361018258, 0.0, -0.26833125633628907, 0.0,
+  -0.080249486838136028, 0.0, 0.053445105356487096, 0.0,
+  0.022612699255295351, 0.0, -0.015939169851691751, 0.0,
+  -0.032655694194645611, 0.0, -0.0015437750928693678, 0.0,
+  0.22360679774997866, 0.0, 0.11148709621158923, 0.0,
+  0.040709002100636729, 0.0, 0.01044937612967332, 0.0,
+  -0.043967969780953846, 0.0, 0.16175013842657965, 0.0,
+  -0.22293244775780224, 0.0, 0.51786518382843283, 0.0,
+  -0.31577226756359134, 0.0, 0.099754058261289635, 0.0,
+  -0.099884642208602006, 0.0, -0.24858620579865096, 0.0,
+  0.087439656231784568, 0.0, 0.013449336295972671, 0.0,
+  0.65964559904633702, 0.0, -0.16868485290877838, 0.0,
+  -0.03440333311465095, 0.0, 0.030609935195265083, 0.0,
+  0.02455724396011227, 0.0, -0.20914117948940392, 0.0,
+  0.22360679774997941, 0.0, 0.72060076719581445, 0.0,
+  0.092640189358825356, 0.0, -0.18049606281699679, 0.0,
+  -0.44839559704062171, 0.0, -0.224720296309634, 0.0,
+  0.25207935402582804, 0.0, -0.10831910496822129, 0.0,
+  -0.40821330836064978, 0.0, 0.13228876980278115, 0.0,
+  0.068978190133994241, 0.0, 0.14138119240969108, 0.0,
+  -0.044628180891372535, 0.0, -0.0085098547752739413, 0.0,
+  -0.12943661339109355, 0.0, -0.13380737697855596, 0.0,
+  -0.027794702892245261, 0.0, 0.029126762790536581, 0.0,
+  0.062474197062603092, 0.0, -0.069994914389812091, 0.0,
+  0.22360679774997894, 0.0, -0.28221433366437498, 0.0,
+  -0.26876067719550051, 0.0, -0.10909916409490779, 0.0,
+  0.15162839648794141, 0.0, -0.050328443141871994, 0.0,
+  -0.035436981717217854, 0.0, 0.2325966294420358, 0.0,
+  -0.31844002336113192, 0.0, 0.19450412382237156, 0.0,
+  -0.042919148902529701, 0.0, -0.12953373738800764, 0.0,
+  -0.023404384459019534, 0.0, 0.33268813502185479, 0.0,
+  -0.50794370803934141, 0.0, -0.21599930831792366, 0.0,
+  -0.037768177963270207, 0.0, 0.049647271303867244, 0.0,
+  0.067927776741577739, 0.0, -0.10977500649968253, 0.0,
+  0.22360679774997883, 0.0, 0.021094096707165999, 0.0,
+  -0.024737078274315302, 0.0, 0.0092483658413535178, 0.0,
+  0.019336044455457668, 0.0, 0.0033474577798263527, 0.0,
+  -0.0048325888508509484, 0.0, -0.053667778053676077, 0.0,
+  -0.0088292049504285382, 0.0, -0.087081062647157398, 0.0,
+  0.0041861019232993435, 0.0, -0.059067698681814225, 0.0,
+  -0.027886635172172203, 0.0, 0.18341467694657043, 0.0,
+  0.0060212193465203137, 0.0, -0.048261303001098217, 0.0,
+  0.053025610442159643, 0.0, -0.98096169224848018, 0.0,
+  0.19255363347080118, 0.0, -0.15357386768249592, 0.0,
+  0.2236067977499793, 0.0, -0.16984722607735675, 0.0,
+  -0.52284727146814236, 0.0, -0.36678515935642864, 0.0,
+  -0.59225876819756051, 0.0, 0.18934675738201309, 0.0,
+  -0.12230171391403206, 0.0, -0.32408296195467862, 0.0,
+  0.47928958296319535, 0.0, 0.10471816315592659, 0.0,
+  0.06151012300992411, 0.0, -0.044589821999511857, 0.0,
+  -0.029428256342245614, 0.0, 0.12822937466291107, 0.0,
+  0.14373656920555974, 0.0, -0.15037787523808388, 0.0,
+  -0.0071927236960361799, 0.0, 0.047009210821520611, 0.0,
+  0.040095973270254014, 0.0, -0.17986417130116347, 0.0,
+  0.22360679774997888, 0.0, 0.25674749515460182, 0.0,
+  0.45660375788266488, 0.0, 0.28566574302148862, 0.0,
+  0.069259144534969785, 0.0, 0.20141466845920244, 0.0,
+  -0.12910220082923476, 0.0, -0.12308344391878502, 0.0,
+  0.37885063485576453, 0.0, 0.15936492264187416, 0.0,
+  -0.057804355285467769, 0.0, -0.16688401729928945, 0.0,
+  0.034775955533847866, 0.0, 0.2148369521412552, 0.0,
+  -0.24204790532602266, 0.0, -0.17996544975158488, 0.0,
+  -0.016166388812084202, 0.0, 0.047189152682194639, 0.0,
+  0.040334149480035573, 0.0, -0.15012991594304828, 0.0,
+  0.22360679774997894, 0.0, 0.001520146264271175, 0.0,
+  -0.0076244949257561166, 0.0, -0.009655322132809124, 0.0,
+  0.028400058849933747, 0.0, 0.024839505040463793, 0.0,
+  -0.014249649426654349, 0.0, -0.071701991942865403, 0.0,
+  -0.013870255135299398, 0.0, 0.27989965119203519, 0.0,
+  0.0087928610650229392, 0.0, -0.073339747966176524, 0.0,
+  -0.047820771620889553, 0.0, 0.099815777342368767, 0.0,
+  0.099686484316268781, 0.0, 0.11834965945289125, 0.0,
+  -0.096151737183114885, 0.0, -0.036257435706790159, 0.0,
+  -0.083262948942426224, 0.0, 0.64990778294433316, 0.0,
+  0.22360679774997883, 0.0, -0.085273364137044338, 0.0,
+  0.085028229211880621, 0.0, 0.11555778461455445, 0.0,
+  0.27267732200235217, 0.0, -0.011442032875169211, 0.0,
+  -0.018298589405311774, 0.0, 0.1263257394988784, 0.0,
+  0.082546247941170686, 0.0, 0.018994855396710496, 0.0,
+  0.78154031040831196, 0.0, 0.32858071450553517, 0.0,
+  -0.63956735715144675, 0.0, 0.013816538338802255, 0.0,
+  0.21210019145179368, 0.0, -0.12812074965215642, 0.0,
+  -0.06366127971279413, 0.0, 0.060994430506446769, 0.0,
+  0.20563680241383309, 0.0, -0.1295745244768215, 0.0,
+  0.22360679774997919, 0.0, 0.06182284332648709, 0.0,
+  -0.37411664479630147, 0.0, 0.66580048936505742, 0.0,
+  -0.13892485685718278, 0.0, 0.0050432355864959387, 0.0,
+  -0.0070863431045931694, 0.0, -0.11987516678843045, 0.0,
+  -0.15531018233553476, 0.0, -0.22659652305990199, 0.0,
+  0.069409276335343981, 0.0, -0.36600882782848826, 0.0,
+  -0.11119271732015652, 0.0, -0.19046224204857592, 0.0,
+  -0.072959946122413452, 0.0, -0.042561625231977276, 0.0,
+  0.1651364672313167, 0.0, 0.01875185071534086, 0.0,
+  -0.16961006637752715, 0.0, 0.062407050403816937, 0.0,
+  0.22360679774997883, 0.0, 0.006456833505900616, 0.0,
+  0.020499299019502183, 0.0, -0.030396033051498617, 0.0,
+  0.036328437120849835, 0.0, 0.10091142212448269, 0.0,
+  0.11966975348291421, 0.0, 0.063235461712582375, 0.0,
+  0.0080618027475456138, 0.0, -0.27709128301089153, 0.0,
+  -0.1234151073275276, 0.0, 0.35682510026229269, 0.0,
+  -0.055088773129113644, 0.0, 0.43696547307159139, 0.0,
+  0.08745841070976855, 0.0, -0.020818269091175689, 0.0,
+  0.14371554883806137, 0.0, 0.036438414064000398, 0.0,
+  -0.12961448642555873, 0.0, 0.074574507007129281, 0.0,
+  0.22360679774997866, 0.0, -0.17004976522580403, 0.0,
+  -0.010984763649784365, 0.0, 0.048976760717906617, 0.0,
+  0.29092846063303057, 0.0, -0.25154971448756863, 0.0,
+  0.31710795145024928, 0.0, -0.36103466497924902, 0.0,
+  0.065882288405265346, 0.0, 0.12476916130975479, 0.0,
+  -0.085140429326794692, 0.0, -0.13990837964778852, 0.0,
+  0.10724402713291806, 0.0, 0.0055167983510234402, 0.0,
+  0.32267873774474498, 0.0, -0.17561784046147164, 0.0,
+  -0.01066533730921241, 0.0, 0.041974471553267098, 0.0,
+  0.02950104804587372, 0.0, -0.19452394566440612, 0.0,
+  0.22360679774997919, 0.0, -0.0023464804135172983, 0.0,
+  0.18377542983545034, 0.0, -0.13490247128885133, 0.0,
+  0.010102346813231671, 0.0, -0.81918748895947435, 0.0,
+  -0.83574898827523958, 0.0, -0.27703272660845701, 0.0,
+  0.024056033956620333, 0.0, -0.1896728430572632, 0.0,
+  -0.073709071259587991, 0.0, 0.14944731830343616, 0.0,
+  -0.039507779777371119, 0.0, 0.12721267945135112, 0.0,
+  0.063479341496401082, 0.0, -0.050265697095991706, 0.0,
+  0.12437711859874191, 0.0, 0.026871083665851045, 0.0,
+  -0.12072872825761191, 0.0, 0.034385236193536693, 0.0,
+  0.22360679774997924, 0.0, 0.012630832721719028, 0.0,
+  -0.0058220332923381614, 0.0, -0.012217462097753259, 0.0,
+  0.0042025597350084437, 0.0, -0.0072342138971793592, 0.0,
+  -0.0095508394728487881, 0.0, -0.0016561367326629148, 0.0,
+  -0.013134867024938069, 0.0, -0.43699294168616953, 0.0,
+  0.32519387917103182, 0.0, -0.14538977041217116, 0.0,
+  0.56684742644814512, 0.0, 0.16912341606168835, 0.0,
+  -0.029016544088115489, 0.0, 0.10893313329490667, 0.0,
+  -0.076920881059463972, 0.0, 0.076103769312438188, 0.0,
+  0.36651751828814327, 0.0, 0.24663365457773245, 0.0,
+  0.22360679774997905, 0.0, 0.027147273649090971, 0.0,
+  -0.0068258564598817325, 0.0, -0.012448807269871649, 0.0,
+  0.018757993348384371, 0.0, -0.0058438054333316029, 0.0,
+  -0.0022373967813643231, 0.0, -0.053213790422494731, 0.0,
+  -0.062355388764949511, 0.0, 0.12638849458143095, 0.0,
+  0.0039351876947221242, 0.0, -0.14799896959024611, 0.0,
+  -0.066295790406115274, 0.0, 0.2014523590667763, 0.0,
+  -0.0020278300457898025, 0.0, 0.87301331242159508, 0.0,
+  0.024148225352256993, 0.0, 0.038777913931336901, 0.0,
+  0.0049357583807783153, 0.0, -0.39985962288030169, 0.0,
+  0.22360679774997858, 0.0, -0.45803779388354271, 0.0,
+  0.33410674426759485, 0.0, 0.21548359261150926, 0.0,
+  -0.35820323979652191, 0.0, -0.0053577486911869079, 0.0,
+  0.035917874277510836, 0.0, 0.036638356675423665, 0.0,
+  -0.12688311736646696, 0.0, 0.094696785744497872, 0.0,
+  -0.010279174042552736, 0.0, 0.30172958771432629, 0.0,
+  0.098357100585510199, 0.0, -0.23474429902333865, 0.0,
+  -0.047461691304197966, 0.0, 0.032324654721589685, 0.0,
+  -0.0060456273838411217, 0.0, -0.013205077552080306, 0.0,
+  0.011619670395473555, 0.0, -0.033690966610586709, 0.0,
+  0.2236067977499788, 0.0, 0.120465102494108, 0.0,
+  -0.14994665403401092, 0.0, -0.12543268354867615, 0.0,
+  0.3192361288803171, 0.0, 0.27460148106699589, 0.0,
+  -0.16996386863691709, 0.0, -0.33653375642259736, 0.0,
+  -0.23840494252636088, 0.0, 0.051327452708899803, 0.0,
+  -0.0026967996997989568, 0.0, 0.35261466117012502, 0.0,
+  0.13235026006476086, 0.0, -0.40535497728822523, 0.0,
+  -0.06042614980043727, 0.0, -0.0047836113690796107, 0.0,
+  0.037525810012633019, 0.0, 0.00028404759598241576, 0.0,
+  -0.026140591812826963, 0.0, -0.07706622312786976, 0.0,
+  0.22360679774997871, 0.0, 0.0081682163718493211, 0.0,
+  -0.01162530586957305, 0.0, 0.0020348710717656439, 0.0,
+  0.0087743576597388, 0.0, -0.009990709065154162, 0.0,
+  0.012096064619804888, 0.0, -0.027323584980384088, 0.0,
+  0.016430072153862836, 0.0, -0.51752535991986903, 0.0,
+  0.048866740595014772, 0.0, 0.015048206862888035, 0.0,
+  0.012948465327731647, 0.0, 0.0035012269571797453, 0.0,
+  -0.098631183932990044, 0.0, -0.022995861207030569, 0.0,
+  -0.92397729123194106, 0.0, -0.083770537728929381, 0.0,
+  -0.67160039741457811, 0.0, -0.3463536486136618, 0.0,
+  0.22360679774997913, 0.0, -0.0025988595563356657, 0.0,
+  -0.019730213742971979, 0.0, -0.011977308758588464, 0.0,
+  0.0052929767211657899, 0.0, 0.015050802192149057, 0.0,
+  -0.0023023013613370415, 0.0, -0.026531601614700175, 0.0,
+  0.043997754532186101, 0.0, -0.33385966725182631, 0.0,
+  -0.4663789303652936, 0.0, -0.047271204584603661, 0.0,
+  -0.41902313575920919, 0.0, -0.30894869505824879, 0.0,
+  -0.030432680698335428, 0.0, 0.06675442895695699, 0.0,
+  -0.18435045632470126, 0.0, 0.071260212468490278, 0.0,
+  0.47844730617332781, 0.0, 0.15358059433069002, 0.0,
+  0.22360679774997924, 0.0, -0.091450076823076668, 0.0,
+  0.27994038683022732, 0.0, -0.44394395842207973, 0.0,
+  0.024551206359724253, 0.0, 0.043728667339925142, 0.0,
+  0.077788038192850281, 0.0, 0.073245942289845697, 0.0,
+  0.031218332002464867, 0.0, -0.16588585425621699, 0.0,
+  0.078654059713584842, 0.0, -0.3977984674257426, 0.0,
+  -0.081747274138768367, 0.0, -0.28840570158287882, 0.0,
+  -0.10455592173643233, 0.0, -0.026316843492775573, 0.0,
+  0.14321986178374743, 0.0, -0.0030857282879796022, 0.0,
+  -0.15534718364110506, 0.0, 0.042977878110162827, 0.0,
+  0.38741178503728735, 0.0, 0.19664878187811929, 0.0,
+  0.17481312868067295, 0.0, 0.25511346827789383, 0.0,
+  0.086347115226651075, 0.0, 0.16425307299412717, 0.0,
+  0.25964732016245706, 0.0, 0.37231340532977553, 0.0,
+  0.10926010608339094, 0.0, 0.21674656286966693, 0.0,
+  0.38553840709840081, 0.0, 0.27740036003832275, 0.0,
+  0.087218734611443444, 0.0, 0.17187269899621813, 0.0,
+  0.20465882538812344, 0.0, 0.31089353119541846, 0.0,
+  0.2728571166673141, 0.0, 0.064335707068598286, 0.0,
+  0.1577510338789489, 0.0, 0.31705479351674787, 0.0,
+  0.24219966728250597, -0.0, 0.097542887665312758, -0.0,
+  0.56046501628439271, -0.0, -0.3203260059048999, -0.0,
+  0.0081037961766363721, -0.0, -0.12412284050070398, -0.0,
+  0.29659908276249208, -0.0, 0.0025181047591668528, -0.0,
+  -0.041452884696052308, -0.0, 0.059618485320195105, -0.0,
+  0.011075592803031345, -0.0, -0.20987601083273788, -0.0,
+  -0.00091055557711604675, -0.0, 0.009658698825817956, -0.0,
+  0.024719315564628083, -0.0, -0.63356728482920988, -0.0,
+  0.14624340283237694, -0.0, 0.0023380783237737773, -0.0,
+  -0.0018240417252116644, -0.0, -0.12900250453440054, -0.0,
+  -0.33132348073092233, -0.0, 0.034057072861997655, -0.0,
+  0.068896804746332946, -0.0, -0.29169213216737988, -0.0,
+  -0.009087027395052941, -0.0, -0.36535407084217408, -0.0,
+  0.50436962896117676, -0.0, -0.012076618703426883, -0.0,
+  0.039523041075539819, -0.0, -0.34497279809263615, -0.0,
+  0.033622674824373117, -0.0, -0.012963531839189253, -0.0,
+  0.068190335941297003, -0.0, -0.0042570346269623534, -0.0,
+  -0.0059431026266206118, -0.0, 0.44189850201807329, -0.0,
+  -0.17405947369501523, -0.0, -0.0031818673329558115, -0.0,
+  -0.013241268913055845, -0.0, 0.37759434653660118, -0.0,
+  0.05793421911933383, 0.0, 0.0087814012480247391, 0.0,
+  -0.13484162503920824, 0.0, -0.11894248542946788, 0.0,
+  0.0034126758010853335, 0.0, -0.25745863231135524, 0.0,
+  0.31697441335489424, 0.0, -0.015362349472135712, 0.0,
+  0.053956407292720526, 0.0, 0.61670650365950919, 0.0,
+  -0.050080280873217795, 0.0, 0.058060300256864948, 0.0,
+  -0.05028192388962683, 0.0, -0.0089736700386580815, 0.0,
+  -0.010887807147052056, 0.0, 0.28629126170147762, 0.0,
+  -0.14626088553463767, 0.0, 0.00055946274942973522, 0.0,
+  -0.0080744631827362242, 0.0, -0.60151252226524232, 0.0,
+  0.1478314077665436, 0.0, -0.041711386594749329, 0.0,
+  -0.37814846260044588, 0.0, 0.18661256542623783, 0.0,
+  0.0080545711596202701, 0.0, -0.4693015153814929, 0.0,
+  0.086753683084559538, 0.0, 0.051009946439341154, 0.0,
+  0.14372674560292484, 0.0, -0.14526437880414192, 0.0,
+  0.067568039395946092, 0.0, 0.38933207416198728, 0.0,
+  0.0042506858503202558, 0.0, 0.0034845583891972109, 0.0,
+  0.018520120531076347, 0.0, -0.5372397635640177, 0.0,
+  0.4202176361794992, 0.0, 0.0027232929734367002, 0.0,
+  0.0040280898771056393, 0.0, 0.037552090107052946, 0.0,
+  -0.40166536905424954, -0.0, 0.22590014611967188, -0.0,
+  -0.27899533053978659, -0.0, -0.091185854762104002, -0.0,
+  0.0020527853100586395, -0.0, 0.22087774806236071, -0.0,
+  0.37141165734653614, -0.0, 0.065679857439609565, -0.0,
+  -0.0088786185797930014, -0.0, 0.007763223070745548, -0.0,
+  0.2763048865254959, -0.0, -0.49557733899955514, -0.0,
+  -0.50742712920347777, -0.0, -0.0088303686080113079, -0.0,
+  -0.0084938935791098943, -0.0, -0.011829724072353075, -0.0,
+  0.53213123406352147, -0.0, -0.0045648759579002152, -0.0,
+  0.016862130748667541, -0.0, 0.098464834669673693, -0.0,
+  0.16940054620492842, 0.0, -0.327143678059236, 0.0,
+  0.32884050756066285, 0.0, -0.067462759031523545, 0.0,
+  -0.0031138785326293786, 0.0, -0.14990635133328722, 0.0,
+  -0.25014479897455938, 0.0, -0.039590122028939502, 0.0,
+  -0.014919463873584284, 0.0, -0.011461682722418898, 0.0,
+  0.34429128699464356, 0.0, 0.65642957474024999, 0.0,
+  -0.54395081038001303, 0.0, -0.012249614729580919, 0.0,
+  -0.0034170196261991978, 0.0, 0.083329024686954134, 0.0,
+  -0.34607153583785072, 0.0, 0.0058072451993965305, 0.0,
+  -0.0027102438746848564, 0.0, 0.18404377361767144, 0.0,
+  0.66516673019204198, 0.0, 0.42146198785544858, 0.0,
+  -0.078366336510557577, 0.0, 0.24557674599669299, 0.0,
+  -0.019178378441636383, 0.0, -0.22030286202701704, 0.0,
+  -0.13226164513740415, 0.0, -0.11048169556348618, 0.0,
+  0.057122065571602543, 0.0, -0.10753055318527234, 0.0,
+  0.10089712208871807, 0.0, -0.41448265360249903, 0.0,
+  -0.099997995467455886, 0.0, -0.0011780223308312156, 0.0,
+  -0.04507182136881397, 0.0, 0.047140925896474145, 0.0,
+  -0.38002691405405675, 0.0, -0.007275120563850046, 0.0,
+  -0.017321524725923982, 0.0, 0.096109945377826259, 0.0,
+  0.62482548021435091, 0.0, -0.26518071052082914, 0.0,
+  -0.30474591191939965, 0.0, -0.34692669411511773, 0.0,
+  -0.0032557130060920517, 0.0, 0.3361926210314613, 0.0,
+  0.42007665539354472, 0.0, -0.022053108125038787, 0.0,
+  0.038515508768662082, 0.0, -0.14375694414644363, 0.0,
+  0.013273226336205833, 0.0, 0.078046310941574479, 0.0,
+  0.0089600512391039781, 0.0, -0.0096407153674270257, 0.0,
+  -0.054498073718810644, 0.0, -0.16845822078844211, 0.0,
+  -0.277796790539803, 0.0, 0.0045140694091584466, 0.0,
+  0.029640082642531908, 0.0, 0.042268876270808747, 0.0,
+  0.1739174189146408, -0.0, 0.10491321437071582, -0.0,
+  0.12368168211473771, -0.0, 0.26538144859497576, -0.0,
+  -0.040214244367316257, -0.0, 0.091990690543971826, -0.0,
+  0.22130179706978684, -0.0, 0.55733894415481322, -0.0,
+  0.011099565269397029, -0.0, -0.2626720241017399, -0.0,
+  -0.5713455800783207, -0.0, 0.1851069120489687, -0.0,
+  -0.088475554941473591, -0.0, -0.40168875952912853, -0.0,
+  0.13833955615847754, -0.0, 0.15745457486930778, -0.0,
+  0.074901990110000469, -0.0, -0.1780705393798574, -0.0,
+  -0.28167255305634409, -0.0, -0.28128853876561166, -0.0,
+  -0.075675386745271578, 0.0, -0.14460371282887202, 0.0,
+  0.08877185718242088, 0.0, -0.080607221864341411, 0.0,
+  0.0026610136129811015, 0.0, 0.074378867963966463, 0.0,
+  -0.11049277258342664, 0.0, 0.024100627461917549, 0.0,
+  0.62864065799143987, 0.0, 0.11075394405977282, 0.0,
+  -0.35028814466528885, 0.0, -0.17387306961279597, 0.0,
+  -0.047328221601013472, 0.0, 0.41147051937461548, 0.0,
+  0.0059290538377004638, 0.0, -0.023526610921869893, 0.0,
+  -0.0054171821887182611, 0.0, 0.023144879077240211, 0.0,
+  -0.54162736879698314, 0.0, 0.18358827124652546, 0.0,
+  0.26783989585485019, -0.0, -0.18762500920372105, -0.0,
+  0.09486109337368237, -0.0, -0.12683488619951769, -0.0,
+  -0.019575836264727527, -0.0, -0.028110701429892093, -0.0,
+  -0.16631102132137254, -0.0, -0.10480223077302533, -0.0,
+  0.13779267389613445, -0.0, -0.30448522241889447, -0.0,
+  0.52801405800523116, -0.0, -0.14896120867455395, -0.0,
+  0.050028830217742661, -0.0, -0.095909844747762235, -0.0,
+  -0.11625499163407021, -0.0, 0.36004105477748088, -0.0,
+  0.3692819593715837, -0.0, 0.003715859386729109, -0.0,
+  -0.028621429697426058, -0.0, -0.48408304251847012, -0.0,
+  0.27446383152032533, -0.0, 0.11197520010877023, -0.0,
+  -0.050804873631248297, -0.0, -0.038882372428369803, -0.0,
+  -0.015680723358083019, -0.0, -0.031477496118898482, -0.0,
+  0.058801047337857675, -0.0, -0.11594376477857157, -0.0,
+  -0.45506145669968451, -0.0, -0.15694616495972616, -0.0,
+  -0.13830978118621351, -0.0, 0.19373240927429633, -0.0,
+  -0.022439571060044378, -0.0, 0.63444681474378317, -0.0,
+  -0.088356514453217599, -0.0, 0.19913130908620755, -0.0,
+  0.23517016816518019, -0.0, 0.0054249098018694661, -0.0,
+  -0.43045956449344047, -0.0, -0.1687834068707916, -0.0,
+  -0.37527033071368265, -0.0, 0.00954755682331687, -0.0,
+  -0.0053702726120032533, -0.0, 0.30638735516305221, -0.0,
+  0.057171825060232426, -0.0, 0.076032831821876673, -0.0,
+  0.20136916313250855, -0.0, 0.13415535256075053, -0.0,
+  0.0054495545277333411, -0.0, -0.1490257272058868, -0.0,
+  0.60815587884017519, -0.0, 0.0055245164177447365, -0.0,
+  0.04005348595909463, -0.0, 0.10493268297952513, -0.0,
+  0.14883428067640914, -0.0, -0.26345526231214417, -0.0,
+  -0.39927391087939296, -0.0, 0.00081315339596964027, -0.0,
+  -0.17593762194579607, -0.0, -0.33009451168948289, -0.0,
+  -0.13913174105687329, -0.0, 0.58051448125523808, -0.0,
+  -0.1012610240480836, -0.0, -0.57990933547183843, -0.0,
+  0.002326716176176042, -0.0, 0.10565545051071212, -0.0,
+  -0.28125244156080459, -0.0, 0.16609481734691542, -0.0,
+  0.10370836952173432, -0.0, -0.070769781040169538, -0.0,
+  0.15089691391867951, -0.0, 0.40057929499422068, -0.0,
+  0.024777262534932398, -0.0, -0.02231843361793779, -0.0,
+  -0.0018572619393267926, -0.0, -0.066033759563014424, -0.0,
+  -0.073785553013354974, -0.0, -0.028397326361146648, -0.0,
+  -0.021484415935900985, -0.0, -0.14835223265015615, -0.0,
+  0.098732054687241097, 0.0, -0.1581775181704082, 0.0,
+  -0.11154022408876203, 0.0, -0.26276236207561388, 0.0,
+  -0.019871208752473592, 0.0, -0.11778089697788051, 0.0,
+  -0.22281806091222317, 0.0, 0.2101130833055577, 0.0,
+  -0.066751111042905903, 0.0, -0.04398937912648692, 0.0,
+  -0.038272750678612279, 0.0, -0.23230206083496349, 0.0,
+  -0.020905420191805312, 0.0, 0.089277969100239232, 0.0,
+  0.85197873131626567, 0.0, 0.047920681986025372, 0.0,
+  -0.0062239856792404812, 0.0, -0.0070547100179263545, 0.0,
+  0.050214565498858742, 0.0, -0.03978739734488642, 0.0,
+  0.098753139327216216, 0.0, -0.076263627223387448, 0.0,
+  -0.054772398306315528, 0.0, -0.10861382215470659, 0.0,
+  0.051613009820244658, 0.0, -0.013317802098088107, 0.0,
+  -0.047317581658131373, 0.0, -0.40354454836283016, 0.0,
+  -0.078408412038294323, 0.0, 0.40347895261472089, 0.0,
+  0.62459295664650294, 0.0, -0.033350879540520295, 0.0,
+  0.12228577746629489, 0.0, -0.14903107119491504, 0.0,
+  0.055711053789835256, 0.0, -0.021187452315930329, 0.0,
+  0.11542264893185449, 0.0, -0.67009912680896144, 0.0,
+  -0.3278250282062381, 0.0, 0.51187421131164801, 0.0,
+  -0.068809895598271914, -0.0, 0.067075828126172909, -0.0,
+  0.056738602800879667, -0.0, 0.14113708503312616, -0.0,
+  -0.94387015347191117, -0.0, 0.086041671054381388, -0.0,
+  0.13653324001443648, -0.0, -0.15042434584810038, -0.0,
+  0.074261577606938411, -0.0, 0.045290668255232834, -0.0,
+  0.15654510340324868, -0.0, 0.12974918247778364, -0.0,
+  0.026116040608113282, -0.0, 0.14575566283208247, -0.0,
+  0.0884356336898207, -0.0, -0.045747252303429464, -0.0,
+  0.00086365198608542902, -0.0, -0.060055910285370245, -0.0,
+  0.1252655644417785, -0.0, -0.010901954822998047, -0.0,
+  -0.10218377346756938, 0.0, 0.039005071056279088, 0.0,
+  0.088211441044882932, 0.0, 0.13996871505135083, 0.0,
+  0.13429187547710353, 0.0, 0.053194220775190475, 0.0,
+  0.084587645437919967, 0.0, -0.25038635039433044, 0.0,
+  0.18147326297413333, 0.0, -0.29692996802023747, 0.0,
+  -0.4036187938332117, 0.0, 0.066098964122751, 0.0,
+  -0.085049271028322576, 0.0, 0.50880552946537883, 0.0,
+  0.0081589553601758135, 0.0, 0.029178010945560048, 0.0,
+  -0.057610399827119657, 0.0, -0.34899018333781112, 0.0,
+  0.60961622332862508, 0.0, -0.39782117513074922, 0.0,
+  -0.0023399784419516792, 0.0, -0.16091102906479848, 0.0,
+  -0.047873538732580587, 0.0, -0.1095700493544451, 0.0,
+  -0.051882411438896242, 0.0, -0.115588110194713, 0.0,
+  -0.15251272637084867, 0.0, 0.94670661148638457, 0.0,
+  -0.055390621779560008, 0.0, 0.052922563735201968, 0.0,
+  0.11248977250005367, 0.0, -0.21112277675219829, 0.0,
+  0.011733748953791085, 0.0, 0.16584952574145079, 0.0,
+  -0.32017913575378976, 0.0, -0.040980773915916043, 0.0,
+  -0.082272436630402984, 0.0, -0.087182003283462359, 0.0,
+  0.094790225596132247, 0.0, 0.053313143700548099, 0.0
+};
@@ -6,5 +6,8 @@
 RateModel wagModel();
 
 extern const char* wagModelText;
+extern const EigenSystemHash wagModelEigenHash;
+extern const double wagModelEigen[];
+extern const size_t wagModelEigenSize;
 
 #endif /* WAG_MODEL_INCLUDED */
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include "../src/forward.h"
+#include "../src/sumprod.h"
+#include "../src/gamma.h"
+#include "../src/util.h"
+#include "../src/jsonutil.h"
+
+// Times the sum-product and Forward engines for 1, 2, 4... discretized-gamma rate categories
+int main (int argc, char **argv) {
+  if (argc != 4 && argc != 5) {
+    cout << "Usage: " << argv[0] << " <model> <alignment> <tree> [<maxCategories>]\n";
+    exit (EXIT_FAILURE);
+  }
+
+  RateModel rates;
+  ifstream in (argv[1]);
+  ParsedJson pj (in);
+  rates.read (pj.value);
+
+  vguard<FastSeq> gapped = readFastSeqs (argv[2]);
+
+  ifstream treeStream (argv[3]);
+  Tree tree (JsonUtil::readStringFromStream (treeStream));
+  tree.reorderSeqs (gapped);
+
+  const int maxCategories = argc == 5 ? atoi (argv[4]) : 8;
+
+  // Forward matrices for successive pairs of leaves
+  vguard<FastSeq> leaves;
+  for (TreeNodeIndex node = 0; node < tree.nodes(); ++node)
+    if (tree.isLeaf (node)) {
+      leaves.push_back (gapped[node]);
+      string& seq = leaves.back().seq;
+      seq.erase (remove_if (seq.begin(), seq.end(), Alignment::isGap), seq.end());
+    }
+  Assert (leaves.size() >= 2, "Need at least two leaves");
+  const double leafTime = tree.branchLength (0);
+
+  double sumProdTime1 = 0, forwardTime1 = 0;
+  cout << setw(10) << "categories" << setw(14) << "sumprod(s)" << setw(10) << "ratio" << setw(14) << "forward(s)" << setw(10) << "ratio" << endl;
+  for (int cats = 1; cats <= maxCategories; cats *= 2) {
+    const RateModel model = cats > 1 ? makeDiscretizedGammaModel (rates, cats, 1.) : rates;
+
+    auto start = chrono::steady_clock::now();
+    AlignColSumProduct sp (model, tree, gapped);
+    while (!sp.alignmentDone()) {
+      sp.fillUp();
+      sp.fillDown();
+      for (auto node : sp.ungappedRowIndices())
+	(void) sp.maxPostState (node);
+      sp.nextColumn();
+    }
+    const double sumProdTime = chrono::duration<double> (chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    ProbModel probs (model, leafTime);
+    PairHMM hmm (probs, probs, model.insProb);
+    for (size_t n = 0; n + 1 < leaves.size(); ++n) {
+      Profile xprof (model.components(), model.alphabet, leaves[n], 0);
+      Profile yprof (model.components(), model.alphabet, leaves[n+1], 1);
+      ForwardMatrix forward (xprof, yprof, hmm, 2, GuideAlignmentEnvelope());
+    }
+    const double forwardTime = chrono::duration<double> (chrono::steady_clock::now() - start).count();
+
+    if (cats == 1) {
+      sumProdTime1 = sumProdTime;
+      forwardTime1 = forwardTime;
+    }
+    cout << setw(10) << cats
+	 << setw(14) << sumProdTime << setw(10) << sumProdTime / sumProdTime1
+	 << setw(14) << forwardTime << setw(10) << forwardTime / forwardTime1
+	 << endl;
+  }
+
+  exit (EXIT_SUCCESS);
+}
@@ -24,9 +24,8 @@ int main (int argc, char **argv) {
   if (useEigen) {
     //    logger.setVerbose(8);
     EigenModel eigen (rates);
-    for (auto& sm: probs.subMat)
-      gsl_matrix_free (sm);
-    probs.subMat = eigen.getSubProbMatrix (t);
+    probs.sharedSubMat = SharedSubProbMatrices (new SubProbMatrices (eigen.getSubProbMatrix (t)));
+    probs.subMat = probs.sharedSubMat->subMat;
   }
   probs.write (cout);
   
@@ -0,0 +1,34 @@
+#include <iostream>
+#include <random>
+#include "../src/util.h"
+
+using namespace std;
+
+// checks that random_double is uniform on [0,1) for mt19937, whose result_type is wider than its output,
+// and so that random_index spreads its choices across all the weights
+int main (int argc, char **argv) {
+  if (argc != 2) {
+    cerr << "Usage: " << argv[0] << " <draws>" << endl;
+    exit (EXIT_FAILURE);
+  }
+  const size_t types = 5, draws = atoi (argv[1]);
+  mt19937 generator;
+  double minVariate = 1, maxVariate = 0;
+  for (size_t n = 0; n < draws; ++n) {
+    const double x = random_double (generator);
+    minVariate = min (minVariate, x);
+    maxVariate = max (maxVariate, x);
+  }
+  cout << "random_double " << (minVariate >= 0 && minVariate < .01 ? "ok" : "low") << ' ' << (maxVariate < 1 && maxVariate > .99 ? "ok" : "high") << endl;
+
+  const vector<double> weights (types, 1.);
+  vector<size_t> count (types, 0);
+  for (size_t n = 0; n < draws; ++n)
+    ++count[random_index (weights, generator)];
+  for (size_t t = 0; t < types; ++t) {
+    const double f = count[t] / (double) draws;
+    cout << "random_index " << t << ' ' << (f > .19 && f < .21 ? "ok" : "skewed") << endl;
+  }
+
+  exit (EXIT_SUCCESS);
+}
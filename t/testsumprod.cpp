@@ -7,8 +7,8 @@
 #include "../src/logger.h"
 
 int main (int argc, char **argv) {
-  if (argc != 4) {
-    cout << "Usage: " << argv[0] << " <model> <alignment> <tree>\n";
+  if (argc != 4 && argc != 5) {
+    cout << "Usage: " << argv[0] << " <model> <alignment> <tree> [<blockSize>]\n";
     exit (EXIT_FAILURE);
   }
   
@@ -27,6 +27,8 @@ int main (int argc, char **argv) {
   //  logger.setVerbose (8);
   
   AlignColSumProduct sp (rates, tree, gapped);
+  if (argc == 5)
+    sp.blockSize = atoi (argv[4]);
 
   while (!sp.alignmentDone()) {
     sp.fillUp();
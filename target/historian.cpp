@@ -18,7 +18,7 @@ struct ProgUsage : OptParser {
 };
 
 ProgUsage::ProgUsage (int argc, char** argv)
-  : OptParser (argc, argv, HISTORIAN_PROGNAME, "{recon,count,fit,mcmc,generate,help,version} [options]")
+  : OptParser (argc, argv, HISTORIAN_PROGNAME, "{recon,count,fit,mcmc,generate,expand,help,version} [options]")
 {
   text = briefText
     + "\n"
@@ -39,6 +39,10 @@ ProgUsage::ProgUsage (int argc, char** argv)
     + "  " + prog + " fit seqs.fa >newmodel.json\n"
     + "  " + prog + " fit -counts counts.json >newmodel.json\n"
     + "\n"
+    + "MCMC:\n"
+    + "  " + prog + " mcmc seqs.fa -trace trace.stk -tracedelta >best.stk\n"
+    + "  " + prog + " expand trace.stk.1 >trace.expanded.stk\n"
+    + "\n"
     + "Simulation:\n"
     + "  " + prog + " generate [-model model.json] [-rootlen N] tree.nh >sim.stk\n"
     + "\n"
@@ -74,6 +78,7 @@ ProgUsage::ProgUsage (int argc, char** argv)
     + "  -shape <S>      Specify shape parameter for gamma distribution\n"
     + "\n"
     + "  -savemodel <f>  Save model to file, prior to any model-fitting\n"
+    + "  -eigencache <d> Cache rate matrix eigensystems in directory <d>\n"
     + "\n"
     + "Reconstruction file I/O options\n"
     + "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n"
@@ -121,6 +126,7 @@ ProgUsage::ProgUsage (int argc, char** argv)
     + "\n"
     + "  -ancseq         Predict ancestral sequences (default is to leave them as " + Alignment::wildcardChar + "'s)\n"
     + "  -ancprob        Report posterior probabilities for ancestral residues\n"
+    + "  -ancthreads <N> Use N threads for ancestral prediction (default " + to_string(DefaultAncestralThreads) + ")\n"
     + "\n"
     + "For additional accuracy in historical reconstruction, the alignment can be\n"
     + "iteratively refined, or MCMC-sampled. By default, refinement and MCMC are\n"
@@ -128,10 +134,23 @@ ProgUsage::ProgUsage (int argc, char** argv)
     + "\n"
     + "  -norefine, -refine"
     + "                  Disable/enable iterative refinement after initial reconstruction\n"
+    + "  -refinethreads <N>\n"
+    + "                  Refine N non-adjacent branches at a time in parallel threads (default " + to_string(DefaultRefinerThreads) + ")\n"
     + "\n"
     + "  -mcmc           Run MCMC sampler after reconstruction\n"
     + "  -samples <N>    Number of MCMC iterations per sequence (default " + to_string(DefaultMCMCSamplesPerSeq) + ")\n"
+    + "  -adapt <N>      Tune move rates for efficiency over first N iterations per sequence (default " + to_string(DefaultMCMCAdaptSamplesPerSeq) + ")\n"
+    + "  -tries <N>      Multiple-try Metropolis: make N proposals per alignment or regraft move, in parallel threads (default " + to_string(DefaultMCMCTries) + ")\n"
+    + "  -ess <N>        Stop MCMC early once log-likelihood effective sample size reaches N\n"
+    + "  -rhat <R>       Stop MCMC early once split-R-hat of log-likelihood across chains is below R\n"
+    + "  -plateau <N>    Stop MCMC early once best history is unchanged for N iterations per sequence\n"
     + "  -trace <file>   Specify MCMC trace filename\n"
+    + "  -thin <N>       Write every Nth MCMC iteration to the trace (default " + to_string(DefaultMCMCTraceThinning) + ")\n"
+    + "  -tracedelta     Write only changed rows of each trace alignment (restore with 'expand')\n"
+    + "  -tracequeue <N> Queue up to N trace records for a background writer thread (default " + to_string(DefaultMCMCTraceQueueSize) + "; 0 to write synchronously)\n"
+    + "  -chains <N>     Run N MCMC chains in parallel threads (default " + to_string(DefaultMCMCChains) + ")\n"
+    + "  -heat <dT>      Temperature increment between successive chains (default " + to_string(DefaultMCMCHeatStep) + ")\n"
+    + "  -swapevery <N>  Number of samples between chain swap proposals (default " + to_string(DefaultMCMCSwapInterval) + ")\n"
     + "  -fixtree        Fix tree during MCMC (sample alignment only)\n"
     + "  -fixalign       Fix alignment during MCMC (sample tree only)\n"
     //    + "  -fixguide       Fix guide alignment during MCMC\n"
@@ -167,6 +186,8 @@ ProgUsage::ProgUsage (int argc, char** argv)
     + "  -upgma          Use UPGMA to estimate tree (default for MCMC)\n"
     + "  -nj             Use neighbor-joining, not UPGMA, to estimate tree\n"
     + "  -jc             Use Jukes-Cantor-like estimates for distance matrix\n"
+    + "  -dedup          Collapse identical sequences before guide alignment & tree\n"
+    + "                   estimation, then restore them as minimal-length branches\n"
     + "\n"
     + "Some common settings (the default is somewhere in between these extremes):\n"
     + "\n"
@@ -381,6 +402,18 @@ int main (int argc, char** argv) {
     recon.fit();
     recon.writeModel (cout);
     
+  } else if (command == "expand" || command == "e") {
+
+    usage.implicitSwitches.push_back (string ("-trace"));
+    usage.unlimitImplicitSwitches = true;
+
+    while (logger.parseLogArgs (argvec)
+	   || recon.parseExpandArgs (argvec)
+	   || usage.parseUnknown())
+      { }
+
+    recon.expandTraces (cout);
+
   } else if (!usage.parseUnknownCommand (command, HISTORIAN_VERSION, false)) {
 
     // default: reconstruct